@@ -253,9 +253,19 @@ else()
 	set(REFLECT_MEMORY_TRACKER_VALUE 0)
 endif()
 
+# Map the log level to the value of log_level_id
+set(LOG_LEVEL_NAMES DEBUG INFO WARNING ERROR CRITICAL)
+string(TOUPPER "${OPTION_BUILD_LOG_LEVEL}" LOG_LEVEL_MINIMUM_NAME)
+list(FIND LOG_LEVEL_NAMES "${LOG_LEVEL_MINIMUM_NAME}" LOG_LEVEL_MINIMUM_VALUE)
+
+if(LOG_LEVEL_MINIMUM_VALUE EQUAL -1)
+	message(FATAL_ERROR "Invalid OPTION_BUILD_LOG_LEVEL '${OPTION_BUILD_LOG_LEVEL}', use one of DEBUG, INFO, WARNING, ERROR or CRITICAL")
+endif()
+
 set(DEFAULT_COMPILE_DEFINITIONS
 	LOG_POLICY_FORMAT_PRETTY=${LOG_POLICY_FORMAT_PRETTY_VALUE}
 	REFLECT_MEMORY_TRACKER=${REFLECT_MEMORY_TRACKER_VALUE}
+	LOG_LEVEL_MINIMUM=${LOG_LEVEL_MINIMUM_VALUE}
 	SYSTEM_${SYSTEM_NAME_UPPER}
 	${MEMORYCHECK_COMPILE_DEFINITIONS}
 	${SANITIZER_COMPILE_DEFINITIONS}
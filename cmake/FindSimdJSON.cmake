@@ -0,0 +1,48 @@
+#
+#	CMake Find SimdJSON by Parra Studios
+#	CMake script to find simdjson library.
+#
+#	Copyright (C) 2016 - 2026 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+#
+#	Licensed under the Apache License, Version 2.0 (the "License");
+#	you may not use this file except in compliance with the License.
+#	You may obtain a copy of the License at
+#
+#		http://www.apache.org/licenses/LICENSE-2.0
+#
+#	Unless required by applicable law or agreed to in writing, software
+#	distributed under the License is distributed on an "AS IS" BASIS,
+#	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#	See the License for the specific language governing permissions and
+#	limitations under the License.
+#
+
+# The following variables are set:
+#
+# SIMDJSON_INCLUDE_DIRS - A list of directories where the simdjson headers are located.
+# SIMDJSON_LIBRARIES - The simdjson library to link against.
+# SIMDJSON_SOURCES - Amalgamated simdjson sources to be compiled with the target (only when it is bundled).
+
+# Prevent vervosity if already included
+if(SIMDJSON_FOUND)
+	set(SIMDJSON_FIND_QUIETLY TRUE)
+endif()
+
+find_path(SIMDJSON_INCLUDE_DIRS NAMES simdjson.h)
+find_library(SIMDJSON_LIBRARIES NAMES simdjson)
+
+include(FindPackageHandleStandardArgs)
+
+find_package_handle_standard_args(SimdJSON
+	REQUIRED_VARS SIMDJSON_INCLUDE_DIRS SIMDJSON_LIBRARIES
+)
+
+mark_as_advanced(SIMDJSON_INCLUDE_DIRS SIMDJSON_LIBRARIES)
+
+if(SIMDJSON_FOUND)
+	if(NOT SIMDJSON_FIND_QUIETLY)
+		message(STATUS "Found simdjson:\n\tLibrary: ${SIMDJSON_LIBRARIES}\n\tIncludes: ${SIMDJSON_INCLUDE_DIRS}")
+	endif()
+elseif(SIMDJSON_FIND_REQUIRED)
+	message(FATAL_ERROR "Could not find simdjson")
+endif()
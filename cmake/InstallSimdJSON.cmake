@@ -0,0 +1,57 @@
+#
+#	CMake Install SimdJSON by Parra Studios
+#	CMake script to install simdjson library.
+#
+#	Copyright (C) 2016 - 2026 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+#
+#	Licensed under the Apache License, Version 2.0 (the "License");
+#	you may not use this file except in compliance with the License.
+#	You may obtain a copy of the License at
+#
+#		http://www.apache.org/licenses/LICENSE-2.0
+#
+#	Unless required by applicable law or agreed to in writing, software
+#	distributed under the License is distributed on an "AS IS" BASIS,
+#	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#	See the License for the specific language governing permissions and
+#	limitations under the License.
+#
+
+# The following variables are set:
+#
+# SIMDJSON_INCLUDE_DIRS - A list of directories where the simdjson headers are located.
+# SIMDJSON_SOURCES - Amalgamated simdjson sources to be compiled with the target.
+
+if(NOT SIMDJSON_FOUND OR USE_BUNDLED_SIMDJSON)
+	if(NOT SIMDJSON_VERSION OR USE_BUNDLED_SIMDJSON)
+		set(SIMDJSON_VERSION 3.10.1)
+	endif()
+
+	include(ExternalProject)
+
+	# The amalgamated single header version is used, so there is nothing to build
+	ExternalProject_Add(simd-json-depends
+		GIT_REPOSITORY		"https://github.com/simdjson/simdjson.git"
+		GIT_TAG				"v${SIMDJSON_VERSION}"
+		GIT_SHALLOW			TRUE
+		BUILD_COMMAND		""
+		CONFIGURE_COMMAND	""
+		INSTALL_COMMAND		""
+		TEST_COMMAND		""
+	)
+
+	ExternalProject_Get_Property(simd-json-depends SOURCE_DIR)
+
+	set(SIMDJSON_ROOT_DIR		${SOURCE_DIR})
+	set(SIMDJSON_INCLUDE_DIRS	${SIMDJSON_ROOT_DIR}/singleheader)
+	set(SIMDJSON_SOURCES		${SIMDJSON_ROOT_DIR}/singleheader/simdjson.cpp)
+	set(SIMDJSON_LIBRARIES "")
+	set(SIMDJSON_FOUND			TRUE)
+
+	# The source is downloaded at build time
+	set_source_files_properties(${SIMDJSON_SOURCES} PROPERTIES GENERATED TRUE)
+
+	mark_as_advanced(SIMDJSON_INCLUDE_DIRS SIMDJSON_SOURCES)
+
+	message(STATUS "Installing simdjson v${SIMDJSON_VERSION}")
+endif()
@@ -30,6 +30,7 @@ extern "C" {
 /* -- Headers -- */
 
 #include <stdint.h>
+#include <stdlib.h>
 
 /* -- Type Definitions -- */
 
@@ -41,6 +42,10 @@ typedef hash (*hash_callback)(const hash_key);
 
 /* -- Methods -- */
 
+ADT_API hash hash_buffer(const void *data, size_t length);
+
+ADT_API hash hash_buffer_stable(const void *data, size_t length);
+
 ADT_API hash hash_callback_str(const hash_key key);
 
 ADT_API hash hash_callback_ptr(const hash_key key);
@@ -0,0 +1,110 @@
+/*
+ *	Abstract Data Type Library by Parra Studios
+ *	A abstract data type library providing generic containers.
+ *
+ *	Copyright (C) 2016 - 2026 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+#ifndef ADT_INTERN_H
+#define ADT_INTERN_H 1
+
+/* -- Headers -- */
+
+#include <adt/adt_api.h>
+
+#include <adt/adt_hash.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* -- Headers -- */
+
+#include <stdlib.h>
+
+/* -- Methods -- */
+
+/**
+*  @brief
+*    Obtain the unique copy of a string from the global intern table, inserting it if
+*    it does not exist yet, interned strings are immutable and live until the end of
+*    the process, so two interned strings are equal if and only if their pointers are equal
+*
+*  @param[in] str
+*    Null terminated string to be interned
+*
+*  @return
+*    Pointer to the interned string or NULL on allocation failure
+*/
+ADT_API const char *intern_string(const char *str);
+
+/**
+*  @brief
+*    Look up a string in the global intern table without inserting it, it is lock free
+*    and it does not allocate, so it is safe to use with untrusted strings
+*
+*  @param[in] str
+*    Null terminated string to be found
+*
+*  @return
+*    Pointer to the interned string or NULL if it has not been interned
+*/
+ADT_API const char *intern_find(const char *str);
+
+/**
+*  @brief
+*    Obtain the precomputed hash of an interned string
+*
+*  @param[in] str
+*    Pointer returned by intern_string or intern_find
+*
+*  @return
+*    The hash of the string, equal to hash_callback_str of the same contents
+*/
+ADT_API hash intern_hash(const char *str);
+
+/**
+*  @brief
+*    Obtain the precomputed length of an interned string
+*
+*  @param[in] str
+*    Pointer returned by intern_string or intern_find
+*
+*  @return
+*    The length of the string without null terminator
+*/
+ADT_API size_t intern_length(const char *str);
+
+/**
+*  @brief
+*    Hash callback for tables whose keys are all interned strings, it must be used
+*    with comparable_callback_ptr as the comparison callback
+*/
+ADT_API hash hash_callback_intern(const hash_key key);
+
+/**
+*  @brief
+*    Release the global intern table and all the interned strings, none of the
+*    pointers returned before can be used after this, the table is created again
+*    on the next insertion
+*/
+ADT_API void intern_destroy(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ADT_INTERN_H */
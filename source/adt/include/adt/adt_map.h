@@ -56,8 +56,7 @@ typedef struct map_iterator_type *map_iterator;
 struct map_iterator_type
 {
 	map m;
-	size_t current_bucket;
-	size_t current_pair;
+	size_t current;
 };
 
 /* -- Methods -- */
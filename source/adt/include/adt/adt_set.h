@@ -55,8 +55,7 @@ typedef struct set_iterator_type *set_iterator;
 struct set_iterator_type
 {
 	set s;
-	size_t current_bucket;
-	size_t current_pair;
+	size_t current;
 };
 
 /* -- Methods -- */
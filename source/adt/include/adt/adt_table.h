@@ -0,0 +1,95 @@
+/*
+ *	Abstract Data Type Library by Parra Studios
+ *	Copyright (C) 2016 - 2026 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	A abstract data type library providing generic containers.
+ *
+ */
+
+#ifndef ADT_TABLE_H
+#define ADT_TABLE_H 1
+
+/* -- Headers -- */
+
+#include <adt/adt_api.h>
+
+#include <adt/adt_comparable.h>
+#include <adt/adt_hash.h>
+#include <adt/adt_vector.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* -- Headers -- */
+
+#include <stdint.h>
+#include <stdlib.h>
+
+/* -- Definitions -- */
+
+#define TABLE_INDEX_INVALID ((size_t)-1)
+
+/* -- Forward Declarations -- */
+
+struct table_slot_type;
+struct table_type;
+
+/* -- Type Definitions -- */
+
+typedef struct table_slot_type *table_slot;
+typedef struct table_type *table;
+
+/* -- Member Data -- */
+
+struct table_slot_type
+{
+	void *key;
+	void *value;
+};
+
+/*
+*  Open addressing hash table (Swiss table layout), each slot has an associated
+*  control byte which is either empty, deleted or full, and when it is full, it
+*  stores the lower 7 bits of the hash, so a group of control bytes can be
+*  compared at once against the hash with SIMD instructions (SSE2 or NEON) or
+*  with a portable 64-bit word fallback before comparing the keys themselves
+*/
+struct table_type
+{
+	size_t count;					/* Amount of full slots */
+	size_t capacity;				/* Amount of slots, it is always zero or power of two */
+	size_t growth;					/* Amount of empty slots that can be filled before rehashing */
+	uint8_t *ctrl;					/* Control bytes, it has capacity plus group width bytes, the last ones mirror the first group */
+	table_slot slots;				/* Array of key value pairs, allocated in the same block as control bytes */
+	hash_callback hash_cb;			/* Callback for hashing the keys */
+	comparable_callback compare_cb; /* Callback for comparing the keys */
+};
+
+/* -- Methods -- */
+
+ADT_API int table_initialize(table t, hash_callback hash_cb, comparable_callback compare_cb);
+
+ADT_API size_t table_size(table t);
+
+ADT_API table_slot table_find(table t, void *key);
+
+ADT_API vector table_find_all(table t, void *key);
+
+ADT_API int table_insert(table t, void *key, void *value);
+
+ADT_API int table_insert_unique(table t, void *key, void *value);
+
+ADT_API int table_remove(table t, void *key, void **value);
+
+ADT_API size_t table_next(table t, size_t index);
+
+ADT_API table_slot table_at(table t, size_t index);
+
+ADT_API void table_clear(table t);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ADT_TABLE_H */
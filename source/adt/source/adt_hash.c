@@ -18,23 +18,193 @@
  *
  */
 
+/* -- Headers -- */
+
 #include <adt/adt_hash.h>
 
+#include <threading/threading_atomic.h>
+
 #include <string.h>
+#include <time.h>
 
-hash hash_callback_str(const hash_key key)
+#if defined(_MSC_VER) && defined(_M_X64)
+	#include <intrin.h>
+#endif
+
+/* -- Definitions -- */
+
+/* Secrets from wyhash (public domain), the string hash is a wyhash variant */
+#define HASH_SECRET_0 UINT64_C(0xA0761D6478BD642F)
+#define HASH_SECRET_1 UINT64_C(0xE7037ED1A0B428DB)
+#define HASH_SECRET_2 UINT64_C(0x8EBC6AF09C88C6DB)
+#define HASH_SECRET_3 UINT64_C(0x589965CC75374CC3)
+
+/* -- Private Data -- */
+
+static atomic_uintptr_t hash_seed_value = 0;
+
+/* -- Private Methods -- */
+
+static uint64_t hash_seed(void);
+
+static uint64_t hash_mix(uint64_t a, uint64_t b);
+
+static uint64_t hash_read8(const uint8_t *p);
+
+static uint64_t hash_read4(const uint8_t *p);
+
+static hash hash_buffer_seed(const void *data, size_t length, uint64_t seed);
+
+/* -- Methods -- */
+
+uint64_t hash_mix(uint64_t a, uint64_t b)
 {
-	/* djb2 */
-	const char *str = (const char *)key;
+	/* Multiply a and b into a 128-bit result and fold the upper and lower halves */
+#if defined(__SIZEOF_INT128__)
+	__uint128_t r = (__uint128_t)a * b;
 
-	hash h = 0x1505;
+	return (uint64_t)r ^ (uint64_t)(r >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+	uint64_t high, low = _umul128(a, b, &high);
 
-	while (*str++ != '\0')
+	return low ^ high;
+#else
+	uint64_t ha = a >> 32, hb = b >> 32, la = (uint32_t)a, lb = (uint32_t)b;
+	uint64_t rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+	uint64_t t = rl + (rm0 << 32), c = t < rl;
+	uint64_t low = t + (rm1 << 32);
+
+	c += low < t;
+
+	return low ^ (rh + (rm0 >> 32) + (rm1 >> 32) + c);
+#endif
+}
+
+uint64_t hash_read8(const uint8_t *p)
+{
+	uint64_t v;
+
+	memcpy(&v, p, sizeof(uint64_t));
+
+	return v;
+}
+
+uint64_t hash_read4(const uint8_t *p)
+{
+	uint32_t v;
+
+	memcpy(&v, p, sizeof(uint32_t));
+
+	return v;
+}
+
+uint64_t hash_seed(void)
+{
+	uintptr_t seed = atomic_load_explicit(&hash_seed_value, memory_order_relaxed);
+
+	if (seed == 0)
 	{
-		h = (hash)(((h << 5) + h) + *str);
+		/* The seed is randomized once per process so the hash of untrusted strings
+		(for example, function names received through RPC) cannot be predicted, the
+		addresses add the entropy of ASLR and the first thread that hashes wins */
+		uintptr_t expected = 0;
+		uint64_t entropy = hash_mix((uint64_t)time(NULL) ^ HASH_SECRET_0, (uint64_t)clock() ^ HASH_SECRET_1);
+
+		entropy = hash_mix(entropy ^ (uint64_t)(uintptr_t)&expected, (uint64_t)(uintptr_t)&hash_seed_value ^ HASH_SECRET_2);
+
+		seed = (uintptr_t)entropy;
+
+		if (seed == 0)
+		{
+			seed = (uintptr_t)HASH_SECRET_3;
+		}
+
+		if (atomic_compare_exchange_strong_explicit(&hash_seed_value, &expected, seed, memory_order_relaxed, memory_order_relaxed) == 0)
+		{
+			seed = expected;
+		}
 	}
 
-	return h;
+	return (uint64_t)seed;
+}
+
+hash hash_buffer_seed(const void *data, size_t length, uint64_t seed)
+{
+	const uint8_t *p = (const uint8_t *)data;
+	uint64_t a, b;
+
+	seed ^= hash_mix(seed ^ HASH_SECRET_0, HASH_SECRET_1);
+
+	if (length <= 16)
+	{
+		if (length >= 4)
+		{
+			/* Two overlapping reads cover from 4 up to 16 bytes */
+			const size_t offset = (length >> 3) << 2;
+
+			a = (hash_read4(p) << 32) | hash_read4(p + offset);
+			b = (hash_read4(p + length - 4) << 32) | hash_read4(p + length - 4 - offset);
+		}
+		else if (length > 0)
+		{
+			a = ((uint64_t)p[0] << 16) | ((uint64_t)p[length >> 1] << 8) | p[length - 1];
+			b = 0;
+		}
+		else
+		{
+			a = b = 0;
+		}
+	}
+	else
+	{
+		size_t i = length;
+
+		if (i > 48)
+		{
+			uint64_t seed1 = seed, seed2 = seed;
+
+			do
+			{
+				seed = hash_mix(hash_read8(p) ^ HASH_SECRET_1, hash_read8(p + 8) ^ seed);
+				seed1 = hash_mix(hash_read8(p + 16) ^ HASH_SECRET_2, hash_read8(p + 24) ^ seed1);
+				seed2 = hash_mix(hash_read8(p + 32) ^ HASH_SECRET_3, hash_read8(p + 40) ^ seed2);
+				p += 48;
+				i -= 48;
+			} while (i > 48);
+
+			seed ^= seed1 ^ seed2;
+		}
+
+		while (i > 16)
+		{
+			seed = hash_mix(hash_read8(p) ^ HASH_SECRET_1, hash_read8(p + 8) ^ seed);
+			p += 16;
+			i -= 16;
+		}
+
+		a = hash_read8(p + i - 16);
+		b = hash_read8(p + i - 8);
+	}
+
+	return (hash)hash_mix(HASH_SECRET_1 ^ length, hash_mix(a ^ HASH_SECRET_1, b ^ seed));
+}
+
+hash hash_buffer(const void *data, size_t length)
+{
+	return hash_buffer_seed(data, length, hash_seed());
+}
+
+hash hash_buffer_stable(const void *data, size_t length)
+{
+	/* Same value in every process, only for identifiers that must be reproducible, never for tables of untrusted keys */
+	return hash_buffer_seed(data, length, 0);
+}
+
+hash hash_callback_str(const hash_key key)
+{
+	const char *str = (const char *)key;
+
+	return hash_buffer(str, strlen(str));
 }
 
 hash hash_callback_ptr(const hash_key key)
@@ -0,0 +1,325 @@
+/*
+ *	Abstract Data Type Library by Parra Studios
+ *	A abstract data type library providing generic containers.
+ *
+ *	Copyright (C) 2016 - 2026 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+/* -- Headers -- */
+
+#include <adt/adt_intern.h>
+
+#include <threading/threading_atomic.h>
+#include <threading/threading_yield.h>
+
+#include <log/log.h>
+
+#include <string.h>
+
+/* -- Definitions -- */
+
+#define INTERN_TABLE_CAPACITY_MIN ((size_t)256)
+#define INTERN_TABLE_LOCK_SPINS	  ((unsigned int)64)
+
+/* -- Forward Declarations -- */
+
+struct intern_entry_type;
+struct intern_table_type;
+
+/* -- Type Definitions -- */
+
+typedef struct intern_entry_type *intern_entry;
+typedef struct intern_table_type *intern_table;
+
+/* -- Member Data -- */
+
+/* The string characters are stored right after the entry */
+struct intern_entry_type
+{
+	hash h;
+	size_t length;
+};
+
+/*
+*  Open addressing table with linear probing, slots are only written while holding the
+*  lock and they are never removed, when the table grows, the new table is published
+*  atomically and the old one is kept alive (linked through retired) so readers can
+*  keep probing it without locking
+*/
+struct intern_table_type
+{
+	size_t capacity;
+	size_t count;
+	intern_table retired;
+	atomic_uintptr_t *slots;
+};
+
+/* -- Private Data -- */
+
+static atomic_uintptr_t intern_table_current = 0;
+
+static atomic_flag intern_table_lock = ATOMIC_FLAG_INIT;
+
+/* -- Private Methods -- */
+
+static const char *intern_entry_str(intern_entry entry);
+
+static intern_entry intern_entry_from_str(const char *str);
+
+static intern_entry intern_table_lookup(intern_table t, const char *str, size_t length, hash h);
+
+static void intern_table_slot_store(intern_table t, intern_entry entry);
+
+static intern_table intern_table_create(size_t capacity, intern_table retired);
+
+static void intern_table_lock_acquire(void);
+
+/* -- Methods -- */
+
+const char *intern_entry_str(intern_entry entry)
+{
+	return (const char *)(entry + 1);
+}
+
+intern_entry intern_entry_from_str(const char *str)
+{
+	return ((intern_entry)str) - 1;
+}
+
+intern_entry intern_table_lookup(intern_table t, const char *str, size_t length, hash h)
+{
+	const size_t mask = t->capacity - 1;
+	size_t index = (size_t)h & mask;
+
+	for (;;)
+	{
+		intern_entry entry = (intern_entry)atomic_load_explicit(&t->slots[index], memory_order_acquire);
+
+		if (entry == NULL)
+		{
+			return NULL;
+		}
+
+		if (entry->h == h && entry->length == length && memcmp(intern_entry_str(entry), str, length) == 0)
+		{
+			return entry;
+		}
+
+		index = (index + 1) & mask;
+	}
+}
+
+void intern_table_slot_store(intern_table t, intern_entry entry)
+{
+	const size_t mask = t->capacity - 1;
+	size_t index = (size_t)entry->h & mask;
+
+	while (atomic_load_explicit(&t->slots[index], memory_order_relaxed) != 0)
+	{
+		index = (index + 1) & mask;
+	}
+
+	atomic_store_explicit(&t->slots[index], (uintptr_t)entry, memory_order_release);
+
+	++t->count;
+}
+
+intern_table intern_table_create(size_t capacity, intern_table retired)
+{
+	intern_table t = malloc(sizeof(struct intern_table_type) + sizeof(atomic_uintptr_t) * capacity);
+	size_t iterator;
+
+	if (t == NULL)
+	{
+		return NULL;
+	}
+
+	t->capacity = capacity;
+	t->count = 0;
+	t->retired = retired;
+	t->slots = (atomic_uintptr_t *)(t + 1);
+
+	for (iterator = 0; iterator < capacity; ++iterator)
+	{
+		atomic_init(&t->slots[iterator], 0);
+	}
+
+	if (retired != NULL)
+	{
+		for (iterator = 0; iterator < retired->capacity; ++iterator)
+		{
+			intern_entry entry = (intern_entry)atomic_load_explicit(&retired->slots[iterator], memory_order_relaxed);
+
+			if (entry != NULL)
+			{
+				intern_table_slot_store(t, entry);
+			}
+		}
+	}
+
+	return t;
+}
+
+void intern_table_lock_acquire(void)
+{
+	unsigned int spins = 0;
+
+	while (atomic_flag_test_and_set_explicit(&intern_table_lock, memory_order_acquire))
+	{
+		/* The lock is held only while inserting, so spin for a while before letting the holder run */
+		if (spins < INTERN_TABLE_LOCK_SPINS)
+		{
+			++spins;
+		}
+		else
+		{
+			threading_yield();
+		}
+	}
+}
+
+const char *intern_string(const char *str)
+{
+	intern_table t;
+	intern_entry entry;
+	size_t length;
+	hash h;
+
+	if (str == NULL)
+	{
+		return NULL;
+	}
+
+	length = strlen(str);
+	h = hash_buffer(str, length);
+
+	t = (intern_table)atomic_load_explicit(&intern_table_current, memory_order_acquire);
+
+	if (t != NULL && (entry = intern_table_lookup(t, str, length, h)) != NULL)
+	{
+		return intern_entry_str(entry);
+	}
+
+	intern_table_lock_acquire();
+
+	/* Look up again, another thread may have inserted it meanwhile */
+	t = (intern_table)atomic_load_explicit(&intern_table_current, memory_order_relaxed);
+
+	if (t != NULL && (entry = intern_table_lookup(t, str, length, h)) != NULL)
+	{
+		goto unlock;
+	}
+
+	/* Keep the load factor under 1/2, readers of the old table still see a consistent state */
+	if (t == NULL || (t->count + 1) * 2 > t->capacity)
+	{
+		intern_table grown = intern_table_create(t == NULL ? INTERN_TABLE_CAPACITY_MIN : t->capacity * 2, t);
+
+		if (grown == NULL)
+		{
+			log_write("metacall", LOG_LEVEL_ERROR, "Intern table bad allocation");
+			entry = NULL;
+			goto unlock;
+		}
+
+		atomic_store_explicit(&intern_table_current, (uintptr_t)grown, memory_order_release);
+
+		t = grown;
+	}
+
+	entry = malloc(sizeof(struct intern_entry_type) + length + 1);
+
+	if (entry == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Intern string bad allocation");
+		goto unlock;
+	}
+
+	entry->h = h;
+	entry->length = length;
+	memcpy((char *)(entry + 1), str, length + 1);
+
+	intern_table_slot_store(t, entry);
+
+unlock:
+	atomic_flag_clear_explicit(&intern_table_lock, memory_order_release);
+
+	return entry == NULL ? NULL : intern_entry_str(entry);
+}
+
+const char *intern_find(const char *str)
+{
+	intern_table t = (intern_table)atomic_load_explicit(&intern_table_current, memory_order_acquire);
+	intern_entry entry;
+	size_t length;
+
+	if (t == NULL || str == NULL)
+	{
+		return NULL;
+	}
+
+	length = strlen(str);
+	entry = intern_table_lookup(t, str, length, hash_buffer(str, length));
+
+	return entry == NULL ? NULL : intern_entry_str(entry);
+}
+
+hash intern_hash(const char *str)
+{
+	return intern_entry_from_str(str)->h;
+}
+
+size_t intern_length(const char *str)
+{
+	return intern_entry_from_str(str)->length;
+}
+
+hash hash_callback_intern(const hash_key key)
+{
+	return intern_entry_from_str((const char *)key)->h;
+}
+
+void intern_destroy(void)
+{
+	intern_table t;
+	size_t iterator;
+
+	intern_table_lock_acquire();
+
+	t = (intern_table)atomic_load_explicit(&intern_table_current, memory_order_relaxed);
+
+	atomic_store_explicit(&intern_table_current, (uintptr_t)0, memory_order_release);
+
+	/* Every entry is in the current table, the retired ones only hold copies of the slots */
+	if (t != NULL)
+	{
+		for (iterator = 0; iterator < t->capacity; ++iterator)
+		{
+			free((intern_entry)atomic_load_explicit(&t->slots[iterator], memory_order_relaxed));
+		}
+	}
+
+	while (t != NULL)
+	{
+		intern_table retired = t->retired;
+
+		free(t);
+
+		t = retired;
+	}
+
+	atomic_flag_clear_explicit(&intern_table_lock, memory_order_release);
+}
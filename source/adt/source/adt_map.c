@@ -20,26 +20,16 @@
 
 /* -- Headers -- */
 
-#include <adt/adt_bucket.h>
 #include <adt/adt_map.h>
+#include <adt/adt_table.h>
 
 #include <log/log.h>
 
-/* -- Definitions -- */
-
-#define MAP_BUCKET_RATIO_MIN 0.1f
-#define MAP_BUCKET_RATIO_MAX 0.77f
-
 /* -- Member Data -- */
 
 struct map_type
 {
-	size_t count;
-	size_t capacity;
-	size_t prime;
-	bucket buckets;
-	map_cb_hash hash_cb;
-	map_cb_compare compare_cb;
+	struct table_type t;
 };
 
 /* -- Methods -- */
@@ -62,16 +52,9 @@ map map_create(map_cb_hash hash_cb, map_cb_compare compare_cb)
 		return NULL;
 	}
 
-	m->hash_cb = hash_cb;
-	m->compare_cb = compare_cb;
-	m->count = 0;
-	m->prime = 0;
-	m->capacity = bucket_capacity(m->prime);
-	m->buckets = bucket_create(m->capacity);
-
-	if (m->buckets == NULL)
+	if (table_initialize(&m->t, hash_cb, compare_cb) != 0)
 	{
-		log_write("metacall", LOG_LEVEL_ERROR, "Bad map bucket creation");
+		log_write("metacall", LOG_LEVEL_ERROR, "Bad map table initialization");
 		free(m);
 		return NULL;
 	}
@@ -83,130 +66,28 @@ size_t map_size(map m)
 {
 	if (m != NULL)
 	{
-		return m->count;
-	}
-
-	return 0;
-}
-
-static int map_bucket_rehash(map m, map new_map)
-{
-	size_t bucket_iterator, pair_iterator;
-
-	for (bucket_iterator = 0; bucket_iterator < m->capacity; ++bucket_iterator)
-	{
-		bucket b = &m->buckets[bucket_iterator];
-
-		if (b->pairs != NULL && b->count > 0)
-		{
-			for (pair_iterator = 0; pair_iterator < b->count; ++pair_iterator)
-			{
-				pair p = &b->pairs[pair_iterator];
-
-				map_hash h = new_map->hash_cb(p->key);
-
-				size_t index = h % new_map->capacity;
-
-				bucket new_bucket = &new_map->buckets[index];
-
-				if (bucket_insert(new_bucket, p->key, p->value) != 0)
-				{
-					log_write("metacall", LOG_LEVEL_ERROR, "Invalid map bucket realloc insertion");
-					return 1;
-				}
-
-				++new_map->count;
-			}
-		}
+		return table_size(&m->t);
 	}
 
 	return 0;
 }
 
-static int map_bucket_realloc(map m)
-{
-	struct map_type new_map;
-	size_t prime = m->prime;
-	float ratio = (float)((float)m->count / (float)m->capacity);
-
-	if (prime > 0 && ratio <= MAP_BUCKET_RATIO_MIN)
-	{
-		--prime;
-	}
-	else if (ratio >= MAP_BUCKET_RATIO_MAX)
-	{
-		++prime;
-	}
-	else
-	{
-		return 0;
-	}
-
-	new_map.hash_cb = m->hash_cb;
-	new_map.compare_cb = m->compare_cb;
-	new_map.count = 0;
-	new_map.prime = prime;
-	new_map.capacity = bucket_capacity(prime);
-	new_map.buckets = bucket_create(new_map.capacity);
-
-	if (new_map.buckets != NULL)
-	{
-		size_t iterator;
-
-		/* Rehash all the elements into the new map */
-		map_bucket_rehash(m, &new_map);
-
-		/* Destroy all pairs from old map */
-		for (iterator = 0; iterator < m->capacity; ++iterator)
-		{
-			bucket b = &m->buckets[iterator];
-
-			if (b->pairs != NULL)
-			{
-				free(b->pairs);
-			}
-		}
-
-		/* Destroy all buckets from old map */
-		free(m->buckets);
-
-		m->capacity = new_map.capacity;
-		m->prime = new_map.prime;
-		m->buckets = new_map.buckets;
-
-		return 0;
-	}
-
-	return 1;
-}
-
 int map_insert(map m, map_key key, map_value value)
 {
-	map_hash h;
-	size_t index;
-	bucket b;
-
 	if (m == NULL || key == NULL || value == NULL)
 	{
 		log_write("metacall", LOG_LEVEL_ERROR, "Invalid map insertion parameters");
 		return 1;
 	}
 
-	h = m->hash_cb(key);
-
-	index = h % m->capacity;
-
-	b = &m->buckets[index];
-
-	if (bucket_insert(b, key, value) != 0)
+	/* Map allows multiple values with the same key */
+	if (table_insert(&m->t, key, value) != 0)
 	{
-		log_write("metacall", LOG_LEVEL_ERROR, "Invalid map bucket insertion");
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid map table insertion");
 		return 1;
 	}
 
-	++m->count;
-
-	return map_bucket_realloc(m);
+	return 0;
 }
 
 int map_insert_array(map m, map_key keys[], map_value values[], size_t size)
@@ -235,13 +116,7 @@ vector map_get(map m, map_key key)
 {
 	if (m != NULL && key != NULL)
 	{
-		map_hash h = m->hash_cb(key);
-
-		size_t index = h % m->capacity;
-
-		bucket b = &m->buckets[index];
-
-		return bucket_get_pairs_value(b, m->compare_cb, key);
+		return table_find_all(&m->t, key);
 	}
 
 	return NULL;
@@ -249,20 +124,9 @@ vector map_get(map m, map_key key)
 
 int map_contains(map m, map_key key)
 {
-	if (m != NULL && key != NULL)
+	if (m != NULL && table_find(&m->t, key) != NULL)
 	{
-		map_hash h = m->hash_cb(key);
-
-		size_t index = h % m->capacity;
-
-		bucket b = &m->buckets[index];
-
-		pair p = bucket_get_pair(b, m->compare_cb, key);
-
-		if (p != NULL)
-		{
-			return 0;
-		}
+		return 0;
 	}
 
 	return 1;
@@ -270,23 +134,13 @@ int map_contains(map m, map_key key)
 
 int map_contains_any(map dest, map src)
 {
-	size_t bucket_iterator, pair_iterator;
+	size_t iterator;
 
-	for (bucket_iterator = 0; bucket_iterator < src->capacity; ++bucket_iterator)
+	for (iterator = table_next(&src->t, 0); iterator < src->t.capacity; iterator = table_next(&src->t, iterator + 1))
 	{
-		bucket b = &src->buckets[bucket_iterator];
-
-		if (b->pairs != NULL && b->count > 0)
+		if (map_contains(dest, src->t.slots[iterator].key) == 0)
 		{
-			for (pair_iterator = 0; pair_iterator < b->count; ++pair_iterator)
-			{
-				pair p = &b->pairs[pair_iterator];
-
-				if (map_contains(dest, p->key) == 0)
-				{
-					return 0;
-				}
-			}
+			return 0;
 		}
 	}
 
@@ -295,9 +149,6 @@ int map_contains_any(map dest, map src)
 
 map_value map_remove(map m, map_key key)
 {
-	map_hash h;
-	size_t index;
-	bucket b;
 	map_value value = NULL;
 
 	if (m == NULL || key == NULL)
@@ -306,23 +157,9 @@ map_value map_remove(map m, map_key key)
 		return NULL;
 	}
 
-	h = m->hash_cb(key);
-
-	index = h % m->capacity;
-
-	b = &m->buckets[index];
-
-	if (bucket_remove(b, m->compare_cb, key, &value) != 0)
-	{
-		log_write("metacall", LOG_LEVEL_ERROR, "Invalid map bucket remove: %p", key);
-		return NULL;
-	}
-
-	--m->count;
-
-	if (map_bucket_realloc(m) != 0)
+	if (table_remove(&m->t, key, &value) != 0)
 	{
-		log_write("metacall", LOG_LEVEL_ERROR, "Invalid map bucket remove reallocation");
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid map table remove: %p", key);
 		return NULL;
 	}
 
@@ -331,9 +168,7 @@ map_value map_remove(map m, map_key key)
 
 vector map_remove_all(map m, map_key key)
 {
-	map_hash h;
-	size_t index, iterator, size;
-	bucket b;
+	size_t iterator, size;
 	vector v = NULL;
 
 	if (m == NULL || key == NULL)
@@ -342,40 +177,25 @@ vector map_remove_all(map m, map_key key)
 		return NULL;
 	}
 
-	h = m->hash_cb(key);
-
-	index = h % m->capacity;
-
-	b = &m->buckets[index];
-
 	v = map_get(m, key);
 
 	size = vector_size(v);
 
 	if (size == 0)
 	{
-		log_write("metacall", LOG_LEVEL_ERROR, "Invalid map bucket remove: %p", key);
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid map table remove: %p", key);
 		vector_destroy(v);
 		return NULL;
 	}
 
 	for (iterator = 0; iterator < size; ++iterator)
 	{
-		if (bucket_remove(b, m->compare_cb, key, NULL) != 0)
+		if (table_remove(&m->t, key, NULL) != 0)
 		{
-			log_write("metacall", LOG_LEVEL_ERROR, "Invalid map bucket remove: %p", key);
+			log_write("metacall", LOG_LEVEL_ERROR, "Invalid map table remove: %p", key);
 			vector_destroy(v);
 			return NULL;
 		}
-
-		--m->count;
-	}
-
-	if (map_bucket_realloc(m) != 0)
-	{
-		log_write("metacall", LOG_LEVEL_ERROR, "Invalid map bucket remove reallocation");
-		vector_destroy(v);
-		return NULL;
 	}
 
 	return v;
@@ -383,27 +203,17 @@ vector map_remove_all(map m, map_key key)
 
 void map_iterate(map m, map_cb_iterate iterate_cb, map_cb_iterate_args args)
 {
-	if (m != NULL && m->buckets != NULL && iterate_cb != NULL)
+	if (m != NULL && iterate_cb != NULL)
 	{
-		size_t bucket_iterator;
+		size_t iterator;
 
-		for (bucket_iterator = 0; bucket_iterator < m->capacity; ++bucket_iterator)
+		for (iterator = table_next(&m->t, 0); iterator < m->t.capacity; iterator = table_next(&m->t, iterator + 1))
 		{
-			bucket b = &m->buckets[bucket_iterator];
+			table_slot slot = &m->t.slots[iterator];
 
-			if (b->pairs != NULL && b->count > 0)
+			if (iterate_cb(m, slot->key, slot->value, args) != 0)
 			{
-				size_t pair_iterator;
-
-				for (pair_iterator = 0; pair_iterator < b->count; ++pair_iterator)
-				{
-					pair p = &b->pairs[pair_iterator];
-
-					if (iterate_cb(m, p->key, p->value, args) != 0)
-					{
-						return;
-					}
-				}
+				return;
 			}
 		}
 	}
@@ -411,23 +221,15 @@ void map_iterate(map m, map_cb_iterate iterate_cb, map_cb_iterate_args args)
 
 int map_append(map dest, map src)
 {
-	size_t bucket_iterator, pair_iterator;
+	size_t iterator;
 
-	for (bucket_iterator = 0; bucket_iterator < src->capacity; ++bucket_iterator)
+	for (iterator = table_next(&src->t, 0); iterator < src->t.capacity; iterator = table_next(&src->t, iterator + 1))
 	{
-		bucket b = &src->buckets[bucket_iterator];
+		table_slot slot = &src->t.slots[iterator];
 
-		if (b->pairs != NULL && b->count > 0)
+		if (map_insert(dest, slot->key, slot->value) != 0)
 		{
-			for (pair_iterator = 0; pair_iterator < b->count; ++pair_iterator)
-			{
-				pair p = &b->pairs[pair_iterator];
-
-				if (map_insert(dest, p->key, p->value) != 0)
-				{
-					return 1;
-				}
-			}
+			return 1;
 		}
 	}
 
@@ -441,33 +243,7 @@ int map_clear(map m)
 		return 1;
 	}
 
-	if (m->buckets != NULL)
-	{
-		size_t iterator;
-
-		for (iterator = 0; iterator < m->capacity; ++iterator)
-		{
-			bucket b = &m->buckets[iterator];
-
-			if (b->pairs != NULL)
-			{
-				free(b->pairs);
-			}
-		}
-
-		free(m->buckets);
-	}
-
-	m->count = 0;
-	m->prime = 0;
-	m->capacity = bucket_capacity(m->prime);
-	m->buckets = bucket_create(m->capacity);
-
-	if (m->buckets == NULL)
-	{
-		log_write("metacall", LOG_LEVEL_ERROR, "Bad map clear bucket creation");
-		return 1;
-	}
+	table_clear(&m->t);
 
 	return 0;
 }
@@ -479,22 +255,7 @@ void map_destroy(map m)
 		return;
 	}
 
-	if (m->buckets != NULL)
-	{
-		size_t iterator;
-
-		for (iterator = 0; iterator < m->capacity; ++iterator)
-		{
-			bucket b = &m->buckets[iterator];
-
-			if (b->pairs != NULL)
-			{
-				free(b->pairs);
-			}
-		}
-
-		free(m->buckets);
-	}
+	table_clear(&m->t);
 
 	free(m);
 }
@@ -503,14 +264,12 @@ void map_iterator_begin(map_iterator it, map m)
 {
 	if (it != NULL)
 	{
-		it->current_bucket = 0;
-		it->current_pair = 0;
+		it->current = 0;
 
-		if (m != NULL && m->buckets != NULL && map_size(m) > 0)
+		if (m != NULL && map_size(m) > 0)
 		{
 			it->m = m;
-
-			map_iterator_next(it);
+			it->current = table_next(&m->t, 0);
 		}
 		else
 		{
@@ -521,9 +280,14 @@ void map_iterator_begin(map_iterator it, map m)
 
 map_key map_iterator_key(map_iterator it)
 {
-	if (it != NULL && it->m != NULL && it->current_bucket < it->m->capacity && it->current_pair > 0)
+	if (it != NULL && it->m != NULL)
 	{
-		return it->m->buckets[it->current_bucket].pairs[it->current_pair - 1].key;
+		table_slot slot = table_at(&it->m->t, it->current);
+
+		if (slot != NULL)
+		{
+			return slot->key;
+		}
 	}
 
 	return NULL;
@@ -531,9 +295,14 @@ map_key map_iterator_key(map_iterator it)
 
 map_value map_iterator_value(map_iterator it)
 {
-	if (it != NULL && it->m != NULL && it->current_bucket < it->m->capacity && it->current_pair > 0)
+	if (it != NULL && it->m != NULL)
 	{
-		return it->m->buckets[it->current_bucket].pairs[it->current_pair - 1].value;
+		table_slot slot = table_at(&it->m->t, it->current);
+
+		if (slot != NULL)
+		{
+			return slot->value;
+		}
 	}
 
 	return NULL;
@@ -541,29 +310,9 @@ map_value map_iterator_value(map_iterator it)
 
 void map_iterator_next(map_iterator it)
 {
-	if (it != NULL && it->m != NULL)
+	if (it != NULL && it->m != NULL && it->current < it->m->t.capacity)
 	{
-		for (; it->current_bucket < it->m->capacity; ++it->current_bucket)
-		{
-			bucket b = &it->m->buckets[it->current_bucket];
-
-			if (b->pairs != NULL && b->count > 0)
-			{
-				for (; it->current_pair < b->count; ++it->current_pair)
-				{
-					pair p = &b->pairs[it->current_pair];
-
-					if (p != NULL)
-					{
-						++it->current_pair;
-
-						return;
-					}
-				}
-			}
-
-			it->current_pair = 0;
-		}
+		it->current = table_next(&it->m->t, it->current + 1);
 	}
 }
 
@@ -571,7 +320,7 @@ int map_iterator_end(map_iterator it)
 {
 	if (it != NULL && it->m != NULL)
 	{
-		if (it->current_bucket >= it->m->capacity)
+		if (it->current >= it->m->t.capacity)
 		{
 			return 0;
 		}
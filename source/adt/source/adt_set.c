@@ -20,26 +20,16 @@
 
 /* -- Headers -- */
 
-#include <adt/adt_bucket.h>
 #include <adt/adt_set.h>
+#include <adt/adt_table.h>
 
 #include <log/log.h>
 
-/* -- Definitions -- */
-
-#define SET_BUCKET_RATIO_MIN 0.1f
-#define SET_BUCKET_RATIO_MAX 0.77f
-
 /* -- Member Data -- */
 
 struct set_type
 {
-	size_t count;
-	size_t capacity;
-	size_t prime;
-	bucket buckets;
-	set_cb_hash hash_cb;
-	set_cb_compare compare_cb;
+	struct table_type t;
 };
 
 /* -- Methods -- */
@@ -62,16 +52,9 @@ set set_create(set_cb_hash hash_cb, set_cb_compare compare_cb)
 		return NULL;
 	}
 
-	s->hash_cb = hash_cb;
-	s->compare_cb = compare_cb;
-	s->count = 0;
-	s->prime = 0;
-	s->capacity = bucket_capacity(s->prime);
-	s->buckets = bucket_create(s->capacity);
-
-	if (s->buckets == NULL)
+	if (table_initialize(&s->t, hash_cb, compare_cb) != 0)
 	{
-		log_write("metacall", LOG_LEVEL_ERROR, "Bad set bucket creation");
+		log_write("metacall", LOG_LEVEL_ERROR, "Bad set table initialization");
 		free(s);
 		return NULL;
 	}
@@ -83,168 +66,27 @@ size_t set_size(set s)
 {
 	if (s != NULL)
 	{
-		return s->count;
+		return table_size(&s->t);
 	}
 
 	return 0;
 }
 
-/*
-
-static int set_bucket_realloc_iterator(set s, set_key key, set_value value, set_cb_iterate_args args)
-{
-	set new_set = (set)args;
-
-	if (new_set != s && key != NULL && args != NULL)
-	{
-		set_hash h = new_set->hash_cb(key);
-
-		size_t index = h % new_set->capacity;
-
-		bucket b = &new_set->buckets[index];
-
-		if (bucket_insert(b, key, value) != 0)
-		{
-			log_write("metacall", LOG_LEVEL_ERROR, "Invalid set bucket realloc insertion");
-			return 1;
-		}
-
-		++new_set->count;
-
-		return 0;
-	}
-
-	return 1;
-}
-*/
-
-static int set_bucket_rehash(set s, set new_set)
-{
-	size_t bucket_iterator, pair_iterator;
-
-	for (bucket_iterator = 0; bucket_iterator < s->capacity; ++bucket_iterator)
-	{
-		bucket b = &s->buckets[bucket_iterator];
-
-		if (b->pairs != NULL && b->count > 0)
-		{
-			for (pair_iterator = 0; pair_iterator < b->count; ++pair_iterator)
-			{
-				pair p = &b->pairs[pair_iterator];
-
-				set_hash h = new_set->hash_cb(p->key);
-
-				size_t index = h % new_set->capacity;
-
-				bucket new_bucket = &new_set->buckets[index];
-
-				if (bucket_insert(new_bucket, p->key, p->value) != 0)
-				{
-					log_write("metacall", LOG_LEVEL_ERROR, "Invalid set bucket realloc insertion");
-					return 1;
-				}
-
-				++new_set->count;
-			}
-		}
-	}
-
-	return 0;
-}
-
-static int set_bucket_realloc(set s)
-{
-	struct set_type new_set;
-	size_t prime = s->prime;
-	float ratio = (float)((float)s->count / (float)s->capacity);
-
-	if (prime > 0 && ratio <= SET_BUCKET_RATIO_MIN)
-	{
-		--prime;
-	}
-	else if (ratio >= SET_BUCKET_RATIO_MAX)
-	{
-		++prime;
-	}
-	else
-	{
-		return 0;
-	}
-
-	new_set.hash_cb = s->hash_cb;
-	new_set.compare_cb = s->compare_cb;
-	new_set.count = 0;
-	new_set.prime = prime;
-	new_set.capacity = bucket_capacity(prime);
-	new_set.buckets = bucket_create(new_set.capacity);
-
-	if (new_set.buckets != NULL)
-	{
-		size_t iterator;
-
-		/* Rehash all the elements into the new set */
-		set_bucket_rehash(s, &new_set);
-
-		/* Destroy all pairs from old set */
-		for (iterator = 0; iterator < s->capacity; ++iterator)
-		{
-			bucket b = &s->buckets[iterator];
-
-			if (b->pairs != NULL)
-			{
-				free(b->pairs);
-			}
-		}
-
-		/* Destroy all buckets from old set */
-		free(s->buckets);
-
-		s->capacity = new_set.capacity;
-		s->prime = new_set.prime;
-		s->buckets = new_set.buckets;
-
-		return 0;
-	}
-
-	return 1;
-}
-
 int set_insert(set s, set_key key, set_value value)
 {
-	set_hash h;
-	size_t index;
-	bucket b;
-	pair p;
-
 	if (s == NULL || key == NULL || value == NULL)
 	{
 		log_write("metacall", LOG_LEVEL_ERROR, "Invalid set insertion parameters");
 		return 1;
 	}
 
-	h = s->hash_cb(key);
-
-	index = h % s->capacity;
-
-	b = &s->buckets[index];
-
-	p = bucket_get_pair(b, s->compare_cb, key);
-
-	if (p != NULL)
+	if (table_insert_unique(&s->t, key, value) != 0)
 	{
-		p->value = value;
-		return 0;
-	}
-
-	if (bucket_insert(b, key, value) != 0)
-	{
-		log_write("metacall", LOG_LEVEL_ERROR, "Invalid set bucket insertion");
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid set table insertion");
 		return 1;
 	}
 
-	++s->count;
-
-	return set_bucket_realloc(s);
+	return 0;
 }
 
 int set_insert_array(set s, set_key keys[], set_value values[], size_t size)
@@ -271,19 +113,13 @@ int set_insert_array(set s, set_key keys[], set_value values[], size_t size)
 
 set_value set_get(set s, set_key key)
 {
-	if (s != NULL && key != NULL)
+	if (s != NULL)
 	{
-		set_hash h = s->hash_cb(key);
-
-		size_t index = h % s->capacity;
-
-		bucket b = &s->buckets[index];
+		table_slot slot = table_find(&s->t, key);
 
-		pair p = bucket_get_pair(b, s->compare_cb, key);
-
-		if (p != NULL)
+		if (slot != NULL)
 		{
-			return p->value;
+			return slot->value;
 		}
 	}
 
@@ -292,20 +128,9 @@ set_value set_get(set s, set_key key)
 
 int set_contains(set s, set_key key)
 {
-	if (s != NULL && key != NULL)
+	if (s != NULL && table_find(&s->t, key) != NULL)
 	{
-		set_hash h = s->hash_cb(key);
-
-		size_t index = h % s->capacity;
-
-		bucket b = &s->buckets[index];
-
-		pair p = bucket_get_pair(b, s->compare_cb, key);
-
-		if (p != NULL)
-		{
-			return 0;
-		}
+		return 0;
 	}
 
 	return 1;
@@ -313,23 +138,13 @@ int set_contains(set s, set_key key)
 
 int set_contains_any(set dest, set src)
 {
-	size_t bucket_iterator, pair_iterator;
+	size_t iterator;
 
-	for (bucket_iterator = 0; bucket_iterator < src->capacity; ++bucket_iterator)
+	for (iterator = table_next(&src->t, 0); iterator < src->t.capacity; iterator = table_next(&src->t, iterator + 1))
 	{
-		bucket b = &src->buckets[bucket_iterator];
-
-		if (b->pairs != NULL && b->count > 0)
+		if (set_contains(dest, src->t.slots[iterator].key) == 0)
 		{
-			for (pair_iterator = 0; pair_iterator < b->count; ++pair_iterator)
-			{
-				pair p = &b->pairs[pair_iterator];
-
-				if (set_contains(dest, p->key) == 0)
-				{
-					return 0;
-				}
-			}
+			return 0;
 		}
 	}
 
@@ -338,24 +153,14 @@ int set_contains_any(set dest, set src)
 
 int set_contains_which(set dest, set src, set_key *key)
 {
-	size_t bucket_iterator, pair_iterator;
+	size_t iterator;
 
-	for (bucket_iterator = 0; bucket_iterator < src->capacity; ++bucket_iterator)
+	for (iterator = table_next(&src->t, 0); iterator < src->t.capacity; iterator = table_next(&src->t, iterator + 1))
 	{
-		bucket b = &src->buckets[bucket_iterator];
-
-		if (b->pairs != NULL && b->count > 0)
+		if (set_contains(dest, src->t.slots[iterator].key) == 0)
 		{
-			for (pair_iterator = 0; pair_iterator < b->count; ++pair_iterator)
-			{
-				pair p = &b->pairs[pair_iterator];
-
-				if (set_contains(dest, p->key) == 0)
-				{
-					*key = p->key;
-					return 0;
-				}
-			}
+			*key = src->t.slots[iterator].key;
+			return 0;
 		}
 	}
 
@@ -364,9 +169,6 @@ int set_contains_which(set dest, set src, set_key *key)
 
 set_value set_remove(set s, set_key key)
 {
-	set_hash h;
-	size_t index;
-	bucket b;
 	set_value value = NULL;
 
 	if (s == NULL || key == NULL)
@@ -375,23 +177,9 @@ set_value set_remove(set s, set_key key)
 		return NULL;
 	}
 
-	h = s->hash_cb(key);
-
-	index = h % s->capacity;
-
-	b = &s->buckets[index];
-
-	if (bucket_remove(b, s->compare_cb, key, &value) != 0)
+	if (table_remove(&s->t, key, &value) != 0)
 	{
-		log_write("metacall", LOG_LEVEL_ERROR, "Invalid set bucket remove: %p", key);
-		return NULL;
-	}
-
-	--s->count;
-
-	if (set_bucket_realloc(s) != 0)
-	{
-		log_write("metacall", LOG_LEVEL_ERROR, "Invalid set bucket remove reallocation");
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid set table remove: %p", key);
 		return NULL;
 	}
 
@@ -400,27 +188,17 @@ set_value set_remove(set s, set_key key)
 
 void set_iterate(set s, set_cb_iterate iterate_cb, set_cb_iterate_args args)
 {
-	if (s != NULL && s->buckets != NULL && iterate_cb != NULL)
+	if (s != NULL && iterate_cb != NULL)
 	{
-		size_t bucket_iterator;
+		size_t iterator;
 
-		for (bucket_iterator = 0; bucket_iterator < s->capacity; ++bucket_iterator)
+		for (iterator = table_next(&s->t, 0); iterator < s->t.capacity; iterator = table_next(&s->t, iterator + 1))
 		{
-			bucket b = &s->buckets[bucket_iterator];
+			table_slot slot = &s->t.slots[iterator];
 
-			if (b->pairs != NULL && b->count > 0)
+			if (iterate_cb(s, slot->key, slot->value, args) != 0)
 			{
-				size_t pair_iterator;
-
-				for (pair_iterator = 0; pair_iterator < b->count; ++pair_iterator)
-				{
-					pair p = &b->pairs[pair_iterator];
-
-					if (iterate_cb(s, p->key, p->value, args) != 0)
-					{
-						return;
-					}
-				}
+				return;
 			}
 		}
 	}
@@ -428,23 +206,15 @@ void set_iterate(set s, set_cb_iterate iterate_cb, set_cb_iterate_args args)
 
 int set_append(set dest, set src)
 {
-	size_t bucket_iterator, pair_iterator;
+	size_t iterator;
 
-	for (bucket_iterator = 0; bucket_iterator < src->capacity; ++bucket_iterator)
+	for (iterator = table_next(&src->t, 0); iterator < src->t.capacity; iterator = table_next(&src->t, iterator + 1))
 	{
-		bucket b = &src->buckets[bucket_iterator];
+		table_slot slot = &src->t.slots[iterator];
 
-		if (b->pairs != NULL && b->count > 0)
+		if (set_insert(dest, slot->key, slot->value) != 0)
 		{
-			for (pair_iterator = 0; pair_iterator < b->count; ++pair_iterator)
-			{
-				pair p = &b->pairs[pair_iterator];
-
-				if (set_insert(dest, p->key, p->value) != 0)
-				{
-					return 1;
-				}
-			}
+			return 1;
 		}
 	}
 
@@ -453,25 +223,17 @@ int set_append(set dest, set src)
 
 int set_disjoint(set dest, set src)
 {
-	size_t bucket_iterator, pair_iterator;
+	size_t iterator;
 
-	for (bucket_iterator = 0; bucket_iterator < src->capacity; ++bucket_iterator)
+	for (iterator = table_next(&src->t, 0); iterator < src->t.capacity; iterator = table_next(&src->t, iterator + 1))
 	{
-		bucket b = &src->buckets[bucket_iterator];
-
-		if (b->pairs != NULL && b->count > 0)
-		{
-			for (pair_iterator = 0; pair_iterator < b->count; ++pair_iterator)
-			{
-				pair p = &b->pairs[pair_iterator];
+		table_slot slot = &src->t.slots[iterator];
 
-				set_value deleted = set_remove(dest, p->key);
+		set_value deleted = set_remove(dest, slot->key);
 
-				if (deleted != p->value)
-				{
-					return 1;
-				}
-			}
+		if (deleted != slot->value)
+		{
+			return 1;
 		}
 	}
 
@@ -485,33 +247,7 @@ int set_clear(set s)
 		return 1;
 	}
 
-	if (s->buckets != NULL)
-	{
-		size_t iterator;
-
-		for (iterator = 0; iterator < s->capacity; ++iterator)
-		{
-			bucket b = &s->buckets[iterator];
-
-			if (b->pairs != NULL)
-			{
-				free(b->pairs);
-			}
-		}
-
-		free(s->buckets);
-	}
-
-	s->count = 0;
-	s->prime = 0;
-	s->capacity = bucket_capacity(s->prime);
-	s->buckets = bucket_create(s->capacity);
-
-	if (s->buckets == NULL)
-	{
-		log_write("metacall", LOG_LEVEL_ERROR, "Bad set clear bucket creation");
-		return 1;
-	}
+	table_clear(&s->t);
 
 	return 0;
 }
@@ -523,22 +259,7 @@ void set_destroy(set s)
 		return;
 	}
 
-	if (s->buckets != NULL)
-	{
-		size_t iterator;
-
-		for (iterator = 0; iterator < s->capacity; ++iterator)
-		{
-			bucket b = &s->buckets[iterator];
-
-			if (b->pairs != NULL)
-			{
-				free(b->pairs);
-			}
-		}
-
-		free(s->buckets);
-	}
+	table_clear(&s->t);
 
 	free(s);
 }
@@ -547,14 +268,12 @@ void set_iterator_begin(set_iterator it, set s)
 {
 	if (it != NULL)
 	{
-		it->current_bucket = 0;
-		it->current_pair = 0;
+		it->current = 0;
 
-		if (s != NULL && s->buckets != NULL && set_size(s) > 0)
+		if (s != NULL && set_size(s) > 0)
 		{
 			it->s = s;
-
-			set_iterator_next(it);
+			it->current = table_next(&s->t, 0);
 		}
 		else
 		{
@@ -565,9 +284,14 @@ void set_iterator_begin(set_iterator it, set s)
 
 set_key set_iterator_key(set_iterator it)
 {
-	if (it != NULL && it->s != NULL && it->current_bucket < it->s->capacity && it->current_pair > 0)
+	if (it != NULL && it->s != NULL)
 	{
-		return it->s->buckets[it->current_bucket].pairs[it->current_pair - 1].key;
+		table_slot slot = table_at(&it->s->t, it->current);
+
+		if (slot != NULL)
+		{
+			return slot->key;
+		}
 	}
 
 	return NULL;
@@ -575,9 +299,14 @@ set_key set_iterator_key(set_iterator it)
 
 set_value set_iterator_value(set_iterator it)
 {
-	if (it != NULL && it->s != NULL && it->current_bucket < it->s->capacity && it->current_pair > 0)
+	if (it != NULL && it->s != NULL)
 	{
-		return it->s->buckets[it->current_bucket].pairs[it->current_pair - 1].value;
+		table_slot slot = table_at(&it->s->t, it->current);
+
+		if (slot != NULL)
+		{
+			return slot->value;
+		}
 	}
 
 	return NULL;
@@ -585,29 +314,9 @@ set_value set_iterator_value(set_iterator it)
 
 void set_iterator_next(set_iterator it)
 {
-	if (it != NULL && it->s != NULL)
+	if (it != NULL && it->s != NULL && it->current < it->s->t.capacity)
 	{
-		for (; it->current_bucket < it->s->capacity; ++it->current_bucket)
-		{
-			bucket b = &it->s->buckets[it->current_bucket];
-
-			if (b->pairs != NULL && b->count > 0)
-			{
-				for (; it->current_pair < b->count; ++it->current_pair)
-				{
-					pair p = &b->pairs[it->current_pair];
-
-					if (p != NULL)
-					{
-						++it->current_pair;
-
-						return;
-					}
-				}
-
-				it->current_pair = 0;
-			}
-		}
+		it->current = table_next(&it->s->t, it->current + 1);
 	}
 }
 
@@ -615,7 +324,7 @@ int set_iterator_end(set_iterator it)
 {
 	if (it != NULL && it->s != NULL)
 	{
-		if (it->current_bucket >= it->s->capacity)
+		if (it->current >= it->s->t.capacity)
 		{
 			return 0;
 		}
@@ -0,0 +1,637 @@
+/*
+ *	Abstract Data Type Library by Parra Studios
+ *	A abstract data type library providing generic containers.
+ *
+ *	Copyright (C) 2016 - 2026 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+/* -- Headers -- */
+
+#include <adt/adt_table.h>
+
+#include <log/log.h>
+
+#include <string.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define TABLE_GROUP_SSE2 1
+	#include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__) && defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+	#define TABLE_GROUP_NEON 1
+	#include <arm_neon.h>
+#endif
+
+#if defined(_MSC_VER)
+	#include <intrin.h>
+#endif
+
+/* -- Definitions -- */
+
+#define TABLE_CTRL_EMPTY   ((uint8_t)0x80)
+#define TABLE_CTRL_DELETED ((uint8_t)0xFE)
+#define TABLE_CTRL_FULL(c) (((c)&0x80) == 0)
+
+/* SSE2 compares 16 control bytes at once producing one bit per byte,
+* NEON and the portable implementation compare 8 control bytes at once
+* producing the most significant bit of each byte
+*/
+#if defined(TABLE_GROUP_SSE2)
+	#define TABLE_GROUP_WIDTH ((size_t)16)
+	#define TABLE_GROUP_SHIFT 0
+#else
+	#define TABLE_GROUP_WIDTH ((size_t)8)
+	#define TABLE_GROUP_SHIFT 3
+	#define TABLE_GROUP_LSBS  UINT64_C(0x0101010101010101)
+	#define TABLE_GROUP_MSBS  UINT64_C(0x8080808080808080)
+#endif
+
+#define TABLE_GROUP_MASK_BITS (TABLE_GROUP_WIDTH << TABLE_GROUP_SHIFT)
+
+/* -- Type Definitions -- */
+
+typedef uint64_t table_mask;
+
+/* -- Private Methods -- */
+
+static hash table_hash(table t, void *key);
+
+static size_t table_growth(size_t capacity);
+
+static void table_ctrl_set(table t, size_t index, uint8_t c);
+
+static table_mask table_group_match(const uint8_t *ctrl, uint8_t h2);
+
+static table_mask table_group_empty(const uint8_t *ctrl);
+
+static table_mask table_group_empty_or_deleted(const uint8_t *ctrl);
+
+static size_t table_mask_trailing(table_mask mask);
+
+static size_t table_mask_leading(table_mask mask);
+
+static size_t table_find_index(table t, void *key, hash h);
+
+static size_t table_find_free(table t, hash h);
+
+static int table_resize(table t, size_t capacity);
+
+static int table_insert_hash(table t, void *key, void *value, hash h);
+
+/* -- Methods -- */
+
+hash table_hash(table t, void *key)
+{
+	/* The hash callbacks may have weak lower bits (for example, aligned pointers), so mix them
+	before splitting them into the probe position (upper bits) and the control byte (lower 7 bits) */
+	hash h = t->hash_cb(key);
+
+#if UINTPTR_MAX == 0xFFFFFFFF
+	h *= (hash)0x9E3779B9;
+	h ^= h >> 16;
+#else
+	h *= (hash)UINT64_C(0x9E3779B97F4A7C15);
+	h ^= h >> 32;
+#endif
+
+	return h;
+}
+
+size_t table_growth(size_t capacity)
+{
+	/* Maximum load factor of 7/8 */
+	return capacity - (capacity >> 3);
+}
+
+void table_ctrl_set(table t, size_t index, uint8_t c)
+{
+	t->ctrl[index] = c;
+
+	/* Mirror the first group after the end, so a group can be loaded from any position without wrapping */
+	if (index < TABLE_GROUP_WIDTH)
+	{
+		t->ctrl[t->capacity + index] = c;
+	}
+}
+
+#if defined(TABLE_GROUP_SSE2)
+
+table_mask table_group_match(const uint8_t *ctrl, uint8_t h2)
+{
+	__m128i group = _mm_loadu_si128((const __m128i *)ctrl);
+
+	return (table_mask)(uint16_t)_mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8((char)h2)));
+}
+
+table_mask table_group_empty(const uint8_t *ctrl)
+{
+	__m128i group = _mm_loadu_si128((const __m128i *)ctrl);
+
+	return (table_mask)(uint16_t)_mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8((char)TABLE_CTRL_EMPTY)));
+}
+
+table_mask table_group_empty_or_deleted(const uint8_t *ctrl)
+{
+	__m128i group = _mm_loadu_si128((const __m128i *)ctrl);
+
+	return (table_mask)(uint16_t)_mm_movemask_epi8(group);
+}
+
+#elif defined(TABLE_GROUP_NEON)
+
+table_mask table_group_match(const uint8_t *ctrl, uint8_t h2)
+{
+	uint8x8_t group = vld1_u8(ctrl);
+
+	return vget_lane_u64(vreinterpret_u64_u8(vceq_u8(group, vdup_n_u8(h2))), 0) & TABLE_GROUP_MSBS;
+}
+
+table_mask table_group_empty(const uint8_t *ctrl)
+{
+	uint8x8_t group = vld1_u8(ctrl);
+
+	return vget_lane_u64(vreinterpret_u64_u8(vceq_u8(group, vdup_n_u8(TABLE_CTRL_EMPTY))), 0) & TABLE_GROUP_MSBS;
+}
+
+table_mask table_group_empty_or_deleted(const uint8_t *ctrl)
+{
+	uint8x8_t group = vld1_u8(ctrl);
+
+	return vget_lane_u64(vreinterpret_u64_u8(group), 0) & TABLE_GROUP_MSBS;
+}
+
+#else
+
+static table_mask table_group_load(const uint8_t *ctrl)
+{
+	table_mask group;
+
+	memcpy(&group, ctrl, sizeof(table_mask));
+
+	#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+	group = __builtin_bswap64(group);
+	#endif
+
+	return group;
+}
+
+table_mask table_group_match(const uint8_t *ctrl, uint8_t h2)
+{
+	/* This may return false positives in the bytes after a real match, which is
+	harmless because the keys are compared anyway after matching the control byte */
+	table_mask group = table_group_load(ctrl) ^ (TABLE_GROUP_LSBS * h2);
+
+	return (group - TABLE_GROUP_LSBS) & ~group & TABLE_GROUP_MSBS;
+}
+
+table_mask table_group_empty(const uint8_t *ctrl)
+{
+	/* Empty is the only control byte with the most significant bit set and the second bit cleared */
+	table_mask group = table_group_load(ctrl);
+
+	return group & ~(group << 6) & TABLE_GROUP_MSBS;
+}
+
+table_mask table_group_empty_or_deleted(const uint8_t *ctrl)
+{
+	return table_group_load(ctrl) & TABLE_GROUP_MSBS;
+}
+
+#endif
+
+size_t table_mask_trailing(table_mask mask)
+{
+	if (mask == 0)
+	{
+		return TABLE_GROUP_WIDTH;
+	}
+
+#if defined(_MSC_VER)
+	{
+		unsigned long index;
+
+	#if defined(_M_X64) || defined(_M_AMD64) || defined(_M_ARM64)
+		_BitScanForward64(&index, mask);
+	#else
+		if (_BitScanForward(&index, (unsigned long)mask) == 0)
+		{
+			_BitScanForward(&index, (unsigned long)(mask >> 32));
+			index += 32;
+		}
+	#endif
+
+		return (size_t)index >> TABLE_GROUP_SHIFT;
+	}
+#else
+	return (size_t)__builtin_ctzll((unsigned long long)mask) >> TABLE_GROUP_SHIFT;
+#endif
+}
+
+size_t table_mask_leading(table_mask mask)
+{
+	size_t zeros;
+
+	if (mask == 0)
+	{
+		return TABLE_GROUP_WIDTH;
+	}
+
+#if defined(_MSC_VER)
+	{
+		unsigned long index;
+
+	#if defined(_M_X64) || defined(_M_AMD64) || defined(_M_ARM64)
+		_BitScanReverse64(&index, mask);
+	#else
+		if (_BitScanReverse(&index, (unsigned long)(mask >> 32)) != 0)
+		{
+			index += 32;
+		}
+		else
+		{
+			_BitScanReverse(&index, (unsigned long)mask);
+		}
+	#endif
+
+		zeros = 63 - (size_t)index;
+	}
+#else
+	zeros = (size_t)__builtin_clzll((unsigned long long)mask);
+#endif
+
+	return (zeros - (64 - TABLE_GROUP_MASK_BITS)) >> TABLE_GROUP_SHIFT;
+}
+
+int table_initialize(table t, hash_callback hash_cb, comparable_callback compare_cb)
+{
+	if (t == NULL || hash_cb == NULL || compare_cb == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid table initialization parameters");
+		return 1;
+	}
+
+	t->count = 0;
+	t->capacity = 0;
+	t->growth = 0;
+	t->ctrl = NULL;
+	t->slots = NULL;
+	t->hash_cb = hash_cb;
+	t->compare_cb = compare_cb;
+
+	return 0;
+}
+
+size_t table_size(table t)
+{
+	if (t != NULL)
+	{
+		return t->count;
+	}
+
+	return 0;
+}
+
+size_t table_find_index(table t, void *key, hash h)
+{
+	const size_t mask = t->capacity - 1;
+	const uint8_t h2 = (uint8_t)(h & 0x7F);
+	size_t offset = (size_t)(h >> 7) & mask;
+	size_t stride = 0;
+
+	for (;;)
+	{
+		const uint8_t *group = &t->ctrl[offset];
+		table_mask match = table_group_match(group, h2);
+
+		while (match != 0)
+		{
+			size_t index = (offset + table_mask_trailing(match)) & mask;
+
+			if (t->compare_cb(key, t->slots[index].key) == 0)
+			{
+				return index;
+			}
+
+			match &= match - 1;
+		}
+
+		/* If the group has an empty slot, the key was never inserted after this point */
+		if (table_group_empty(group) != 0)
+		{
+			return TABLE_INDEX_INVALID;
+		}
+
+		/* Triangular probing visits all the groups when capacity is power of two */
+		stride += TABLE_GROUP_WIDTH;
+		offset = (offset + stride) & mask;
+	}
+}
+
+size_t table_find_free(table t, hash h)
+{
+	const size_t mask = t->capacity - 1;
+	size_t offset = (size_t)(h >> 7) & mask;
+	size_t stride = 0;
+
+	for (;;)
+	{
+		table_mask free_mask = table_group_empty_or_deleted(&t->ctrl[offset]);
+
+		if (free_mask != 0)
+		{
+			return (offset + table_mask_trailing(free_mask)) & mask;
+		}
+
+		stride += TABLE_GROUP_WIDTH;
+		offset = (offset + stride) & mask;
+	}
+}
+
+int table_resize(table t, size_t capacity)
+{
+	struct table_type old = *t;
+	size_t ctrl_size = capacity + TABLE_GROUP_WIDTH;
+	size_t iterator;
+	void *block;
+
+	/* Slots and control bytes are allocated in a single block, slots first for keeping the pointer alignment */
+	block = malloc((sizeof(struct table_slot_type) * capacity) + ctrl_size);
+
+	if (block == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Bad table allocation");
+		return 1;
+	}
+
+	t->slots = (table_slot)block;
+	t->ctrl = (uint8_t *)&t->slots[capacity];
+	t->capacity = capacity;
+	t->growth = table_growth(capacity) - old.count;
+
+	memset(t->ctrl, TABLE_CTRL_EMPTY, ctrl_size);
+
+	/* Rehash all the elements of the old storage into the new one, tombstones are discarded */
+	for (iterator = 0; iterator < old.capacity; ++iterator)
+	{
+		if (TABLE_CTRL_FULL(old.ctrl[iterator]))
+		{
+			table_slot slot = &old.slots[iterator];
+			hash h = table_hash(t, slot->key);
+			size_t index = table_find_free(t, h);
+
+			table_ctrl_set(t, index, (uint8_t)(h & 0x7F));
+			t->slots[index] = *slot;
+		}
+	}
+
+	if (old.slots != NULL)
+	{
+		free(old.slots);
+	}
+
+	return 0;
+}
+
+int table_insert_hash(table t, void *key, void *value, hash h)
+{
+	size_t index;
+
+	if (t->growth == 0)
+	{
+		size_t capacity = t->capacity == 0 ? TABLE_GROUP_WIDTH : t->capacity;
+
+		/* Grow only if the table is really full, otherwise it is full of tombstones, so rehash in place */
+		if (t->count >= (table_growth(capacity) >> 1))
+		{
+			capacity <<= 1;
+		}
+
+		if (table_resize(t, capacity) != 0)
+		{
+			return 1;
+		}
+	}
+
+	index = table_find_free(t, h);
+
+	if (t->ctrl[index] == TABLE_CTRL_EMPTY)
+	{
+		--t->growth;
+	}
+
+	table_ctrl_set(t, index, (uint8_t)(h & 0x7F));
+
+	t->slots[index].key = key;
+	t->slots[index].value = value;
+
+	++t->count;
+
+	return 0;
+}
+
+table_slot table_find(table t, void *key)
+{
+	if (t != NULL && key != NULL && t->count > 0)
+	{
+		size_t index = table_find_index(t, key, table_hash(t, key));
+
+		if (index != TABLE_INDEX_INVALID)
+		{
+			return &t->slots[index];
+		}
+	}
+
+	return NULL;
+}
+
+vector table_find_all(table t, void *key)
+{
+	vector v = vector_create(sizeof(void *));
+
+	if (v == NULL)
+	{
+		return NULL;
+	}
+
+	if (t != NULL && key != NULL && t->count > 0)
+	{
+		const size_t mask = t->capacity - 1;
+		const hash h = table_hash(t, key);
+		const uint8_t h2 = (uint8_t)(h & 0x7F);
+		size_t offset = (size_t)(h >> 7) & mask;
+		size_t stride = 0;
+
+		for (;;)
+		{
+			const uint8_t *group = &t->ctrl[offset];
+			table_mask match = table_group_match(group, h2);
+
+			while (match != 0)
+			{
+				size_t index = (offset + table_mask_trailing(match)) & mask;
+
+				if (t->compare_cb(key, t->slots[index].key) == 0)
+				{
+					vector_push_back(v, &t->slots[index].value);
+				}
+
+				match &= match - 1;
+			}
+
+			if (table_group_empty(group) != 0)
+			{
+				break;
+			}
+
+			stride += TABLE_GROUP_WIDTH;
+			offset = (offset + stride) & mask;
+		}
+	}
+
+	return v;
+}
+
+int table_insert(table t, void *key, void *value)
+{
+	if (t == NULL || key == NULL || value == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid table insertion parameters");
+		return 1;
+	}
+
+	return table_insert_hash(t, key, value, table_hash(t, key));
+}
+
+int table_insert_unique(table t, void *key, void *value)
+{
+	hash h;
+
+	if (t == NULL || key == NULL || value == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid table insertion parameters");
+		return 1;
+	}
+
+	h = table_hash(t, key);
+
+	if (t->count > 0)
+	{
+		size_t index = table_find_index(t, key, h);
+
+		/* Replace the value if the key already exists */
+		if (index != TABLE_INDEX_INVALID)
+		{
+			t->slots[index].value = value;
+			return 0;
+		}
+	}
+
+	return table_insert_hash(t, key, value, h);
+}
+
+int table_remove(table t, void *key, void **value)
+{
+	size_t index, before;
+	table_mask empty_before, empty_after;
+
+	if (t == NULL || key == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid table remove parameters");
+		return 1;
+	}
+
+	if (t->count == 0)
+	{
+		return 1;
+	}
+
+	index = table_find_index(t, key, table_hash(t, key));
+
+	if (index == TABLE_INDEX_INVALID)
+	{
+		return 1;
+	}
+
+	if (value != NULL)
+	{
+		*value = t->slots[index].value;
+	}
+
+	/* If there is no window of a full group containing this slot, no probe sequence
+	has ever continued after it, so it can be marked as empty instead of deleted */
+	before = (index - TABLE_GROUP_WIDTH) & (t->capacity - 1);
+	empty_before = table_group_empty(&t->ctrl[before]);
+	empty_after = table_group_empty(&t->ctrl[index]);
+
+	if (empty_before != 0 && empty_after != 0 && (table_mask_trailing(empty_after) + table_mask_leading(empty_before)) < TABLE_GROUP_WIDTH)
+	{
+		table_ctrl_set(t, index, TABLE_CTRL_EMPTY);
+		++t->growth;
+	}
+	else
+	{
+		table_ctrl_set(t, index, TABLE_CTRL_DELETED);
+	}
+
+	--t->count;
+
+	/* Removal never reallocates the storage, so it is safe to remove while iterating */
+	return 0;
+}
+
+size_t table_next(table t, size_t index)
+{
+	if (t != NULL)
+	{
+		for (; index < t->capacity; ++index)
+		{
+			if (TABLE_CTRL_FULL(t->ctrl[index]))
+			{
+				return index;
+			}
+		}
+
+		return t->capacity;
+	}
+
+	return 0;
+}
+
+table_slot table_at(table t, size_t index)
+{
+	if (t != NULL && index < t->capacity && TABLE_CTRL_FULL(t->ctrl[index]))
+	{
+		return &t->slots[index];
+	}
+
+	return NULL;
+}
+
+void table_clear(table t)
+{
+	if (t != NULL)
+	{
+		if (t->slots != NULL)
+		{
+			free(t->slots);
+		}
+
+		t->count = 0;
+		t->capacity = 0;
+		t->growth = 0;
+		t->ctrl = NULL;
+		t->slots = NULL;
+	}
+}
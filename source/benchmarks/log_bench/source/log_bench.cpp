@@ -34,6 +34,13 @@ static int stream_flush(void *)
 	return 0;
 }
 
+static int stream_write_count(void *context, const char *, const size_t)
+{
+	// Count the writes that reach the stream so the coalescing can be compared
+	++*static_cast<int64_t *>(context);
+	return 0;
+}
+
 class log_bench : public benchmark::Fixture
 {
 public:
@@ -98,4 +105,57 @@ BENCHMARK_REGISTER_F(log_bench, call_va)
 	->Iterations(1)
 	->Repetitions(3);
 
+class log_bench_batch : public benchmark::Fixture
+{
+public:
+	void SetUp(benchmark::State &state)
+	{
+		writes = 0;
+
+		// Flush only on critical records so the error records are coalesced until the buffer is full
+		if (log_configure("batch",
+				log_policy_format_text(),
+				log_policy_schedule_sync(),
+				log_policy_storage_batch(state.range(0), LOG_LEVEL_CRITICAL, 0),
+				log_policy_stream_custom(&writes, &stream_write_count, &stream_flush)) != 0)
+		{
+			state.SkipWithError("Error creating the log");
+		}
+	}
+
+	void TearDown(benchmark::State &)
+	{
+		log_delete("batch");
+	}
+
+protected:
+	int64_t writes;
+};
+
+BENCHMARK_DEFINE_F(log_bench_batch, call_macro)
+(benchmark::State &state)
+{
+	const int64_t call_count = 10000;
+
+	for (auto _ : state)
+	{
+		for (int64_t it = 0; it < call_count; ++it)
+		{
+			log_write("batch", LOG_LEVEL_ERROR, "Message");
+		}
+	}
+
+	state.SetLabel("Log Benchmark - Call Macro Batch");
+	state.SetItemsProcessed(call_count);
+	state.counters["writes"] = static_cast<double>(writes);
+}
+
+BENCHMARK_REGISTER_F(log_bench_batch, call_macro)
+	->Unit(benchmark::kMillisecond)
+	->Arg(0x200)
+	->Arg(0x1000)
+	->Arg(0x10000)
+	->Iterations(1)
+	->Repetitions(3);
+
 BENCHMARK_MAIN();
@@ -0,0 +1,217 @@
+/*
+ *	MetaCall Library by Parra Studios
+ *	A library for providing a foreign function interface calls.
+ *
+ *	Copyright (C) 2016 - 2026 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <metacall/metacall.h>
+#include <metacall/metacall_link.h>
+#include <metacall/metacall_loaders.h>
+
+#include <string>
+#include <vector>
+
+/* The hook replaces dlsym in the hooked runtimes, it is exported but it is not part of the public API */
+extern "C" void *metacall_link_hook(void *handle, const char *symbol);
+
+#define METACALL_LINK_BENCH_SYMBOLS 0x40
+
+static std::vector<std::string> symbols;
+
+static void metacall_link_bench_symbol(void)
+{
+}
+
+class metacall_link_bench : public benchmark::Fixture
+{
+public:
+};
+
+BENCHMARK_DEFINE_F(metacall_link_bench, init)
+(benchmark::State &state)
+{
+	for (auto _ : state)
+	{
+		static const char py_script[] =
+			"#!/usr/bin/env python3\n"
+			"def py_link(left: int, right: int) -> int:\n"
+			"\treturn 0;";
+
+		static const char rb_script[] =
+			"def rb_link(left, right)\n"
+			"\treturn 0\n"
+			"end\n";
+
+		/* Each runtime hooks the dlsym of its own library, the symbols are shared by both of them */
+		static const char *const tags[][2] = {
+			{ "py", "python" },
+			{ "rb", "ruby" }
+		};
+
+		metacall_log_null();
+
+		if (metacall_initialize() != 0)
+		{
+			state.SkipWithError("Error initializing MetaCall");
+			return;
+		}
+
+		if (metacall_load_from_memory(tags[0][0], py_script, sizeof(py_script), NULL) != 0)
+		{
+			state.SkipWithError("Error loading py_link function");
+			return;
+		}
+
+		if (metacall_load_from_memory(tags[1][0], rb_script, sizeof(rb_script), NULL) != 0)
+		{
+			state.SkipWithError("Error loading rb_link function");
+			return;
+		}
+
+		symbols.reserve(METACALL_LINK_BENCH_SYMBOLS);
+
+		for (size_t iterator = 0; iterator < METACALL_LINK_BENCH_SYMBOLS; ++iterator)
+		{
+			const char *const *tag = tags[iterator % (sizeof(tags) / sizeof(tags[0]))];
+
+			symbols.push_back("metacall_link_bench_symbol_" + std::to_string(iterator));
+
+			if (metacall_link_register(tag[0], tag[1], symbols.back().c_str(), &metacall_link_bench_symbol) != 0)
+			{
+				state.SkipWithError("Error registering the link symbols");
+				return;
+			}
+		}
+	}
+
+	state.SetLabel("MetaCall Link Benchmark - Init");
+}
+
+BENCHMARK_REGISTER_F(metacall_link_bench, init)
+	->Unit(benchmark::kMillisecond)
+	->Iterations(1)
+	->Repetitions(1);
+
+BENCHMARK_DEFINE_F(metacall_link_bench, hook)
+(benchmark::State &state)
+{
+	/* Simulate the symbol resolution of several runtimes starting at the same time */
+	for (auto _ : state)
+	{
+		for (const std::string &symbol : symbols)
+		{
+			void *ptr = metacall_link_hook(NULL, symbol.c_str());
+
+			benchmark::DoNotOptimize(ptr);
+
+			if (ptr == NULL)
+			{
+				state.SkipWithError("Link symbol not intercepted");
+				return;
+			}
+		}
+	}
+
+	state.SetItemsProcessed(state.iterations() * symbols.size());
+	state.SetLabel("MetaCall Link Benchmark - Hook");
+}
+
+BENCHMARK_REGISTER_F(metacall_link_bench, hook)
+	->Threads(1)
+	->Threads(2)
+	->Threads(4)
+	->Threads(8)
+	->UseRealTime()
+	->Unit(benchmark::kMicrosecond)
+	->Repetitions(3);
+
+BENCHMARK_DEFINE_F(metacall_link_bench, hook_register)
+(benchmark::State &state)
+{
+	static const char churn_symbol[] = "metacall_link_bench_churn";
+
+	/* The first thread keeps registering and unregistering a symbol while the others resolve symbols,
+	so the lookups run against a table that is being replaced at the same time */
+	if (state.thread_index() == 0)
+	{
+		for (auto _ : state)
+		{
+			if (metacall_link_register("py", "python", churn_symbol, &metacall_link_bench_symbol) != 0 ||
+				metacall_link_unregister("py", "python", churn_symbol) != 0)
+			{
+				state.SkipWithError("Error registering the churn symbol");
+				return;
+			}
+		}
+
+		state.SetItemsProcessed(state.iterations() * 2);
+	}
+	else
+	{
+		for (auto _ : state)
+		{
+			for (const std::string &symbol : symbols)
+			{
+				void *ptr = metacall_link_hook(NULL, symbol.c_str());
+
+				benchmark::DoNotOptimize(ptr);
+
+				if (ptr == NULL)
+				{
+					state.SkipWithError("Link symbol lost while registering other symbols");
+					return;
+				}
+			}
+
+			void *churn = metacall_link_hook(NULL, churn_symbol);
+
+			benchmark::DoNotOptimize(churn);
+		}
+
+		state.SetItemsProcessed(state.iterations() * (symbols.size() + 1));
+	}
+
+	state.SetLabel("MetaCall Link Benchmark - Hook While Registering");
+}
+
+BENCHMARK_REGISTER_F(metacall_link_bench, hook_register)
+	->Threads(2)
+	->Threads(4)
+	->Threads(8)
+	->UseRealTime()
+	->Unit(benchmark::kMicrosecond)
+	->Repetitions(3);
+
+BENCHMARK_DEFINE_F(metacall_link_bench, destroy)
+(benchmark::State &state)
+{
+	for (auto _ : state)
+	{
+		metacall_destroy();
+	}
+
+	state.SetLabel("MetaCall Link Benchmark - Destroy");
+}
+
+BENCHMARK_REGISTER_F(metacall_link_bench, destroy)
+	->Unit(benchmark::kMillisecond)
+	->Iterations(1)
+	->Repetitions(1);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,259 @@
+/*
+ *	MetaCall Library by Parra Studios
+ *	A library for providing a foreign function interface calls.
+ *
+ *	Copyright (C) 2016 - 2026 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <metacall/metacall.h>
+
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+class metacall_msgpack_serial_bench : public benchmark::Fixture
+{
+public:
+	void SetUp(benchmark::State &state)
+	{
+		static const char *const keys[] = { "id", "name", "score", "ratio", "payload", "tags" };
+
+		const size_t size = static_cast<size_t>(state.range(0));
+
+		unsigned char payload[0x40];
+
+		for (size_t iterator = 0; iterator < sizeof(payload); ++iterator)
+		{
+			payload[iterator] = static_cast<unsigned char>(iterator * 7);
+		}
+
+		/* Generate an array of records with numbers, strings, buffers and nested arrays */
+		v = metacall_value_create_array(NULL, size);
+
+		void **records = metacall_value_to_array(v);
+
+		for (size_t iterator = 0; iterator < size; ++iterator)
+		{
+			const std::string name = "record_" + std::to_string(iterator);
+
+			const void *tags[] = {
+				metacall_value_create_string("a", 1),
+				metacall_value_create_string("b", 1)
+			};
+
+			void *values[] = {
+				metacall_value_create_int(static_cast<int>(iterator)),
+				metacall_value_create_string(name.c_str(), name.length()),
+				metacall_value_create_double(static_cast<double>(iterator) / 3.0),
+				metacall_value_create_float(static_cast<float>(iterator) / 7.0f),
+				metacall_value_create_buffer(payload, sizeof(payload)),
+				metacall_value_create_array(tags, sizeof(tags) / sizeof(tags[0]))
+			};
+
+			records[iterator] = metacall_value_create_map(NULL, sizeof(keys) / sizeof(keys[0]));
+
+			void **tuples = metacall_value_to_map(records[iterator]);
+
+			for (size_t index = 0; index < sizeof(keys) / sizeof(keys[0]); ++index)
+			{
+				const void *tupla[] = {
+					metacall_value_create_string(keys[index], strlen(keys[index])),
+					values[index]
+				};
+
+				tuples[index] = metacall_value_create_array(tupla, 2);
+			}
+		}
+	}
+
+	void TearDown(benchmark::State &)
+	{
+		metacall_value_destroy(v);
+	}
+
+	void Serialize(benchmark::State &state, const char *name)
+	{
+		struct metacall_allocator_std_type std_ctx = { &std::malloc, &std::realloc, &std::free };
+
+		void *allocator = metacall_allocator_create(METACALL_ALLOCATOR_STD, (void *)&std_ctx);
+
+		size_t size = 0;
+
+		for (auto _ : state)
+		{
+			char *buffer = metacall_serialize(name, v, &size, allocator);
+
+			if (buffer == NULL)
+			{
+				state.SkipWithError("Error serializing the value");
+				break;
+			}
+
+			benchmark::DoNotOptimize(buffer);
+
+			metacall_allocator_free(allocator, buffer);
+		}
+
+		metacall_allocator_destroy(allocator);
+
+		state.counters["size"] = static_cast<double>(size);
+		state.SetBytesProcessed(state.iterations() * size);
+	}
+
+	void Deserialize(benchmark::State &state, const char *name)
+	{
+		struct metacall_allocator_std_type std_ctx = { &std::malloc, &std::realloc, &std::free };
+
+		void *allocator = metacall_allocator_create(METACALL_ALLOCATOR_STD, (void *)&std_ctx);
+
+		size_t size = 0;
+
+		char *buffer = metacall_serialize(name, v, &size, allocator);
+
+		if (buffer == NULL)
+		{
+			state.SkipWithError("Error serializing the value");
+			metacall_allocator_destroy(allocator);
+			return;
+		}
+
+		for (auto _ : state)
+		{
+			void *result = metacall_deserialize(name, buffer, size, allocator);
+
+			if (result == NULL)
+			{
+				state.SkipWithError("Error deserializing the buffer");
+				break;
+			}
+
+			state.PauseTiming();
+			metacall_value_destroy(result);
+			state.ResumeTiming();
+		}
+
+		metacall_allocator_free(allocator, buffer);
+
+		metacall_allocator_destroy(allocator);
+
+		state.counters["size"] = static_cast<double>(size);
+		state.SetBytesProcessed(state.iterations() * size);
+	}
+
+	void *v;
+};
+
+BENCHMARK_DEFINE_F(metacall_msgpack_serial_bench, init)
+(benchmark::State &state)
+{
+	for (auto _ : state)
+	{
+		metacall_log_null();
+
+		if (metacall_initialize() != 0)
+		{
+			state.SkipWithError("Error initializing MetaCall");
+			return;
+		}
+	}
+
+	state.SetLabel("MetaCall MessagePack Serial Benchmark - Init");
+}
+
+BENCHMARK_REGISTER_F(metacall_msgpack_serial_bench, init)
+	->Unit(benchmark::kMillisecond)
+	->Arg(0)
+	->Iterations(1)
+	->Repetitions(1);
+
+BENCHMARK_DEFINE_F(metacall_msgpack_serial_bench, msgpack_serialize)
+(benchmark::State &state)
+{
+	Serialize(state, "msgpack");
+
+	state.SetLabel("MetaCall MessagePack Serial Benchmark - MessagePack Serialize");
+}
+
+BENCHMARK_REGISTER_F(metacall_msgpack_serial_bench, msgpack_serialize)
+	->Unit(benchmark::kMicrosecond)
+	->Arg(1 << 4)
+	->Arg(1 << 10)
+	->Arg(1 << 14);
+
+BENCHMARK_DEFINE_F(metacall_msgpack_serial_bench, msgpack_deserialize)
+(benchmark::State &state)
+{
+	Deserialize(state, "msgpack");
+
+	state.SetLabel("MetaCall MessagePack Serial Benchmark - MessagePack Deserialize");
+}
+
+BENCHMARK_REGISTER_F(metacall_msgpack_serial_bench, msgpack_deserialize)
+	->Unit(benchmark::kMicrosecond)
+	->Arg(1 << 4)
+	->Arg(1 << 10)
+	->Arg(1 << 14);
+
+#if defined(METACALL_MSGPACK_SERIAL_BENCH_JSON)
+BENCHMARK_DEFINE_F(metacall_msgpack_serial_bench, json_serialize)
+(benchmark::State &state)
+{
+	Serialize(state, "rapid_json");
+
+	state.SetLabel("MetaCall MessagePack Serial Benchmark - JSON Serialize");
+}
+
+BENCHMARK_REGISTER_F(metacall_msgpack_serial_bench, json_serialize)
+	->Unit(benchmark::kMicrosecond)
+	->Arg(1 << 4)
+	->Arg(1 << 10)
+	->Arg(1 << 14);
+
+BENCHMARK_DEFINE_F(metacall_msgpack_serial_bench, json_deserialize)
+(benchmark::State &state)
+{
+	Deserialize(state, "rapid_json");
+
+	state.SetLabel("MetaCall MessagePack Serial Benchmark - JSON Deserialize");
+}
+
+BENCHMARK_REGISTER_F(metacall_msgpack_serial_bench, json_deserialize)
+	->Unit(benchmark::kMicrosecond)
+	->Arg(1 << 4)
+	->Arg(1 << 10)
+	->Arg(1 << 14);
+#endif
+
+BENCHMARK_DEFINE_F(metacall_msgpack_serial_bench, destroy)
+(benchmark::State &state)
+{
+	for (auto _ : state)
+	{
+		metacall_destroy();
+	}
+
+	state.SetLabel("MetaCall MessagePack Serial Benchmark - Destroy");
+}
+
+BENCHMARK_REGISTER_F(metacall_msgpack_serial_bench, destroy)
+	->Unit(benchmark::kMillisecond)
+	->Arg(0)
+	->Iterations(1)
+	->Repetitions(1);
+
+BENCHMARK_MAIN();
@@ -222,6 +222,82 @@ BENCHMARK_REGISTER_F(metacall_node_call_bench, call_async)
 	->Iterations(1)
 	->Repetitions(3);
 
+BENCHMARK_DEFINE_F(metacall_node_call_bench, call_port_by_name)
+(benchmark::State &state)
+{
+	const int64_t call_count = 100000;
+	const int64_t call_size = sizeof(double) * 3; // (double, double) -> double
+
+	for (auto _ : state)
+	{
+/* NodeJS */
+#if defined(OPTION_BUILD_LOADERS_NODE)
+		{
+			// The loop is executed in JavaScript, each call looks up the function by name through the port
+			void *ret = metacall("port_call_port_by_name", (double)call_count);
+
+			state.PauseTiming();
+
+			if (ret == NULL || metacall_value_to_double(ret) != 0.0)
+			{
+				state.SkipWithError("Invalid return value from port_call_port_by_name");
+			}
+
+			metacall_value_destroy(ret);
+
+			state.ResumeTiming();
+		}
+#endif /* OPTION_BUILD_LOADERS_NODE */
+	}
+
+	state.SetLabel("MetaCall NodeJS Call Benchmark - Port Call By Name");
+	state.SetBytesProcessed(call_size * call_count);
+	state.SetItemsProcessed(call_count);
+}
+
+BENCHMARK_REGISTER_F(metacall_node_call_bench, call_port_by_name)
+	->Unit(benchmark::kMillisecond)
+	->Iterations(1)
+	->Repetitions(3);
+
+BENCHMARK_DEFINE_F(metacall_node_call_bench, call_port_by_handle)
+(benchmark::State &state)
+{
+	const int64_t call_count = 100000;
+	const int64_t call_size = sizeof(double) * 3; // (double, double) -> double
+
+	for (auto _ : state)
+	{
+/* NodeJS */
+#if defined(OPTION_BUILD_LOADERS_NODE)
+		{
+			// The loop is executed in JavaScript, the function is looked up once and called through its handle
+			void *ret = metacall("port_call_port_by_handle", (double)call_count);
+
+			state.PauseTiming();
+
+			if (ret == NULL || metacall_value_to_double(ret) != 0.0)
+			{
+				state.SkipWithError("Invalid return value from port_call_port_by_handle");
+			}
+
+			metacall_value_destroy(ret);
+
+			state.ResumeTiming();
+		}
+#endif /* OPTION_BUILD_LOADERS_NODE */
+	}
+
+	state.SetLabel("MetaCall NodeJS Call Benchmark - Port Call By Handle");
+	state.SetBytesProcessed(call_size * call_count);
+	state.SetItemsProcessed(call_count);
+}
+
+BENCHMARK_REGISTER_F(metacall_node_call_bench, call_port_by_handle)
+	->Unit(benchmark::kMillisecond)
+	->Iterations(1)
+	->Repetitions(3);
+
 /* TODO: NodeJS re-initialization */
 /* BENCHMARK_MAIN(); */
 
@@ -265,8 +341,20 @@ int main(int argc, char **argv)
 			"	};\n"
 			"	console.log(memoryUsage);\n"
 			"}\n"
+			"const { metacall, metacall_function } = require('" METACALL_NODE_PORT_PATH "');\n"
 			"module.exports = {\n"
 			"	mem_check,\n"
+			"	port_call_by_name: (count) => {\n"
+			"		let result = 0;\n"
+			"		for (let i = 0; i < count; ++i) result += metacall('int_mem_type', 0, 0);\n"
+			"		return result;\n"
+			"	},\n"
+			"	port_call_by_handle: (count) => {\n"
+			"		const int_mem_type = metacall_function('int_mem_type');\n"
+			"		let result = 0;\n"
+			"		for (let i = 0; i < count; ++i) result += int_mem_type(0, 0);\n"
+			"		return result;\n"
+			"	},\n"
 			"	int_mem_type: (left, right) => 0,\n"
 			"	int_mem_async_type: async (left, right) => new Promise(resolve => 0),\n"
 			"};\n";
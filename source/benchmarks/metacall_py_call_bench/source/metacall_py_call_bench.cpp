@@ -136,6 +136,82 @@ BENCHMARK_REGISTER_F(metacall_py_call_bench, call_array_args)
 	->Iterations(1)
 	->Repetitions(5);
 
+BENCHMARK_DEFINE_F(metacall_py_call_bench, call_port_by_name)
+(benchmark::State &state)
+{
+	const int64_t call_count = 100000;
+	const int64_t call_size = sizeof(long) * 3; // (long, long) -> long
+
+	for (auto _ : state)
+	{
+/* Python */
+#if defined(OPTION_BUILD_LOADERS_PY)
+		{
+			// The loop is executed in Python, each call looks up the function by name through the port
+			void *ret = metacall("port_call_by_name", (long)call_count);
+
+			state.PauseTiming();
+
+			if (ret == NULL || metacall_value_to_long(ret) != 0L)
+			{
+				state.SkipWithError("Invalid return value from port_call_by_name");
+			}
+
+			metacall_value_destroy(ret);
+
+			state.ResumeTiming();
+		}
+#endif /* OPTION_BUILD_LOADERS_PY */
+	}
+
+	state.SetLabel("MetaCall Python Call Benchmark - Port Call By Name");
+	state.SetBytesProcessed(call_size * call_count);
+	state.SetItemsProcessed(call_count);
+}
+
+BENCHMARK_REGISTER_F(metacall_py_call_bench, call_port_by_name)
+	->Unit(benchmark::kMillisecond)
+	->Iterations(1)
+	->Repetitions(5);
+
+BENCHMARK_DEFINE_F(metacall_py_call_bench, call_port_by_handle)
+(benchmark::State &state)
+{
+	const int64_t call_count = 100000;
+	const int64_t call_size = sizeof(long) * 3; // (long, long) -> long
+
+	for (auto _ : state)
+	{
+/* Python */
+#if defined(OPTION_BUILD_LOADERS_PY)
+		{
+			// The loop is executed in Python, the function is looked up once and called through its handle
+			void *ret = metacall("port_call_by_handle", (long)call_count);
+
+			state.PauseTiming();
+
+			if (ret == NULL || metacall_value_to_long(ret) != 0L)
+			{
+				state.SkipWithError("Invalid return value from port_call_by_handle");
+			}
+
+			metacall_value_destroy(ret);
+
+			state.ResumeTiming();
+		}
+#endif /* OPTION_BUILD_LOADERS_PY */
+	}
+
+	state.SetLabel("MetaCall Python Call Benchmark - Port Call By Handle");
+	state.SetBytesProcessed(call_size * call_count);
+	state.SetItemsProcessed(call_count);
+}
+
+BENCHMARK_REGISTER_F(metacall_py_call_bench, call_port_by_handle)
+	->Unit(benchmark::kMillisecond)
+	->Iterations(1)
+	->Repetitions(5);
+
 /* Use main for initializing MetaCall once. There's a bug in Python async which prevents reinitialization */
 /* https://github.com/python/cpython/issues/89425 */
 /* https://bugs.python.org/issue45262 */
@@ -161,10 +237,32 @@ int main(int argc, char *argv[])
 			"def int_mem_type(left: int, right: int) -> int:\n"
 			"\treturn 0;";
 
+		static const char port_call[] =
+			"#!/usr/bin/env python3\n"
+			"import sys\n"
+			"sys.path.insert(0, '" METACALL_PYTHON_PORT_PATH "')\n"
+			"from metacall import metacall, metacall_function\n"
+			"def port_call_by_name(count: int) -> int:\n"
+			"\tresult = 0\n"
+			"\tfor _ in range(count):\n"
+			"\t\tresult += metacall('int_mem_type', 0, 0)\n"
+			"\treturn result\n"
+			"def port_call_by_handle(count: int) -> int:\n"
+			"\tint_mem_type = metacall_function('int_mem_type')\n"
+			"\tresult = 0\n"
+			"\tfor _ in range(count):\n"
+			"\t\tresult += int_mem_type(0, 0)\n"
+			"\treturn result\n";
+
 		if (metacall_load_from_memory(tag, int_mem_type, sizeof(int_mem_type), NULL) != 0)
 		{
 			return 2;
 		}
+
+		if (metacall_load_from_memory(tag, port_call, sizeof(port_call), NULL) != 0)
+		{
+			return 2;
+		}
 	}
 #endif /* OPTION_BUILD_LOADERS_PY */
 
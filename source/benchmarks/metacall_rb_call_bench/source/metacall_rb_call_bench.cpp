@@ -136,6 +136,70 @@ BENCHMARK_REGISTER_F(metacall_rb_call_bench, call_array_args)
 	->Iterations(1)
 	->Repetitions(5);
 
+BENCHMARK_DEFINE_F(metacall_rb_call_bench, call_threads)
+(benchmark::State &state)
+{
+	const int64_t call_count = 100000;
+	const int64_t call_size = sizeof(int) * 3; // (int, int) -> int
+	const int64_t thread_count = state.range(0);
+
+	for (auto _ : state)
+	{
+/* Ruby calling into Python */
+#if defined(OPTION_BUILD_LOADERS_RB) && defined(OPTION_BUILD_LOADERS_PY)
+		{
+			state.PauseTiming();
+
+			void *args[2] = {
+				metacall_value_create_long((long)thread_count),
+				metacall_value_create_long((long)(call_count / thread_count))
+			};
+
+			state.ResumeTiming();
+
+			/* Each Ruby thread calls int_mem_type_py through the port, which releases the GVL while Python runs,
+			so the other Ruby threads can prepare their next call meanwhile */
+			void *ret = metacallv("int_mem_type_threads", args);
+
+			state.PauseTiming();
+
+			if (ret == NULL)
+			{
+				state.SkipWithError("Null return value from int_mem_type_threads");
+			}
+
+			if (metacall_value_to_int(ret) != 0)
+			{
+				state.SkipWithError("Invalid return value from int_mem_type_threads");
+			}
+
+			metacall_value_destroy(ret);
+
+			for (auto arg : args)
+			{
+				metacall_value_destroy(arg);
+			}
+
+			state.ResumeTiming();
+		}
+#endif /* OPTION_BUILD_LOADERS_RB && OPTION_BUILD_LOADERS_PY */
+	}
+
+	state.SetLabel("MetaCall Ruby Call Benchmark - Multiple Thread Call");
+	state.SetBytesProcessed(call_size * call_count);
+	state.SetItemsProcessed(call_count);
+}
+
+BENCHMARK_REGISTER_F(metacall_rb_call_bench, call_threads)
+	->Unit(benchmark::kMillisecond)
+	->Arg(1)
+	->Arg(2)
+	->Arg(4)
+	->Arg(8)
+	->UseRealTime()
+	->Iterations(1)
+	->Repetitions(5);
+
 /* Use main for initializing MetaCall once. There's a bug in Ruby 3.2 on MacOS which prevents reinitialization */
 /*
 	Stack trace (most recent call last):
@@ -179,6 +243,11 @@ int main(int argc, char *argv[])
 			"#!/usr/bin/env ruby\n"
 			"def int_mem_type(left: Fixnum, right: Fixnum)\n"
 			"\treturn 0\n"
+			"end\n"
+			"def int_mem_type_threads(threads, calls)\n"
+			"\tworkers = Array.new(threads) { Thread.new { calls.times { MetaCallRbLoaderPort.metacall('int_mem_type_py', 0, 0) } } }\n"
+			"\tworkers.each(&:join)\n"
+			"\treturn 0\n"
 			"end\n";
 
 		if (metacall_load_from_memory(tag, int_mem_type, sizeof(int_mem_type), NULL) != 0)
@@ -188,6 +257,23 @@ int main(int argc, char *argv[])
 	}
 #endif /* OPTION_BUILD_LOADERS_RB */
 
+/* Python */
+#if defined(OPTION_BUILD_LOADERS_PY)
+	{
+		static const char tag[] = "py";
+
+		static const char int_mem_type_py[] =
+			"#!/usr/bin/env python3\n"
+			"def int_mem_type_py(left: int, right: int) -> int:\n"
+			"\treturn 0\n";
+
+		if (metacall_load_from_memory(tag, int_mem_type_py, sizeof(int_mem_type_py), NULL) != 0)
+		{
+			return 2;
+		}
+	}
+#endif /* OPTION_BUILD_LOADERS_PY */
+
 	::benchmark::Initialize(&argc, argv);
 
 	if (::benchmark::ReportUnrecognizedArguments(argc, argv))
@@ -0,0 +1,163 @@
+/*
+ *	MetaCall Library by Parra Studios
+ *	A library for providing a foreign function interface calls.
+ *
+ *	Copyright (C) 2016 - 2026 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <metacall/metacall.h>
+
+#include <cstdlib>
+#include <string>
+
+class metacall_serial_bench : public benchmark::Fixture
+{
+public:
+	void SetUp(benchmark::State &state)
+	{
+		const size_t size = static_cast<size_t>(state.range(0));
+
+		/* Generate an array of records until it reaches the size of the document */
+		document.clear();
+		document.reserve(size + 0x100);
+		document += '[';
+
+		for (size_t iterator = 0; document.size() < size; ++iterator)
+		{
+			const std::string id = std::to_string(iterator);
+
+			if (iterator > 0)
+			{
+				document += ',';
+			}
+
+			document += "{\"id\":" + id + ",\"name\":\"record_" + id + "\",\"score\":" + id + ".5,\"active\":true,\"tags\":[\"a\",\"b\",null]}";
+		}
+
+		document += ']';
+	}
+
+	void TearDown(benchmark::State &)
+	{
+		document.clear();
+		document.shrink_to_fit();
+	}
+
+	void Parse(benchmark::State &state, const char *name)
+	{
+		struct metacall_allocator_std_type std_ctx = { &std::malloc, &std::realloc, &std::free };
+
+		void *allocator = metacall_allocator_create(METACALL_ALLOCATOR_STD, (void *)&std_ctx);
+
+		for (auto _ : state)
+		{
+			/* The size includes the null terminator */
+			void *v = metacall_deserialize(name, document.c_str(), document.size() + 1, allocator);
+
+			if (v == NULL)
+			{
+				state.SkipWithError("Error parsing the document");
+				break;
+			}
+
+			state.PauseTiming();
+			metacall_value_destroy(v);
+			state.ResumeTiming();
+		}
+
+		metacall_allocator_destroy(allocator);
+
+		state.SetBytesProcessed(state.iterations() * document.size());
+	}
+
+	std::string document;
+};
+
+BENCHMARK_DEFINE_F(metacall_serial_bench, init)
+(benchmark::State &state)
+{
+	for (auto _ : state)
+	{
+		metacall_log_null();
+
+		if (metacall_initialize() != 0)
+		{
+			state.SkipWithError("Error initializing MetaCall");
+			return;
+		}
+	}
+
+	state.SetLabel("MetaCall Serial Benchmark - Init");
+}
+
+BENCHMARK_REGISTER_F(metacall_serial_bench, init)
+	->Unit(benchmark::kMillisecond)
+	->Arg(0)
+	->Iterations(1)
+	->Repetitions(1);
+
+BENCHMARK_DEFINE_F(metacall_serial_bench, rapid_json_parse)
+(benchmark::State &state)
+{
+	Parse(state, "rapid_json");
+
+	state.SetLabel("MetaCall Serial Benchmark - RapidJSON Parse");
+}
+
+BENCHMARK_REGISTER_F(metacall_serial_bench, rapid_json_parse)
+	->Unit(benchmark::kMillisecond)
+	->Arg(1 << 10)	  /* 1KB */
+	->Arg(1 << 16)	  /* 64KB */
+	->Arg(1 << 20)	  /* 1MB */
+	->Arg(1 << 24)	  /* 16MB */
+	->Arg(100 << 20); /* 100MB */
+
+BENCHMARK_DEFINE_F(metacall_serial_bench, simd_json_parse)
+(benchmark::State &state)
+{
+	Parse(state, "simd_json");
+
+	state.SetLabel("MetaCall Serial Benchmark - simdjson Parse");
+}
+
+BENCHMARK_REGISTER_F(metacall_serial_bench, simd_json_parse)
+	->Unit(benchmark::kMillisecond)
+	->Arg(1 << 10)	  /* 1KB */
+	->Arg(1 << 16)	  /* 64KB */
+	->Arg(1 << 20)	  /* 1MB */
+	->Arg(1 << 24)	  /* 16MB */
+	->Arg(100 << 20); /* 100MB */
+
+BENCHMARK_DEFINE_F(metacall_serial_bench, destroy)
+(benchmark::State &state)
+{
+	for (auto _ : state)
+	{
+		metacall_destroy();
+	}
+
+	state.SetLabel("MetaCall Serial Benchmark - Destroy");
+}
+
+BENCHMARK_REGISTER_F(metacall_serial_bench, destroy)
+	->Unit(benchmark::kMillisecond)
+	->Arg(0)
+	->Iterations(1)
+	->Repetitions(1);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,173 @@
+/*
+ *	MetaCall Library by Parra Studios
+ *	A library for providing a foreign function interface calls.
+ *
+ *	Copyright (C) 2016 - 2026 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <metacall/metacall.h>
+#include <metacall/metacall_fork.h>
+#include <metacall/metacall_loaders.h>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+static const char tag[] = "py";
+
+/* The imports simulate the startup cost of a worker script */
+static const char py_script[] =
+	"#!/usr/bin/env python3\n"
+	"import asyncio, decimal, email.parser, json\n"
+	"def py_worker(left: int, right: int) -> int:\n"
+	"\treturn left + right;";
+
+static int metacall_spawn_worker_bench_call(void)
+{
+	void *ret = metacall("py_worker", 1, 2);
+	int result = (ret != NULL && metacall_value_to_long(ret) == 3) ? 0 : 1;
+
+	metacall_value_destroy(ret);
+
+	return result;
+}
+
+static int metacall_spawn_worker_bench_wait(pid_t pid)
+{
+	int status = 0;
+
+	if (pid == -1 || waitpid(pid, &status, 0) != pid)
+	{
+		return 1;
+	}
+
+	return (WIFEXITED(status) && WEXITSTATUS(status) == 0) ? 0 : 1;
+}
+
+class metacall_spawn_worker_bench : public benchmark::Fixture
+{
+public:
+};
+
+BENCHMARK_DEFINE_F(metacall_spawn_worker_bench, cold)
+(benchmark::State &state)
+{
+	/* Each worker initializes MetaCall and loads the scripts by itself */
+	for (auto _ : state)
+	{
+		pid_t pid = fork();
+
+		if (pid == 0)
+		{
+			metacall_log_null();
+
+			if (metacall_initialize() != 0 || metacall_load_from_memory(tag, py_script, sizeof(py_script), NULL) != 0)
+			{
+				_exit(1);
+			}
+
+			_exit(metacall_spawn_worker_bench_call());
+		}
+
+		if (metacall_spawn_worker_bench_wait(pid) != 0)
+		{
+			state.SkipWithError("Error running the cold worker");
+			return;
+		}
+	}
+
+	state.SetLabel("MetaCall Spawn Worker Benchmark - Cold");
+}
+
+BENCHMARK_REGISTER_F(metacall_spawn_worker_bench, cold)
+	->Unit(benchmark::kMillisecond)
+	->Iterations(10)
+	->Repetitions(3);
+
+BENCHMARK_DEFINE_F(metacall_spawn_worker_bench, init)
+(benchmark::State &state)
+{
+	for (auto _ : state)
+	{
+		metacall_log_null();
+
+		if (metacall_initialize() != 0)
+		{
+			state.SkipWithError("Error initializing MetaCall");
+			return;
+		}
+
+		if (metacall_load_from_memory(tag, py_script, sizeof(py_script), NULL) != 0)
+		{
+			state.SkipWithError("Error loading py_worker function");
+			return;
+		}
+	}
+
+	state.SetLabel("MetaCall Spawn Worker Benchmark - Init");
+}
+
+BENCHMARK_REGISTER_F(metacall_spawn_worker_bench, init)
+	->Unit(benchmark::kMillisecond)
+	->Iterations(1)
+	->Repetitions(1);
+
+BENCHMARK_DEFINE_F(metacall_spawn_worker_bench, spawn)
+(benchmark::State &state)
+{
+	/* Each worker is forked from the initialized template and calls directly */
+	for (auto _ : state)
+	{
+		metacall_pid pid = metacall_spawn_worker();
+
+		if (pid == 0)
+		{
+			_exit(metacall_spawn_worker_bench_call());
+		}
+
+		if (metacall_spawn_worker_bench_wait(pid) != 0)
+		{
+			state.SkipWithError("Error running the spawned worker");
+			return;
+		}
+	}
+
+	state.SetLabel("MetaCall Spawn Worker Benchmark - Spawn");
+}
+
+BENCHMARK_REGISTER_F(metacall_spawn_worker_bench, spawn)
+	->Unit(benchmark::kMillisecond)
+	->Iterations(10)
+	->Repetitions(3);
+
+BENCHMARK_DEFINE_F(metacall_spawn_worker_bench, destroy)
+(benchmark::State &state)
+{
+	for (auto _ : state)
+	{
+		metacall_destroy();
+	}
+
+	state.SetLabel("MetaCall Spawn Worker Benchmark - Destroy");
+}
+
+BENCHMARK_REGISTER_F(metacall_spawn_worker_bench, destroy)
+	->Unit(benchmark::kMillisecond)
+	->Iterations(1)
+	->Repetitions(1);
+
+BENCHMARK_MAIN();
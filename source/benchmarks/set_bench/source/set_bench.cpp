@@ -144,4 +144,164 @@ BENCHMARK_REGISTER_F(set_bench, set_iterators_2)
 	->Iterations(ITERATIONS)
 	->Repetitions(3);
 
+class set_size_bench : public benchmark::Fixture
+{
+public:
+	void SetUp(benchmark::State &state)
+	{
+		const size_t size = (size_t)state.range(0);
+
+		keys.resize(size);
+		values.resize(size);
+
+		for (size_t i = 0; i < size; ++i)
+		{
+			keys[i] = std::to_string(i);
+			values[i] = (int)i;
+		}
+	}
+
+	void TearDown(benchmark::State &)
+	{
+		keys.clear();
+		values.clear();
+	}
+
+	std::vector<std::string> keys;
+	std::vector<int> values;
+};
+
+BENCHMARK_DEFINE_F(set_size_bench, set_insert)
+(benchmark::State &state)
+{
+	const size_t size = keys.size();
+
+	for (auto _ : state)
+	{
+		set s = set_create(&hash_callback_str, &comparable_callback_str);
+
+		for (size_t i = 0; i < size; ++i)
+		{
+			set_insert(s, (set_key)keys[i].c_str(), &values[i]);
+		}
+
+		set_destroy(s);
+	}
+
+	state.SetLabel("Set Benchmark - Insert");
+	state.SetItemsProcessed(state.iterations() * size);
+}
+
+BENCHMARK_REGISTER_F(set_size_bench, set_insert)
+	->Unit(benchmark::kMillisecond)
+	->RangeMultiplier(10)
+	->Range(1000, 1000000);
+
+BENCHMARK_DEFINE_F(set_size_bench, set_get)
+(benchmark::State &state)
+{
+	const size_t size = keys.size();
+	set s = set_create(&hash_callback_str, &comparable_callback_str);
+	uint64_t sum = 0;
+
+	for (size_t i = 0; i < size; ++i)
+	{
+		set_insert(s, (set_key)keys[i].c_str(), &values[i]);
+	}
+
+	for (auto _ : state)
+	{
+		for (size_t i = 0; i < size; ++i)
+		{
+			int *value = (int *)set_get(s, (set_key)keys[i].c_str());
+
+			sum += (uint64_t)(*value);
+		}
+	}
+
+	benchmark::DoNotOptimize(sum);
+
+	set_destroy(s);
+
+	state.SetLabel("Set Benchmark - Get");
+	state.SetItemsProcessed(state.iterations() * size);
+}
+
+BENCHMARK_REGISTER_F(set_size_bench, set_get)
+	->Unit(benchmark::kMillisecond)
+	->RangeMultiplier(10)
+	->Range(1000, 1000000);
+
+BENCHMARK_DEFINE_F(set_size_bench, set_get_miss)
+(benchmark::State &state)
+{
+	const size_t size = keys.size();
+	set s = set_create(&hash_callback_str, &comparable_callback_str);
+	std::vector<std::string> missing(size);
+	uint64_t found = 0;
+
+	for (size_t i = 0; i < size; ++i)
+	{
+		set_insert(s, (set_key)keys[i].c_str(), &values[i]);
+		missing[i] = "missing_" + keys[i];
+	}
+
+	for (auto _ : state)
+	{
+		for (size_t i = 0; i < size; ++i)
+		{
+			found += (uint64_t)(set_get(s, (set_key)missing[i].c_str()) != NULL);
+		}
+	}
+
+	benchmark::DoNotOptimize(found);
+
+	set_destroy(s);
+
+	state.SetLabel("Set Benchmark - Get Miss");
+	state.SetItemsProcessed(state.iterations() * size);
+}
+
+BENCHMARK_REGISTER_F(set_size_bench, set_get_miss)
+	->Unit(benchmark::kMillisecond)
+	->RangeMultiplier(10)
+	->Range(1000, 1000000);
+
+BENCHMARK_DEFINE_F(set_size_bench, set_iterate)
+(benchmark::State &state)
+{
+	const size_t size = keys.size();
+	set s = set_create(&hash_callback_str, &comparable_callback_str);
+	uint64_t sum = 0;
+
+	for (size_t i = 0; i < size; ++i)
+	{
+		set_insert(s, (set_key)keys[i].c_str(), &values[i]);
+	}
+
+	for (auto _ : state)
+	{
+		set_iterator_type it;
+
+		for (set_iterator_begin(&it, s); set_iterator_end(&it) > 0; set_iterator_next(&it))
+		{
+			int *i = (int *)set_iterator_value(&it);
+
+			sum += ((uint64_t)(*i));
+		}
+	}
+
+	benchmark::DoNotOptimize(sum);
+
+	set_destroy(s);
+
+	state.SetLabel("Set Benchmark - Iterate");
+	state.SetItemsProcessed(state.iterations() * size);
+}
+
+BENCHMARK_REGISTER_F(set_size_bench, set_iterate)
+	->Unit(benchmark::kMillisecond)
+	->RangeMultiplier(10)
+	->Range(1000, 1000000);
+
 BENCHMARK_MAIN();
@@ -13,8 +13,6 @@
 
 #include <metacall/metacall.h>
 
-#include <condition_variable>
-#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
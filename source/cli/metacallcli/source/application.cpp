@@ -433,54 +433,16 @@ void application::run()
 
 	while (exit_condition != true)
 	{
-		std::mutex await_mutex;
-		std::condition_variable await_cond;
-		std::unique_lock<std::mutex> lock(await_mutex);
+		/* Evaluate the next command, the REPL is closed when the evaluation is rejected */
+		void *future = metacall_future_call(evaluate_func, metacall_null_args, 0);
 
-		struct await_data_type
-		{
-			void *v;
-			std::mutex &mutex;
-			std::condition_variable &cond;
-			bool exit_condition;
-		};
-
-		struct await_data_type await_data = { NULL, await_mutex, await_cond, false };
-
-		void *future = metacallfv_await_s(
-			evaluate_func, metacall_null_args, 0,
-			[](void *result, void *ctx) -> void * {
-				struct await_data_type *await_data = static_cast<struct await_data_type *>(ctx);
-				std::unique_lock<std::mutex> lock(await_data->mutex);
-				/* Value must be always copied, it gets deleted after the scope */
-				await_data->v = metacall_value_copy(result);
-				await_data->cond.notify_one();
-				return NULL;
-			},
-			[](void *result, void *ctx) -> void * {
-				struct await_data_type *await_data = static_cast<struct await_data_type *>(ctx);
-				std::unique_lock<std::mutex> lock(await_data->mutex);
-				/* Value must be always copied, it gets deleted after the scope */
-				await_data->v = metacall_value_copy(result);
-				await_data->exit_condition = true;
-				await_data->cond.notify_one();
-				return NULL;
-			},
-			static_cast<void *>(&await_data));
-
-		await_cond.wait(lock);
-
-		/* Unused */
-		metacall_value_destroy(future);
-
-		/* Check if the loop was rejected */
-		if (await_data.exit_condition)
+		if (future == NULL || metacall_future_wait(future, -1) != 0 || metacall_future_status(future) == METACALL_FUTURE_REJECTED)
 		{
 			exit_condition = true;
 		}
 		else
 		{
-			void **results = metacall_value_to_array(await_data.v);
+			void **results = metacall_value_to_array(metacall_future_value(future));
 			void *args[2];
 
 			if (metacall_value_id(results[0]) == METACALL_EXCEPTION || metacall_value_id(results[0]) == METACALL_THROWABLE)
@@ -518,7 +480,7 @@ void application::run()
 			metacall_value_destroy(args[1]);
 		}
 
-		metacall_value_destroy(await_data.v);
+		metacall_future_destroy(future);
 	}
 
 	if (plugin_cli_handle != NULL)
@@ -0,0 +1,128 @@
+/*
+ *	MetaCall Log Decoder by Parra Studios
+ *	A command line tool for converting binary logs into text.
+ *
+ *	Copyright (C) 2016 - 2026 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+#include <log/log_policy_format_binary.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define METACALL_LOG_DECODE_CHUNK_SIZE	 ((size_t)0x00010000)
+#define METACALL_LOG_DECODE_MAX_CAPACITY ((size_t)0x04000000)
+
+static int metacall_log_decode(FILE *in, const char *name)
+{
+	size_t capacity = METACALL_LOG_DECODE_CHUNK_SIZE, length = 0;
+	char *buffer = malloc(capacity);
+
+	if (buffer == NULL)
+	{
+		fprintf(stderr, "metacalllogdecode: out of memory\n");
+		return 1;
+	}
+
+	for (;;)
+	{
+		size_t read_size = fread(&buffer[length], 1, capacity - length, in);
+		size_t decoded;
+
+		length += read_size;
+
+		decoded = log_policy_format_binary_decode(buffer, length, stdout);
+
+		/* Keep the incomplete record at the beginning of the buffer for the next chunk */
+		if (decoded > 0)
+		{
+			length -= decoded;
+			memmove(buffer, &buffer[decoded], length);
+		}
+		else if (length == capacity)
+		{
+			char *grow;
+
+			/* The record does not fit in the buffer, records bigger than the limit are considered invalid */
+			if (capacity >= METACALL_LOG_DECODE_MAX_CAPACITY || (grow = realloc(buffer, capacity << 1)) == NULL)
+			{
+				break;
+			}
+
+			buffer = grow;
+			capacity <<= 1;
+		}
+
+		if (read_size == 0)
+		{
+			break;
+		}
+	}
+
+	free(buffer);
+
+	if (ferror(in))
+	{
+		fprintf(stderr, "metacalllogdecode: error reading '%s'\n", name);
+		return 1;
+	}
+
+	if (length > 0)
+	{
+		fprintf(stderr, "metacalllogdecode: '%s' contains %lu bytes which are not a valid record\n", name, (unsigned long)length);
+		return 1;
+	}
+
+	return 0;
+}
+
+int main(int argc, char *argv[])
+{
+	int result = 0, iterator;
+
+	if (argc < 2)
+	{
+		return metacall_log_decode(stdin, "stdin");
+	}
+
+	for (iterator = 1; iterator < argc; ++iterator)
+	{
+		FILE *in;
+
+		if (strcmp(argv[iterator], "-h") == 0 || strcmp(argv[iterator], "--help") == 0)
+		{
+			printf("Usage: metacalllogdecode [file...]\n");
+			printf("Convert the records written by the binary log format into text, reads from stdin if no file is given\n");
+			return 0;
+		}
+
+		in = fopen(argv[iterator], "rb");
+
+		if (in == NULL)
+		{
+			fprintf(stderr, "metacalllogdecode: cannot open '%s'\n", argv[iterator]);
+			result = 1;
+			continue;
+		}
+
+		result |= metacall_log_decode(in, argv[iterator]);
+
+		fclose(in);
+	}
+
+	return result;
+}
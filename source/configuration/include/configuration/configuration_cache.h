@@ -0,0 +1,105 @@
+/*
+ *	Configuration Library by Parra Studios
+ *	Copyright (C) 2016 - 2026 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	A cross-platform library for managing multiple configuration formats.
+ *
+ */
+
+#ifndef CONFIGURATION_CACHE_H
+#define CONFIGURATION_CACHE_H 1
+
+/* -- Headers -- */
+
+#include <configuration/configuration_api.h>
+
+#include <reflect/reflect_value_type.h>
+
+#include <stddef.h>
+#include <time.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* -- Type Definitions -- */
+
+/*
+*  Identifies the contents of a configuration file, a cached tree is reused only
+*  while the file keeps the same size and modification time
+*/
+struct configuration_cache_stamp_type
+{
+	size_t size;
+	time_t mtime;
+	long mtime_nsec;
+};
+
+typedef struct configuration_cache_stamp_type *configuration_cache_stamp;
+
+/* -- Methods -- */
+
+/**
+*  @brief
+*    Retrieve the stamp of the regular file located in @path
+*
+*  @param[in] path
+*    Path of the configuration file
+*
+*  @param[out] stamp
+*    Stamp of the file contents
+*
+*  @return
+*    Returns zero if @path is a regular file, distinct from zero otherwise
+*
+*/
+CONFIGURATION_API int configuration_cache_stat(const char *path, configuration_cache_stamp stamp);
+
+/**
+*  @brief
+*    Retrieve a copy of the tree parsed from @path if it was parsed with the same @stamp
+*
+*  @param[in] path
+*    Path of the configuration file
+*
+*  @param[in] stamp
+*    Stamp of the file taken before reading it
+*
+*  @return
+*    Returns a new value owned by the caller on cache hit, null otherwise
+*
+*/
+CONFIGURATION_API value configuration_cache_get(const char *path, configuration_cache_stamp stamp);
+
+/**
+*  @brief
+*    Store a copy of the tree @v parsed from @path, replacing any previous entry,
+*    the cache is process wide so it survives to configuration_destroy
+*
+*  @param[in] path
+*    Path of the configuration file
+*
+*  @param[in] stamp
+*    Stamp of the file taken before reading it
+*
+*  @param[in] v
+*    Parsed tree, it is copied so the caller keeps the ownership
+*
+*  @return
+*    Returns zero on correct insertion, distinct from zero otherwise
+*
+*/
+CONFIGURATION_API int configuration_cache_insert(const char *path, configuration_cache_stamp stamp, value v);
+
+/**
+*  @brief
+*    Remove all the cached trees, it is executed at exit
+*
+*/
+CONFIGURATION_API void configuration_cache_clear(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CONFIGURATION_CACHE_H */
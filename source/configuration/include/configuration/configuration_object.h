@@ -25,6 +25,7 @@
 
 #include <configuration/configuration_api.h>
 
+#include <configuration/configuration_cache.h>
 #include <configuration/configuration_object_handle.h>
 
 #include <adt/adt_set.h>
@@ -151,16 +152,43 @@ CONFIGURATION_API configuration configuration_object_parent(configuration config
 
 /**
 *  @brief
-*    Retrieve the source of configuration object @config
+*    Retrieve the source of configuration object @config, the file is read
+*    (or mapped in memory if it is big) the first time it is requested
+*
+*  @param[in] config
+*    Pointer to configuration object
+*
+*  @param[out] size
+*    Size of the source including the null terminator (can be null)
+*
+*  @return
+*    Returns source of configuration object @config, null if it has no path or it cannot be read
+*
+*/
+CONFIGURATION_API const char *configuration_object_source(configuration config, size_t *size);
+
+/**
+*  @brief
+*    Release the source of configuration object @config once it has been parsed
+*
+*  @param[in] config
+*    Pointer to configuration object
+*
+*/
+CONFIGURATION_API void configuration_object_source_release(configuration config);
+
+/**
+*  @brief
+*    Retrieve the stamp of the file of configuration object @config taken at initialization
 *
 *  @param[in] config
 *    Pointer to configuration object
 *
 *  @return
-*    Returns source of configuration object @config
+*    Returns the stamp of configuration object @config, null if it has no path
 *
 */
-CONFIGURATION_API const char *configuration_object_source(configuration config);
+CONFIGURATION_API configuration_cache_stamp configuration_object_stamp(configuration config);
 
 /**
 *  @brief
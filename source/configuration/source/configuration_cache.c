@@ -0,0 +1,227 @@
+/*
+*	Configuration Library by Parra Studios
+*	Copyright (C) 2016 - 2026 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+*
+*	A cross-platform library for managing multiple configuration formats.
+*
+*/
+
+/* -- Headers -- */
+
+#include <configuration/configuration_cache.h>
+
+#include <adt/adt_set.h>
+
+#include <log/log.h>
+
+#include <portability/portability_atexit.h>
+
+#include <threading/threading_mutex.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <sys/stat.h>
+
+/* -- Member Data -- */
+
+struct configuration_cache_entry_type
+{
+	char *path;
+	struct configuration_cache_stamp_type stamp;
+	value v;
+};
+
+/* -- Private Variables -- */
+
+static threading_mutex_type configuration_cache_mutex = THREADING_MUTEX_INITIALIZE;
+
+static set configuration_cache_map = NULL;
+
+/* -- Private Methods -- */
+
+static int configuration_cache_stamp_compare(configuration_cache_stamp left, configuration_cache_stamp right);
+
+static void configuration_cache_entry_destroy(struct configuration_cache_entry_type *entry);
+
+/* -- Methods -- */
+
+int configuration_cache_stat(const char *path, configuration_cache_stamp stamp)
+{
+	struct stat st;
+
+	if (path == NULL || stamp == NULL || stat(path, &st) != 0)
+	{
+		return 1;
+	}
+
+	if ((st.st_mode & S_IFMT) != S_IFREG)
+	{
+		return 1;
+	}
+
+	stamp->size = (size_t)st.st_size;
+	stamp->mtime = st.st_mtime;
+
+#if defined(__linux__) || defined(__linux) || defined(__gnu_linux) || defined(__FreeBSD__)
+	stamp->mtime_nsec = (long)st.st_mtim.tv_nsec;
+#elif defined(__APPLE__) || defined(__MACH__) || defined(__MACOSX__)
+	stamp->mtime_nsec = (long)st.st_mtimespec.tv_nsec;
+#else
+	stamp->mtime_nsec = 0;
+#endif
+
+	return 0;
+}
+
+int configuration_cache_stamp_compare(configuration_cache_stamp left, configuration_cache_stamp right)
+{
+	return !(left->size == right->size && left->mtime == right->mtime && left->mtime_nsec == right->mtime_nsec);
+}
+
+void configuration_cache_entry_destroy(struct configuration_cache_entry_type *entry)
+{
+	free(entry->path);
+	value_type_destroy(entry->v);
+	free(entry);
+}
+
+value configuration_cache_get(const char *path, configuration_cache_stamp stamp)
+{
+	struct configuration_cache_entry_type *entry;
+	value v = NULL;
+
+	if (path == NULL || stamp == NULL)
+	{
+		return NULL;
+	}
+
+	threading_mutex_lock(&configuration_cache_mutex);
+
+	if (configuration_cache_map != NULL)
+	{
+		entry = set_get(configuration_cache_map, (set_key)path);
+
+		if (entry != NULL && configuration_cache_stamp_compare(&entry->stamp, stamp) == 0)
+		{
+			v = value_type_copy(entry->v);
+		}
+	}
+
+	threading_mutex_unlock(&configuration_cache_mutex);
+
+	return v;
+}
+
+int configuration_cache_insert(const char *path, configuration_cache_stamp stamp, value v)
+{
+	struct configuration_cache_entry_type *entry;
+	value cpy;
+	size_t size;
+
+	if (path == NULL || stamp == NULL || v == NULL)
+	{
+		return 1;
+	}
+
+	cpy = value_type_copy(v);
+
+	if (cpy == NULL)
+	{
+		return 1;
+	}
+
+	threading_mutex_lock(&configuration_cache_mutex);
+
+	if (configuration_cache_map == NULL)
+	{
+		configuration_cache_map = set_create(&hash_callback_str, &comparable_callback_str);
+
+		if (configuration_cache_map == NULL)
+		{
+			log_write("metacall", LOG_LEVEL_ERROR, "Invalid configuration cache allocation");
+			goto insert_error;
+		}
+
+		/* The cache outlives configuration_destroy, so it is released at exit */
+		if (portability_atexit_initialize() == 0)
+		{
+			portability_atexit_register(&configuration_cache_clear);
+		}
+	}
+
+	entry = set_get(configuration_cache_map, (set_key)path);
+
+	if (entry != NULL)
+	{
+		value_type_destroy(entry->v);
+		entry->stamp = *stamp;
+		entry->v = cpy;
+
+		threading_mutex_unlock(&configuration_cache_mutex);
+
+		return 0;
+	}
+
+	entry = malloc(sizeof(struct configuration_cache_entry_type));
+
+	if (entry == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid configuration cache entry allocation");
+		goto insert_error;
+	}
+
+	size = strlen(path) + 1;
+
+	entry->path = malloc(sizeof(char) * size);
+
+	if (entry->path == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid configuration cache entry path allocation");
+		free(entry);
+		goto insert_error;
+	}
+
+	memcpy(entry->path, path, size);
+
+	entry->stamp = *stamp;
+	entry->v = cpy;
+
+	if (set_insert(configuration_cache_map, (set_key)entry->path, entry) != 0)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid configuration cache entry insertion <%s>", path);
+		entry->v = NULL;
+		configuration_cache_entry_destroy(entry);
+		goto insert_error;
+	}
+
+	threading_mutex_unlock(&configuration_cache_mutex);
+
+	return 0;
+
+insert_error:
+	threading_mutex_unlock(&configuration_cache_mutex);
+	value_type_destroy(cpy);
+	return 1;
+}
+
+void configuration_cache_clear(void)
+{
+	threading_mutex_lock(&configuration_cache_mutex);
+
+	if (configuration_cache_map != NULL)
+	{
+		struct set_iterator_type it;
+
+		for (set_iterator_begin(&it, configuration_cache_map); set_iterator_end(&it) != 0; set_iterator_next(&it))
+		{
+			configuration_cache_entry_destroy(set_iterator_value(&it));
+		}
+
+		set_destroy(configuration_cache_map);
+
+		configuration_cache_map = NULL;
+	}
+
+	threading_mutex_unlock(&configuration_cache_mutex);
+}
@@ -8,6 +8,7 @@
 
 /* -- Headers -- */
 
+#include <configuration/configuration_cache.h>
 #include <configuration/configuration_impl.h>
 #include <configuration/configuration_singleton.h>
 
@@ -104,25 +105,51 @@ int configuration_impl_load(configuration config, void *allocator)
 	{
 		configuration current = *((configuration *)vector_front(queue));
 
-		const char *source = configuration_object_source(current);
+		const char *path = configuration_object_path(current);
 
 		value v;
 
 		vector_pop_front(queue);
 
-		if (source == NULL)
+		if (path == NULL)
 		{
 			v = value_create_map(NULL, 0);
 		}
 		else
 		{
-			v = serial_deserialize(singleton->s, source, strlen(source) + 1, (memory_allocator)allocator);
+			configuration_cache_stamp stamp = configuration_object_stamp(current);
+
+			/* Reuse the tree if the file has not changed since the last time it was parsed */
+			v = configuration_cache_get(path, stamp);
 
 			if (v == NULL)
 			{
-				log_write("metacall", LOG_LEVEL_ERROR, "Invalid configuration implementation load (childs) <%p>", current);
+				size_t size;
+
+				const char *source = configuration_object_source(current, &size);
+
+				if (source == NULL)
+				{
+					log_write("metacall", LOG_LEVEL_ERROR, "Invalid configuration implementation source read <%s>", path);
+
+					goto load_error;
+				}
+
+				v = serial_deserialize(singleton->s, source, size, (memory_allocator)allocator);
 
-				goto load_error;
+				configuration_object_source_release(current);
+
+				if (v == NULL)
+				{
+					log_write("metacall", LOG_LEVEL_ERROR, "Invalid configuration implementation load (childs) <%p>", current);
+
+					goto load_error;
+				}
+
+				if (configuration_cache_insert(path, stamp, v) != 0)
+				{
+					log_write("metacall", LOG_LEVEL_DEBUG, "Configuration %s could not be cached", path);
+				}
 			}
 		}
 
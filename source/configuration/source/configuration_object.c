@@ -8,6 +8,7 @@
 
 /* -- Headers -- */
 
+#include <configuration/configuration_cache.h>
 #include <configuration/configuration_impl.h>
 #include <configuration/configuration_object.h>
 
@@ -17,6 +18,22 @@
 
 #include <string.h>
 
+#if defined(unix) || defined(__unix__) || defined(__unix) || \
+	defined(linux) || defined(__linux__) || defined(__linux) || defined(__gnu_linux) || \
+	defined(__FreeBSD__) || \
+	(defined(__APPLE__) && defined(__MACH__)) || defined(__MACOSX__)
+
+	#define CONFIGURATION_OBJECT_MMAP 1
+
+	/* Files smaller than this are read into a buffer instead of being mapped */
+	#define CONFIGURATION_OBJECT_MMAP_SIZE ((size_t)0x100000)
+
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif
+
 /* -- Member Data -- */
 
 struct configuration_type
@@ -25,21 +42,28 @@ struct configuration_type
 	char *path;
 	set map;
 	configuration parent;
+	struct configuration_cache_stamp_type stamp;
 	char *source;
+	size_t size;
+	int mapped;
 	value v;
 };
 
 /* -- Private Methods -- */
 
-static char *configuration_object_read(const char *path);
+static char *configuration_object_read(const char *path, size_t *size);
+
+#if defined(CONFIGURATION_OBJECT_MMAP)
+static char *configuration_object_map(const char *path, configuration_cache_stamp stamp);
+#endif
 
 /* -- Methods -- */
 
-char *configuration_object_read(const char *path)
+char *configuration_object_read(const char *path, size_t *size)
 {
 	FILE *file = fopen(path, "rb");
 
-	size_t size, size_read;
+	size_t size_read;
 
 	char *buffer;
 
@@ -50,11 +74,11 @@ char *configuration_object_read(const char *path)
 
 	fseek(file, 0, SEEK_END);
 
-	size = ftell(file);
+	*size = ftell(file);
 
 	fseek(file, 0, SEEK_SET);
 
-	buffer = malloc(sizeof(char) * (size + 1));
+	buffer = malloc(sizeof(char) * (*size + 1));
 
 	if (buffer == NULL)
 	{
@@ -65,13 +89,13 @@ char *configuration_object_read(const char *path)
 		return NULL;
 	}
 
-	size_read = fread(buffer, sizeof(char), size, file);
+	size_read = fread(buffer, sizeof(char), *size, file);
 
 	fclose(file);
 
-	if (size_read != size)
+	if (size_read != *size)
 	{
-		log_write("metacall", LOG_LEVEL_ERROR, "Invalid configuration file size read (%u != %u)", size_read, size);
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid configuration file size read (%u != %u)", size_read, *size);
 
 		free(buffer);
 
@@ -83,6 +107,62 @@ char *configuration_object_read(const char *path)
 	return buffer;
 }
 
+#if defined(CONFIGURATION_OBJECT_MMAP)
+char *configuration_object_map(const char *path, configuration_cache_stamp stamp)
+{
+	long page_size = sysconf(_SC_PAGESIZE);
+	struct stat st;
+	char *source;
+	int fd;
+
+	/* A mapped file that is truncated by another process raises SIGBUS when the parser reaches
+	the missing pages, while a buffer read fails gracefully, most configurations are a few bytes
+	so copying them is cheaper than mapping, only big files are worth the mapping */
+	if (stamp->size < CONFIGURATION_OBJECT_MMAP_SIZE)
+	{
+		return NULL;
+	}
+
+	/* The serial expects a null terminated source, the kernel fills with zeros the tail of
+	the last page, so the file can be parsed in place unless it ends in a page boundary */
+	if (page_size <= 0 || (stamp->size % (size_t)page_size) == 0)
+	{
+		return NULL;
+	}
+
+	fd = open(path, O_RDONLY);
+
+	if (fd == -1)
+	{
+		return NULL;
+	}
+
+	/* The file may have been modified after the stamp was taken, in that case it is read instead */
+	if (fstat(fd, &st) != 0 || (size_t)st.st_size != stamp->size)
+	{
+		close(fd);
+		return NULL;
+	}
+
+	source = mmap(NULL, stamp->size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+	close(fd);
+
+	if (source == MAP_FAILED)
+	{
+		return NULL;
+	}
+
+	if (source[stamp->size] != '\0')
+	{
+		munmap(source, stamp->size);
+		return NULL;
+	}
+
+	return source;
+}
+#endif
+
 configuration configuration_object_initialize(const char *name, const char *path, configuration parent)
 {
 	configuration config = malloc(sizeof(struct configuration_type));
@@ -100,19 +180,18 @@ configuration configuration_object_initialize(const char *name, const char *path
 	{
 		log_write("metacall", LOG_LEVEL_DEBUG, "Trying to load configuration from %s", path);
 
-		config->source = configuration_object_read(path);
-
-		if (config->source == NULL)
+		/* The file is only checked here, it is read when the source is requested if it is not cached */
+		if (configuration_cache_stat(path, &config->stamp) != 0)
 		{
 			free(config);
 
 			return NULL;
 		}
 	}
-	else
-	{
-		config->source = NULL;
-	}
+
+	config->source = NULL;
+	config->size = 0;
+	config->mapped = 0;
 
 	name_size = strlen(name) + 1;
 
@@ -314,11 +393,61 @@ configuration configuration_object_parent(configuration config)
 	return config->parent;
 }
 
-const char *configuration_object_source(configuration config)
+const char *configuration_object_source(configuration config, size_t *size)
 {
+	if (config->source == NULL && config->path != NULL)
+	{
+#if defined(CONFIGURATION_OBJECT_MMAP)
+		config->source = configuration_object_map(config->path, &config->stamp);
+
+		if (config->source != NULL)
+		{
+			config->size = config->stamp.size;
+			config->mapped = 1;
+		}
+		else
+#endif
+		{
+			config->source = configuration_object_read(config->path, &config->size);
+		}
+	}
+
+	if (size != NULL)
+	{
+		*size = config->source != NULL ? config->size + 1 : 0;
+	}
+
 	return config->source;
 }
 
+configuration_cache_stamp configuration_object_stamp(configuration config)
+{
+	return config->path != NULL ? &config->stamp : NULL;
+}
+
+void configuration_object_source_release(configuration config)
+{
+	if (config->source == NULL)
+	{
+		return;
+	}
+
+#if defined(CONFIGURATION_OBJECT_MMAP)
+	if (config->mapped == 1)
+	{
+		munmap(config->source, config->size);
+	}
+	else
+#endif
+	{
+		free(config->source);
+	}
+
+	config->source = NULL;
+	config->size = 0;
+	config->mapped = 0;
+}
+
 value configuration_object_value(configuration config)
 {
 	return config->v;
@@ -351,10 +480,7 @@ void configuration_object_destroy(configuration config)
 		free(config->path);
 	}
 
-	if (config->source != NULL)
-	{
-		free(config->source);
-	}
+	configuration_object_source_release(config);
 
 	set_destroy(config->map);
 
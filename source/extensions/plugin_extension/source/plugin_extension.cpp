@@ -36,10 +36,253 @@ namespace fs = std::experimental::filesystem;
 	#error "C++ standard too old for compiling this file."
 #endif
 
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <random>
+#include <sstream>
 #include <string>
+#include <vector>
+
+/* The index stores the configurations found in a plugin directory and the modification time and
+number of entries of the directories scanned, so next initializations only need to check each directory
+instead of walking them, it is only used when METACALL_PLUGIN_INDEX_PATH points to a directory for it */
+static const char plugin_index_header[] = "metacall-plugin-index 3";
 
 static void *extension_loader = NULL;
 
+struct plugin_index_dir
+{
+	fs::path path;
+	long long time;
+	size_t count;
+};
+
+static bool plugin_index_stat(const fs::path &dir, long long &time, size_t &count)
+{
+	std::error_code ec;
+	fs::file_time_type current = fs::last_write_time(dir, ec);
+
+	if (ec)
+	{
+		return false;
+	}
+
+	/* The time alone is not enough in filesystems with coarse timestamps, where a directory modified
+	in the same tick as the scan keeps its time, so the number of entries is compared too */
+	fs::directory_iterator it(dir, ec);
+
+	if (ec)
+	{
+		return false;
+	}
+
+	time = static_cast<long long>(current.time_since_epoch().count());
+	count = static_cast<size_t>(std::distance(it, fs::directory_iterator()));
+
+	return true;
+}
+
+static bool plugin_index_path(const fs::path &plugin_path, fs::path &index_path)
+{
+	const char *index_env = std::getenv("METACALL_PLUGIN_INDEX_PATH");
+	std::error_code ec;
+
+	if (index_env == NULL || *index_env == '\0')
+	{
+		return false;
+	}
+
+	fs::path cache_path(index_env);
+
+	fs::create_directories(cache_path, ec);
+
+	if (ec)
+	{
+		return false;
+	}
+
+	/* The name is derived from the plugin path, the path is also stored in the index in case of collision */
+	std::ostringstream name;
+
+	name << std::hex << std::hash<std::string>()(plugin_path.string()) << ".index";
+
+	index_path = cache_path / name.str();
+
+	return true;
+}
+
+static bool plugin_index_read(const fs::path &index_path, const fs::path &plugin_path, std::vector<std::string> &configs)
+{
+	std::ifstream index(index_path);
+	std::string line;
+
+	if (!index || !std::getline(index, line) || line != plugin_index_header)
+	{
+		return false;
+	}
+
+	if (!std::getline(index, line) || line != "path " + plugin_path.string())
+	{
+		return false;
+	}
+
+	while (std::getline(index, line))
+	{
+		static const std::string dir_prefix = "dir ";
+		static const std::string config_prefix = "config ";
+
+		if (line == "end")
+		{
+			return true;
+		}
+		else if (line.compare(0, dir_prefix.size(), dir_prefix) == 0)
+		{
+			/* Format: dir <time> <count> <path> */
+			char *end = NULL;
+			long long time = std::strtoll(line.c_str() + dir_prefix.size(), &end, 10), current_time = 0;
+			size_t current_count = 0;
+
+			if (end == NULL || *end != ' ')
+			{
+				return false;
+			}
+
+			unsigned long long count = std::strtoull(end + 1, &end, 10);
+
+			if (end == NULL || *end != ' ')
+			{
+				return false;
+			}
+
+			if (plugin_index_stat(fs::path(end + 1), current_time, current_count) == false ||
+				current_time != time || current_count != count)
+			{
+				return false;
+			}
+		}
+		else if (line.compare(0, config_prefix.size(), config_prefix) == 0)
+		{
+			configs.push_back(line.substr(config_prefix.size()));
+		}
+		else
+		{
+			return false;
+		}
+	}
+
+	/* The index was not completely written */
+	return false;
+}
+
+static void plugin_index_write(const fs::path &index_path, const fs::path &plugin_path, const std::vector<plugin_index_dir> &dirs, const std::vector<std::string> &configs)
+{
+	/* The index is written into a temporary file and then renamed, so other processes
+	reading or writing the same index concurrently never observe a partial file */
+	std::ostringstream suffix;
+	std::random_device random;
+	std::error_code ec;
+
+	suffix << ".tmp" << std::hex << random();
+
+	fs::path tmp_path = index_path;
+
+	tmp_path += suffix.str();
+
+	{
+		std::ofstream index(tmp_path, std::ios::trunc);
+
+		if (!index)
+		{
+			return;
+		}
+
+		index << plugin_index_header << '\n';
+
+		index << "path " << plugin_path.string() << '\n';
+
+		for (const plugin_index_dir &dir : dirs)
+		{
+			index << "dir " << dir.time << ' ' << dir.count << ' ' << dir.path.string() << '\n';
+		}
+
+		for (const std::string &config : configs)
+		{
+			index << "config " << config << '\n';
+		}
+
+		index << "end\n";
+
+		index.close();
+
+		if (!index)
+		{
+			fs::remove(tmp_path, ec);
+			return;
+		}
+	}
+
+	fs::rename(tmp_path, index_path, ec);
+
+	if (ec)
+	{
+		fs::remove(tmp_path, ec);
+	}
+}
+
+static bool plugin_scan(const std::string &ext_path, std::vector<plugin_index_dir> &dirs, std::vector<std::string> &configs)
+{
+	static std::string m_begins = "metacall-";
+	static std::string m_ends = ".json";
+
+	/* Each directory is checked before listing it, so if it is modified
+	during the scan, the index will be invalidated in the next initialization */
+	plugin_index_dir root = { fs::path(ext_path), 0, 0 };
+	bool indexable = plugin_index_stat(root.path, root.time, root.count);
+	dirs.push_back(root);
+
+	auto i = fs::recursive_directory_iterator(ext_path);
+	while (i != fs::recursive_directory_iterator())
+	{
+		if (i.depth() == 1)
+		{
+			i.disable_recursion_pending();
+		}
+
+		fs::directory_entry dir(*i);
+		if (i.depth() == 0 && dir.is_directory())
+		{
+			plugin_index_dir current = { dir.path(), 0, 0 };
+			indexable = indexable && plugin_index_stat(current.path, current.time, current.count);
+			dirs.push_back(current);
+		}
+		else if (dir.is_regular_file())
+		{
+			std::string config = dir.path().filename().string();
+
+			if (config == "metacall.json" ||
+				(config.substr(0, m_begins.size()) == m_begins &&
+					config.substr(config.size() - m_ends.size()) == m_ends))
+			{
+				configs.push_back(dir.path().string());
+
+				i++;
+
+				if (i != fs::end(i) && i.depth() == 1)
+				{
+					i.pop();
+				}
+				continue;
+			}
+		}
+
+		i++;
+	}
+
+	return indexable;
+}
+
 static void *plugin_load_from_path(size_t argc, void *args[], void *data)
 {
 	/* TODO: Improve return values with throwable in the future */
@@ -90,63 +333,57 @@ static void *plugin_load_from_path(size_t argc, void *args[], void *data)
 		}
 	}
 
-	static std::string m_begins = "metacall-";
-	static std::string m_ends = ".json";
+	std::error_code ec;
+	fs::path plugin_path = fs::weakly_canonical(fs::path(ext_path), ec);
+	fs::path index_path;
+	std::vector<std::string> configs;
 
-	struct metacall_allocator_std_type std_ctx = { &std::malloc, &std::realloc, &std::free };
-	void *config_allocator = metacall_allocator_create(METACALL_ALLOCATOR_STD, (void *)&std_ctx);
+	if (ec)
+	{
+		plugin_path = fs::path(ext_path);
+	}
 
-	auto i = fs::recursive_directory_iterator(ext_path);
-	while (i != fs::recursive_directory_iterator())
+	/* If the index is not enabled, the plugins are scanned on each initialization */
+	bool indexable = plugin_index_path(plugin_path, index_path);
+
+	if (indexable == false || plugin_index_read(index_path, plugin_path, configs) == false)
 	{
-		if (i.depth() == 1)
-		{
-			i.disable_recursion_pending();
-		}
+		std::vector<plugin_index_dir> dirs;
 
-		fs::directory_entry dir(*i);
-		if (dir.is_regular_file())
-		{
-			std::string config = dir.path().filename().string();
+		configs.clear();
 
-			if (config == "metacall.json" ||
-				(config.substr(0, m_begins.size()) == m_begins &&
-					config.substr(config.size() - m_ends.size()) == m_ends))
-			{
-				std::string dir_path = dir.path().string();
-				void *current_handle = NULL;
-				void **current_handle_ptr = (handle_ptr != NULL && *handle_ptr != NULL) ? &current_handle : NULL;
+		if (plugin_scan(ext_path, dirs, configs) == true && indexable == true)
+		{
+			plugin_index_write(index_path, plugin_path, dirs, configs);
+		}
+	}
 
-				log_write("metacall", LOG_LEVEL_DEBUG, "Loading plugin: %s", dir_path.c_str());
+	struct metacall_allocator_std_type std_ctx = { &std::malloc, &std::realloc, &std::free };
+	void *config_allocator = metacall_allocator_create(METACALL_ALLOCATOR_STD, (void *)&std_ctx);
 
-				/* On each iteration, pass a new handle to metacall_load_from_configuration */
-				if (metacall_load_from_configuration(dir_path.c_str(), current_handle_ptr, config_allocator) != 0)
-				{
-					log_write("metacall", LOG_LEVEL_ERROR, "Failed to load plugin: %s", dir_path.c_str());
-					metacall_allocator_destroy(config_allocator);
-					return metacall_value_create_int(4);
-				}
+	for (const std::string &dir_path : configs)
+	{
+		void *current_handle = NULL;
+		void **current_handle_ptr = (handle_ptr != NULL && *handle_ptr != NULL) ? &current_handle : NULL;
 
-				/* Populate the current handle into the handle_ptr */
-				if (handle_ptr != NULL && *handle_ptr != NULL)
-				{
-					if (metacall_handle_populate(*handle_ptr, current_handle) != 0)
-					{
-						log_write("metacall", LOG_LEVEL_ERROR, "Failed to populate handle in plugin: %s", dir_path.c_str());
-					}
-				}
+		log_write("metacall", LOG_LEVEL_DEBUG, "Loading plugin: %s", dir_path.c_str());
 
-				i++;
+		/* On each iteration, pass a new handle to metacall_load_from_configuration */
+		if (metacall_load_from_configuration(dir_path.c_str(), current_handle_ptr, config_allocator) != 0)
+		{
+			log_write("metacall", LOG_LEVEL_ERROR, "Failed to load plugin: %s", dir_path.c_str());
+			metacall_allocator_destroy(config_allocator);
+			return metacall_value_create_int(4);
+		}
 
-				if (i != fs::end(i) && i.depth() == 1)
-				{
-					i.pop();
-				}
-				continue;
+		/* Populate the current handle into the handle_ptr */
+		if (handle_ptr != NULL && *handle_ptr != NULL)
+		{
+			if (metacall_handle_populate(*handle_ptr, current_handle) != 0)
+			{
+				log_write("metacall", LOG_LEVEL_ERROR, "Failed to populate handle in plugin: %s", dir_path.c_str());
 			}
 		}
-
-		i++;
 	}
 
 	metacall_allocator_destroy(config_allocator);
@@ -77,6 +77,8 @@ LOADER_API loader_impl loader_get_impl(const loader_tag tag);
 
 LOADER_API value loader_get(const char *name);
 
+LOADER_API function loader_get_function(const char *name);
+
 LOADER_API void *loader_get_handle(const loader_tag tag, const char *name);
 
 LOADER_API int loader_set_options(const loader_tag tag, value options);
@@ -95,10 +97,14 @@ LOADER_API void *loader_handle_export(void *handle);
 
 LOADER_API value loader_handle_get(void *handle, const char *name);
 
+LOADER_API function loader_handle_get_function(void *handle, const char *name);
+
 LOADER_API int loader_handle_populate(void *handle_dest, void *handle_src);
 
 LOADER_API value loader_metadata(void);
 
+LOADER_API uint64_t loader_metadata_generation(void);
+
 LOADER_API int loader_clear(void *handle);
 
 LOADER_API int loader_is_destroyed(loader_impl impl);
@@ -107,6 +113,8 @@ LOADER_API void loader_set_destroyed(loader_impl impl);
 
 LOADER_API void loader_unload_children(loader_impl impl);
 
+LOADER_API int loader_fork(enum loader_impl_fork_id id);
+
 LOADER_API void loader_destroy(void);
 
 LOADER_API const char *loader_print_info(void);
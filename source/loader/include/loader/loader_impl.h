@@ -35,17 +35,31 @@
 extern "C" {
 #endif
 
+/* -- Headers -- */
+
+#include <stdint.h>
+
 /* -- Methods -- */
 
+LOADER_NO_EXPORT void loader_impl_lock_read(void);
+
+LOADER_NO_EXPORT void loader_impl_unlock_read(void);
+
+LOADER_NO_EXPORT void loader_impl_lock_write(void);
+
+LOADER_NO_EXPORT void loader_impl_unlock_write(void);
+
 LOADER_NO_EXPORT int loader_impl_initialize(plugin_manager manager, plugin p, loader_impl impl);
 
 LOADER_API int loader_impl_is_initialized(loader_impl impl);
 
+LOADER_API int loader_impl_fork(loader_impl impl, enum loader_impl_fork_id id);
+
 LOADER_API loader_impl loader_impl_create(const loader_tag tag);
 
 LOADER_API loader_impl loader_impl_create_host(const loader_tag tag);
 
-LOADER_API int loader_impl_dependencies(loader_impl impl, detour d, const loader_tag tag);
+LOADER_API int loader_impl_dependencies(loader_impl impl, plugin_manager manager, const loader_tag tag);
 
 LOADER_API int loader_impl_link(plugin p, loader_impl impl);
 
@@ -87,6 +101,8 @@ LOADER_API value loader_impl_get_option(loader_impl impl, const char *field);
 
 LOADER_API int loader_impl_get_option_host(loader_impl impl);
 
+LOADER_API int loader_impl_get_option_lazy(loader_impl impl);
+
 LOADER_API int loader_impl_handle_initialize(plugin_manager manager, plugin p, loader_impl impl, const loader_path name, void **handle_ptr);
 
 LOADER_API vector loader_impl_handle_populated(void *handle);
@@ -101,6 +117,10 @@ LOADER_API void *loader_impl_handle_container_of(loader_impl impl, void *handle)
 
 LOADER_API int loader_impl_handle_validate(void *handle);
 
+LOADER_API void loader_impl_handle_invalidate(void *handle);
+
+LOADER_API uint64_t loader_impl_metadata_generation(void);
+
 LOADER_API value loader_impl_metadata(loader_impl impl);
 
 LOADER_API int loader_impl_clear(void *handle);
@@ -39,6 +39,13 @@ struct loader_impl_type;
 
 typedef struct loader_impl_type *loader_impl;
 
+enum loader_impl_fork_id
+{
+	LOADER_IMPL_FORK_PREPARE = 0, /* Before the fork, in the parent, the runtime must be quiescent after it */
+	LOADER_IMPL_FORK_PARENT = 1,  /* After the fork (or after a failed prepare), in the parent */
+	LOADER_IMPL_FORK_CHILD = 2	  /* After the fork, in the child, only the thread that forked is alive */
+};
+
 typedef loader_impl_data (*loader_impl_interface_initialize)(loader_impl, configuration);
 
 typedef int (*loader_impl_interface_execution_path)(loader_impl, const loader_path);
@@ -55,6 +62,8 @@ typedef int (*loader_impl_interface_discover)(loader_impl, loader_handle, contex
 
 typedef int (*loader_impl_interface_destroy)(loader_impl);
 
+typedef int (*loader_impl_interface_fork)(loader_impl, enum loader_impl_fork_id);
+
 typedef struct loader_impl_interface_type
 {
 	loader_impl_interface_initialize initialize;
@@ -65,6 +74,7 @@ typedef struct loader_impl_interface_type
 	loader_impl_interface_clear clear;
 	loader_impl_interface_discover discover;
 	loader_impl_interface_destroy destroy;
+	loader_impl_interface_fork fork; /* Optional, loaders without it are treated as fork safe */
 
 } * loader_impl_interface;
 
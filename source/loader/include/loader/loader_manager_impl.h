@@ -29,6 +29,8 @@
 
 #include <plugin/plugin_manager.h>
 
+#include <threading/threading_mutex.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -48,12 +50,16 @@ struct loader_initialization_order_type
 
 struct loader_manager_impl_type
 {
-	plugin host;				 /* Points to the internal host loader (it stores functions registered by the user) */
-	vector initialization_order; /* Stores the loader implementations by order of initialization (used for destruction) */
-	uint64_t init_thread_id;	 /* Stores the thread id of the thread that initialized metacall */
-	vector script_paths;		 /* Vector of search path for the scripts */
-	set destroy_map;			 /* Tracks the list of destroyed runtimes during destruction of the manager (loader_impl -> NULL) */
-	detour d;					 /* Stores the detour manager that is being used for hooking */
+	plugin host;						  /* Points to the internal host loader (it stores functions registered by the user) */
+	vector initialization_order;		  /* Stores the loader implementations by order of initialization (used for destruction) */
+	uint64_t init_thread_id;			  /* Stores the thread id of the thread that initialized metacall */
+	vector script_paths;				  /* Vector of search path for the scripts */
+	set destroy_map;					  /* Tracks the list of destroyed runtimes during destruction of the manager (loader_impl -> NULL) */
+	detour d;							  /* Stores the detour manager that is being used for hooking */
+	vector libraries;					  /* Snapshot of the libraries loaded in the process, used for resolving the dependencies of the host loaders */
+	uint64_t libraries_generation;		  /* Generation of the loaded libraries when the snapshot was taken */
+	set dependencies;					  /* Dependencies resolved against the current snapshot (name -> loader_manager_impl_dependency) */
+	threading_mutex_type libraries_mutex; /* Guards the snapshot and the dependencies, the loaders can be created from multiple threads */
 };
 
 /* -- Type Definitions -- */
@@ -72,6 +78,8 @@ LOADER_API void loader_manager_impl_set_destroyed(loader_manager_impl manager_im
 
 LOADER_API int loader_manager_impl_is_destroyed(loader_manager_impl manager_impl, loader_impl impl);
 
+LOADER_API int loader_manager_impl_dependency_find(loader_manager_impl manager_impl, const char *name, char *path, size_t size);
+
 LOADER_API void loader_manager_impl_destroy(loader_manager_impl manager_impl);
 
 #ifdef __cplusplus
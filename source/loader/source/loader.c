@@ -35,6 +35,7 @@
 
 #include <log/log.h>
 
+#include <threading/threading_mutex.h>
 #include <threading/threading_thread_id.h>
 
 #include <stdlib.h>
@@ -56,12 +57,21 @@ static plugin loader_get_impl_plugin(const loader_tag tag);
 
 static plugin loader_get_impl_plugin_options(const loader_tag tag, value options);
 
+static value loader_get_value(const char *name);
+
+static function loader_get_value_function(value v);
+
 /* -- Member Data -- */
 
 static plugin_manager_declare(loader_manager);
 
+/* Serializes the creation of the loaders, so a loader requested from multiple threads is created only once */
+static threading_mutex_type loader_create_mutex = THREADING_MUTEX_INITIALIZE;
+
 static int loader_manager_initialized = 1;
 
+static uint64_t loader_fork_thread_id = THREAD_ID_INVALID;
+
 /* -- Methods -- */
 
 int loader_initialize(void)
@@ -176,13 +186,23 @@ void loader_initialization_register_plugin(plugin p)
 			plugin_name(p), vector_size(manager_impl->initialization_order), initialization_order.id);
 		*/
 
+		loader_impl_lock_write();
+
 		vector_push_back(manager_impl->initialization_order, &initialization_order);
+
+		loader_impl_unlock_write();
 	}
 }
 
 int loader_is_initialized(const loader_tag tag)
 {
-	plugin p = plugin_manager_get(&loader_manager, tag);
+	plugin p;
+
+	loader_impl_lock_read();
+
+	p = plugin_manager_get(&loader_manager, tag);
+
+	loader_impl_unlock_read();
 
 	if (p == NULL)
 	{
@@ -201,7 +221,18 @@ int loader_register(const char *name, loader_register_invoke invoke, void **func
 
 int loader_register_handle(void *impl, void *handle, const char *name, loader_register_invoke invoke, type_id return_type, size_t arg_size, type_id args_type_id[], void *data)
 {
-	return loader_host_register((loader_impl)impl, loader_impl_handle_context(handle), name, invoke, NULL, return_type, arg_size, args_type_id, data);
+	if (loader_host_register((loader_impl)impl, loader_impl_handle_context(handle), name, invoke, NULL, return_type, arg_size, args_type_id, data) != 0)
+	{
+		return 1;
+	}
+
+	loader_impl_lock_write();
+
+	loader_impl_handle_invalidate(handle);
+
+	loader_impl_unlock_write();
+
+	return 0;
 }
 
 void loader_detour(detour d)
@@ -228,12 +259,30 @@ plugin loader_get_impl_plugin(const loader_tag tag)
 
 plugin loader_get_impl_plugin_options(const loader_tag tag, value options)
 {
-	plugin p = plugin_manager_get(&loader_manager, tag);
+	plugin p;
 
 	loader_impl impl;
 
+	loader_impl_lock_read();
+
+	p = plugin_manager_get(&loader_manager, tag);
+
+	loader_impl_unlock_read();
+
+	if (p != NULL)
+	{
+		return p;
+	}
+
+	threading_mutex_lock(&loader_create_mutex);
+
+	/* Check again, the loader may have been created by another thread meanwhile */
+	p = plugin_manager_get(&loader_manager, tag);
+
 	if (p != NULL)
 	{
+		threading_mutex_unlock(&loader_create_mutex);
+
 		return p;
 	}
 
@@ -250,28 +299,36 @@ plugin loader_get_impl_plugin_options(const loader_tag tag, value options)
 	loader_impl_set_options(impl, options);
 
 	/* Dynamic link loader dependencies if it is not host */
-	if (loader_impl_dependencies(impl, plugin_manager_impl_type(&loader_manager, loader_manager_impl)->d, tag) != 0)
+	if (loader_impl_dependencies(impl, &loader_manager, tag) != 0)
 	{
 		goto plugin_manager_create_error;
 	}
 
-	/* Dynamic link the loader */
+	/* Dynamic link the loader, the plugin is published to the readers once it is linked and attached */
+	loader_impl_lock_write();
+
 	p = plugin_manager_create(&loader_manager, tag, impl, &loader_impl_destroy_dtor);
 
 	if (p == NULL)
 	{
+		loader_impl_unlock_write();
 		goto plugin_manager_create_error;
 	}
 
 	/* If it is host, link the loader symbols to the host (either the executable or a library) */
 	if (loader_impl_link(p, impl) != 0)
 	{
+		loader_impl_unlock_write();
 		goto plugin_manager_create_error;
 	}
 
 	/* Store in the loader implementation the reference to the plugin which belongs to */
 	loader_impl_attach(impl, p);
 
+	loader_impl_unlock_write();
+
+	threading_mutex_unlock(&loader_create_mutex);
+
 	/* Check if it is host, initialize it and set it as host */
 	if (options != NULL && loader_impl_get_option_host(impl) == 1)
 	{
@@ -279,12 +336,16 @@ plugin loader_get_impl_plugin_options(const loader_tag tag, value options)
 
 		if (loader_impl_initialize(&loader_manager, p, plugin_impl_type(p, loader_impl)) != 0)
 		{
-			goto plugin_manager_create_error;
+			goto plugin_manager_initialize_error;
 		}
 
 		manager_impl = plugin_manager_impl_type(&loader_manager, loader_manager_impl);
 
+		loader_impl_lock_write();
+
 		manager_impl->host = p;
+
+		loader_impl_unlock_write();
 	}
 
 	/* TODO: Disable logs here until log is completely thread safe and async signal safe */
@@ -295,8 +356,14 @@ plugin loader_get_impl_plugin_options(const loader_tag tag, value options)
 plugin_manager_create_error:
 	loader_impl_destroy(p, impl);
 loader_create_error:
+	threading_mutex_unlock(&loader_create_mutex);
 	log_write("metacall", LOG_LEVEL_ERROR, "Failed to create loader: %s", tag);
 	return NULL;
+
+plugin_manager_initialize_error:
+	loader_impl_destroy(p, impl);
+	log_write("metacall", LOG_LEVEL_ERROR, "Failed to initialize host loader: %s", tag);
+	return NULL;
 }
 
 loader_impl loader_get_impl(const loader_tag tag)
@@ -540,7 +607,7 @@ int loader_load_from_configuration(const loader_path path, void **handle, void *
 	return 0;
 }
 
-value loader_get(const char *name)
+value loader_get_value(const char *name)
 {
 	struct set_iterator_type it;
 
@@ -561,6 +628,52 @@ value loader_get(const char *name)
 	return NULL;
 }
 
+function loader_get_value_function(value v)
+{
+	function f;
+
+	if (value_type_id(v) != TYPE_FUNCTION)
+	{
+		return NULL;
+	}
+
+	f = value_to_function(v);
+
+	/* The reference is taken while the lock is held, so the function outlives a concurrent clear of its handle */
+	if (function_increment_reference(f) != 0)
+	{
+		return NULL;
+	}
+
+	return f;
+}
+
+value loader_get(const char *name)
+{
+	value scope_object;
+
+	loader_impl_lock_read();
+
+	scope_object = loader_get_value(name);
+
+	loader_impl_unlock_read();
+
+	return scope_object;
+}
+
+function loader_get_function(const char *name)
+{
+	function f;
+
+	loader_impl_lock_read();
+
+	f = loader_get_value_function(loader_get_value(name));
+
+	loader_impl_unlock_read();
+
+	return f;
+}
+
 void *loader_get_handle(const loader_tag tag, const char *name)
 {
 	plugin p = loader_get_impl_plugin(tag);
@@ -620,19 +733,26 @@ int loader_handle_populate(void *handle_dest, void *handle_src)
 	context ctx_src = loader_impl_handle_context(handle_src);
 	char *duplicated_key;
 
+	int result = 1;
+
+	loader_impl_lock_write();
+
 	if (context_contains(ctx_src, ctx_dest, &duplicated_key) == 0 && duplicated_key != NULL)
 	{
 		log_write("metacall", LOG_LEVEL_ERROR, "Duplicated symbol found named '%s' already defined in the handle scope", duplicated_key);
-		return 1;
 	}
 	else if (context_append(ctx_dest, ctx_src) == 0)
 	{
 		vector_push_back_var(loader_impl_handle_populated(handle_src), handle_dest);
 
-		return 0;
+		loader_impl_handle_invalidate(handle_dest);
+
+		result = 0;
 	}
 
-	return 1;
+	loader_impl_unlock_write();
+
+	return result;
 }
 
 const char *loader_handle_id(void *handle)
@@ -642,21 +762,55 @@ const char *loader_handle_id(void *handle)
 
 value loader_handle_export(void *handle)
 {
-	return loader_impl_handle_export(handle);
+	value v;
+
+	loader_impl_lock_read();
+
+	v = loader_impl_handle_export(handle);
+
+	loader_impl_unlock_read();
+
+	return v;
 }
 
 value loader_handle_get(void *handle, const char *name)
 {
+	value v = NULL;
+
 	if (handle != NULL)
 	{
 		context ctx = loader_impl_handle_context(handle);
 
 		scope sp = context_scope(ctx);
 
-		return scope_get(sp, name);
+		loader_impl_lock_read();
+
+		v = scope_get(sp, name);
+
+		loader_impl_unlock_read();
 	}
 
-	return NULL;
+	return v;
+}
+
+function loader_handle_get_function(void *handle, const char *name)
+{
+	function f = NULL;
+
+	if (handle != NULL)
+	{
+		context ctx = loader_impl_handle_context(handle);
+
+		scope sp = context_scope(ctx);
+
+		loader_impl_lock_read();
+
+		f = loader_get_value_function(scope_get(sp, name));
+
+		loader_impl_unlock_read();
+	}
+
+	return f;
 }
 
 value loader_metadata_impl(plugin p, loader_impl impl)
@@ -695,12 +849,19 @@ value loader_metadata_impl(plugin p, loader_impl impl)
 
 value loader_metadata(void)
 {
-	value *values, v = value_create_map(NULL, plugin_manager_size(&loader_manager));
+	value *values, v;
 	struct set_iterator_type it;
 	size_t values_it;
 
+	/* The metadata of the handles is cached when it is generated, so it needs exclusive access */
+	loader_impl_lock_write();
+
+	v = value_create_map(NULL, plugin_manager_size(&loader_manager));
+
 	if (v == NULL)
 	{
+		loader_impl_unlock_write();
+
 		return NULL;
 	}
 
@@ -720,9 +881,16 @@ value loader_metadata(void)
 		}
 	}
 
+	loader_impl_unlock_write();
+
 	return v;
 }
 
+uint64_t loader_metadata_generation(void)
+{
+	return loader_impl_metadata_generation();
+}
+
 int loader_clear(void *handle)
 {
 	return loader_impl_clear(handle);
@@ -806,6 +974,97 @@ void loader_unload_children(loader_impl impl)
 	}
 }
 
+int loader_fork(enum loader_impl_fork_id id)
+{
+	loader_manager_impl manager_impl = plugin_manager_impl_type(&loader_manager, loader_manager_impl);
+	size_t iterator, size;
+	int result = 0;
+
+	if (manager_impl == NULL || manager_impl->initialization_order == NULL)
+	{
+		return 0;
+	}
+
+	size = vector_size(manager_impl->initialization_order);
+
+	if (id == LOADER_IMPL_FORK_PREPARE)
+	{
+		loader_fork_thread_id = thread_id_get_current();
+
+		/* Prepare in inverse initialization order, so the children are quiescent before their parents */
+		for (iterator = size; iterator > 0; --iterator)
+		{
+			loader_initialization_order order = vector_at(manager_impl->initialization_order, iterator - 1);
+
+			if (order->p == NULL || order->p == manager_impl->host)
+			{
+				continue;
+			}
+
+			if (loader_impl_fork(plugin_impl_type(order->p, loader_impl), LOADER_IMPL_FORK_PREPARE) != 0)
+			{
+				log_write("metacall", LOG_LEVEL_ERROR, "Loader %s cannot be prepared for fork", plugin_name(order->p));
+
+				/* Resume the loaders that have been already prepared */
+				for (; iterator < size; ++iterator)
+				{
+					order = vector_at(manager_impl->initialization_order, iterator);
+
+					if (order->p != NULL && order->p != manager_impl->host)
+					{
+						(void)loader_impl_fork(plugin_impl_type(order->p, loader_impl), LOADER_IMPL_FORK_PARENT);
+					}
+				}
+
+				return 1;
+			}
+		}
+	}
+	else
+	{
+		/* Thread ids are not preserved in the child, rebase the ones of the thread that forked */
+		if (id == LOADER_IMPL_FORK_CHILD)
+		{
+			uint64_t current = thread_id_get_current();
+
+			if (manager_impl->init_thread_id == loader_fork_thread_id)
+			{
+				manager_impl->init_thread_id = current;
+			}
+
+			for (iterator = 0; iterator < size; ++iterator)
+			{
+				loader_initialization_order order = vector_at(manager_impl->initialization_order, iterator);
+
+				if (order->id == loader_fork_thread_id)
+				{
+					order->id = current;
+				}
+			}
+		}
+
+		/* Resume in initialization order, so the parents are ready before their children */
+		for (iterator = 0; iterator < size; ++iterator)
+		{
+			loader_initialization_order order = vector_at(manager_impl->initialization_order, iterator);
+
+			if (order->p == NULL || order->p == manager_impl->host)
+			{
+				continue;
+			}
+
+			if (loader_impl_fork(plugin_impl_type(order->p, loader_impl), id) != 0)
+			{
+				log_write("metacall", LOG_LEVEL_ERROR, "Loader %s failed to resume after fork in the %s", plugin_name(order->p), id == LOADER_IMPL_FORK_CHILD ? "child" : "parent");
+
+				result = 1;
+			}
+		}
+	}
+
+	return result;
+}
+
 void loader_destroy(void)
 {
 	loader_manager_impl manager_impl = plugin_manager_impl_type(&loader_manager, loader_manager_impl);
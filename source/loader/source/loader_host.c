@@ -89,6 +89,7 @@ function_interface function_host_singleton(void)
 		NULL,
 		&function_host_interface_invoke,
 		&function_host_interface_await,
+		NULL,
 		NULL
 	};
 
@@ -212,8 +213,15 @@ int loader_host_register(loader_impl host, context ctx, const char *name, loader
 		}
 
 		scope sp = context_scope(ctx);
+		int result;
+
+		loader_impl_lock_write();
+
+		result = scope_define(sp, name, v);
+
+		loader_impl_unlock_write();
 
-		if (scope_define(sp, name, v) != 0)
+		if (result != 0)
 		{
 			value_type_destroy(v);
 			return 1;
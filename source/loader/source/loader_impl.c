@@ -37,10 +37,15 @@
 #include <configuration/configuration.h>
 #include <configuration/configuration_object.h>
 
-#include <portability/portability_library_path.h>
-
 #include <environment/environment_variable.h>
 
+#include <threading/threading_atomic.h>
+#include <threading/threading_mutex.h>
+#include <threading/threading_rwlock.h>
+
+#include <portability/portability_compiler.h>
+
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -54,6 +59,8 @@
 #define LOADER_IMPL_FUNCTION_INIT "__metacall_initialize__"
 #define LOADER_IMPL_FUNCTION_FINI "__metacall_finalize__"
 
+#define LOADER_IMPL_INIT_ORDER_ROOT SIZE_MAX
+
 #if defined(WIN32) || defined(_WIN32) || \
 	defined(__CYGWIN__) || defined(__CYGWIN32__) || \
 	defined(__MINGW32__) || defined(__MINGW64__)
@@ -68,10 +75,18 @@
 
 struct loader_handle_impl_type;
 
+struct loader_impl_init_order_type;
+
+struct loader_impl_load_type;
+
 /* -- Type Definitions -- */
 
 typedef struct loader_handle_impl_type *loader_handle_impl;
 
+typedef struct loader_impl_init_order_type *loader_impl_init_order;
+
+typedef struct loader_impl_load_type *loader_impl_load;
+
 /* -- Member Data -- */
 
 struct loader_impl_type
@@ -90,6 +105,7 @@ struct loader_impl_type
 	set library_map;			   /* List of handles (dynlink) to the dependencies of the loader and the loader itself */
 	detour d;					   /* Reference to the detour which was used for hooking the loader or its dependencies */
 	set detour_map;				   /* List of detour handles (detour_handle) to the dependencies of the loader and the loader itself */
+	threading_mutex_type init_mutex; /* Serializes the initialization of the loader when it is loaded from multiple threads */
 };
 
 struct loader_handle_impl_type
@@ -102,6 +118,21 @@ struct loader_handle_impl_type
 	context ctx;				 /* Contains the objects, classes and functions loaded in the handle */
 	int populated;				 /* If it is populated (0), the handle context is also stored in loader context (global scope), otherwise it is private */
 	vector populated_handles;	 /* Vector containing all the references to which this handle has been populated into, it is necessary for detach the symbols when destroying (used in load_from_* when passing an input parameter) */
+	value metadata;				 /* Cached metadata of the handle, it is NULL when the context has been modified and it must be generated again */
+	int discovered;				 /* If it is discovered (0), the loader has finished filling the handle context, until then it is not inspected */
+};
+
+struct loader_impl_init_order_type
+{
+	loader_handle_impl handle_impl; /* Handle stored in this position, it is NULL while it is being loaded or after it has been cleared */
+	size_t parent;					/* Position of the handle whose load has loaded this one, or LOADER_IMPL_INIT_ORDER_ROOT */
+};
+
+struct loader_impl_load_type
+{
+	loader_impl impl;	   /* Loader where the handle is being loaded */
+	size_t init_order;	   /* Position reserved for the handle in the initialization order */
+	loader_impl_load prev; /* Load which was in progress in the same thread when this one started */
 };
 
 /* -- Private Methods -- */
@@ -112,9 +143,7 @@ static void loader_impl_configuration_execution_paths(loader_impl_interface ifac
 
 static void loader_impl_configuration_environment(loader_impl impl);
 
-static int loader_impl_dependencies_self_list(const char *library, void *data);
-
-static int loader_impl_dependencies_self_find(loader_impl impl, const char *key_str, vector dependencies_self);
+static int loader_impl_dependencies_self_find(loader_impl impl, loader_manager_impl manager_impl, const char *key_str);
 
 static int loader_impl_dependencies_load(loader_impl impl, const char *key_str, value *paths_array, size_t paths_size);
 
@@ -126,17 +155,23 @@ static configuration loader_impl_initialize_configuration(const loader_tag tag);
 
 static int loader_impl_initialize_registered(plugin_manager manager, plugin p);
 
+static int loader_impl_initialize_impl(plugin_manager manager, plugin p, loader_impl impl);
+
 static loader_handle_impl loader_impl_load_handle(loader_impl impl, loader_impl_interface iface, loader_handle module, const char *path, size_t size);
 
-static int loader_impl_handle_init(loader_impl impl, loader_handle_impl handle_impl, void **handle_ptr, int populated);
+static void loader_impl_handle_init(loader_handle_impl handle_impl, void **handle_ptr, int populated);
 
 static int loader_impl_handle_register(plugin_manager manager, loader_impl impl, loader_handle_impl handle_impl, void **handle_ptr);
 
-static int loader_impl_handle_init_order(loader_impl impl, void **handle_ptr, size_t *init_order_ptr);
+static int loader_impl_handle_init_order(loader_impl impl, void **handle_ptr, loader_impl_load load);
+
+static void loader_impl_handle_init_order_end(loader_impl_load load, int init_order_not_initialized);
 
-static int loader_impl_handle_discover_impl(plugin_manager manager, loader_impl impl, loader_impl_interface iface, loader_handle handle, const char *path, void **handle_ptr, size_t init_order, int init_order_not_initialized);
+static void loader_impl_handle_init_order_remove(loader_impl impl, size_t init_order);
 
-static int loader_impl_handle_discover(plugin_manager manager, loader_impl impl, loader_impl_interface iface, loader_handle handle, const char *path, void **handle_ptr, size_t init_order, int init_order_not_initialized);
+static int loader_impl_handle_discover_impl(plugin_manager manager, loader_impl impl, loader_impl_interface iface, loader_handle handle, const char *path, void **handle_ptr, loader_impl_load load, int init_order_not_initialized);
+
+static int loader_impl_handle_discover(plugin_manager manager, loader_impl impl, loader_impl_interface iface, loader_handle handle, const char *path, void **handle_ptr, loader_impl_load load, int init_order_not_initialized);
 
 static size_t loader_impl_handle_name(plugin_manager manager, const loader_path path, loader_path result);
 
@@ -157,8 +192,52 @@ static void loader_impl_destroy_handle_children(loader_impl impl, size_t init_or
 static const char loader_handle_impl_magic_alloc[] = "loader_handle_impl_magic_alloc";
 static const char loader_handle_impl_magic_free[] = "loader_handle_impl_magic_free";
 
+#if defined(PORTABILITY_THREAD_LOCAL)
+/* Innermost load in progress in the current thread, the handles loaded meanwhile are its children */
+static PORTABILITY_THREAD_LOCAL loader_impl_load loader_impl_load_current = NULL;
+#endif
+
+/* Generation of the metadata, it is incremented each time a handle is loaded, cleared or its context modified */
+static atomic_uintmax_t loader_impl_metadata_generation_counter = 0;
+
+/* Protects the loaders, the handle tables and the scopes of the contexts: lookups take it for reading, while
+the loads and clears take it for writing only when publishing or removing the handles, the code of the loaders
+(load, discover, initialization and finalization hooks, clear) runs without holding it, so lookups and calls are
+not blocked while a script is being loaded and the loaders can call back into MetaCall without deadlocking */
+#if defined(LOADER_THREAD_SAFE)
+static threading_rwlock_type loader_impl_lock = THREADING_RWLOCK_INITIALIZE;
+#endif
+
 /* -- Methods -- */
 
+void loader_impl_lock_read(void)
+{
+#if defined(LOADER_THREAD_SAFE)
+	threading_rwlock_read_lock(&loader_impl_lock);
+#endif
+}
+
+void loader_impl_unlock_read(void)
+{
+#if defined(LOADER_THREAD_SAFE)
+	threading_rwlock_read_unlock(&loader_impl_lock);
+#endif
+}
+
+void loader_impl_lock_write(void)
+{
+#if defined(LOADER_THREAD_SAFE)
+	threading_rwlock_write_lock(&loader_impl_lock);
+#endif
+}
+
+void loader_impl_unlock_write(void)
+{
+#if defined(LOADER_THREAD_SAFE)
+	threading_rwlock_write_unlock(&loader_impl_lock);
+#endif
+}
+
 loader_impl loader_impl_allocate(const loader_tag tag)
 {
 	loader_impl impl = malloc(sizeof(struct loader_impl_type));
@@ -184,7 +263,7 @@ loader_impl loader_impl_allocate(const loader_tag tag)
 		goto alloc_handle_impl_map_error;
 	}
 
-	impl->handle_impl_init_order = vector_create_type(loader_handle_impl);
+	impl->handle_impl_init_order = vector_create_type(struct loader_impl_init_order_type);
 
 	if (impl->handle_impl_init_order == NULL)
 	{
@@ -226,8 +305,15 @@ loader_impl loader_impl_allocate(const loader_tag tag)
 		goto alloc_detour_map_error;
 	}
 
+	if (threading_mutex_initialize(&impl->init_mutex) != 0)
+	{
+		goto alloc_init_mutex_error;
+	}
+
 	return impl;
 
+alloc_init_mutex_error:
+	set_destroy(impl->detour_map);
 alloc_detour_map_error:
 	set_destroy(impl->library_map);
 alloc_library_map_error:
@@ -396,44 +482,22 @@ void loader_impl_configuration_environment(loader_impl impl)
 	}
 }
 
-int loader_impl_dependencies_self_list(const char *library, void *data)
+int loader_impl_dependencies_self_find(loader_impl impl, loader_manager_impl manager_impl, const char *key_str)
 {
-	vector dependencies_self = (vector)data;
-
-	vector_push_back_empty(dependencies_self);
-
-	strncpy(vector_back(dependencies_self), library, strnlen(library, PORTABILITY_PATH_SIZE) + 1);
-
-	return 0;
-}
-
-int loader_impl_dependencies_self_find(loader_impl impl, const char *key_str, vector dependencies_self)
-{
-	size_t iterator, size = vector_size(dependencies_self);
-	char library_self_name[PORTABILITY_PATH_SIZE];
+	/* Try to load it from the dependencies of the executable, the libraries of the process
+	and the dependencies already resolved are cached by the manager between loaders */
+	char library_self[PORTABILITY_PATH_SIZE];
 	dynlink handle;
 
-	/* Try to load it from the dependencies of the executable */
-	for (iterator = 0; iterator < size; ++iterator)
+	if (loader_manager_impl_dependency_find(manager_impl, key_str, library_self, PORTABILITY_PATH_SIZE) == 0)
 	{
-		const char *library_self = vector_at(dependencies_self, iterator);
-
-		/* Get the name of the library */
-		portability_path_get_fullname(library_self, strnlen(library_self, PORTABILITY_PATH_SIZE) + 1, library_self_name, PORTABILITY_PATH_SIZE);
-
-		/* Try to find the dependency name in the library */
-		if (strstr(library_self_name, key_str) != NULL)
-		{
-			handle = dynlink_load_absolute(library_self, DYNLINK_FLAGS_BIND_LAZY | DYNLINK_FLAGS_BIND_GLOBAL);
-
-			goto dependencies_map_insert;
-		}
+		handle = dynlink_load_absolute(library_self, DYNLINK_FLAGS_BIND_LAZY | DYNLINK_FLAGS_BIND_GLOBAL);
+	}
+	else
+	{
+		/* If it is not found in the dependencies, it is linked statically to the executable, load it */
+		handle = dynlink_load_self(DYNLINK_FLAGS_BIND_LAZY | DYNLINK_FLAGS_BIND_GLOBAL);
 	}
-
-	/* If it is not found in the dependencies, it is linked statically to the executable, load it */
-	handle = dynlink_load_self(DYNLINK_FLAGS_BIND_LAZY | DYNLINK_FLAGS_BIND_GLOBAL);
-
-dependencies_map_insert:
 
 	if (handle != NULL && set_insert(impl->library_map, (const set_key)key_str, (set_value)handle) == 0)
 	{
@@ -512,8 +576,10 @@ void loader_impl_dependencies_search_paths(loader_impl impl, const loader_tag ta
 }
 #endif
 
-int loader_impl_dependencies(loader_impl impl, detour d, const loader_tag tag)
+int loader_impl_dependencies(loader_impl impl, plugin_manager manager, const loader_tag tag)
 {
+	loader_manager_impl manager_impl = plugin_manager_impl_type(manager, loader_manager_impl);
+
 	/* Dependencies have the following format:
 	{
 		"dependencies": {
@@ -552,7 +618,7 @@ int loader_impl_dependencies(loader_impl impl, detour d, const loader_tag tag)
 	*/
 
 	/* Initialize the loader detour */
-	impl->d = d;
+	impl->d = manager_impl->d;
 
 #if defined(WIN32) || defined(_WIN32)
 	loader_impl_dependencies_search_paths(impl, tag);
@@ -563,27 +629,9 @@ int loader_impl_dependencies(loader_impl impl, detour d, const loader_tag tag)
 	{
 		size_t size = value_type_count(dependencies_value);
 		value *dependencies_map = value_to_map(dependencies_value);
-		vector dependencies_self = NULL;
 		size_t iterator;
 		const int host = loader_impl_get_option_host(impl);
 
-		/* In case of host, get all loaded dependencies into an array */
-		if (host == 1)
-		{
-			dependencies_self = vector_create(sizeof(char) * PORTABILITY_PATH_SIZE);
-
-			if (dependencies_self == NULL)
-			{
-				return 1;
-			}
-
-			if (portability_library_path_list(&loader_impl_dependencies_self_list, (void *)dependencies_self) != 0)
-			{
-				vector_destroy(dependencies_self);
-				return 1;
-			}
-		}
-
 		/* Iterate through the dependencies */
 		for (iterator = 0; iterator < size; ++iterator)
 		{
@@ -613,18 +661,15 @@ int loader_impl_dependencies(loader_impl impl, detour d, const loader_tag tag)
 					else
 					{
 						/* Otherwise try to find if the library is already loaded, and if not, load the process */
-						if (loader_impl_dependencies_self_find(impl, key_str, dependencies_self) != 0)
+						if (loader_impl_dependencies_self_find(impl, manager_impl, key_str) != 0)
 						{
 							log_write("metacall", LOG_LEVEL_ERROR, "Failed to load dependency '%s' from loader '%s' as a host", key_str, tag);
-							vector_destroy(dependencies_self);
 							return 1;
 						}
 					}
 				}
 			}
 		}
-
-		vector_destroy(dependencies_self);
 	}
 
 	return 0;
@@ -758,7 +803,12 @@ configuration loader_impl_initialize_configuration(const loader_tag tag)
 int loader_impl_initialize_registered(plugin_manager manager, plugin p)
 {
 	loader_manager_impl manager_impl = plugin_manager_impl_type(manager, loader_manager_impl);
-	size_t iterator, size = vector_size(manager_impl->initialization_order);
+	size_t iterator, size;
+	int result = 1;
+
+	loader_impl_lock_read();
+
+	size = vector_size(manager_impl->initialization_order);
 
 	/* Check if the plugin has been properly registered into initialization order list */
 	for (iterator = 0; iterator < size; ++iterator)
@@ -767,14 +817,30 @@ int loader_impl_initialize_registered(plugin_manager manager, plugin p)
 
 		if (order->p == p)
 		{
-			return 0;
+			result = 0;
+			break;
 		}
 	}
 
-	return 1;
+	loader_impl_unlock_read();
+
+	return result;
 }
 
 int loader_impl_initialize(plugin_manager manager, plugin p, loader_impl impl)
+{
+	int result;
+
+	threading_mutex_lock(&impl->init_mutex);
+
+	result = loader_impl_initialize_impl(manager, p, impl);
+
+	threading_mutex_unlock(&impl->init_mutex);
+
+	return result;
+}
+
+int loader_impl_initialize_impl(plugin_manager manager, plugin p, loader_impl impl)
 {
 	static const char loader_library_path[] = "loader_library_path";
 	value loader_library_path_value = NULL;
@@ -903,6 +969,27 @@ int loader_impl_is_initialized(loader_impl impl)
 	return impl->init;
 }
 
+int loader_impl_fork(loader_impl impl, enum loader_impl_fork_id id)
+{
+	loader_impl_interface iface;
+
+	/* Loaders that have not been initialized have no runtime state to take care of */
+	if (impl == NULL || impl->p == NULL || impl->init != 0)
+	{
+		return 0;
+	}
+
+	iface = loader_iface(impl->p);
+
+	/* Loaders without a fork callback have no runtime threads to take care of */
+	if (iface == NULL || iface->fork == NULL)
+	{
+		return 0;
+	}
+
+	return iface->fork(impl, id);
+}
+
 loader_impl loader_impl_create(const loader_tag tag)
 {
 	loader_impl impl = loader_impl_allocate(tag);
@@ -952,7 +1039,15 @@ type loader_impl_type(loader_impl impl, const char *name)
 {
 	if (impl != NULL && impl->type_info_map != NULL && name != NULL)
 	{
-		return (type)set_get(impl->type_info_map, (const set_key)name);
+		type t;
+
+		loader_impl_lock_read();
+
+		t = (type)set_get(impl->type_info_map, (const set_key)name);
+
+		loader_impl_unlock_read();
+
+		return t;
 	}
 
 	return NULL;
@@ -962,7 +1057,15 @@ int loader_impl_type_define(loader_impl impl, const char *name, type t)
 {
 	if (impl != NULL && impl->type_info_map != NULL && name != NULL)
 	{
-		return set_insert(impl->type_info_map, (const set_key)name, (set_value)t);
+		int result;
+
+		loader_impl_lock_write();
+
+		result = set_insert(impl->type_info_map, (const set_key)name, (set_value)t);
+
+		loader_impl_unlock_write();
+
+		return result;
 	}
 
 	return 1;
@@ -986,6 +1089,8 @@ loader_handle_impl loader_impl_load_handle(loader_impl impl, loader_impl_interfa
 	handle_impl->iface = iface;
 	strncpy(handle_impl->path, path, size - 1);
 	handle_impl->module = module;
+	handle_impl->metadata = NULL;
+	handle_impl->discovered = 1;
 	handle_impl->ctx = context_create(handle_impl->path);
 
 	if (handle_impl->ctx == NULL)
@@ -1019,8 +1124,9 @@ void loader_impl_destroy_handle(loader_handle_impl handle_impl)
 	{
 		static const char func_fini_name[] = LOADER_IMPL_FUNCTION_FINI;
 		size_t iterator;
+		int initialized = (handle_impl->impl->init == 0);
 
-		if (handle_impl->impl->init == 0)
+		if (initialized)
 		{
 			/* TODO: Disable logs here until log is completely thread safe and async signal safe */
 			/* log_write("metacall", LOG_LEVEL_DEBUG, "Destroying handle %s", handle_impl->path); */
@@ -1029,13 +1135,11 @@ void loader_impl_destroy_handle(loader_handle_impl handle_impl)
 			{
 				log_write("metacall", LOG_LEVEL_ERROR, "Error when calling destructor from handle impl: %p (%s)", (void *)handle_impl, func_fini_name);
 			}
-
-			if (handle_impl->module != NULL && handle_impl->iface->clear(handle_impl->impl, handle_impl->module) != 0)
-			{
-				log_write("metacall", LOG_LEVEL_ERROR, "Error when clearing handle impl: %p", (void *)handle_impl);
-			}
 		}
 
+		/* Remove the symbols from the scopes before clearing the handle, so they cannot be found while it is being cleared */
+		loader_impl_lock_write();
+
 		if (handle_impl->populated == 0)
 		{
 			context_remove(handle_impl->impl->ctx, handle_impl->ctx);
@@ -1051,6 +1155,17 @@ void loader_impl_destroy_handle(loader_handle_impl handle_impl)
 			}
 
 			context_remove(populated_handle_impl->ctx, handle_impl->ctx);
+
+			loader_impl_handle_invalidate(populated_handle_impl);
+		}
+
+		loader_impl_handle_invalidate(handle_impl);
+
+		loader_impl_unlock_write();
+
+		if (initialized && handle_impl->module != NULL && handle_impl->iface->clear(handle_impl->impl, handle_impl->module) != 0)
+		{
+			log_write("metacall", LOG_LEVEL_ERROR, "Error when clearing handle impl: %p", (void *)handle_impl);
 		}
 
 		context_destroy(handle_impl->ctx);
@@ -1063,18 +1178,68 @@ void loader_impl_destroy_handle(loader_handle_impl handle_impl)
 
 void loader_impl_destroy_handle_children(loader_impl impl, size_t init_order)
 {
-	/* Here we delete all the subsequent loaded scripts because this script can load others,
-	and once it is destroyed it must clear all of them */
-	size_t iterator, size = vector_size(impl->handle_impl_init_order);
+	/* Here we delete all the scripts loaded by this one because this script can load others,
+	and once it is destroyed it must clear all of them, the positions after it which belong
+	to loads done concurrently by other threads are left untouched */
+	size_t iterator, size;
+	vector children = vector_create_type(loader_handle_impl);
+
+	if (children == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid allocation of the children of the handle in position %" PRIuS, init_order);
+	}
+
+	/* The children are destroyed out of the lock because their clear calls into the loader */
+	loader_impl_lock_write();
+
+	size = vector_size(impl->handle_impl_init_order);
 
-	for (iterator = init_order + 1; iterator < size; ++iterator)
+	for (iterator = init_order + 1; iterator < size && children != NULL; ++iterator)
 	{
-		loader_handle_impl iterator_handle_impl = vector_at_type(impl->handle_impl_init_order, iterator, loader_handle_impl);
+		loader_impl_init_order child = vector_at(impl->handle_impl_init_order, iterator);
+		size_t parent = child->parent;
+
+		/* The parents always precede their children, so the ancestors are walked back until reaching this handle */
+		while (parent != LOADER_IMPL_INIT_ORDER_ROOT && parent > init_order)
+		{
+			parent = ((loader_impl_init_order)vector_at(impl->handle_impl_init_order, parent))->parent;
+		}
+
+		if (parent == init_order && child->handle_impl != NULL)
+		{
+			loader_handle_impl handle_impl = child->handle_impl;
+
+			set_remove(impl->handle_impl_path_map, (set_key)handle_impl->path);
+
+			if (handle_impl->module != NULL)
+			{
+				set_remove(impl->handle_impl_map, (set_key)handle_impl->module);
+			}
+
+			vector_push_back_var(children, handle_impl);
 
-		loader_impl_destroy_handle(iterator_handle_impl);
+			child->handle_impl = NULL;
+		}
 	}
 
-	vector_pop_back(impl->handle_impl_init_order);
+	loader_impl_handle_init_order_remove(impl, init_order);
+
+	loader_impl_unlock_write();
+
+	if (children != NULL)
+	{
+		/* Destroy them in inverse creation order */
+		iterator = vector_size(children);
+
+		while (iterator > 0)
+		{
+			--iterator;
+
+			loader_impl_destroy_handle(vector_at_type(children, iterator, loader_handle_impl));
+		}
+
+		vector_destroy(children);
+	}
 }
 
 int loader_impl_execution_path(plugin p, loader_impl impl, const loader_path path)
@@ -1126,10 +1291,16 @@ int loader_impl_function_hook_call(context ctx, const char func_name[])
 {
 	scope sp = context_scope(ctx);
 
-	value val = scope_get(sp, func_name);
+	value val;
 
 	function func_init = NULL;
 
+	loader_impl_lock_read();
+
+	val = scope_get(sp, func_name);
+
+	loader_impl_unlock_read();
+
 	if (val != NULL)
 	{
 		func_init = value_to_function(val);
@@ -1154,25 +1325,14 @@ int loader_impl_function_hook_call(context ctx, const char func_name[])
 	return 0;
 }
 
-int loader_impl_handle_init(loader_impl impl, loader_handle_impl handle_impl, void **handle_ptr, int populated)
+void loader_impl_handle_init(loader_handle_impl handle_impl, void **handle_ptr, int populated)
 {
-	static const char func_init_name[] = LOADER_IMPL_FUNCTION_INIT;
-
-	int result = loader_impl_function_hook_call(impl->ctx, func_init_name);
-
 	handle_impl->populated = populated;
 
-	if (result != 0)
-	{
-		log_write("metacall", LOG_LEVEL_ERROR, "Error when calling to init hook function (" LOADER_IMPL_FUNCTION_INIT ") of handle: %s", handle_impl->path);
-	}
-
 	if (handle_ptr != NULL)
 	{
 		*handle_ptr = handle_impl;
 	}
-
-	return result;
 }
 
 int loader_impl_handle_register(plugin_manager manager, loader_impl impl, loader_handle_impl handle_impl, void **handle_ptr)
@@ -1199,7 +1359,9 @@ int loader_impl_handle_register(plugin_manager manager, loader_impl impl, loader
 
 		if (context_append(impl->ctx, handle_impl->ctx) == 0)
 		{
-			return loader_impl_handle_init(impl, handle_impl, handle_ptr, 0);
+			loader_impl_handle_init(handle_impl, handle_ptr, 0);
+
+			return 0;
 		}
 	}
 	else
@@ -1219,63 +1381,137 @@ int loader_impl_handle_register(plugin_manager manager, loader_impl impl, loader
 			{
 				vector_push_back_var(handle_impl->populated_handles, target_handle);
 
-				return loader_impl_handle_init(impl, handle_impl, NULL, 1);
+				loader_impl_handle_invalidate(target_handle);
+
+				loader_impl_handle_init(handle_impl, NULL, 1);
+
+				return 0;
 			}
 		}
 		else
 		{
 			/* Otherwise, initialize the handle and do not propagate the symbols, keep it private to the handle instance */
-			return loader_impl_handle_init(impl, handle_impl, handle_ptr, 1);
+			loader_impl_handle_init(handle_impl, handle_ptr, 1);
+
+			return 0;
 		}
 	}
 
 	return 1;
 }
 
-int loader_impl_handle_init_order(loader_impl impl, void **handle_ptr, size_t *init_order_ptr)
+int loader_impl_handle_init_order(loader_impl impl, void **handle_ptr, loader_impl_load load)
 {
-	size_t init_order = 0;
 	int init_order_not_initialized = !(handle_ptr != NULL && *handle_ptr != NULL);
 
+	load->impl = impl;
+	load->init_order = 0;
+	load->prev = NULL;
+
 	if (init_order_not_initialized)
 	{
-		init_order = vector_size(impl->handle_impl_init_order);
+		/* The position is reserved with an empty handle, so the clears done meanwhile never match it */
+		struct loader_impl_init_order_type init_order = { NULL, LOADER_IMPL_INIT_ORDER_ROOT };
 
-		vector_push_back_empty(impl->handle_impl_init_order);
-	}
+#if defined(PORTABILITY_THREAD_LOCAL)
+		loader_impl_load parent;
 
-	*init_order_ptr = init_order;
+		/* The handle is a child of the innermost load of the same loader which is in progress in this thread */
+		for (parent = loader_impl_load_current; parent != NULL; parent = parent->prev)
+		{
+			if (parent->impl == impl)
+			{
+				init_order.parent = parent->init_order;
+				break;
+			}
+		}
+#endif
+
+		loader_impl_lock_write();
+
+		load->init_order = vector_size(impl->handle_impl_init_order);
+
+		vector_push_back_var(impl->handle_impl_init_order, init_order);
+
+		loader_impl_unlock_write();
+
+#if defined(PORTABILITY_THREAD_LOCAL)
+		load->prev = loader_impl_load_current;
+		loader_impl_load_current = load;
+#endif
+	}
 
 	return init_order_not_initialized;
 }
 
-int loader_impl_handle_discover(plugin_manager manager, loader_impl impl, loader_impl_interface iface, loader_handle handle, const char *path, void **handle_ptr, size_t init_order, int init_order_not_initialized)
+void loader_impl_handle_init_order_end(loader_impl_load load, int init_order_not_initialized)
+{
+#if defined(PORTABILITY_THREAD_LOCAL)
+	if (init_order_not_initialized)
+	{
+		loader_impl_load_current = load->prev;
+	}
+#else
+	(void)load;
+	(void)init_order_not_initialized;
+#endif
+}
+
+void loader_impl_handle_init_order_remove(loader_impl impl, size_t init_order)
+{
+	/* The position is left empty instead of erased because the loads in progress in other threads have reserved the positions after it */
+	if (init_order + 1 == vector_size(impl->handle_impl_init_order))
+	{
+		vector_pop_back(impl->handle_impl_init_order);
+	}
+	else
+	{
+		loader_impl_init_order position = vector_at(impl->handle_impl_init_order, init_order);
+
+		position->handle_impl = NULL;
+	}
+}
+
+int loader_impl_handle_discover(plugin_manager manager, loader_impl impl, loader_impl_interface iface, loader_handle handle, const char *path, void **handle_ptr, loader_impl_load load, int init_order_not_initialized)
 {
 	/* if the handle has failed to be loaded, clean all the loaded children */
 	if (handle == NULL)
 	{
+		loader_impl_handle_init_order_end(load, init_order_not_initialized);
+
 		if (init_order_not_initialized)
 		{
-			loader_impl_destroy_handle_children(impl, init_order);
+			loader_impl_destroy_handle_children(impl, load->init_order);
 		}
 
 		return 1;
 	}
 
-	return loader_impl_handle_discover_impl(manager, impl, iface, handle, path, handle_ptr, init_order, init_order_not_initialized);
+	return loader_impl_handle_discover_impl(manager, impl, iface, handle, path, handle_ptr, load, init_order_not_initialized);
 }
 
-int loader_impl_handle_discover_impl(plugin_manager manager, loader_impl impl, loader_impl_interface iface, loader_handle handle, const char *path, void **handle_ptr, size_t init_order, int init_order_not_initialized)
+int loader_impl_handle_discover_impl(plugin_manager manager, loader_impl impl, loader_impl_interface iface, loader_handle handle, const char *path, void **handle_ptr, loader_impl_load load, int init_order_not_initialized)
 {
+	static const char func_init_name[] = LOADER_IMPL_FUNCTION_INIT;
+
 	loader_handle_impl handle_impl = loader_impl_load_handle(impl, iface, handle, path, LOADER_PATH_SIZE);
 
 	if (handle_impl == NULL)
 	{
+		loader_impl_handle_init_order_end(load, init_order_not_initialized);
+
+		if (init_order_not_initialized)
+		{
+			loader_impl_destroy_handle_children(impl, load->init_order);
+		}
+
 		return 1;
 	}
 
 	handle_impl->populated = 1;
 
+	loader_impl_lock_write();
+
 	if (set_insert(impl->handle_impl_path_map, handle_impl->path, handle_impl) != 0)
 	{
 		goto insert_handle_path_map_error;
@@ -1289,19 +1525,44 @@ int loader_impl_handle_discover_impl(plugin_manager manager, loader_impl impl, l
 		}
 	}
 
+	loader_impl_unlock_write();
+
+	/* The symbols are discovered into the context of the handle, which is not visible until it is registered */
 	if (iface != NULL)
 	{
 		if (iface->discover(impl, handle_impl->module, handle_impl->ctx) != 0)
 		{
+			loader_impl_lock_write();
 			goto discover_handle_error;
 		}
 	}
 
+	loader_impl_lock_write();
+
+	handle_impl->discovered = 0;
+
 	if (loader_impl_handle_register(manager, impl, handle_impl, handle_ptr) == 0)
 	{
+		/* A new handle has been registered, so the metadata has changed */
+		loader_impl_handle_invalidate(handle_impl);
+
+		loader_impl_unlock_write();
+
+		if (loader_impl_function_hook_call(impl->ctx, func_init_name) != 0)
+		{
+			log_write("metacall", LOG_LEVEL_ERROR, "Error when calling to init hook function (" LOADER_IMPL_FUNCTION_INIT ") of handle: %s", handle_impl->path);
+
+			loader_impl_lock_write();
+			goto discover_handle_error;
+		}
+
+		loader_impl_handle_init_order_end(load, init_order_not_initialized);
+
 		if (init_order_not_initialized)
 		{
-			vector_set_var(impl->handle_impl_init_order, init_order, handle_impl);
+			loader_impl_lock_write();
+			((loader_impl_init_order)vector_at(impl->handle_impl_init_order, load->init_order))->handle_impl = handle_impl;
+			loader_impl_unlock_write();
 		}
 
 		return 0;
@@ -1315,9 +1576,13 @@ discover_handle_error:
 insert_handle_map_error:
 	set_remove(impl->handle_impl_path_map, handle_impl->path);
 insert_handle_path_map_error:
+	loader_impl_unlock_write();
+
+	loader_impl_handle_init_order_end(load, init_order_not_initialized);
+
 	if (init_order_not_initialized)
 	{
-		loader_impl_destroy_handle_children(impl, init_order);
+		loader_impl_destroy_handle_children(impl, load->init_order);
 	}
 
 	log_write("metacall", LOG_LEVEL_ERROR, "Error when loading handle: %s", handle_impl->path);
@@ -1376,7 +1641,7 @@ int loader_impl_load_from_file(plugin_manager manager, plugin p, loader_impl imp
 		{
 			loader_handle handle;
 			loader_path path;
-			size_t init_order;
+			struct loader_impl_load_type load;
 			int init_order_not_initialized;
 
 			if (loader_impl_initialize(manager, p, impl) != 0)
@@ -1391,14 +1656,14 @@ int loader_impl_load_from_file(plugin_manager manager, plugin p, loader_impl imp
 				return 1;
 			}
 
-			init_order_not_initialized = loader_impl_handle_init_order(impl, handle_ptr, &init_order);
+			init_order_not_initialized = loader_impl_handle_init_order(impl, handle_ptr, &load);
 
 			handle = iface->load_from_file(impl, paths, size, data);
 
 			/* TODO: Disable logs here until log is completely thread safe and async signal safe */
 			/* log_write("metacall", LOG_LEVEL_DEBUG, "Loader interface: %p - Loader handle: %p", (void *)iface, (void *)handle); */
 
-			return loader_impl_handle_discover(manager, impl, iface, handle, path, handle_ptr, init_order, init_order_not_initialized);
+			return loader_impl_handle_discover(manager, impl, iface, handle, path, handle_ptr, &load, init_order_not_initialized);
 		}
 	}
 
@@ -1410,7 +1675,7 @@ int loader_impl_load_from_memory_name(loader_impl impl, loader_name name, const
 	/* TODO: Improve name with time or uuid */
 	static const char format[] = "%p-%p-%" PRIuS "-%u";
 
-	hash h = hash_callback_str((const hash_key)buffer);
+	hash h = hash_buffer_stable(buffer, size);
 
 	size_t length = snprintf(NULL, 0, format, (const void *)impl, (const void *)buffer, size, (unsigned int)h);
 
@@ -1440,7 +1705,7 @@ int loader_impl_load_from_memory(plugin_manager manager, plugin p, loader_impl i
 		{
 			loader_name name;
 			loader_handle handle = NULL;
-			size_t init_order;
+			struct loader_impl_load_type load;
 			int init_order_not_initialized;
 
 			if (loader_impl_initialize(manager, p, impl) != 0)
@@ -1462,14 +1727,14 @@ int loader_impl_load_from_memory(plugin_manager manager, plugin p, loader_impl i
 				return 1;
 			}
 
-			init_order_not_initialized = loader_impl_handle_init_order(impl, handle_ptr, &init_order);
+			init_order_not_initialized = loader_impl_handle_init_order(impl, handle_ptr, &load);
 
 			handle = iface->load_from_memory(impl, name, buffer, size, data);
 
 			/* TODO: Disable logs here until log is completely thread safe and async signal safe */
 			/* log_write("metacall", LOG_LEVEL_DEBUG, "Loader interface: %p - Loader handle: %p", (void *)iface, (void *)handle); */
 
-			return loader_impl_handle_discover(manager, impl, iface, handle, name, handle_ptr, init_order, init_order_not_initialized);
+			return loader_impl_handle_discover(manager, impl, iface, handle, name, handle_ptr, &load, init_order_not_initialized);
 		}
 	}
 
@@ -1482,7 +1747,7 @@ int loader_impl_load_from_package(plugin_manager manager, plugin p, loader_impl
 	{
 		loader_impl_interface iface = loader_iface(p);
 		loader_path subpath;
-		size_t init_order;
+		struct loader_impl_load_type load;
 		int init_order_not_initialized;
 
 		if (iface != NULL && loader_impl_handle_name(manager, path, subpath) > 1)
@@ -1501,14 +1766,14 @@ int loader_impl_load_from_package(plugin_manager manager, plugin p, loader_impl
 				return 1;
 			}
 
-			init_order_not_initialized = loader_impl_handle_init_order(impl, handle_ptr, &init_order);
+			init_order_not_initialized = loader_impl_handle_init_order(impl, handle_ptr, &load);
 
 			handle = iface->load_from_package(impl, path, data);
 
 			/* TODO: Disable logs here until log is completely thread safe and async signal safe */
 			/* log_write("metacall", LOG_LEVEL_DEBUG, "Loader interface: %p - Loader handle: %p", (void *)iface, (void *)handle); */
 
-			return loader_impl_handle_discover(manager, impl, iface, handle, subpath, handle_ptr, init_order, init_order_not_initialized);
+			return loader_impl_handle_discover(manager, impl, iface, handle, subpath, handle_ptr, &load, init_order_not_initialized);
 		}
 	}
 
@@ -1519,7 +1784,15 @@ void *loader_impl_get_handle(loader_impl impl, const char *name)
 {
 	if (impl != NULL && name != NULL)
 	{
-		return (void *)set_get(impl->handle_impl_path_map, (set_key)name);
+		void *handle;
+
+		loader_impl_lock_read();
+
+		handle = (void *)set_get(impl->handle_impl_path_map, (set_key)name);
+
+		loader_impl_unlock_read();
+
+		return handle;
 	}
 
 	return NULL;
@@ -1578,10 +1851,22 @@ int loader_impl_get_option_host(loader_impl impl)
 	return 0;
 }
 
+int loader_impl_get_option_lazy(loader_impl impl)
+{
+	value lazy = loader_impl_get_option(impl, "lazy");
+
+	if (lazy != NULL && value_type_id(lazy) == TYPE_BOOL)
+	{
+		return value_to_bool(lazy);
+	}
+
+	return 0;
+}
+
 int loader_impl_handle_initialize(plugin_manager manager, plugin p, loader_impl impl, const loader_path name, void **handle_ptr)
 {
 	loader_path path;
-	size_t init_order;
+	struct loader_impl_load_type load;
 	int init_order_not_initialized;
 
 	if (impl == NULL)
@@ -1601,10 +1886,10 @@ int loader_impl_handle_initialize(plugin_manager manager, plugin p, loader_impl
 		return 1;
 	}
 
-	init_order_not_initialized = loader_impl_handle_init_order(impl, handle_ptr, &init_order);
+	init_order_not_initialized = loader_impl_handle_init_order(impl, handle_ptr, &load);
 
 	/* We pass module and iface as null so we skip the discover step, it is not needed here because we manually initialize it */
-	return loader_impl_handle_discover_impl(manager, impl, NULL, NULL, path, handle_ptr, init_order, init_order_not_initialized);
+	return loader_impl_handle_discover_impl(manager, impl, NULL, NULL, path, handle_ptr, &load, init_order_not_initialized);
 }
 
 vector loader_impl_handle_populated(void *handle)
@@ -1639,7 +1924,15 @@ void *loader_impl_handle_container_of(loader_impl impl, void *handle)
 {
 	if (handle != NULL)
 	{
-		return (void *)((loader_handle_impl)set_get(impl->handle_impl_map, (set_key)handle));
+		void *handle_impl;
+
+		loader_impl_lock_read();
+
+		handle_impl = (void *)((loader_handle_impl)set_get(impl->handle_impl_map, (set_key)handle));
+
+		loader_impl_unlock_read();
+
+		return handle_impl;
 	}
 
 	return NULL;
@@ -1652,6 +1945,25 @@ int loader_impl_handle_validate(void *handle)
 	return !(handle_impl != NULL && handle_impl->magic == (uintptr_t)loader_handle_impl_magic_alloc);
 }
 
+void loader_impl_handle_invalidate(void *handle)
+{
+	loader_handle_impl handle_impl = handle;
+
+	if (handle_impl != NULL && handle_impl->metadata != NULL)
+	{
+		value_type_destroy(handle_impl->metadata);
+
+		handle_impl->metadata = NULL;
+	}
+
+	atomic_fetch_add_explicit(&loader_impl_metadata_generation_counter, 1, memory_order_release);
+}
+
+uint64_t loader_impl_metadata_generation(void)
+{
+	return (uint64_t)atomic_load_explicit(&loader_impl_metadata_generation_counter, memory_order_acquire);
+}
+
 value loader_impl_metadata_handle_name(loader_handle_impl handle_impl)
 {
 	static const char name[] = "name";
@@ -1754,7 +2066,8 @@ value loader_impl_metadata_handle(loader_handle_impl handle_impl)
 
 value loader_impl_metadata(loader_impl impl)
 {
-	value *values, v = value_create_array(NULL, set_size(impl->handle_impl_path_map));
+	size_t size = set_size(impl->handle_impl_path_map);
+	value *values, v = value_create_array(NULL, size);
 	struct set_iterator_type it;
 	size_t values_it;
 
@@ -1769,7 +2082,19 @@ value loader_impl_metadata(loader_impl impl)
 	{
 		loader_handle_impl handle_impl = set_iterator_value(&it);
 
-		values[values_it] = loader_impl_metadata_handle(handle_impl);
+		/* Skip the handles which are still being loaded by other thread */
+		if (handle_impl->discovered != 0)
+		{
+			continue;
+		}
+
+		/* Generate the metadata only if the handle has been modified since the last time */
+		if (handle_impl->metadata == NULL)
+		{
+			handle_impl->metadata = loader_impl_metadata_handle(handle_impl);
+		}
+
+		values[values_it] = value_type_copy(handle_impl->metadata);
 
 		if (values[values_it] != NULL)
 		{
@@ -1777,6 +2102,23 @@ value loader_impl_metadata(loader_impl impl)
 		}
 	}
 
+	/* The array cannot contain empty elements, so it is shrunk to the handles skipped or failed */
+	if (values_it < size)
+	{
+		value compact = value_create_array(values, values_it);
+
+		if (compact == NULL)
+		{
+			value_type_destroy(v);
+
+			return NULL;
+		}
+
+		value_destroy(v);
+
+		v = compact;
+	}
+
 	return v;
 }
 
@@ -1790,8 +2132,12 @@ int loader_impl_clear(void *handle)
 
 		size_t iterator;
 
+		int result;
+
+		loader_impl_lock_write();
+
 		/* Remove the handle from the path indexing set */
-		int result = !(set_remove(impl->handle_impl_path_map, (set_key)handle_impl->path) == handle_impl);
+		result = !(set_remove(impl->handle_impl_path_map, (set_key)handle_impl->path) == handle_impl);
 
 		/* Remove the handle from the pointer indexing set */
 		result |= !(set_remove(impl->handle_impl_map, (set_key)handle_impl->module) == handle_impl);
@@ -1799,15 +2145,18 @@ int loader_impl_clear(void *handle)
 		/* Search for the handle in the initialization order list and remove it */
 		for (iterator = 0; iterator < vector_size(impl->handle_impl_init_order); ++iterator)
 		{
-			loader_handle_impl iterator_handle_impl = vector_at_type(impl->handle_impl_init_order, iterator, loader_handle_impl);
+			loader_impl_init_order init_order = vector_at(impl->handle_impl_init_order, iterator);
 
-			if (handle_impl == iterator_handle_impl)
+			if (handle_impl == init_order->handle_impl)
 			{
-				vector_erase(impl->handle_impl_init_order, iterator);
+				loader_impl_handle_init_order_remove(impl, iterator);
+
 				break;
 			}
 		}
 
+		loader_impl_unlock_write();
+
 		loader_impl_destroy_handle(handle_impl);
 
 		return result;
@@ -1832,15 +2181,15 @@ void loader_impl_destroy_objects(loader_impl impl)
 
 		if (iterator > 0)
 		{
-			loader_handle_impl iterator_handle_impl;
+			loader_impl_init_order init_order;
 
 			do
 			{
 				--iterator;
 
-				iterator_handle_impl = vector_at_type(impl->handle_impl_init_order, iterator, loader_handle_impl);
+				init_order = vector_at(impl->handle_impl_init_order, iterator);
 
-				loader_impl_destroy_handle(iterator_handle_impl);
+				loader_impl_destroy_handle(init_order->handle_impl);
 
 			} while (iterator > 0);
 		}
@@ -1920,6 +2269,8 @@ void loader_impl_destroy_deallocate(loader_impl impl)
 
 	set_destroy(impl->library_map);
 
+	threading_mutex_destroy(&impl->init_mutex);
+
 	free(impl);
 }
 
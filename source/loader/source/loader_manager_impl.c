@@ -26,16 +26,33 @@
 
 #include <environment/environment_variable_path.h>
 
+#include <portability/portability_library_path.h>
 #include <portability/portability_path.h>
 #include <portability/portability_working_path.h>
 
 #include <log/log.h>
 
+#include <string.h>
+
 /* -- Definitions -- */
 
 #define LOADER_SCRIPT_PATH		   "LOADER_SCRIPT_PATH"
 #define LOADER_SCRIPT_DEFAULT_PATH "."
 
+/* -- Member Data -- */
+
+struct loader_manager_impl_library_type
+{
+	char *path;
+	size_t name; /* Offset of the file name inside of the path */
+};
+
+struct loader_manager_impl_dependency_type
+{
+	const char *path; /* Points to the snapshot, it is NULL if the dependency is not loaded in the process */
+	char name[];
+};
+
 /* -- Private Methods -- */
 
 static vector loader_manager_impl_script_paths_initialize(void);
@@ -44,6 +61,16 @@ static void loader_manager_impl_iface_destroy(plugin_manager manager, void *impl
 
 static void loader_manager_impl_script_paths_destroy(vector script_paths);
 
+static int loader_manager_impl_libraries_list(const char *library, void *data);
+
+static int loader_manager_impl_libraries_refresh(loader_manager_impl manager_impl);
+
+static void loader_manager_impl_libraries_clear(loader_manager_impl manager_impl);
+
+static const char *loader_manager_impl_libraries_find(loader_manager_impl manager_impl, const char *name);
+
+static const char *loader_manager_impl_dependency_find_impl(loader_manager_impl manager_impl, const char *name);
+
 /* -- Private Data -- */
 
 static void *loader_manager_impl_is_destroyed_ptr = NULL;
@@ -159,6 +186,16 @@ loader_manager_impl loader_manager_impl_initialize(void)
 		goto script_paths_error;
 	}
 
+	manager_impl->libraries = NULL;
+	manager_impl->libraries_generation = 0;
+	manager_impl->dependencies = NULL;
+
+	if (threading_mutex_initialize(&manager_impl->libraries_mutex) != 0)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Loader failed to initialize the libraries mutex");
+		goto libraries_mutex_error;
+	}
+
 	manager_impl->init_thread_id = thread_id_get_current();
 
 	manager_impl->host = loader_host_initialize();
@@ -172,6 +209,8 @@ loader_manager_impl loader_manager_impl_initialize(void)
 	return manager_impl;
 
 host_error:
+	threading_mutex_destroy(&manager_impl->libraries_mutex);
+libraries_mutex_error:
 	loader_manager_impl_script_paths_destroy(manager_impl->script_paths);
 script_paths_error:
 	set_destroy(manager_impl->destroy_map);
@@ -223,10 +262,227 @@ int loader_manager_impl_is_destroyed(loader_manager_impl manager_impl, loader_im
 	return set_get(manager_impl->destroy_map, impl) != &loader_manager_impl_is_destroyed_ptr;
 }
 
+int loader_manager_impl_libraries_list(const char *library, void *data)
+{
+	vector libraries = (vector)data;
+	struct loader_manager_impl_library_type lib;
+	size_t iterator, length = strnlen(library, PORTABILITY_PATH_SIZE);
+
+	/* Skip the executable and the virtual libraries */
+	if (length == 0)
+	{
+		return 0;
+	}
+
+	lib.path = malloc(sizeof(char) * (length + 1));
+
+	if (lib.path == NULL)
+	{
+		return 1;
+	}
+
+	memcpy(lib.path, library, sizeof(char) * length);
+	lib.path[length] = '\0';
+	lib.name = 0;
+
+	for (iterator = 0; iterator < length; ++iterator)
+	{
+		if (PORTABILITY_PATH_SEPARATOR(library[iterator]))
+		{
+			lib.name = iterator + 1;
+		}
+	}
+
+	vector_push_back(libraries, &lib);
+
+	return 0;
+}
+
+void loader_manager_impl_libraries_clear(loader_manager_impl manager_impl)
+{
+	if (manager_impl->dependencies != NULL)
+	{
+		struct set_iterator_type it;
+
+		for (set_iterator_begin(&it, manager_impl->dependencies); set_iterator_end(&it) != 0; set_iterator_next(&it))
+		{
+			free(set_iterator_value(&it));
+		}
+
+		set_clear(manager_impl->dependencies);
+	}
+
+	if (manager_impl->libraries != NULL)
+	{
+		size_t iterator, size = vector_size(manager_impl->libraries);
+
+		for (iterator = 0; iterator < size; ++iterator)
+		{
+			struct loader_manager_impl_library_type *lib = vector_at(manager_impl->libraries, iterator);
+
+			free(lib->path);
+		}
+
+		vector_clear(manager_impl->libraries);
+	}
+}
+
+int loader_manager_impl_libraries_refresh(loader_manager_impl manager_impl)
+{
+	uint64_t generation = 0;
+
+	/* Reuse the snapshot while no library has been loaded or unloaded, if the platform
+	does not provide the generation, the snapshot is always taken again */
+	if (portability_library_path_generation(&generation) == 0 && manager_impl->libraries != NULL && generation == manager_impl->libraries_generation)
+	{
+		return 0;
+	}
+
+	loader_manager_impl_libraries_clear(manager_impl);
+
+	if (manager_impl->libraries == NULL)
+	{
+		manager_impl->libraries = vector_create(sizeof(struct loader_manager_impl_library_type));
+
+		if (manager_impl->libraries == NULL)
+		{
+			return 1;
+		}
+	}
+
+	if (manager_impl->dependencies == NULL)
+	{
+		manager_impl->dependencies = set_create(&hash_callback_str, &comparable_callback_str);
+
+		if (manager_impl->dependencies == NULL)
+		{
+			return 1;
+		}
+	}
+
+	if (portability_library_path_list(&loader_manager_impl_libraries_list, (void *)manager_impl->libraries) != 0)
+	{
+		loader_manager_impl_libraries_clear(manager_impl);
+		return 1;
+	}
+
+	manager_impl->libraries_generation = generation;
+
+	return 0;
+}
+
+const char *loader_manager_impl_libraries_find(loader_manager_impl manager_impl, const char *name)
+{
+	size_t iterator, size = vector_size(manager_impl->libraries);
+
+	for (iterator = 0; iterator < size; ++iterator)
+	{
+		struct loader_manager_impl_library_type *lib = vector_at(manager_impl->libraries, iterator);
+
+		/* Try to find the dependency name in the file name of the library */
+		if (strstr(&lib->path[lib->name], name) != NULL)
+		{
+			return lib->path;
+		}
+	}
+
+	return NULL;
+}
+
+const char *loader_manager_impl_dependency_find_impl(loader_manager_impl manager_impl, const char *name)
+{
+	struct loader_manager_impl_dependency_type *dependency;
+	size_t length;
+
+	if (loader_manager_impl_libraries_refresh(manager_impl) != 0)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Loader failed to list the libraries of the process");
+		return NULL;
+	}
+
+	dependency = set_get(manager_impl->dependencies, (set_key)name);
+
+	if (dependency != NULL)
+	{
+		return dependency->path;
+	}
+
+	length = strlen(name) + 1;
+
+	dependency = malloc(sizeof(struct loader_manager_impl_dependency_type) + sizeof(char) * length);
+
+	if (dependency == NULL)
+	{
+		return loader_manager_impl_libraries_find(manager_impl, name);
+	}
+
+	memcpy(dependency->name, name, sizeof(char) * length);
+
+	dependency->path = loader_manager_impl_libraries_find(manager_impl, name);
+
+	if (set_insert(manager_impl->dependencies, (set_key)dependency->name, dependency) != 0)
+	{
+		const char *path = dependency->path;
+
+		free(dependency);
+
+		return path;
+	}
+
+	return dependency->path;
+}
+
+int loader_manager_impl_dependency_find(loader_manager_impl manager_impl, const char *name, char *path, size_t size)
+{
+	const char *dependency_path;
+	int result = 1;
+
+	if (manager_impl == NULL || name == NULL || path == NULL || size == 0)
+	{
+		return 1;
+	}
+
+	threading_mutex_lock(&manager_impl->libraries_mutex);
+
+	dependency_path = loader_manager_impl_dependency_find_impl(manager_impl, name);
+
+	/* The path is copied while the lock is held because another thread can refresh the snapshot it points to */
+	if (dependency_path != NULL)
+	{
+		size_t length = strlen(dependency_path) + 1;
+
+		if (length <= size)
+		{
+			memcpy(path, dependency_path, sizeof(char) * length);
+			result = 0;
+		}
+		else
+		{
+			log_write("metacall", LOG_LEVEL_ERROR, "Loader dependency path is too long: %s", dependency_path);
+		}
+	}
+
+	threading_mutex_unlock(&manager_impl->libraries_mutex);
+
+	return result;
+}
+
 void loader_manager_impl_destroy(loader_manager_impl manager_impl)
 {
 	if (manager_impl != NULL)
 	{
+		loader_manager_impl_libraries_clear(manager_impl);
+
+		if (manager_impl->libraries != NULL)
+		{
+			vector_destroy(manager_impl->libraries);
+		}
+
+		if (manager_impl->dependencies != NULL)
+		{
+			set_destroy(manager_impl->dependencies);
+		}
+
 		if (manager_impl->initialization_order != NULL)
 		{
 			vector_destroy(manager_impl->initialization_order);
@@ -237,6 +493,8 @@ void loader_manager_impl_destroy(loader_manager_impl manager_impl)
 			set_destroy(manager_impl->destroy_map);
 		}
 
+		threading_mutex_destroy(&manager_impl->libraries_mutex);
+
 		manager_impl->init_thread_id = THREAD_ID_INVALID;
 
 		if (manager_impl->script_paths != NULL)
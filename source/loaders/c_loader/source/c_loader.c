@@ -33,7 +33,8 @@ loader_impl_interface c_loader_impl_interface_singleton(void)
 		&c_loader_impl_load_from_package,
 		&c_loader_impl_clear,
 		&c_loader_impl_discover,
-		&c_loader_impl_destroy
+		&c_loader_impl_destroy,
+		NULL
 	};
 
 	return &loader_impl_interface_c;
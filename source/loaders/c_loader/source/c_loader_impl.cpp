@@ -1136,7 +1136,8 @@ function_interface function_c_singleton()
 		&function_c_interface_create,
 		&function_c_interface_invoke,
 		&function_c_interface_await,
-		&function_c_interface_destroy
+		&function_c_interface_destroy,
+		NULL
 	};
 
 	return &c_interface;
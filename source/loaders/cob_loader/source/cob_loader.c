@@ -33,7 +33,8 @@ loader_impl_interface cob_loader_impl_interface_singleton(void)
 		&cob_loader_impl_load_from_package,
 		&cob_loader_impl_clear,
 		&cob_loader_impl_discover,
-		&cob_loader_impl_destroy
+		&cob_loader_impl_destroy,
+		NULL
 	};
 
 	return &loader_impl_interface_cob;
@@ -112,7 +112,8 @@ function_interface function_cob_singleton(void)
 		&function_cob_interface_create,
 		&function_cob_interface_invoke,
 		&function_cob_interface_await,
-		&function_cob_interface_destroy
+		&function_cob_interface_destroy,
+		NULL
 	};
 
 	return &cob_interface;
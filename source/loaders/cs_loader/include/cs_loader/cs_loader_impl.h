@@ -37,6 +37,8 @@ CS_LOADER_API int cs_loader_impl_discover(loader_impl impl, loader_handle handle
 
 CS_LOADER_API int cs_loader_impl_destroy(loader_impl impl);
 
+CS_LOADER_API int cs_loader_impl_fork(loader_impl impl, enum loader_impl_fork_id id);
+
 #ifdef __cplusplus
 }
 #endif
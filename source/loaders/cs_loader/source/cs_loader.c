@@ -24,7 +24,8 @@ loader_impl_interface cs_loader_impl_interface_singleton(void)
 		&cs_loader_impl_load_from_package,
 		&cs_loader_impl_clear,
 		&cs_loader_impl_discover,
-		&cs_loader_impl_destroy
+		&cs_loader_impl_destroy,
+		&cs_loader_impl_fork
 	};
 
 	return &loader_impl_interface_cs;
@@ -160,7 +160,8 @@ function_interface function_cs_singleton(void)
 		&function_cs_interface_create,
 		&function_cs_interface_invoke,
 		&function_cs_interface_await,
-		&function_cs_interface_destroy
+		&function_cs_interface_destroy,
+		NULL
 	};
 
 	return &cs_interface;
@@ -413,3 +414,18 @@ int cs_loader_impl_destroy(loader_impl impl)
 
 	return 0;
 }
+
+int cs_loader_impl_fork(loader_impl impl, enum loader_impl_fork_id id)
+{
+	(void)impl;
+
+	/* CoreCLR keeps the finalizer, the tiered compilation and the garbage collector in background threads,
+	which are lost in the child together with any lock they were holding */
+	if (id == LOADER_IMPL_FORK_PREPARE)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "C# loader does not support fork, spawn the workers before loading C#");
+		return 1;
+	}
+
+	return 0;
+}
@@ -47,6 +47,8 @@ DART_LOADER_API int dart_loader_impl_discover(loader_impl impl, loader_handle ha
 
 DART_LOADER_API int dart_loader_impl_destroy(loader_impl impl);
 
+DART_LOADER_API int dart_loader_impl_fork(loader_impl impl, enum loader_impl_fork_id id);
+
 #ifdef __cplusplus
 }
 #endif
@@ -33,7 +33,8 @@ loader_impl_interface dart_loader_impl_interface_singleton(void)
 		&dart_loader_impl_load_from_package,
 		&dart_loader_impl_clear,
 		&dart_loader_impl_discover,
-		&dart_loader_impl_destroy
+		&dart_loader_impl_destroy,
+		&dart_loader_impl_fork
 	};
 
 	return &loader_impl_interface_dart;
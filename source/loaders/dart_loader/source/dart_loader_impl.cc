@@ -242,7 +242,8 @@ function_interface function_dart_singleton(void)
 		&function_dart_interface_create,
 		&function_dart_interface_invoke,
 		&function_dart_interface_await,
-		&function_dart_interface_destroy
+		&function_dart_interface_destroy,
+		NULL
 	};
 
 	return &dart_interface;
@@ -630,3 +631,18 @@ int dart_loader_impl_destroy(loader_impl impl)
 
 	return 1;
 }
+
+int dart_loader_impl_fork(loader_impl impl, enum loader_impl_fork_id id)
+{
+	(void)impl;
+
+	/* The Dart VM schedules its isolates, the compiler and the garbage collector in its own thread pool,
+	which does not exist in the child */
+	if (id == LOADER_IMPL_FORK_PREPARE)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Dart loader does not support fork, spawn the workers before loading Dart");
+		return 1;
+	}
+
+	return 0;
+}
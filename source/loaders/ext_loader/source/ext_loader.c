@@ -33,7 +33,8 @@ loader_impl_interface ext_loader_impl_interface_singleton(void)
 		&ext_loader_impl_load_from_package,
 		&ext_loader_impl_clear,
 		&ext_loader_impl_discover,
-		&ext_loader_impl_destroy
+		&ext_loader_impl_destroy,
+		NULL
 	};
 
 	return &loader_impl_interface_ext;
@@ -33,7 +33,8 @@ loader_impl_interface file_loader_impl_interface_singleton(void)
 		&file_loader_impl_load_from_package,
 		&file_loader_impl_clear,
 		&file_loader_impl_discover,
-		&file_loader_impl_destroy
+		&file_loader_impl_destroy,
+		NULL
 	};
 
 	return &loader_impl_interface_file;
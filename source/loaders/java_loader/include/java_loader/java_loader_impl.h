@@ -45,6 +45,8 @@ JAVA_LOADER_API int java_loader_impl_discover(loader_impl impl, loader_handle ha
 
 JAVA_LOADER_API int java_loader_impl_destroy(loader_impl impl);
 
+JAVA_LOADER_API int java_loader_impl_fork(loader_impl impl, enum loader_impl_fork_id id);
+
 #ifdef __cplusplus
 }
 #endif
@@ -2093,3 +2093,18 @@ int java_loader_impl_destroy(loader_impl impl)
 
 	return 1;
 }
+
+int java_loader_impl_fork(loader_impl impl, enum loader_impl_fork_id id)
+{
+	(void)impl;
+
+	/* The JVM runs the garbage collector, the compiler and the signal dispatcher in threads of its own,
+	they are not cloned into the child, so the first safepoint of the VM would wait for them forever */
+	if (id == LOADER_IMPL_FORK_PREPARE)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Java loader does not support fork, spawn the workers before loading Java");
+		return 1;
+	}
+
+	return 0;
+}
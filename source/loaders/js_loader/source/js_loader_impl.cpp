@@ -561,7 +561,8 @@ function_interface function_js_singleton(void)
 		&function_js_interface_create,
 		&function_js_interface_invoke,
 		&function_js_interface_await,
-		&function_js_interface_destroy
+		&function_js_interface_destroy,
+		NULL
 	};
 
 	return &js_interface;
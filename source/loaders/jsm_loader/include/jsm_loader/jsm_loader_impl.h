@@ -41,6 +41,8 @@ JSM_LOADER_API int jsm_loader_impl_discover(loader_impl impl, loader_handle hand
 
 JSM_LOADER_API int jsm_loader_impl_destroy(loader_impl impl);
 
+JSM_LOADER_API int jsm_loader_impl_fork(loader_impl impl, enum loader_impl_fork_id id);
+
 #ifdef __cplusplus
 }
 #endif
@@ -31,7 +31,8 @@ loader_impl_interface jsm_loader_impl_interface_singleton(void)
 		&jsm_loader_impl_load,
 		&jsm_loader_impl_clear,
 		&jsm_loader_impl_discover,
-		&jsm_loader_impl_destroy
+		&jsm_loader_impl_destroy,
+		&jsm_loader_impl_fork
 	};
 
 	return &loader_impl_interface_jsm;
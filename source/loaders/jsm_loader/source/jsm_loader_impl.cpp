@@ -106,7 +106,8 @@ function_interface function_jsm_singleton()
 		&function_jsm_interface_create,
 		&function_jsm_interface_invoke,
 		&function_jsm_interface_await,
-		&function_jsm_interface_destroy
+		&function_jsm_interface_destroy,
+		NULL
 	};
 
 	return &jsm_interface;
@@ -261,3 +262,18 @@ int jsm_loader_impl_destroy(loader_impl impl)
 
 	return 1;
 }
+
+int jsm_loader_impl_fork(loader_impl impl, enum loader_impl_fork_id id)
+{
+	(void)impl;
+
+	/* SpiderMonkey compiles and collects garbage off the main thread with a pool of helper threads,
+	the child inherits the state of the pool but not its threads */
+	if (id == LOADER_IMPL_FORK_PREPARE)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "SpiderMonkey loader does not support fork, spawn the workers before loading SpiderMonkey");
+		return 1;
+	}
+
+	return 0;
+}
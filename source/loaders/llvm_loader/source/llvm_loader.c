@@ -33,7 +33,8 @@ loader_impl_interface llvm_loader_impl_interface_singleton(void)
 		&llvm_loader_impl_load_from_package,
 		&llvm_loader_impl_clear,
 		&llvm_loader_impl_discover,
-		&llvm_loader_impl_destroy
+		&llvm_loader_impl_destroy,
+		NULL
 	};
 
 	return &loader_impl_interface_llvm;
@@ -174,7 +174,8 @@ function_interface function_llvm_singleton(void)
 		&function_llvm_interface_create,
 		&function_llvm_interface_invoke,
 		&function_llvm_interface_await,
-		&function_llvm_interface_destroy
+		&function_llvm_interface_destroy,
+		NULL
 	};
 
 	return &llvm_function_interface;
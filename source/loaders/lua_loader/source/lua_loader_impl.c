@@ -268,7 +268,8 @@ function_interface function_lua_singleton(void)
 		&function_lua_interface_create,
 		&function_lua_interface_invoke,
 		&function_lua_interface_await,
-		&function_lua_interface_destroy
+		&function_lua_interface_destroy,
+		NULL
 	};
 
 	return &lua_interface;
@@ -20,7 +20,8 @@ loader_impl_interface mock_loader_impl_interface_singleton(void)
 		&mock_loader_impl_clear,
 		&mock_loader_impl_register_types,
 		&mock_loader_impl_discover,
-		&mock_loader_impl_destroy
+		&mock_loader_impl_destroy,
+		NULL
 	};
 
 	return &loader_impl_interface_mock;
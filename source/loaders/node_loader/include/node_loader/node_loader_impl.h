@@ -51,6 +51,8 @@ NODE_LOADER_API int node_loader_impl_discover(loader_impl impl, loader_handle ha
 
 NODE_LOADER_API int node_loader_impl_destroy(loader_impl impl);
 
+NODE_LOADER_API int node_loader_impl_fork(loader_impl impl, enum loader_impl_fork_id id);
+
 NODE_LOADER_NO_EXPORT void node_loader_impl_exception(napi_env env, napi_status status);
 
 NODE_LOADER_NO_EXPORT void node_loader_impl_finalizer(napi_env env, napi_value v, void *data);
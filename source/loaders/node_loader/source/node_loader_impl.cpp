@@ -1924,7 +1924,8 @@ function_interface function_node_singleton()
 		&function_node_interface_create,
 		&function_node_interface_invoke,
 		&function_node_interface_await,
-		&function_node_interface_destroy
+		&function_node_interface_destroy,
+		NULL
 	};
 
 	return &node_function_interface;
@@ -5032,3 +5033,18 @@ int node_loader_impl_destroy(loader_impl impl)
 
 	return 0;
 }
+
+int node_loader_impl_fork(loader_impl impl, enum loader_impl_fork_id id)
+{
+	(void)impl;
+
+	/* Node.js runs in its own thread, that thread and the libuv loop owned by it
+	do not exist in the child, so the isolate cannot be recovered after the fork */
+	if (id == LOADER_IMPL_FORK_PREPARE)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "NodeJS loader does not support fork, spawn the workers before loading NodeJS");
+		return 1;
+	}
+
+	return 0;
+}
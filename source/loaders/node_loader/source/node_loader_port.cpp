@@ -114,6 +114,133 @@ napi_value node_loader_port_metacall(napi_env env, napi_callback_info info)
 	return result;
 }
 
+/* Arguments of a function handle call are kept in the stack up to this size */
+#define NODE_LOADER_PORT_FUNCTION_ARGS_SIZE 0x10
+
+static napi_value node_loader_port_metacall_function_call(napi_env env, napi_callback_info info)
+{
+	napi_value argv_stack[NODE_LOADER_PORT_FUNCTION_ARGS_SIZE];
+	void *args_stack[NODE_LOADER_PORT_FUNCTION_ARGS_SIZE];
+	size_t argc = NODE_LOADER_PORT_FUNCTION_ARGS_SIZE;
+	napi_value *argv = argv_stack;
+	void **args = args_stack;
+	napi_value recv;
+	void *data;
+
+	napi_status status = napi_get_cb_info(env, info, &argc, argv, &recv, &data);
+
+	node_loader_impl_exception(env, status);
+
+	/* Allocate the arguments only when they do not fit in the stack */
+	if (argc > NODE_LOADER_PORT_FUNCTION_ARGS_SIZE)
+	{
+		argv = new napi_value[argc];
+		args = new void *[argc];
+
+		status = napi_get_cb_info(env, info, &argc, argv, &recv, &data);
+
+		node_loader_impl_exception(env, status);
+	}
+
+	/* Obtain NodeJS loader implementation */
+	loader_impl impl = loader_get_impl(node_loader_tag);
+	loader_impl_node node_impl = (loader_impl_node)loader_impl_get(impl);
+
+	/* Store current reference of the environment */
+	node_loader_impl_env(node_impl, env);
+
+	for (size_t args_count = 0; args_count < argc; ++args_count)
+	{
+		args[args_count] = node_loader_impl_napi_to_value(node_impl, env, recv, argv[args_count]);
+	}
+
+	/* Call to the function directly, without looking it up by name */
+	void *ret = metacallfv_s(metacall_value_to_function(data), args, argc);
+
+	napi_value result = node_loader_impl_value_to_napi(node_impl, env, ret);
+
+	if (metacall_value_id(ret) == METACALL_THROWABLE)
+	{
+		napi_throw(env, result);
+	}
+
+	for (size_t args_count = 0; args_count < argc; ++args_count)
+	{
+		metacall_value_destroy(args[args_count]);
+	}
+
+	metacall_value_destroy(ret);
+
+	if (argv != argv_stack)
+	{
+		delete[] argv;
+		delete[] args;
+	}
+
+	return result;
+}
+
+napi_value node_loader_port_metacall_function(napi_env env, napi_callback_info info)
+{
+	const size_t args_size = 1;
+	size_t argc = args_size, name_length;
+	napi_value argv[args_size];
+	char name_stack[0x100];
+	char *name = name_stack;
+
+	napi_get_cb_info(env, info, &argc, argv, nullptr, nullptr);
+
+	if (argc != args_size)
+	{
+		napi_throw_error(env, nullptr, "Invalid number of arguments, use it like: metacall_function('function_name')");
+		return nullptr;
+	}
+
+	napi_status status = napi_get_value_string_utf8(env, argv[0], nullptr, 0, &name_length);
+
+	if (status != napi_ok)
+	{
+		napi_throw_type_error(env, nullptr, "Function name should be of string type");
+		return nullptr;
+	}
+
+	if (name_length >= sizeof(name_stack))
+	{
+		name = new char[name_length + 1];
+	}
+
+	status = napi_get_value_string_utf8(env, argv[0], name, name_length + 1, &name_length);
+
+	node_loader_impl_exception(env, status);
+
+	void *func = metacall_function(name);
+
+	napi_value result = nullptr;
+
+	if (func == NULL)
+	{
+		napi_throw_error(env, nullptr, "Function not found");
+	}
+	else
+	{
+		/* The value keeps a reference to the function while the handle is alive */
+		void *v = metacall_value_create_function(func);
+
+		status = napi_create_function(env, name, name_length, &node_loader_port_metacall_function_call, v, &result);
+
+		node_loader_impl_exception(env, status);
+
+		node_loader_impl_finalizer(env, result, v);
+	}
+
+	if (name != name_stack)
+	{
+		delete[] name;
+	}
+
+	return result;
+}
+
 napi_value node_loader_port_metacallfms(napi_env env, napi_callback_info info)
 {
 	size_t argc = 0;
@@ -1176,6 +1303,7 @@ void node_loader_port_exports(napi_env env, napi_value exports)
 	x(metacall); \
 	x(metacallfms); \
 	x(metacall_await); \
+	x(metacall_function); \
 	x(metacall_execution_path); \
 	x(metacall_load_from_file); \
 	x(metacall_load_from_file_export); \
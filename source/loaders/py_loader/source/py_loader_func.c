@@ -26,6 +26,8 @@
 
 #include <metacall/metacall.h>
 
+#define PY_LOADER_IMPL_FUNC_ARGS_SIZE 0x10
+
 struct py_loader_impl_func_obj
 {
 	PyObject_HEAD
@@ -48,6 +50,7 @@ static void py_loader_impl_func_dealloc(PyObject *self)
 static PyObject *py_loader_impl_func_call(PyObject *self, PyObject *args, PyObject *kwds)
 {
 	struct py_loader_impl_func_obj *wrapped = (struct py_loader_impl_func_obj *)self;
+	void *stack_args[PY_LOADER_IMPL_FUNC_ARGS_SIZE];
 
 	/* TODO: Support callback named arguments call? */
 	(void)kwds;
@@ -62,7 +65,8 @@ static PyObject *py_loader_impl_func_call(PyObject *self, PyObject *args, PyObje
 
 	Py_ssize_t callee_args_size = PyTuple_Size(args);
 	size_t args_size = callee_args_size < 0 ? 0 : (size_t)callee_args_size;
-	void **value_args = args_size == 0 ? metacall_null_args : malloc(sizeof(void *) * args_size);
+	/* Avoid the allocation of the arguments in the most common case */
+	void **value_args = args_size == 0 ? metacall_null_args : (args_size <= PY_LOADER_IMPL_FUNC_ARGS_SIZE ? stack_args : malloc(sizeof(void *) * args_size));
 
 	if (value_args == NULL)
 	{
@@ -97,7 +101,7 @@ static PyObject *py_loader_impl_func_call(PyObject *self, PyObject *args, PyObje
 		value_type_destroy(value_args[args_count]);
 	}
 
-	if (value_args != metacall_null_args)
+	if (value_args != metacall_null_args && value_args != stack_args)
 	{
 		free(value_args);
 	}
@@ -116,6 +116,9 @@ struct loader_impl_py_type
 	PyObject *import_module;
 	PyObject *import_function;
 
+	/* Defer the introspection of the function signatures until they are used */
+	int lazy;
+
 	/* Start asyncio required modules */
 	PyObject *asyncio_module;
 	PyObject *asyncio_iscoroutinefunction;
@@ -174,7 +177,7 @@ static class_interface py_class_interface_singleton(void);
 
 static size_t py_loader_impl_discover_callable_args_count(loader_impl_py py_impl, PyObject *callable);
 
-static int py_loader_impl_discover_func(loader_impl impl, PyObject *func, function f);
+static int py_loader_impl_discover_func(loader_impl impl, PyObject *func, function f, signature s, enum async_id *async);
 
 static int py_loader_impl_discover_method(loader_impl impl, PyObject *callable, method m, bool is_static);
 
@@ -1071,8 +1074,6 @@ value py_loader_impl_capi_to_value(loader_impl impl, PyObject *obj, type_id id)
 		}
 		else
 		{
-			loader_impl_py py_impl = loader_impl_get(impl);
-			size_t args_count = py_loader_impl_discover_callable_args_count(py_impl, obj);
 			loader_impl_py_function py_func = malloc(sizeof(struct loader_impl_py_function_type));
 			function f = NULL;
 
@@ -1085,9 +1086,9 @@ value py_loader_impl_capi_to_value(loader_impl impl, PyObject *obj, type_id id)
 			py_func->func = obj;
 			py_func->impl = impl;
 
-			f = function_create(NULL, args_count, py_func, &function_py_singleton);
+			f = function_create(NULL, 0, py_func, &function_py_singleton);
 
-			if (py_loader_impl_discover_func(impl, obj, f) != 0)
+			if (function_discover(f) != 0)
 			{
 				function_destroy(f);
 
@@ -1763,13 +1764,41 @@ void function_py_interface_destroy(function func, function_impl impl)
 	}
 }
 
+signature function_py_interface_discover(function func, function_impl impl, enum async_id *async)
+{
+	loader_impl_py_function py_func = (loader_impl_py_function)impl;
+	loader_impl_py py_impl = loader_impl_get(py_func->impl);
+	size_t args_count;
+	signature s;
+
+	py_loader_thread_acquire();
+
+	/* The functions are created without arguments, the signature is built here and published by the caller once it is complete */
+	args_count = py_loader_impl_discover_callable_args_count(py_impl, py_func->func);
+
+	log_write("metacall", LOG_LEVEL_DEBUG, "Introspection: function %s, args count %" PRIuS, function_name(func), args_count);
+
+	s = signature_create(args_count);
+
+	if (s != NULL && py_loader_impl_discover_func(py_func->impl, py_func->func, func, s, async) != 0)
+	{
+		signature_destroy(s);
+		s = NULL;
+	}
+
+	py_loader_thread_release();
+
+	return s;
+}
+
 function_interface function_py_singleton(void)
 {
 	static struct function_interface_type py_function_interface = {
 		&function_py_interface_create,
 		&function_py_interface_invoke,
 		&function_py_interface_await,
-		&function_py_interface_destroy
+		&function_py_interface_destroy,
+		&function_py_interface_discover
 	};
 
 	return &py_function_interface;
@@ -2477,6 +2506,8 @@ loader_impl_data py_loader_impl_initialize(loader_impl impl, configuration confi
 		goto error_alloc_py_impl;
 	}
 
+	py_impl->lazy = loader_impl_get_option_lazy(impl);
+
 	if (host == 0)
 	{
 		Py_InitializeEx(0);
@@ -3276,7 +3307,7 @@ unsupported_callable:
 	return args_count;
 }
 
-int py_loader_impl_discover_func(loader_impl impl, PyObject *func, function f)
+int py_loader_impl_discover_func(loader_impl impl, PyObject *func, function f, signature s, enum async_id *async)
 {
 	loader_impl_py py_impl = loader_impl_get(impl);
 	PyObject *args = PyTuple_New(1);
@@ -3294,7 +3325,6 @@ int py_loader_impl_discover_func(loader_impl impl, PyObject *func, function f)
 
 	if (result != NULL)
 	{
-		signature s = function_signature(f);
 		const char *func_name = function_name(f);
 		PyObject *parameters = PyObject_GetAttrString(result, "parameters");
 		PyObject *return_annotation = PyObject_GetAttrString(result, "return_annotation");
@@ -3341,7 +3371,7 @@ int py_loader_impl_discover_func(loader_impl impl, PyObject *func, function f)
 
 		Py_DecRef(parameters);
 
-		function_async(f, py_loader_impl_check_async(py_impl, func) == 1 ? ASYNCHRONOUS : SYNCHRONOUS);
+		*async = py_loader_impl_check_async(py_impl, func) == 1 ? ASYNCHRONOUS : SYNCHRONOUS;
 
 		signature_set_return(s, py_loader_impl_discover_type(impl, return_annotation, func_name, NULL));
 
@@ -3356,8 +3386,6 @@ int py_loader_impl_discover_func(loader_impl impl, PyObject *func, function f)
 
 		if (PyCFunction_Check(func))
 		{
-			signature s = function_signature(f);
-
 			signature_set_return(s, NULL);
 
 			return 0;
@@ -3832,7 +3860,6 @@ int py_loader_impl_discover_module(loader_impl impl, PyObject *module, context c
 		else if (PyCallable_Check(module_dict_val))
 		{
 			const char *func_name = PyUnicode_AsUTF8(module_dict_key);
-			size_t discover_args_count = py_loader_impl_discover_callable_args_count(py_impl, module_dict_val);
 			loader_impl_py_function py_func = malloc(sizeof(struct loader_impl_py_function_type));
 
 			if (py_func == NULL)
@@ -3845,11 +3872,10 @@ int py_loader_impl_discover_module(loader_impl impl, PyObject *module, context c
 			py_func->func = module_dict_val;
 			py_func->impl = impl;
 
-			function f = function_create(func_name, discover_args_count, py_func, &function_py_singleton);
-
-			log_write("metacall", LOG_LEVEL_DEBUG, "Introspection: function %s, args count %" PRIuS, func_name, discover_args_count);
+			/* The arguments are inspected by the discover, in lazy mode it is deferred until the first use */
+			function f = function_create(func_name, 0, py_func, &function_py_singleton);
 
-			if (py_loader_impl_discover_func(impl, module_dict_val, f) == 0)
+			if (py_impl->lazy == 1 || function_discover(f) == 0)
 			{
 				scope sp = context_scope(ctx);
 				value v = value_create_function(f);
@@ -4253,3 +4279,64 @@ int py_loader_impl_destroy(loader_impl impl)
 
 	return result;
 }
+
+int py_loader_impl_fork(loader_impl impl, enum loader_impl_fork_id id)
+{
+	loader_impl_py py_impl = loader_impl_get(impl);
+	PyObject *args_tuple, *asyncio_loop;
+
+	if (id == LOADER_IMPL_FORK_PREPARE)
+	{
+		/* Keep the GIL during the fork as os.fork does, so no other thread is inside of the interpreter */
+		py_loader_thread_acquire();
+#if PY_MAJOR_VERSION == 3 && PY_MINOR_VERSION >= 7
+		PyOS_BeforeFork();
+#endif
+		return 0;
+	}
+
+	if (id == LOADER_IMPL_FORK_PARENT)
+	{
+#if PY_MAJOR_VERSION == 3 && PY_MINOR_VERSION >= 7
+		PyOS_AfterFork_Parent();
+#endif
+		py_loader_thread_release();
+		return 0;
+	}
+
+#if PY_MAJOR_VERSION == 3 && PY_MINOR_VERSION >= 7
+	PyOS_AfterFork_Child();
+#else
+	PyOS_AfterFork();
+#endif
+
+	/* The asyncio thread does not exist in the child, start a new event loop */
+	args_tuple = PyTuple_New(0);
+	asyncio_loop = PyObject_Call(py_impl->thread_background_start, args_tuple, NULL);
+	Py_DecRef(args_tuple);
+
+	if (asyncio_loop == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Error produced while starting the asyncio thread in the forked process");
+		py_loader_impl_error_print(py_impl);
+		py_loader_thread_release();
+		return 1;
+	}
+
+	/* The previous loop belongs to a thread that is not running anymore, it cannot be stopped */
+	Py_DecRef(py_impl->asyncio_loop);
+	py_impl->asyncio_loop = asyncio_loop;
+
+	if (loader_impl_get_option_host(impl) == 1)
+	{
+		args_tuple = PyTuple_New(1);
+		Py_IncRef(py_impl->asyncio_loop);
+		PyTuple_SetItem(args_tuple, 0, py_impl->asyncio_loop);
+		Py_DecRef(PyObject_Call(py_impl->thread_background_register_atexit, args_tuple, NULL));
+		Py_DecRef(args_tuple);
+	}
+
+	py_loader_thread_release();
+
+	return 0;
+}
@@ -21,6 +21,7 @@
 #include <metacall/metacall.h>
 
 #include <py_loader/py_loader_dict.h>
+#include <py_loader/py_loader_func.h>
 #include <py_loader/py_loader_impl.h>
 #include <py_loader/py_loader_port.h>
 #include <py_loader/py_loader_symbol_fallback.h>
@@ -673,6 +674,62 @@ clear:
 	return result;
 }
 
+static PyObject *py_loader_port_function(PyObject *self, PyObject *args)
+{
+	static const char format[] = "O:metacall_function";
+	PyObject *name, *result;
+	const char *name_str;
+	loader_impl impl;
+	void *func, *v;
+
+	(void)self;
+
+	/* Parse arguments */
+	if (!PyArg_ParseTuple(args, (char *)format, &name))
+	{
+		PyErr_SetString(PyExc_TypeErrorPtr(), "Invalid number of arguments, use it like: metacall_function('function_name');");
+		return NULL;
+	}
+
+#if PY_MAJOR_VERSION == 2
+	name_str = PyString_Check(name) ? PyString_AsString(name) : NULL;
+#elif PY_MAJOR_VERSION == 3
+	name_str = PyUnicode_Check(name) ? PyUnicode_AsUTF8(name) : NULL;
+#endif
+
+	if (name_str == NULL)
+	{
+		PyErr_SetString(PyExc_TypeErrorPtr(), "Invalid function name string conversion, first parameter must be a string");
+		return NULL;
+	}
+
+	/* Obtain Python loader implementation */
+	impl = loader_get_impl(py_loader_tag);
+
+	func = metacall_function(name_str);
+
+	if (func == NULL)
+	{
+		PyErr_Format(PyExc_ValueErrorPtr(), "Function '%s' not found", name_str);
+		return NULL;
+	}
+
+	/* The callable keeps a reference to the function, so calls skip the lookup by name */
+	v = metacall_value_create_function(func);
+
+	if (v == NULL)
+	{
+		PyErr_SetString(PyExc_ValueErrorPtr(), "Invalid function value allocation");
+		return NULL;
+	}
+
+	result = py_loader_impl_func_new(impl, loader_impl_get(impl), v);
+
+	metacall_value_destroy(v);
+
+	return result;
+}
+
 // TODO
 #if 0
 static PyObject *py_loader_port_await(PyObject *self, PyObject *var_args)
@@ -1038,6 +1095,8 @@ static PyMethodDef metacall_methods[] = {
 		"Get information about all loaded objects." },
 	{ "metacall", py_loader_port_invoke, METH_VARARGS,
 		"Call a function anonymously." },
+	{ "metacall_function", py_loader_port_function, METH_VARARGS,
+		"Get a callable to a function, it avoids looking up the function by name on each call." },
 	{ "metacall_value_create_ptr", py_loader_port_value_create_ptr, METH_VARARGS,
 		"Create a new value of type Pointer." },
 	{ "metacall_value_reference", py_loader_port_value_reference, METH_VARARGS,
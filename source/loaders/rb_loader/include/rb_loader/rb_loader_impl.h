@@ -51,6 +51,10 @@ RB_LOADER_API int rb_loader_impl_discover(loader_impl impl, loader_handle handle
 
 RB_LOADER_API int rb_loader_impl_destroy(loader_impl impl);
 
+RB_LOADER_API int rb_loader_impl_fork(loader_impl impl, enum loader_impl_fork_id id);
+
+RB_LOADER_NO_EXPORT void *rb_loader_impl_call_without_gvl(void *(*callback)(void *), void *data);
+
 RB_LOADER_NO_EXPORT const char *rb_type_deserialize(loader_impl impl, VALUE v, value *result);
 
 RB_LOADER_NO_EXPORT VALUE rb_type_serialize(value v);
@@ -37,6 +37,7 @@
 #endif
 
 #include <ruby.h>
+#include <ruby/thread.h>
 
 /* Disable warnings from Ruby */
 #if defined(__clang__)
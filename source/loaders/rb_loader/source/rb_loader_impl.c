@@ -13,6 +13,7 @@
 #include <loader/loader.h>
 #include <loader/loader_impl.h>
 
+#include <portability/portability_compiler.h>
 #include <portability/portability_path.h>
 
 #include <reflect/reflect_context.h>
@@ -43,8 +44,10 @@
 	#include <unistd.h>
 #endif
 
-#define LOADER_IMPL_RB_FUNCTION_ARGS_SIZE 0x10
-#define LOADER_IMPL_RB_PROTECT_ARGS_SIZE  0x10
+#define LOADER_IMPL_RB_PROTECT_ARGS_SIZE 0x10
+
+/* Method identifiers are resolved on discovery and stored as the method implementation */
+#define LOADER_IMPL_RB_METHOD_ID(m) ((ID)(uintptr_t)method_data(m))
 
 typedef struct loader_impl_rb_module_type
 {
@@ -68,6 +71,7 @@ typedef struct loader_impl_rb_function_type
 	VALUE module_instance;
 	ID method_id;
 	VALUE args_hash;
+	VALUE *args_keys;
 	loader_impl impl;
 
 } * loader_impl_rb_function;
@@ -110,6 +114,16 @@ typedef struct loader_impl_rb_discover_module_protect_type
 	context ctx;
 } * loader_impl_rb_discover_module_protect;
 
+typedef struct loader_impl_rb_invoke_type
+{
+	void *owner;
+	void *impl;
+	method m;
+	const char *name;
+	void **args;
+	size_t size;
+} * loader_impl_rb_invoke;
+
 static class_interface rb_class_interface_singleton(void);
 static object_interface rb_object_interface_singleton(void);
 static void rb_loader_impl_discover_methods(klass c, VALUE cls, const char *class_name_str, enum class_visibility_id visibility, const char *method_type_str, VALUE methods, int (*register_method)(klass, method));
@@ -119,6 +133,50 @@ static int rb_loader_impl_interactive_terminal(void);
 static int rb_loader_impl_run_main = 1;
 static char *rb_loader_impl_main_module = NULL;
 
+/* Set while the current Ruby thread runs without the GVL, after releasing it for calling into other loaders */
+static PORTABILITY_THREAD_LOCAL int rb_loader_impl_gvl_released = 0;
+
+static void *rb_loader_impl_call_with_gvl(void *(*callback)(void *), void *data)
+{
+	/* Threads not created by Ruby have no execution context, so they cannot enter the VM */
+	if (ruby_native_thread_p() == 0)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Ruby cannot be called from a thread which has not been created by Ruby");
+		return NULL;
+	}
+
+	/* Ruby threads that released the GVL (i.e. calling to other loaders through the port) must acquire it again */
+	if (rb_loader_impl_gvl_released == 1)
+	{
+		void *result;
+
+		rb_loader_impl_gvl_released = 0;
+
+		result = rb_thread_call_with_gvl(callback, data);
+
+		rb_loader_impl_gvl_released = 1;
+
+		return result;
+	}
+
+	return callback(data);
+}
+
+void *rb_loader_impl_call_without_gvl(void *(*callback)(void *), void *data)
+{
+	int released = rb_loader_impl_gvl_released;
+
+	void *result;
+
+	rb_loader_impl_gvl_released = 1;
+
+	result = rb_thread_call_without_gvl(callback, data, NULL, NULL);
+
+	rb_loader_impl_gvl_released = released;
+
+	return result;
+}
+
 int function_rb_interface_create(function func, function_impl impl)
 {
 	signature s = function_signature(func);
@@ -362,20 +420,19 @@ static VALUE rb_loader_impl_funcallv_kw_protect(VALUE args)
 		} \
 	} while (0)
 
-function_return function_rb_interface_invoke(function func, function_impl impl, function_args args, size_t size)
+static void *function_rb_interface_invoke_gvl(void *data)
 {
-	loader_impl_rb_function rb_function = (loader_impl_rb_function)impl;
+	loader_impl_rb_invoke invoke = (loader_impl_rb_invoke)data;
 
-	signature s = function_signature(func);
+	loader_impl_rb_function rb_function = (loader_impl_rb_function)invoke->impl;
 
-	const size_t args_size = size;
+	signature s = function_signature((function)invoke->owner);
 
-	VALUE result_value = Qnil;
+	void **args = invoke->args;
 
-	if (args_size > LOADER_IMPL_RB_FUNCTION_ARGS_SIZE)
-	{
-		return NULL;
-	}
+	const size_t args_size = invoke->size;
+
+	VALUE result_value = Qnil;
 
 	if (args_size > 0)
 	{
@@ -389,18 +446,16 @@ function_return function_rb_interface_invoke(function func, function_impl impl,
 
 		size_t args_count, ducktype_args_count = 0;
 
-		VALUE args_value[LOADER_IMPL_RB_FUNCTION_ARGS_SIZE + 1];
+		/* Allocated in the stack for small argument counts, otherwise in a buffer marked by the GC */
+		VALUE args_tmp;
+		VALUE *args_value = ALLOCV_N(VALUE, args_tmp, args_size + 1);
 
 		for (args_count = 0; args_count < args_size; ++args_count)
 		{
 			type t = signature_get_type(s, args_count);
 
-			type_id id = TYPE_INVALID;
-
 			if (t == NULL)
 			{
-				id = value_type_id((value)args[args_count]);
-
 				if (invoke_type == FUNCTION_RB_UNKNOWN)
 				{
 					invoke_type = FUNCTION_RB_DUCKTYPED;
@@ -418,17 +473,13 @@ function_return function_rb_interface_invoke(function func, function_impl impl,
 
 					ducktype_args_count = args_count;
 				}
-
-				id = type_index(t);
 			}
 
-			log_write("metacall", LOG_LEVEL_DEBUG, "Type %p, %d", (void *)t, id);
-
 			args_value[args_count] = rb_type_serialize(args[args_count]);
 
 			if (t != NULL)
 			{
-				rb_hash_aset(rb_function->args_hash, ID2SYM(rb_intern(signature_get_name(s, args_count))), args_value[args_count]);
+				rb_hash_aset(rb_function->args_hash, rb_function->args_keys[args_count], args_value[args_count]);
 			}
 		}
 
@@ -491,6 +542,8 @@ function_return function_rb_interface_invoke(function func, function_impl impl,
 				// TODO: Throw exception ?
 			}
 		}
+
+		ALLOCV_END(args_tmp);
 	}
 	else
 	{
@@ -521,6 +574,13 @@ function_return function_rb_interface_invoke(function func, function_impl impl,
 	return v;
 }
 
+function_return function_rb_interface_invoke(function func, function_impl impl, function_args args, size_t size)
+{
+	struct loader_impl_rb_invoke_type invoke = { func, impl, NULL, NULL, args, size };
+
+	return rb_loader_impl_call_with_gvl(&function_rb_interface_invoke_gvl, &invoke);
+}
+
 function_return function_rb_interface_await(function func, function_impl impl, function_args args, size_t size, function_resolve_callback resolve_callback, function_reject_callback reject_callback, void *context)
 {
 	/* TODO */
@@ -549,6 +609,8 @@ void function_rb_interface_destroy(function func, function_impl impl)
 			log_write("metacall", LOG_LEVEL_DEBUG, "Unreferencing Ruby function '%s' from module", function_name(func));
 
 			rb_undef(rb_function->module, rb_to_id(name));
+
+			rb_gc_unregister_address(&rb_function->args_hash);
 		}
 
 		free(rb_function);
@@ -561,7 +623,8 @@ function_interface function_rb_singleton(void)
 		&function_rb_interface_create,
 		&function_rb_interface_invoke,
 		&function_rb_interface_await,
-		&function_rb_interface_destroy
+		&function_rb_interface_destroy,
+		NULL
 	};
 
 	return &rb_interface;
@@ -628,26 +691,25 @@ int rb_object_interface_set(object obj, object_impl impl, struct accessor_type *
 	return 0;
 }
 
-value rb_object_interface_method_invoke(object obj, object_impl impl, method m, object_args args, size_t argc)
+static void *rb_object_interface_method_invoke_gvl(void *data)
 {
-	(void)obj;
+	loader_impl_rb_invoke invoke = (loader_impl_rb_invoke)data;
 
-	loader_impl_rb_object rb_obj = (loader_impl_rb_object)impl;
+	loader_impl_rb_object rb_obj = (loader_impl_rb_object)invoke->impl;
 
-	if (rb_obj == NULL || rb_obj->object == Qnil)
-	{
-		return NULL;
-	}
+	size_t argc = invoke->size;
+
+	VALUE argv_tmp;
+	VALUE *argv = ALLOCV_N(VALUE, argv_tmp, argc);
 
-	VALUE *argv = malloc(sizeof(VALUE) * argc);
 	for (size_t i = 0; i < argc; i++)
 	{
-		argv[i] = rb_type_serialize(args[i]);
+		argv[i] = rb_type_serialize(invoke->args[i]);
 	}
 
-	VALUE rb_retval = rb_funcallv(rb_obj->object, rb_intern(method_name(m)), argc, argv);
+	VALUE rb_retval = rb_funcallv(rb_obj->object, LOADER_IMPL_RB_METHOD_ID(invoke->m), argc, argv);
 
-	free(argv);
+	ALLOCV_END(argv_tmp);
 
 	if (rb_retval == Qnil)
 	{
@@ -660,6 +722,20 @@ value rb_object_interface_method_invoke(object obj, object_impl impl, method m,
 	return result;
 }
 
+value rb_object_interface_method_invoke(object obj, object_impl impl, method m, object_args args, size_t argc)
+{
+	loader_impl_rb_object rb_obj = (loader_impl_rb_object)impl;
+
+	if (rb_obj == NULL || rb_obj->object == Qnil)
+	{
+		return NULL;
+	}
+
+	struct loader_impl_rb_invoke_type invoke = { obj, impl, m, NULL, args, argc };
+
+	return rb_loader_impl_call_with_gvl(&rb_object_interface_method_invoke_gvl, &invoke);
+}
+
 value rb_object_interface_method_await(object obj, object_impl impl, method m, object_args args, size_t size, object_resolve_callback resolve, object_reject_callback reject, void *ctx)
 {
 	// TODO
@@ -732,25 +808,28 @@ int rb_class_interface_create(klass cls, class_impl impl)
 	return 0;
 }
 
-object rb_class_interface_constructor(klass cls, class_impl impl, const char *name, constructor ctor, class_args args, size_t argc)
+static void *rb_class_interface_constructor_gvl(void *data)
 {
-	(void)cls;
-	(void)ctor;
+	loader_impl_rb_invoke invoke = (loader_impl_rb_invoke)data;
 
-	loader_impl_rb_class rb_cls = impl;
+	loader_impl_rb_class rb_cls = invoke->impl;
 	loader_impl_rb_object rb_obj = malloc(sizeof(struct loader_impl_rb_object_type));
 
-	object obj = object_create(name, ACCESSOR_TYPE_DYNAMIC, rb_obj, &rb_object_interface_singleton, cls);
+	object obj = object_create(invoke->name, ACCESSOR_TYPE_DYNAMIC, rb_obj, &rb_object_interface_singleton, (klass)invoke->owner);
+
+	size_t argc = invoke->size;
+
+	VALUE argv_tmp;
+	VALUE *argv = ALLOCV_N(VALUE, argv_tmp, argc);
 
-	VALUE *argv = malloc(sizeof(VALUE) * argc);
 	for (size_t i = 0; i < argc; i++)
 	{
-		argv[i] = rb_type_serialize(args[i]);
+		argv[i] = rb_type_serialize(invoke->args[i]);
 	}
 
 	VALUE rbval_object = rb_funcallv(rb_cls->class, rb_intern("new"), argc, argv);
 
-	free(argv);
+	ALLOCV_END(argv_tmp);
 
 	rb_obj->object = rbval_object;
 	rb_obj->object_class = rb_cls->class;
@@ -760,6 +839,15 @@ object rb_class_interface_constructor(klass cls, class_impl impl, const char *na
 	return obj;
 }
 
+object rb_class_interface_constructor(klass cls, class_impl impl, const char *name, constructor ctor, class_args args, size_t argc)
+{
+	(void)ctor;
+
+	struct loader_impl_rb_invoke_type invoke = { cls, impl, NULL, name, args, argc };
+
+	return rb_loader_impl_call_with_gvl(&rb_class_interface_constructor_gvl, &invoke);
+}
+
 value rb_class_interface_static_get(klass cls, class_impl impl, struct accessor_type *accessor)
 {
 	loader_impl_rb_class rb_class = (loader_impl_rb_class)impl;
@@ -809,36 +897,25 @@ int rb_class_interface_static_set(klass cls, class_impl impl, struct accessor_ty
 	return 0;
 }
 
-value rb_class_interface_static_invoke(klass cls, class_impl impl, method m, class_args args, size_t argc)
+static void *rb_class_interface_static_invoke_gvl(void *data)
 {
-	// TODO
-	(void)cls;
-	(void)impl;
-	(void)args;
+	loader_impl_rb_invoke invoke = (loader_impl_rb_invoke)data;
 
-	loader_impl_rb_class rb_class = (loader_impl_rb_class)impl;
-
-	if (rb_class == NULL || rb_class->class == Qnil)
-	{
-		return NULL;
-	}
+	loader_impl_rb_class rb_class = (loader_impl_rb_class)invoke->impl;
 
-	char *methodname = method_name(m);
+	size_t argc = invoke->size;
 
-	if (methodname == NULL)
-	{
-		return NULL;
-	}
+	VALUE argv_tmp;
+	VALUE *argv = ALLOCV_N(VALUE, argv_tmp, argc);
 
-	VALUE *argv = malloc(sizeof(VALUE) * argc);
 	for (size_t i = 0; i < argc; i++)
 	{
-		argv[i] = rb_type_serialize(args[i]);
+		argv[i] = rb_type_serialize(invoke->args[i]);
 	}
 
-	VALUE rb_retval = rb_funcallv(rb_class->class, rb_intern(methodname), argc, argv);
+	VALUE rb_retval = rb_funcallv(rb_class->class, LOADER_IMPL_RB_METHOD_ID(invoke->m), argc, argv);
 
-	free(argv);
+	ALLOCV_END(argv_tmp);
 
 	if (rb_retval == Qnil)
 	{
@@ -851,6 +928,20 @@ value rb_class_interface_static_invoke(klass cls, class_impl impl, method m, cla
 	return result;
 }
 
+value rb_class_interface_static_invoke(klass cls, class_impl impl, method m, class_args args, size_t argc)
+{
+	loader_impl_rb_class rb_class = (loader_impl_rb_class)impl;
+
+	if (rb_class == NULL || rb_class->class == Qnil || m == NULL)
+	{
+		return NULL;
+	}
+
+	struct loader_impl_rb_invoke_type invoke = { cls, impl, m, NULL, args, argc };
+
+	return rb_loader_impl_call_with_gvl(&rb_class_interface_static_invoke_gvl, &invoke);
+}
+
 value rb_class_interface_static_await(klass cls, class_impl impl, method m, class_args args, size_t size, class_resolve_callback resolve, class_reject_callback reject, void *ctx)
 {
 	// TODO
@@ -1584,7 +1675,7 @@ int rb_loader_impl_clear(loader_impl impl, loader_handle handle)
 	return 0;
 }
 
-int rb_loader_impl_discover_func(loader_impl impl, function f, rb_function_parser function_parser)
+int rb_loader_impl_discover_func(loader_impl impl, function f, loader_impl_rb_function rb_function, rb_function_parser function_parser)
 {
 	signature s = function_signature(f);
 
@@ -1597,6 +1688,9 @@ int rb_loader_impl_discover_func(loader_impl impl, function f, rb_function_parse
 		for (index = 0; index < size; ++index)
 		{
 			signature_set(s, index, function_parser->params[index].name, loader_impl_type(impl, function_parser->params[index].type));
+
+			/* Cache the keyword symbols so they are not interned on each call */
+			rb_function->args_keys[index] = ID2SYM(rb_intern(function_parser->params[index].name));
 		}
 
 		return 0;
@@ -1605,9 +1699,9 @@ int rb_loader_impl_discover_func(loader_impl impl, function f, rb_function_parse
 	return 1;
 }
 
-loader_impl_rb_function rb_function_create(loader_impl impl, loader_impl_rb_module rb_module, ID id)
+loader_impl_rb_function rb_function_create(loader_impl impl, loader_impl_rb_module rb_module, ID id, size_t args_size)
 {
-	loader_impl_rb_function rb_function = malloc(sizeof(struct loader_impl_rb_function_type));
+	loader_impl_rb_function rb_function = malloc(sizeof(struct loader_impl_rb_function_type) + sizeof(VALUE) * args_size);
 
 	if (rb_function != NULL)
 	{
@@ -1615,8 +1709,12 @@ loader_impl_rb_function rb_function_create(loader_impl impl, loader_impl_rb_modu
 		rb_function->module_instance = rb_module->instance;
 		rb_function->method_id = id;
 		rb_function->args_hash = rb_hash_new();
+		rb_function->args_keys = (VALUE *)(rb_function + 1);
 		rb_function->impl = impl;
 
+		/* The keyword arguments hash is reused between calls, so it must survive the GC */
+		rb_gc_register_address(&rb_function->args_hash);
+
 		return rb_function;
 	}
 
@@ -1662,7 +1760,7 @@ void rb_loader_impl_discover_methods(klass c, VALUE cls, const char *class_name_
 		method m = method_create(c,
 			method_name_str,
 			args_count,
-			(method_impl)instance_method,
+			(method_impl)(uintptr_t)rb_sym2id(rb_method),
 			visibility,
 			SYNCHRONOUS, /* There is not async functions in Ruby */
 			NULL);
@@ -1738,13 +1836,13 @@ static VALUE rb_loader_impl_discover_module_protect(VALUE args)
 				continue;
 			}
 
-			rb_function = rb_function_create(impl, rb_module, rb_intern(method_name_str));
+			rb_function = rb_function_create(impl, rb_module, rb_sym2id(method), function_parser->params_size);
 
 			if (rb_function)
 			{
 				function f = function_create(method_name_str, function_parser->params_size, rb_function, &function_rb_singleton);
 
-				if (f != NULL && rb_loader_impl_discover_func(impl, f, function_parser) == 0)
+				if (f != NULL && rb_loader_impl_discover_func(impl, f, rb_function, function_parser) == 0)
 				{
 					scope sp = context_scope(ctx);
 					value v = value_create_function(f);
@@ -1918,3 +2016,23 @@ int rb_loader_impl_destroy(loader_impl impl)
 
 	return ruby_cleanup(0);
 }
+
+int rb_loader_impl_fork(loader_impl impl, enum loader_impl_fork_id id)
+{
+	(void)impl;
+
+	/* Only the thread that forks survives, so it must be the one running the VM */
+	if (id == LOADER_IMPL_FORK_PREPARE && (ruby_native_thread_p() == 0 || rb_loader_impl_gvl_released == 1))
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Ruby loader can only be forked from a Ruby thread holding the GVL");
+		return 1;
+	}
+
+	/* Rebuild the thread list and the timer thread of the VM in the child */
+	if (id == LOADER_IMPL_FORK_CHILD)
+	{
+		rb_thread_atfork();
+	}
+
+	return 0;
+}
@@ -21,6 +21,10 @@
 #include <rb_loader/rb_loader_impl.h>
 #include <rb_loader/rb_loader_port.h>
 
+#include <loader/loader_impl.h>
+
+#include <reflect/reflect_value_type.h>
+
 #include <format/format.h>
 
 #include <metacall/metacall.h>
@@ -29,6 +33,23 @@
 
 static loader_impl rb_loader_impl = NULL;
 
+typedef struct rb_loader_port_call_type
+{
+	const char *name;
+	value *args;
+	size_t size;
+	value result;
+} * rb_loader_port_call;
+
+static void *rb_loader_port_call_without_gvl(void *data)
+{
+	rb_loader_port_call call = (rb_loader_port_call)data;
+
+	call->result = metacallv_s(call->name, call->args, call->size);
+
+	return NULL;
+}
+
 static VALUE rb_loader_port_load_from_file(VALUE self, VALUE tag_value, VALUE paths_value)
 {
 	const char *tag;
@@ -142,7 +163,9 @@ static VALUE rb_loader_port_metacall(int argc, VALUE *argv, VALUE self)
 {
 	const char *function_name;
 	size_t args_size, iterator;
-	value *args, result;
+	value *args;
+	struct rb_loader_port_call_type call;
+	value v;
 
 	(void)self;
 
@@ -179,7 +202,24 @@ static VALUE rb_loader_port_metacall(int argc, VALUE *argv, VALUE self)
 	}
 
 	/* Execute the call */
-	result = metacallv_s(function_name, args, args_size);
+	call.name = function_name;
+	call.args = args;
+	call.size = args_size;
+	call.result = NULL;
+
+	v = loader_impl_get_value(rb_loader_impl, function_name);
+
+	if (v != NULL && value_type_id(v) == TYPE_FUNCTION)
+	{
+		/* Calls to Ruby functions keep the GVL, handing it over to acquire it again right after is pure overhead */
+		rb_loader_port_call_without_gvl(&call);
+	}
+	else
+	{
+		/* Release the GVL while calling other loaders, so other Ruby threads can run meanwhile,
+		if they call back into Ruby, the loader will acquire it again */
+		rb_loader_impl_call_without_gvl(&rb_loader_port_call_without_gvl, &call);
+	}
 
 	/* Clear the arguments */
 	if (args_size > 0)
@@ -192,7 +232,7 @@ static VALUE rb_loader_port_metacall(int argc, VALUE *argv, VALUE self)
 		free(args);
 	}
 
-	return rb_type_serialize(result);
+	return rb_type_serialize(call.result);
 }
 
 static VALUE rb_loader_port_inspect(VALUE self)
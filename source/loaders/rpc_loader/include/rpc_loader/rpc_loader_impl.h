@@ -47,6 +47,8 @@ RPC_LOADER_API int rpc_loader_impl_discover(loader_impl impl, loader_handle hand
 
 RPC_LOADER_API int rpc_loader_impl_destroy(loader_impl impl);
 
+RPC_LOADER_API int rpc_loader_impl_fork(loader_impl impl, enum loader_impl_fork_id id);
+
 #ifdef __cplusplus
 }
 #endif
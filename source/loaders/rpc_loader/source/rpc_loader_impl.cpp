@@ -110,6 +110,7 @@ struct rpc_async_context
 static size_t rpc_loader_impl_write_data(void *buffer, size_t size, size_t nmemb, void *userp);
 static int rpc_loader_impl_discover_value(loader_impl_rpc rpc_impl, std::string &url, value v, context ctx);
 static int rpc_loader_impl_initialize_types(loader_impl impl, loader_impl_rpc rpc_impl);
+static CURL *rpc_loader_impl_discover_curl(void);
 
 size_t rpc_loader_impl_write_data(void *buffer, size_t size, size_t nmemb, void *userp)
 {
@@ -460,7 +461,8 @@ function_interface function_rpc_singleton(void)
 		&function_rpc_interface_create,
 		&function_rpc_interface_invoke,
 		&function_rpc_interface_await,
-		&function_rpc_interface_destroy
+		&function_rpc_interface_destroy,
+		NULL
 	};
 
 	return &rpc_function_interface;
@@ -510,6 +512,20 @@ int rpc_loader_impl_initialize_types(loader_impl impl, loader_impl_rpc rpc_impl)
 	return 0;
 }
 
+CURL *rpc_loader_impl_discover_curl(void)
+{
+	CURL *discover_curl = curl_easy_init();
+
+	if (discover_curl != NULL)
+	{
+		curl_easy_setopt(discover_curl, CURLOPT_VERBOSE, CURL_VERBOSE);
+		curl_easy_setopt(discover_curl, CURLOPT_HEADER, 0L);
+		curl_easy_setopt(discover_curl, CURLOPT_WRITEFUNCTION, rpc_loader_impl_write_data);
+	}
+
+	return discover_curl;
+}
+
 loader_impl_data rpc_loader_impl_initialize(loader_impl impl, configuration config)
 {
 	loader_impl_rpc rpc_impl = new loader_impl_rpc_type();
@@ -540,7 +556,7 @@ loader_impl_data rpc_loader_impl_initialize(loader_impl impl, configuration conf
 	curl_global_init(CURL_GLOBAL_ALL);
 
 	/* Initialize discover CURL object */
-	rpc_impl->discover_curl = curl_easy_init();
+	rpc_impl->discover_curl = rpc_loader_impl_discover_curl();
 
 	if (rpc_impl->discover_curl == NULL)
 	{
@@ -553,10 +569,6 @@ loader_impl_data rpc_loader_impl_initialize(loader_impl impl, configuration conf
 		return NULL;
 	}
 
-	curl_easy_setopt(rpc_impl->discover_curl, CURLOPT_VERBOSE, CURL_VERBOSE);
-	curl_easy_setopt(rpc_impl->discover_curl, CURLOPT_HEADER, 0L);
-	curl_easy_setopt(rpc_impl->discover_curl, CURLOPT_WRITEFUNCTION, rpc_loader_impl_write_data);
-
 	rpc_impl->headers = NULL;
 	rpc_impl->headers = curl_slist_append(rpc_impl->headers, "Accept: application/json");
 	rpc_impl->headers = curl_slist_append(rpc_impl->headers, "Content-Type: application/json");
@@ -936,5 +948,57 @@ int rpc_loader_impl_destroy(loader_impl impl)
 
 	delete rpc_impl;
 
+	return 0;
+}
+
+int rpc_loader_impl_fork(loader_impl impl, enum loader_impl_fork_id id)
+{
+	loader_impl_rpc rpc_impl = static_cast<loader_impl_rpc>(loader_impl_get(impl));
+
+	if (id == LOADER_IMPL_FORK_PREPARE)
+	{
+		/* Stop the poll thread, it waits until the in-flight async transfers are finished */
+		rpc_impl->exit_flag.store(true);
+		curl_multi_wakeup(rpc_impl->async_multi);
+		if (rpc_impl->poll_thread.joinable())
+		{
+			rpc_impl->poll_thread.join();
+		}
+
+		return 0;
+	}
+
+	if (id == LOADER_IMPL_FORK_CHILD)
+	{
+		/* The inherited handles are not cleaned up because their cached connections are shared
+		with the parent, closing them (i.e. TLS shutdown) would break the connections of the parent */
+		CURL *discover_curl = rpc_loader_impl_discover_curl();
+		CURLM *async_multi = curl_multi_init();
+
+		if (discover_curl == NULL || async_multi == NULL)
+		{
+			log_write("metacall", LOG_LEVEL_ERROR, "Could not create CURL handles in the forked process");
+
+			if (discover_curl != NULL)
+			{
+				curl_easy_cleanup(discover_curl);
+			}
+
+			if (async_multi != NULL)
+			{
+				curl_multi_cleanup(async_multi);
+			}
+
+			return 1;
+		}
+
+		rpc_impl->discover_curl = discover_curl;
+		rpc_impl->async_multi = async_multi;
+	}
+
+	/* Start the poll thread again */
+	rpc_impl->exit_flag.store(false);
+	rpc_impl->poll_thread = std::thread(rpc_poll_loop, rpc_impl);
+
 	return 0;
 }
\ No newline at end of file
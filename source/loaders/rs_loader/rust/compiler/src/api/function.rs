@@ -16,6 +16,7 @@ pub struct FunctionInterface {
         OpaqueType,
     ) -> OpaqueType,
     destroy: extern "C" fn(OpaqueType, OpaqueType),
+    discover: Option<extern "C" fn(OpaqueType, OpaqueType, *mut c_int) -> OpaqueType>,
 }
 
 #[no_mangle]
@@ -71,6 +72,7 @@ pub extern "C" fn function_singleton() -> *const FunctionInterface {
         invoke: function_singleton_invoke,
         r#await: function_singleton_await,
         destroy: function_singleton_destroy,
+        discover: None,
     };
 
     &SINGLETON
@@ -33,7 +33,8 @@ loader_impl_interface rs_loader_impl_interface_singleton(void)
 		&rs_loader_impl_load_from_package,
 		&rs_loader_impl_clear,
 		&rs_loader_impl_discover,
-		&rs_loader_impl_destroy
+		&rs_loader_impl_destroy,
+		NULL
 	};
 
 	return &loader_impl_interface_rs;
@@ -33,7 +33,8 @@ loader_impl_interface ts_loader_impl_interface_singleton(void)
 		&ts_loader_impl_load_from_package,
 		&ts_loader_impl_clear,
 		&ts_loader_impl_discover,
-		&ts_loader_impl_destroy
+		&ts_loader_impl_destroy,
+		NULL
 	};
 
 	return &loader_impl_interface_ts;
@@ -84,7 +84,8 @@ function_interface function_ts_singleton(void)
 		&function_ts_interface_create,
 		&function_ts_interface_invoke,
 		&function_ts_interface_await,
-		&function_ts_interface_destroy
+		&function_ts_interface_destroy,
+		NULL
 	};
 
 	return &ts_function_interface;
@@ -38,6 +38,8 @@ WASM_LOADER_API int wasm_loader_impl_clear(loader_impl impl, loader_handle handl
 WASM_LOADER_API int wasm_loader_impl_discover(loader_impl impl, loader_handle handle, context ctx);
 WASM_LOADER_API int wasm_loader_impl_destroy(loader_impl impl);
 
+WASM_LOADER_API int wasm_loader_impl_fork(loader_impl impl, enum loader_impl_fork_id id);
+
 #ifdef __cplusplus
 }
 #endif
@@ -33,7 +33,8 @@ loader_impl_interface wasm_loader_impl_interface_singleton(void)
 		&wasm_loader_impl_load_from_package,
 		&wasm_loader_impl_clear,
 		&wasm_loader_impl_discover,
-		&wasm_loader_impl_destroy
+		&wasm_loader_impl_destroy,
+		&wasm_loader_impl_fork
 	};
 
 	return &loader_impl_interface_wasm;
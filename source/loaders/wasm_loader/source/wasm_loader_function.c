@@ -29,7 +29,8 @@ function_interface function_wasm_singleton(void)
 		// not fully implemented in Wasmtime
 		// (see https://docs.wasmtime.dev/stability-wasm-proposals-support.html)
 		NULL,
-		&function_wasm_interface_destroy
+		&function_wasm_interface_destroy,
+		NULL
 	};
 
 	return &wasm_function_interface;
@@ -253,6 +253,21 @@ int wasm_loader_impl_destroy(loader_impl impl)
 	return 0;
 }
 
+int wasm_loader_impl_fork(loader_impl impl, enum loader_impl_fork_id id)
+{
+	(void)impl;
+
+	/* The engine of Wasmtime compiles modules in a thread pool, the child would get the
+	engine without the threads that back it */
+	if (id == LOADER_IMPL_FORK_PREPARE)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "WebAssembly loader does not support fork, spawn the workers before loading WebAssembly");
+		return 1;
+	}
+
+	return 0;
+}
+
 static int initialize_types(loader_impl impl)
 {
 	// TODO: Implement ANYREF and FUNCREF?
@@ -44,6 +44,24 @@ extern "C" {
 
 #include <stdarg.h>
 
+/* -- Forward Declarations -- */
+
+struct log_impl_type;
+
+/* -- Member Data -- */
+
+/* Logger resolved by a call site of log_write, valid while the generation matches the one of the loggers */
+struct log_cache_type
+{
+	size_t generation;
+	const char *name;
+	struct log_impl_type *impl;
+};
+
+/* -- Definitions -- */
+
+#define LOG_CACHE_INITIALIZER { 0, NULL, NULL }
+
 /* -- Methods -- */
 
 LOG_API void *log_instance(void);
@@ -62,6 +80,10 @@ LOG_API int log_write_impl(const char *name, const size_t line, const char *func
 
 LOG_API int log_write_impl_va(const char *name, const size_t line, const char *func, const char *file, const enum log_level_id level, const char *message, ...);
 
+LOG_API int log_write_cache_impl(struct log_cache_type *cache, const char *name, const size_t line, const char *func, const char *file, const enum log_level_id level, const char *message);
+
+LOG_API int log_write_cache_impl_va(struct log_cache_type *cache, const char *name, const size_t line, const char *func, const char *file, const enum log_level_id level, const char *message, ...);
+
 LOG_API int log_clear(const char *name);
 
 LOG_API int log_delete(const char *name);
@@ -15,6 +15,8 @@
 
 #include <log/log_policy.h>
 
+#include <stdio.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -23,6 +25,10 @@ extern "C" {
 
 LOG_API log_policy_interface log_policy_format_binary_interface(void);
 
+/* Write the binary records of @buffer as text into @out, returns the number of bytes decoded,
+which is less than @size when the last record is incomplete or when a record is invalid */
+LOG_API size_t log_policy_format_binary_decode(const void *buffer, const size_t size, FILE *out);
+
 #ifdef __cplusplus
 }
 #endif
@@ -53,10 +53,14 @@ struct log_policy_storage_impl_type
 
 LOG_API log_policy_interface log_policy_storage(const log_policy_id policy_storage_id);
 
-LOG_API log_policy log_policy_storage_batch(size_t size);
+LOG_API log_policy log_policy_storage_batch(size_t size, enum log_level_id flush_level, size_t flush_interval);
 
 LOG_API log_policy log_policy_storage_sequential(void);
 
+LOG_API log_aspect log_policy_storage_sibling(log_policy policy, enum log_aspect_id aspect_id);
+
+LOG_API int log_policy_storage_write(log_policy policy, const void *buffer, const size_t size);
+
 #ifdef __cplusplus
 }
 #endif
@@ -13,6 +13,7 @@
 
 #include <log/log_api.h>
 
+#include <log/log_level.h>
 #include <log/log_policy.h>
 
 #ifdef __cplusplus
@@ -31,7 +32,9 @@ typedef struct log_policy_storage_batch_ctor_type *log_policy_storage_batch_ctor
 
 struct log_policy_storage_batch_ctor_type
 {
-	size_t size;
+	size_t size;				   /* Size in bytes of the buffer where the formatted records are coalesced */
+	enum log_level_id flush_level; /* Records with this level or higher are flushed immediately */
+	size_t flush_interval;		   /* Milliseconds a record can stay in the buffer, checked on append (zero disables it) */
 };
 
 /* -- Methods -- */
@@ -68,6 +68,8 @@ LOG_API log_policy log_policy_stream_nginx(ngx_log_t *ngx_log_ptr, void (*ngx_er
 
 LOG_API log_policy log_policy_stream_socket(const char *ip, uint16_t port);
 
+LOG_API log_policy log_policy_stream_socket_unix(const char *path, enum log_policy_stream_socket_type_id type, size_t size);
+
 LOG_API log_policy log_policy_stream_stdio(FILE *stream);
 
 LOG_API log_policy log_policy_stream_syslog(const char *name);
@@ -23,6 +23,17 @@ extern "C" {
 
 #include <stdint.h>
 
+/* -- Definitions -- */
+
+enum log_policy_stream_socket_type_id
+{
+	LOG_POLICY_STREAM_SOCKET_UDP = 0x00,
+	LOG_POLICY_STREAM_SOCKET_UNIX_DGRAM = 0x01,
+	LOG_POLICY_STREAM_SOCKET_UNIX_STREAM = 0x02,
+
+	LOG_POLICY_STREAM_SOCKET_TYPE_SIZE
+};
+
 /* -- Forward Declarations -- */
 
 struct log_policy_stream_socket_ctor_type;
@@ -35,14 +46,19 @@ typedef struct log_policy_stream_socket_ctor_type *log_policy_stream_socket_ctor
 
 struct log_policy_stream_socket_ctor_type
 {
+	enum log_policy_stream_socket_type_id type;
 	const char *ip;
 	uint16_t port;
+	const char *path;
+	size_t size;
 };
 
 /* -- Methods -- */
 
 LOG_API log_policy_interface log_policy_stream_socket_interface(void);
 
+LOG_API uint64_t log_policy_stream_socket_dropped(log_policy policy);
+
 #ifdef __cplusplus
 }
 #endif
@@ -36,6 +36,36 @@ extern "C" {
 
 #define LOG_PREPROCESSOR_LINE ((size_t)__LINE__)
 
+/* Records with a level lower than the minimum (a log_level_id value) are removed at compile time */
+#ifndef LOG_LEVEL_MINIMUM
+	#define LOG_LEVEL_MINIMUM 0
+#endif
+
+#if LOG_LEVEL_MINIMUM > 0
+	#define LOG_PREPROCESSOR_LEVEL(level) ((int)(level) >= LOG_LEVEL_MINIMUM)
+#else
+	#define LOG_PREPROCESSOR_LEVEL(level) 1
+#endif
+
+/* Each call site caches the logger it writes to, so the logger is not looked up by name on every
+write, the cache needs a static variable inside of an expression (statement expressions) */
+#if defined(__GNUC__) || defined(__clang__)
+	#define LOG_PREPROCESSOR_WRITE(level, expr) \
+		__extension__({ \
+			int log_write_result = 0; \
+			if (LOG_PREPROCESSOR_LEVEL(level)) \
+			{ \
+				static struct log_cache_type log_cache_site = LOG_CACHE_INITIALIZER; \
+				log_write_result = expr; \
+			} \
+			log_write_result; \
+		})
+	#define LOG_PREPROCESSOR_CACHE_SITE (&log_cache_site)
+#else
+	#define LOG_PREPROCESSOR_WRITE(level, expr) (LOG_PREPROCESSOR_LEVEL(level) ? (expr) : 0)
+	#define LOG_PREPROCESSOR_CACHE_SITE NULL
+#endif
+
 /* -- Macros -- */
 
 #define log_configure(name, ...) \
@@ -44,14 +74,14 @@ extern "C" {
 #if (defined(__cplusplus) && (__cplusplus >= 201103L)) || \
 	(defined(__STDC__) && defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L))
 	#define log_write(name, level, ...) \
-		PREPROCESSOR_IF(PREPROCESSOR_ARGS_EMPTY(__VA_ARGS__), \
-			log_write_impl(name, LOG_PREPROCESSOR_LINE, log_record_function(), __FILE__, level, __VA_ARGS__), \
-			log_write_impl_va(name, LOG_PREPROCESSOR_LINE, log_record_function(), __FILE__, level, __VA_ARGS__))
+		LOG_PREPROCESSOR_WRITE(level, PREPROCESSOR_IF(PREPROCESSOR_ARGS_EMPTY(__VA_ARGS__), \
+			log_write_cache_impl(LOG_PREPROCESSOR_CACHE_SITE, name, LOG_PREPROCESSOR_LINE, log_record_function(), __FILE__, level, __VA_ARGS__), \
+			log_write_cache_impl_va(LOG_PREPROCESSOR_CACHE_SITE, name, LOG_PREPROCESSOR_LINE, log_record_function(), __FILE__, level, __VA_ARGS__)))
 #else
 	#define log_write(name, level, message, ...) \
-		PREPROCESSOR_IF(PREPROCESSOR_ARGS_EMPTY(__VA_ARGS__), \
-			log_write_impl(name, LOG_PREPROCESSOR_LINE, log_record_function(), __FILE__, level, message), \
-			log_write_impl_va(name, LOG_PREPROCESSOR_LINE, log_record_function(), __FILE__, level, message, __VA_ARGS__))
+		LOG_PREPROCESSOR_WRITE(level, PREPROCESSOR_IF(PREPROCESSOR_ARGS_EMPTY(__VA_ARGS__), \
+			log_write_cache_impl(LOG_PREPROCESSOR_CACHE_SITE, name, LOG_PREPROCESSOR_LINE, log_record_function(), __FILE__, level, message), \
+			log_write_cache_impl_va(LOG_PREPROCESSOR_CACHE_SITE, name, LOG_PREPROCESSOR_LINE, log_record_function(), __FILE__, level, message, __VA_ARGS__)))
 #endif
 
 #ifdef __cplusplus
@@ -28,6 +28,10 @@
 
 #include <stdarg.h>
 
+/* -- Definitions -- */
+
+#define LOG_CACHE_BUSY ((size_t)-1)
+
 /* -- Methods -- */
 
 void *log_instance(void)
@@ -145,22 +149,61 @@ int log_level(const char *name, const char *level, size_t length)
 	return 1;
 }
 
-int log_write_impl(const char *name, const size_t line, const char *func, const char *file, const enum log_level_id level, const char *message)
+static log_impl log_cache_get(struct log_cache_type *cache, const char *name)
 {
-	log_impl impl = log_singleton_get(name);
+#if defined(__GNUC__) || defined(__clang__)
+	size_t generation, cached;
+	log_impl impl;
 
-	struct log_record_ctor_type record_ctor;
+	if (cache == NULL)
+	{
+		return log_singleton_get(name);
+	}
 
-	enum log_level_id impl_level;
+	generation = log_singleton_generation();
+	cached = __atomic_load_n(&cache->generation, __ATOMIC_ACQUIRE);
 
-	if (impl == NULL)
+	if (cached == generation)
 	{
-		return 0;
+		const char *cached_name = __atomic_load_n(&cache->name, __ATOMIC_RELAXED);
+
+		impl = __atomic_load_n(&cache->impl, __ATOMIC_RELAXED);
+
+		__atomic_thread_fence(__ATOMIC_ACQUIRE);
+
+		/* The entry is valid if no other thread has updated it while it was being read */
+		if (cached_name == name && __atomic_load_n(&cache->generation, __ATOMIC_RELAXED) == cached)
+		{
+			return impl;
+		}
 	}
 
-	impl_level = log_impl_level(impl);
+	impl = log_singleton_get(name);
 
-	if (level < impl_level)
+	/* Only one thread updates the entry at a time, the others keep using the lookup */
+	if (cached != LOG_CACHE_BUSY && __atomic_compare_exchange_n(&cache->generation, &cached, LOG_CACHE_BUSY, 0, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED))
+	{
+		__atomic_thread_fence(__ATOMIC_RELEASE);
+
+		__atomic_store_n(&cache->name, name, __ATOMIC_RELAXED);
+		__atomic_store_n(&cache->impl, impl, __ATOMIC_RELAXED);
+		__atomic_store_n(&cache->generation, generation, __ATOMIC_RELEASE);
+	}
+
+	return impl;
+#else
+	/* Call sites are not cached without statement expressions, see log_preprocessor.h */
+	(void)cache;
+
+	return log_singleton_get(name);
+#endif
+}
+
+static int log_write_record(log_impl impl, const size_t line, const char *func, const char *file, const enum log_level_id level, const char *message, struct log_record_va_list_type *variable_args)
+{
+	struct log_record_ctor_type record_ctor;
+
+	if (impl == NULL || level < log_impl_level(impl))
 	{
 		return 0;
 	}
@@ -170,50 +213,59 @@ int log_write_impl(const char *name, const size_t line, const char *func, const
 	record_ctor.file = file;
 	record_ctor.level = level;
 	record_ctor.message = message;
-	record_ctor.variable_args = NULL;
+	record_ctor.variable_args = variable_args;
 
 	return log_impl_write(impl, &record_ctor);
 }
 
+int log_write_impl(const char *name, const size_t line, const char *func, const char *file, const enum log_level_id level, const char *message)
+{
+	return log_write_record(log_singleton_get(name), line, func, file, level, message, NULL);
+}
+
 int log_write_impl_va(const char *name, const size_t line, const char *func, const char *file, const enum log_level_id level, const char *message, ...)
 {
 	log_impl impl = log_singleton_get(name);
 
-	struct log_record_ctor_type record_ctor;
+	struct log_record_va_list_type variable_args;
 
 	int result;
 
-	enum log_level_id impl_level;
-
-	struct log_record_va_list_type variable_args;
-
-	if (impl == NULL)
+	if (impl == NULL || level < log_impl_level(impl))
 	{
 		return 0;
 	}
 
-	impl_level = log_impl_level(impl);
+	va_start(variable_args.data, message);
 
-	if (impl == NULL)
-	{
-		return 1;
-	}
+	result = log_write_record(impl, line, func, file, level, message, &variable_args);
+
+	va_end(variable_args.data);
+
+	return result;
+}
 
-	if (level < impl_level)
+int log_write_cache_impl(struct log_cache_type *cache, const char *name, const size_t line, const char *func, const char *file, const enum log_level_id level, const char *message)
+{
+	return log_write_record(log_cache_get(cache, name), line, func, file, level, message, NULL);
+}
+
+int log_write_cache_impl_va(struct log_cache_type *cache, const char *name, const size_t line, const char *func, const char *file, const enum log_level_id level, const char *message, ...)
+{
+	log_impl impl = log_cache_get(cache, name);
+
+	struct log_record_va_list_type variable_args;
+
+	int result;
+
+	if (impl == NULL || level < log_impl_level(impl))
 	{
 		return 0;
 	}
 
 	va_start(variable_args.data, message);
 
-	record_ctor.line = line;
-	record_ctor.func = func;
-	record_ctor.file = file;
-	record_ctor.level = level;
-	record_ctor.message = message;
-	record_ctor.variable_args = &variable_args;
-
-	result = log_impl_write(impl, &record_ctor);
+	result = log_write_record(impl, line, func, file, level, message, &variable_args);
 
 	va_end(variable_args.data);
 
@@ -14,6 +14,8 @@
 #include <log/log_aspect_schedule.h>
 #include <log/log_policy_schedule.h>
 
+#include <log/log_aspect_storage.h>
+
 #include <log/log_aspect_format.h>
 #include <log/log_policy_format.h>
 
@@ -107,7 +109,7 @@ static int log_aspect_stream_impl_write_cb(log_aspect aspect, log_policy policy,
 		return 1;
 	}
 
-	/* TODO: remove this, use storage policy instead */
+	/* Loggers without storage write each record directly into the stream */
 	{
 		void *buffer = malloc(size);
 
@@ -146,9 +148,9 @@ static int log_aspect_stream_impl_write_execute_cb(log_policy policy, log_aspect
 
 	log_record record;
 
-	int result;
+	log_aspect storage;
 
-	struct log_aspect_stream_write_cb_data_type write_data;
+	int result;
 
 	if (schedule_impl->lock(policy) != 0)
 	{
@@ -167,10 +169,24 @@ static int log_aspect_stream_impl_write_execute_cb(log_policy policy, log_aspect
 		return 1;
 	}
 
-	write_data.impl = execute_data->impl;
-	write_data.record = record;
+	storage = log_impl_aspect(execute_data->impl, LOG_ASPECT_STORAGE);
+
+	if (storage != NULL)
+	{
+		log_aspect_storage_impl storage_impl = log_aspect_derived(storage);
+
+		/* The storage decides when the formatted record is written into the streams */
+		result = storage_impl->append(storage, record);
+	}
+	else
+	{
+		struct log_aspect_stream_write_cb_data_type write_data;
+
+		write_data.impl = execute_data->impl;
+		write_data.record = record;
 
-	result = log_aspect_notify_all(execute_data->aspect, &log_aspect_stream_impl_write_cb, (log_aspect_notify_data)&write_data);
+		result = log_aspect_notify_all(execute_data->aspect, &log_aspect_stream_impl_write_cb, (log_aspect_notify_data)&write_data);
+	}
 
 	if (schedule_impl->lock(policy) != 0)
 	{
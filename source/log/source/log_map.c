@@ -252,11 +252,60 @@ const void *log_map_get(log_map map, const char *key)
 
 const void *log_map_remove(log_map map, const char *key)
 {
-	/* TODO: remove log impl from map and clear bucket */
-	(void)map;
-	(void)key;
+	size_t hash = log_map_hash_fnv1(key) & (map->table.size - 1);
 
-	return NULL;
+	log_map_bucket head = &map->table.data[hash];
+
+	log_map_bucket bucket = head, prev = NULL;
+
+	const void *value;
+
+	if (head->key == NULL)
+	{
+		return NULL;
+	}
+
+	while (bucket != NULL && strcmp(bucket->key, key) != 0)
+	{
+		prev = bucket;
+		bucket = bucket->next;
+	}
+
+	if (bucket == NULL)
+	{
+		return NULL;
+	}
+
+	value = bucket->value;
+
+	if (prev != NULL)
+	{
+		/* Collided buckets are unlinked, their block storage is released on clear */
+		prev->next = bucket->next;
+
+		bucket->key = NULL;
+		bucket->value = NULL;
+	}
+	else if (head->next != NULL)
+	{
+		log_map_bucket next = head->next;
+
+		head->key = next->key;
+		head->value = next->value;
+		head->next = next->next;
+
+		next->key = NULL;
+		next->value = NULL;
+	}
+	else
+	{
+		head->key = NULL;
+		head->value = NULL;
+	}
+
+	--map->table.count;
+
+	return value;
 }
 
 int log_map_clear(log_map map)
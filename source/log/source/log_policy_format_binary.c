@@ -8,24 +8,122 @@
 
 /* -- Headers -- */
 
+#include <log/log_level.h>
 #include <log/log_policy_format.h>
 #include <log/log_policy_format_binary.h>
 
+#include <format/format_print.h>
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+/* -- Definitions -- */
+
+/*
+*	Each record is written without formatting its message, it is composed by:
+*
+*		uint32_t magic			LOG_POLICY_FORMAT_BINARY_MAGIC (also detects the byte order)
+*		uint32_t size			Size in bytes of the record
+*		int64_t time			Time of the record
+*		uint64_t thread_id		Identifier of the thread that wrote the record
+*		uint64_t line			Line of the record
+*		uint8_t level			Level of the record
+*		uint8_t flags			LOG_POLICY_FORMAT_BINARY_FLAG_FORMAT if the message is a format string
+*		uint16_t argc			Number of arguments
+*		uint32_t file_length	Length of the file name
+*		uint32_t func_length	Length of the function name
+*		uint32_t message_length	Length of the message
+*		char file[], func[], message[]
+*		arguments[argc]			Tag of one byte followed by its value
+*
+*	The serialized record is followed by a null character that is not part of it,
+*	so the streams that drop the null character of text records write it unmodified
+*/
+
+#define LOG_POLICY_FORMAT_BINARY_MAGIC		 ((uint32_t)0x424C434D)
+#define LOG_POLICY_FORMAT_BINARY_HEADER_SIZE ((size_t)48)
+#define LOG_POLICY_FORMAT_BINARY_SIZE_OFFSET ((size_t)4)
+#define LOG_POLICY_FORMAT_BINARY_ARGC_OFFSET ((size_t)34)
+#define LOG_POLICY_FORMAT_BINARY_FLAG_FORMAT ((uint8_t)0x01)
+#define LOG_POLICY_FORMAT_BINARY_NULL_STRING ((uint32_t)0xFFFFFFFF)
+
+/* -- Macros -- */
+
+#ifndef va_copy
+	#if defined(__va_copy)
+		#define va_copy(dest, src) __va_copy((dest), (src))
+	#elif defined(__builtin_va_copy)
+		#define va_copy(dest, src) __builtin_va_copy((dest), (src))
+	#else
+		#define va_copy(dest, src) ((void)memcpy(&(dest), &(src), sizeof(va_list)))
+	#endif
+#endif
+
 /* -- Forward Declarations -- */
 
 struct log_policy_format_binary_data_type;
 
+struct log_policy_format_binary_spec_type;
+
+struct log_policy_format_binary_writer_type;
+
 /* -- Type Definitions -- */
 
 typedef struct log_policy_format_binary_data_type *log_policy_format_binary_data;
 
+typedef struct log_policy_format_binary_spec_type *log_policy_format_binary_spec;
+
+typedef struct log_policy_format_binary_writer_type *log_policy_format_binary_writer;
+
 /* -- Member Data -- */
 
+enum log_policy_format_binary_arg_id
+{
+	LOG_POLICY_FORMAT_BINARY_ARG_INT = 0x01,
+	LOG_POLICY_FORMAT_BINARY_ARG_UINT = 0x02,
+	LOG_POLICY_FORMAT_BINARY_ARG_DOUBLE = 0x03,
+	LOG_POLICY_FORMAT_BINARY_ARG_STRING = 0x04,
+	LOG_POLICY_FORMAT_BINARY_ARG_POINTER = 0x05
+};
+
+enum log_policy_format_binary_length_id
+{
+	LOG_POLICY_FORMAT_BINARY_LENGTH_NONE,
+	LOG_POLICY_FORMAT_BINARY_LENGTH_HH,
+	LOG_POLICY_FORMAT_BINARY_LENGTH_H,
+	LOG_POLICY_FORMAT_BINARY_LENGTH_L,
+	LOG_POLICY_FORMAT_BINARY_LENGTH_LL,
+	LOG_POLICY_FORMAT_BINARY_LENGTH_J,
+	LOG_POLICY_FORMAT_BINARY_LENGTH_Z,
+	LOG_POLICY_FORMAT_BINARY_LENGTH_T,
+	LOG_POLICY_FORMAT_BINARY_LENGTH_LONG_DOUBLE
+};
+
 struct log_policy_format_binary_data_type
 {
 	void *todo;
 };
 
+struct log_policy_format_binary_spec_type
+{
+	const char *begin;	/* Position of the '%' character */
+	const char *length; /* Position of the length modifier */
+	const char *end;	/* Position after the conversion character */
+	unsigned int stars;
+	enum log_policy_format_binary_length_id length_id;
+	char conversion; /* Null character if the conversion is not supported */
+};
+
+struct log_policy_format_binary_writer_type
+{
+	char *buffer; /* Null when only the size is calculated */
+	size_t size;
+	size_t offset;
+};
+
 /* -- Private Methods -- */
 
 static int log_policy_format_binary_create(log_policy policy, const log_policy_ctor ctor);
@@ -38,6 +136,18 @@ static size_t log_policy_format_binary_deserialize(log_policy policy, log_record
 
 static int log_policy_format_binary_destroy(log_policy policy);
 
+static const char *log_policy_format_binary_spec_next(const char *format, log_policy_format_binary_spec spec);
+
+static void log_policy_format_binary_write(log_policy_format_binary_writer writer, const void *data, size_t size);
+
+static void log_policy_format_binary_write_arg(log_policy_format_binary_writer writer, uint8_t tag, const void *data, size_t size);
+
+static size_t log_policy_format_binary_encode(const log_record record, log_policy_format_binary_writer writer);
+
+static int log_policy_format_binary_read(const char *buffer, size_t size, size_t *offset, void *data, size_t data_size);
+
+static int log_policy_format_binary_decode_record(const char *record, size_t size, FILE *out);
+
 /* -- Methods -- */
 
 log_policy_interface log_policy_format_binary_interface(void)
@@ -73,29 +183,330 @@ static int log_policy_format_binary_create(log_policy policy, const log_policy_c
 	return 0;
 }
 
+const char *log_policy_format_binary_spec_next(const char *format, log_policy_format_binary_spec spec)
+{
+	const char *it = strchr(format, '%');
+
+	if (it == NULL)
+	{
+		return NULL;
+	}
+
+	spec->begin = it++;
+	spec->stars = 0;
+	spec->length_id = LOG_POLICY_FORMAT_BINARY_LENGTH_NONE;
+
+	/* Flags, width and precision */
+	while (*it != '\0' && strchr("-+ #0'123456789.*", *it) != NULL)
+	{
+		if (*it == '*')
+		{
+			++spec->stars;
+		}
+
+		++it;
+	}
+
+	spec->length = it;
+
+	switch (*it)
+	{
+		case 'h':
+			spec->length_id = (it[1] == 'h') ? LOG_POLICY_FORMAT_BINARY_LENGTH_HH : LOG_POLICY_FORMAT_BINARY_LENGTH_H;
+			it += (it[1] == 'h') ? 2 : 1;
+			break;
+
+		case 'l':
+			spec->length_id = (it[1] == 'l') ? LOG_POLICY_FORMAT_BINARY_LENGTH_LL : LOG_POLICY_FORMAT_BINARY_LENGTH_L;
+			it += (it[1] == 'l') ? 2 : 1;
+			break;
+
+		case 'q':
+			spec->length_id = LOG_POLICY_FORMAT_BINARY_LENGTH_LL;
+			++it;
+			break;
+
+		case 'j':
+			spec->length_id = LOG_POLICY_FORMAT_BINARY_LENGTH_J;
+			++it;
+			break;
+
+		case 'z':
+			spec->length_id = LOG_POLICY_FORMAT_BINARY_LENGTH_Z;
+			++it;
+			break;
+
+		case 't':
+			spec->length_id = LOG_POLICY_FORMAT_BINARY_LENGTH_T;
+			++it;
+			break;
+
+		case 'L':
+			spec->length_id = LOG_POLICY_FORMAT_BINARY_LENGTH_LONG_DOUBLE;
+			++it;
+			break;
+	}
+
+	/* Wide characters and unknown conversions stop the parsing of the arguments */
+	if (*it != '\0' && strchr("diuoxXcfFeEgGaAspn%", *it) != NULL &&
+		!((*it == 's' || *it == 'c') && spec->length_id == LOG_POLICY_FORMAT_BINARY_LENGTH_L))
+	{
+		spec->conversion = *it++;
+	}
+	else
+	{
+		spec->conversion = '\0';
+	}
+
+	spec->end = it;
+
+	return it;
+}
+
+void log_policy_format_binary_write(log_policy_format_binary_writer writer, const void *data, size_t size)
+{
+	if (writer->buffer != NULL && writer->offset + size <= writer->size)
+	{
+		memcpy(&writer->buffer[writer->offset], data, size);
+	}
+
+	writer->offset += size;
+}
+
+void log_policy_format_binary_write_arg(log_policy_format_binary_writer writer, uint8_t tag, const void *data, size_t size)
+{
+	log_policy_format_binary_write(writer, &tag, sizeof(uint8_t));
+	log_policy_format_binary_write(writer, data, size);
+}
+
+size_t log_policy_format_binary_encode(const log_record record, log_policy_format_binary_writer writer)
+{
+	const char *file = log_record_file(record);
+	const char *func = log_record_func(record);
+	const char *message = log_record_message(record);
+	struct log_record_va_list_type *variable_args = log_record_variable_args(record);
+	uint32_t magic = LOG_POLICY_FORMAT_BINARY_MAGIC, size = 0;
+	int64_t time = (int64_t)*log_record_time(record);
+	uint64_t thread_id = log_record_thread_id(record), line = (uint64_t)log_record_line(record);
+	uint8_t level = (uint8_t)log_record_level(record);
+	uint8_t flags = (variable_args != NULL) ? LOG_POLICY_FORMAT_BINARY_FLAG_FORMAT : 0;
+	uint16_t argc = 0;
+	uint32_t file_length = (file != NULL) ? (uint32_t)strlen(file) : 0;
+	uint32_t func_length = (func != NULL) ? (uint32_t)strlen(func) : 0;
+	uint32_t message_length = (message != NULL) ? (uint32_t)strlen(message) : 0;
+
+	log_policy_format_binary_write(writer, &magic, sizeof(uint32_t));
+	log_policy_format_binary_write(writer, &size, sizeof(uint32_t));
+	log_policy_format_binary_write(writer, &time, sizeof(int64_t));
+	log_policy_format_binary_write(writer, &thread_id, sizeof(uint64_t));
+	log_policy_format_binary_write(writer, &line, sizeof(uint64_t));
+	log_policy_format_binary_write(writer, &level, sizeof(uint8_t));
+	log_policy_format_binary_write(writer, &flags, sizeof(uint8_t));
+	log_policy_format_binary_write(writer, &argc, sizeof(uint16_t));
+	log_policy_format_binary_write(writer, &file_length, sizeof(uint32_t));
+	log_policy_format_binary_write(writer, &func_length, sizeof(uint32_t));
+	log_policy_format_binary_write(writer, &message_length, sizeof(uint32_t));
+	log_policy_format_binary_write(writer, file, file_length);
+	log_policy_format_binary_write(writer, func, func_length);
+	log_policy_format_binary_write(writer, message, message_length);
+
+	/* The arguments are copied as they are, the message is formatted when the log is decoded */
+	if (variable_args != NULL && message != NULL)
+	{
+		struct log_policy_format_binary_spec_type spec;
+		const char *it = message;
+		va_list args;
+
+		va_copy(args, variable_args->data);
+
+		while ((it = log_policy_format_binary_spec_next(it, &spec)) != NULL && spec.conversion != '\0')
+		{
+			unsigned int star;
+
+			for (star = 0; star < spec.stars; ++star)
+			{
+				int64_t value = (int64_t)va_arg(args, int);
+
+				log_policy_format_binary_write_arg(writer, LOG_POLICY_FORMAT_BINARY_ARG_INT, &value, sizeof(int64_t));
+				++argc;
+			}
+
+			switch (spec.conversion)
+			{
+				case 'd':
+				case 'i':
+				case 'c': {
+					int64_t value;
+
+					switch (spec.length_id)
+					{
+						case LOG_POLICY_FORMAT_BINARY_LENGTH_HH:
+							value = (int64_t)(signed char)va_arg(args, int);
+							break;
+						case LOG_POLICY_FORMAT_BINARY_LENGTH_H:
+							value = (int64_t)(short)va_arg(args, int);
+							break;
+						case LOG_POLICY_FORMAT_BINARY_LENGTH_L:
+							value = (int64_t)va_arg(args, long);
+							break;
+						case LOG_POLICY_FORMAT_BINARY_LENGTH_LL:
+							value = (int64_t)va_arg(args, long long);
+							break;
+						case LOG_POLICY_FORMAT_BINARY_LENGTH_J:
+							value = (int64_t)va_arg(args, intmax_t);
+							break;
+						case LOG_POLICY_FORMAT_BINARY_LENGTH_Z:
+							value = (int64_t)va_arg(args, size_t);
+							break;
+						case LOG_POLICY_FORMAT_BINARY_LENGTH_T:
+							value = (int64_t)va_arg(args, ptrdiff_t);
+							break;
+						default:
+							value = (int64_t)va_arg(args, int);
+							break;
+					}
+
+					log_policy_format_binary_write_arg(writer, LOG_POLICY_FORMAT_BINARY_ARG_INT, &value, sizeof(int64_t));
+					++argc;
+					break;
+				}
+
+				case 'u':
+				case 'o':
+				case 'x':
+				case 'X': {
+					uint64_t value;
+
+					switch (spec.length_id)
+					{
+						case LOG_POLICY_FORMAT_BINARY_LENGTH_HH:
+							value = (uint64_t)(unsigned char)va_arg(args, unsigned int);
+							break;
+						case LOG_POLICY_FORMAT_BINARY_LENGTH_H:
+							value = (uint64_t)(unsigned short)va_arg(args, unsigned int);
+							break;
+						case LOG_POLICY_FORMAT_BINARY_LENGTH_L:
+							value = (uint64_t)va_arg(args, unsigned long);
+							break;
+						case LOG_POLICY_FORMAT_BINARY_LENGTH_LL:
+							value = (uint64_t)va_arg(args, unsigned long long);
+							break;
+						case LOG_POLICY_FORMAT_BINARY_LENGTH_J:
+							value = (uint64_t)va_arg(args, uintmax_t);
+							break;
+						case LOG_POLICY_FORMAT_BINARY_LENGTH_Z:
+							value = (uint64_t)va_arg(args, size_t);
+							break;
+						case LOG_POLICY_FORMAT_BINARY_LENGTH_T:
+							value = (uint64_t)va_arg(args, ptrdiff_t);
+							break;
+						default:
+							value = (uint64_t)va_arg(args, unsigned int);
+							break;
+					}
+
+					log_policy_format_binary_write_arg(writer, LOG_POLICY_FORMAT_BINARY_ARG_UINT, &value, sizeof(uint64_t));
+					++argc;
+					break;
+				}
+
+				case 'f':
+				case 'F':
+				case 'e':
+				case 'E':
+				case 'g':
+				case 'G':
+				case 'a':
+				case 'A': {
+					double value;
+
+					if (spec.length_id == LOG_POLICY_FORMAT_BINARY_LENGTH_LONG_DOUBLE)
+					{
+						value = (double)va_arg(args, long double);
+					}
+					else
+					{
+						value = va_arg(args, double);
+					}
+
+					log_policy_format_binary_write_arg(writer, LOG_POLICY_FORMAT_BINARY_ARG_DOUBLE, &value, sizeof(double));
+					++argc;
+					break;
+				}
+
+				case 's': {
+					const char *str = va_arg(args, const char *);
+					uint32_t length = (str != NULL) ? (uint32_t)strlen(str) : LOG_POLICY_FORMAT_BINARY_NULL_STRING;
+
+					log_policy_format_binary_write_arg(writer, LOG_POLICY_FORMAT_BINARY_ARG_STRING, &length, sizeof(uint32_t));
+
+					if (str != NULL)
+					{
+						log_policy_format_binary_write(writer, str, length);
+					}
+
+					++argc;
+					break;
+				}
+
+				case 'p': {
+					uint64_t value = (uint64_t)(uintptr_t)va_arg(args, void *);
+
+					log_policy_format_binary_write_arg(writer, LOG_POLICY_FORMAT_BINARY_ARG_POINTER, &value, sizeof(uint64_t));
+					++argc;
+					break;
+				}
+
+				case 'n': {
+					/* Nothing is written when the message is not formatted */
+					(void)va_arg(args, void *);
+					break;
+				}
+			}
+		}
+
+		va_end(args);
+	}
+
+	/* A buffer smaller than the record makes the size differ, so the serialization fails */
+	if (writer->buffer != NULL && writer->offset < writer->size)
+	{
+		size = (uint32_t)writer->offset;
+
+		memcpy(&writer->buffer[LOG_POLICY_FORMAT_BINARY_SIZE_OFFSET], &size, sizeof(uint32_t));
+		memcpy(&writer->buffer[LOG_POLICY_FORMAT_BINARY_ARGC_OFFSET], &argc, sizeof(uint16_t));
+
+		writer->buffer[writer->offset] = '\0';
+	}
+
+	return writer->offset + 1;
+}
+
 static size_t log_policy_format_binary_size(log_policy policy, const log_record record)
 {
-	const size_t mock_binary_size = 1;
+	struct log_policy_format_binary_writer_type writer = { NULL, 0, 0 };
 
 	(void)policy;
-	(void)record;
 
-	/* TODO: implement properly this */
-	return mock_binary_size;
+	return log_policy_format_binary_encode(record, &writer);
 }
 
 static size_t log_policy_format_binary_serialize(log_policy policy, const log_record record, void *buffer, const size_t size)
 {
-	log_policy_format_binary_data binary_data = log_policy_instance(policy);
+	struct log_policy_format_binary_writer_type writer;
 
-	(void)binary_data;
-	(void)record;
-	(void)size;
+	(void)policy;
+
+	if (buffer == NULL || size < LOG_POLICY_FORMAT_BINARY_HEADER_SIZE + 1)
+	{
+		return 0;
+	}
 
-	/* TODO: implement properly this */
-	*((char *)buffer) = '\0';
+	writer.buffer = buffer;
+	writer.size = size;
+	writer.offset = 0;
 
-	return size;
+	return log_policy_format_binary_encode(record, &writer);
 }
 
 static size_t log_policy_format_binary_deserialize(log_policy policy, log_record record, const void *buffer, const size_t size)
@@ -121,3 +532,294 @@ static int log_policy_format_binary_destroy(log_policy policy)
 
 	return 0;
 }
+
+int log_policy_format_binary_read(const char *buffer, size_t size, size_t *offset, void *data, size_t data_size)
+{
+	if (*offset + data_size > size)
+	{
+		return 1;
+	}
+
+	memcpy(data, &buffer[*offset], data_size);
+
+	*offset += data_size;
+
+	return 0;
+}
+
+int log_policy_format_binary_decode_record(const char *record, size_t size, FILE *out)
+{
+	static const char header_format[] = "[%.19s] #%" PRIu64 " [ %" PRIu64 " | %.*s | %.*s ] @%s : ";
+	uint32_t file_length, func_length, message_length;
+	int64_t record_time;
+	uint64_t thread_id, line;
+	uint8_t level, flags;
+	size_t offset = LOG_POLICY_FORMAT_BINARY_SIZE_OFFSET + sizeof(uint32_t);
+	const char *file, *func, *message, *it, *text;
+	time_t t;
+	struct log_policy_format_binary_spec_type spec;
+
+	/* The magic and the size have been validated already, and the header fits in the record */
+	log_policy_format_binary_read(record, size, &offset, &record_time, sizeof(int64_t));
+	log_policy_format_binary_read(record, size, &offset, &thread_id, sizeof(uint64_t));
+	log_policy_format_binary_read(record, size, &offset, &line, sizeof(uint64_t));
+	log_policy_format_binary_read(record, size, &offset, &level, sizeof(uint8_t));
+	log_policy_format_binary_read(record, size, &offset, &flags, sizeof(uint8_t));
+	offset += sizeof(uint16_t);
+	log_policy_format_binary_read(record, size, &offset, &file_length, sizeof(uint32_t));
+	log_policy_format_binary_read(record, size, &offset, &func_length, sizeof(uint32_t));
+	log_policy_format_binary_read(record, size, &offset, &message_length, sizeof(uint32_t));
+
+	if (level >= LOG_LEVEL_SIZE || (size_t)file_length + func_length + message_length > size - offset)
+	{
+		return 1;
+	}
+
+	file = &record[offset];
+	func = &file[file_length];
+	message = &func[func_length];
+	offset += (size_t)file_length + func_length + message_length;
+
+	t = (time_t)record_time;
+	text = ctime(&t);
+
+	fprintf(out, header_format, text != NULL ? text : "", thread_id, line,
+		(int)file_length, file, (int)func_length, func, log_level_to_string((enum log_level_id)level));
+
+	if (!(flags & LOG_POLICY_FORMAT_BINARY_FLAG_FORMAT))
+	{
+		fprintf(out, "%.*s\n", (int)message_length, message);
+
+		return 0;
+	}
+
+	/* The message is not null terminated inside the record, so it is copied to be parsed */
+	{
+		char *format = malloc(message_length + 1);
+		char spec_format[32];
+		int result = 0;
+
+		if (format == NULL)
+		{
+			return 1;
+		}
+
+		memcpy(format, message, message_length);
+		format[message_length] = '\0';
+
+		it = format;
+
+		while (result == 0)
+		{
+			const char *next = log_policy_format_binary_spec_next(it, &spec);
+			int stars[2] = { 0, 0 };
+			unsigned int star;
+			size_t spec_length;
+			uint8_t tag = 0;
+
+			if (next == NULL || spec.conversion == '\0')
+			{
+				fputs(it, out);
+				break;
+			}
+
+			fwrite(it, 1, (size_t)(spec.begin - it), out);
+
+			it = next;
+
+			if (spec.conversion == '%')
+			{
+				fputc('%', out);
+				continue;
+			}
+
+			for (star = 0; star < spec.stars && star < 2; ++star)
+			{
+				int64_t value = 0;
+
+				if (log_policy_format_binary_read(record, size, &offset, &tag, sizeof(uint8_t)) != 0 || tag != LOG_POLICY_FORMAT_BINARY_ARG_INT ||
+					log_policy_format_binary_read(record, size, &offset, &value, sizeof(int64_t)) != 0)
+				{
+					result = 1;
+				}
+
+				stars[star] = (int)value;
+			}
+
+			if (result != 0 || spec.stars > 2 || spec.conversion == 'n')
+			{
+				continue;
+			}
+
+			/* Build the conversion with the length modifier of the stored value */
+			spec_length = (size_t)(spec.length - spec.begin);
+
+			if (spec_length + 4 > sizeof(spec_format))
+			{
+				result = 1;
+				break;
+			}
+
+			memcpy(spec_format, spec.begin, spec_length);
+
+			if (strchr("diuoxX", spec.conversion) != NULL)
+			{
+				spec_format[spec_length++] = 'l';
+				spec_format[spec_length++] = 'l';
+			}
+
+			spec_format[spec_length++] = spec.conversion;
+			spec_format[spec_length] = '\0';
+
+			if (log_policy_format_binary_read(record, size, &offset, &tag, sizeof(uint8_t)) != 0)
+			{
+				result = 1;
+				break;
+			}
+
+#define LOG_POLICY_FORMAT_BINARY_PRINT(value) \
+	((spec.stars == 0) ? fprintf(out, spec_format, value) : (spec.stars == 1) ? fprintf(out, spec_format, stars[0], value) : fprintf(out, spec_format, stars[0], stars[1], value))
+
+			switch (tag)
+			{
+				case LOG_POLICY_FORMAT_BINARY_ARG_INT: {
+					int64_t value;
+
+					result = log_policy_format_binary_read(record, size, &offset, &value, sizeof(int64_t));
+
+					if (result == 0)
+					{
+						if (spec.conversion == 'c')
+						{
+							LOG_POLICY_FORMAT_BINARY_PRINT((int)value);
+						}
+						else
+						{
+							LOG_POLICY_FORMAT_BINARY_PRINT((long long)value);
+						}
+					}
+
+					break;
+				}
+
+				case LOG_POLICY_FORMAT_BINARY_ARG_UINT: {
+					uint64_t value;
+
+					result = log_policy_format_binary_read(record, size, &offset, &value, sizeof(uint64_t));
+
+					if (result == 0)
+					{
+						LOG_POLICY_FORMAT_BINARY_PRINT((unsigned long long)value);
+					}
+
+					break;
+				}
+
+				case LOG_POLICY_FORMAT_BINARY_ARG_DOUBLE: {
+					double value;
+
+					result = log_policy_format_binary_read(record, size, &offset, &value, sizeof(double));
+
+					if (result == 0)
+					{
+						LOG_POLICY_FORMAT_BINARY_PRINT(value);
+					}
+
+					break;
+				}
+
+				case LOG_POLICY_FORMAT_BINARY_ARG_STRING: {
+					uint32_t length;
+					char *str;
+
+					result = log_policy_format_binary_read(record, size, &offset, &length, sizeof(uint32_t));
+
+					if (result != 0)
+					{
+						break;
+					}
+
+					if (length == LOG_POLICY_FORMAT_BINARY_NULL_STRING)
+					{
+						LOG_POLICY_FORMAT_BINARY_PRINT("(null)");
+						break;
+					}
+
+					if ((size_t)length > size - offset || (str = malloc((size_t)length + 1)) == NULL)
+					{
+						result = 1;
+						break;
+					}
+
+					memcpy(str, &record[offset], length);
+					str[length] = '\0';
+					offset += length;
+
+					LOG_POLICY_FORMAT_BINARY_PRINT(str);
+
+					free(str);
+					break;
+				}
+
+				case LOG_POLICY_FORMAT_BINARY_ARG_POINTER: {
+					uint64_t value;
+
+					result = log_policy_format_binary_read(record, size, &offset, &value, sizeof(uint64_t));
+
+					if (result == 0)
+					{
+						LOG_POLICY_FORMAT_BINARY_PRINT((void *)(uintptr_t)value);
+					}
+
+					break;
+				}
+
+				default:
+					result = 1;
+					break;
+			}
+
+#undef LOG_POLICY_FORMAT_BINARY_PRINT
+		}
+
+		free(format);
+
+		fputc('\n', out);
+
+		return result;
+	}
+}
+
+size_t log_policy_format_binary_decode(const void *buffer, const size_t size, FILE *out)
+{
+	const char *data = buffer;
+	size_t offset = 0;
+
+	while (size - offset >= LOG_POLICY_FORMAT_BINARY_HEADER_SIZE)
+	{
+		uint32_t magic, record_size;
+
+		memcpy(&magic, &data[offset], sizeof(uint32_t));
+		memcpy(&record_size, &data[offset + LOG_POLICY_FORMAT_BINARY_SIZE_OFFSET], sizeof(uint32_t));
+
+		if (magic != LOG_POLICY_FORMAT_BINARY_MAGIC || record_size < LOG_POLICY_FORMAT_BINARY_HEADER_SIZE)
+		{
+			break;
+		}
+
+		/* Incomplete records are left to be decoded with the rest of the log */
+		if (record_size > size - offset)
+		{
+			break;
+		}
+
+		if (log_policy_format_binary_decode_record(&data[offset], record_size, out) != 0)
+		{
+			break;
+		}
+
+		offset += record_size;
+	}
+
+	return offset;
+}
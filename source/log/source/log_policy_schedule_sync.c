@@ -11,6 +11,25 @@
 #include <log/log_policy_schedule.h>
 #include <log/log_policy_schedule_sync.h>
 
+#include <threading/threading_mutex.h>
+
+#include <stdlib.h>
+
+/* -- Forward Declarations -- */
+
+struct log_policy_schedule_sync_data_type;
+
+/* -- Type Definitions -- */
+
+typedef struct log_policy_schedule_sync_data_type *log_policy_schedule_sync_data;
+
+/* -- Member Data -- */
+
+struct log_policy_schedule_sync_data_type
+{
+	threading_mutex_type mutex;
+};
+
 /* -- Private Methods -- */
 
 static int log_policy_schedule_sync_create(log_policy policy, const log_policy_ctor ctor);
@@ -44,9 +63,23 @@ log_policy_interface log_policy_schedule_sync_interface(void)
 
 static int log_policy_schedule_sync_create(log_policy policy, const log_policy_ctor ctor)
 {
+	log_policy_schedule_sync_data sync_data = malloc(sizeof(struct log_policy_schedule_sync_data_type));
+
 	(void)ctor;
 
-	log_policy_instantiate(policy, NULL, LOG_POLICY_SCHEDULE_SYNC);
+	if (sync_data == NULL)
+	{
+		return 1;
+	}
+
+	if (threading_mutex_initialize(&sync_data->mutex) != 0)
+	{
+		free(sync_data);
+
+		return 1;
+	}
+
+	log_policy_instantiate(policy, sync_data, LOG_POLICY_SCHEDULE_SYNC);
 
 	return 0;
 }
@@ -60,9 +93,19 @@ static int log_policy_schedule_sync_lock(log_policy policy)
 
 static int log_policy_schedule_sync_execute(log_policy policy, log_policy_schedule_execute_cb callback, log_policy_schedule_data data)
 {
-	(void)policy;
+	log_policy_schedule_sync_data sync_data = log_policy_instance(policy);
+
+	int result;
+
+	/* The whole write is serialized, so the records pushed into the handle by different threads are
+	not interleaved, this is why the lock and unlock called from inside the callback do nothing */
+	threading_mutex_lock(&sync_data->mutex);
 
-	return callback(policy, data);
+	result = callback(policy, data);
+
+	threading_mutex_unlock(&sync_data->mutex);
+
+	return result;
 }
 
 static int log_policy_schedule_sync_unlock(log_policy policy)
@@ -74,7 +117,14 @@ static int log_policy_schedule_sync_unlock(log_policy policy)
 
 static int log_policy_schedule_sync_destroy(log_policy policy)
 {
-	(void)policy;
+	log_policy_schedule_sync_data sync_data = log_policy_instance(policy);
+
+	if (sync_data != NULL)
+	{
+		threading_mutex_destroy(&sync_data->mutex);
+
+		free(sync_data);
+	}
 
 	return 0;
 }
@@ -12,6 +12,21 @@
 #include <log/log_policy_storage_batch.h>
 #include <log/log_policy_storage_sequential.h>
 
+#include <log/log_impl.h>
+#include <log/log_policy_stream.h>
+
+/* -- Member Data -- */
+
+struct log_policy_storage_write_type
+{
+	const void *buffer;
+	size_t size;
+};
+
+/* -- Private Methods -- */
+
+static int log_policy_storage_write_cb(log_aspect aspect, log_policy policy, log_aspect_notify_data notify_data);
+
 /* -- Methods -- */
 
 log_policy_interface log_policy_storage(const log_policy_id policy_storage_id)
@@ -24,11 +39,13 @@ log_policy_interface log_policy_storage(const log_policy_id policy_storage_id)
 	return policy_storage_singleton[policy_storage_id]();
 }
 
-log_policy log_policy_storage_batch(size_t size)
+log_policy log_policy_storage_batch(size_t size, enum log_level_id flush_level, size_t flush_interval)
 {
 	struct log_policy_storage_batch_ctor_type batch_ctor;
 
 	batch_ctor.size = size;
+	batch_ctor.flush_level = flush_level;
+	batch_ctor.flush_interval = flush_interval;
 
 	return log_policy_create(LOG_ASPECT_STORAGE, log_policy_storage(LOG_POLICY_STORAGE_BATCH), &batch_ctor);
 }
@@ -37,3 +54,48 @@ log_policy log_policy_storage_sequential(void)
 {
 	return log_policy_create(LOG_ASPECT_STORAGE, log_policy_storage(LOG_POLICY_STORAGE_SEQUENTIAL), NULL);
 }
+
+log_aspect log_policy_storage_sibling(log_policy policy, enum log_aspect_id aspect_id)
+{
+	log_aspect aspect = log_policy_aspect(policy);
+
+	if (aspect == NULL)
+	{
+		return NULL;
+	}
+
+	return log_impl_aspect(log_aspect_parent(aspect), aspect_id);
+}
+
+int log_policy_storage_write_cb(log_aspect aspect, log_policy policy, log_aspect_notify_data notify_data)
+{
+	struct log_policy_storage_write_type *write_args = notify_data;
+
+	log_policy_stream_impl stream_impl = log_policy_derived(policy);
+
+	(void)aspect;
+
+	if (stream_impl->write(policy, write_args->buffer, write_args->size) != 0)
+	{
+		return 1;
+	}
+
+	return stream_impl->flush(policy);
+}
+
+int log_policy_storage_write(log_policy policy, const void *buffer, const size_t size)
+{
+	log_aspect stream = log_policy_storage_sibling(policy, LOG_ASPECT_STREAM);
+
+	struct log_policy_storage_write_type notify_data;
+
+	if (stream == NULL)
+	{
+		return 1;
+	}
+
+	notify_data.buffer = buffer;
+	notify_data.size = size;
+
+	return log_aspect_notify_all(stream, &log_policy_storage_write_cb, (log_aspect_notify_data)&notify_data);
+}
@@ -8,9 +8,29 @@
 
 /* -- Headers -- */
 
+#include <log/log_aspect_format.h>
 #include <log/log_policy_storage.h>
 #include <log/log_policy_storage_batch.h>
 
+#include <threading/threading_mutex.h>
+
+#include <stdint.h>
+#include <string.h>
+
+#if defined(_WIN32)
+	#ifndef NOMINMAX
+		#define NOMINMAX
+	#endif
+
+	#ifndef WIN32_LEAN_AND_MEAN
+		#define WIN32_LEAN_AND_MEAN
+	#endif
+
+	#include <windows.h>
+#else
+	#include <time.h>
+#endif
+
 /* -- Definitions -- */
 
 #define LOG_POLICY_STORAGE_BATCH_MIN_SIZE ((size_t)0x00000200)
@@ -28,15 +48,25 @@ typedef struct log_policy_storage_batch_data_type *log_policy_storage_batch_data
 
 struct log_policy_storage_batch_data_type
 {
-	void *buffer;
+	char *buffer;
 	size_t count;
 	size_t size;
+	enum log_level_id flush_level;
+	uint64_t flush_interval;
+	uint64_t timestamp;
+	threading_mutex_type mutex;
 };
 
 /* -- Private Methods -- */
 
 static int log_policy_storage_batch_create(log_policy policy, const log_policy_ctor ctor);
 
+static uint64_t log_policy_storage_batch_time(void);
+
+static int log_policy_storage_batch_append_direct(log_policy policy, log_aspect format, const log_record record, size_t size);
+
+static int log_policy_storage_batch_flush_impl(log_policy policy, log_policy_storage_batch_data batch_data);
+
 static int log_policy_storage_batch_append(log_policy policy, const log_record record);
 
 static int log_policy_storage_batch_flush(log_policy policy);
@@ -73,6 +103,7 @@ static int log_policy_storage_batch_create(log_policy policy, const log_policy_c
 	}
 
 	batch_data->count = 0;
+	batch_data->timestamp = 0;
 
 	if (batch_ctor != NULL && batch_ctor->size >= LOG_POLICY_STORAGE_BATCH_MIN_SIZE && batch_ctor->size <= LOG_POLICY_STORAGE_BATCH_MAX_SIZE)
 	{
@@ -83,7 +114,19 @@ static int log_policy_storage_batch_create(log_policy policy, const log_policy_c
 		batch_data->size = LOG_POLICY_STORAGE_BATCH_MIN_SIZE;
 	}
 
-	batch_data->buffer = malloc(batch_data->size);
+	if (batch_ctor != NULL && batch_ctor->flush_level < LOG_LEVEL_SIZE)
+	{
+		batch_data->flush_level = batch_ctor->flush_level;
+		batch_data->flush_interval = (uint64_t)batch_ctor->flush_interval;
+	}
+	else
+	{
+		batch_data->flush_level = LOG_LEVEL_ERROR;
+		batch_data->flush_interval = 0;
+	}
+
+	/* Reserve one more byte for the null character terminating the batch */
+	batch_data->buffer = malloc(batch_data->size + 1);
 
 	if (batch_data->buffer == NULL)
 	{
@@ -92,36 +135,175 @@ static int log_policy_storage_batch_create(log_policy policy, const log_policy_c
 		return 1;
 	}
 
+	if (threading_mutex_initialize(&batch_data->mutex) != 0)
+	{
+		free(batch_data->buffer);
+		free(batch_data);
+
+		return 1;
+	}
+
 	log_policy_instantiate(policy, batch_data, LOG_POLICY_STORAGE_BATCH);
 
 	return 0;
 }
 
+static uint64_t log_policy_storage_batch_time(void)
+{
+#if defined(_WIN32)
+	return (uint64_t)GetTickCount64();
+#else
+	struct timespec now;
+
+	if (clock_gettime(CLOCK_MONOTONIC, &now) != 0)
+	{
+		return 0;
+	}
+
+	return (uint64_t)now.tv_sec * 1000 + (uint64_t)now.tv_nsec / 1000000;
+#endif
+}
+
+static int log_policy_storage_batch_append_direct(log_policy policy, log_aspect format, const log_record record, size_t size)
+{
+	log_aspect_format_impl format_impl = log_aspect_derived(format);
+
+	void *buffer = malloc(size);
+
+	int result = 1;
+
+	if (buffer == NULL)
+	{
+		return 1;
+	}
+
+	if (format_impl->serialize(format, record, buffer, size) == 0)
+	{
+		result = log_policy_storage_write(policy, buffer, size);
+	}
+
+	free(buffer);
+
+	return result;
+}
+
+static int log_policy_storage_batch_flush_impl(log_policy policy, log_policy_storage_batch_data batch_data)
+{
+	int result;
+
+	if (batch_data->count == 0)
+	{
+		return 0;
+	}
+
+	/* Streams receive null terminated records, so the whole batch is written at once as a single record */
+	batch_data->buffer[batch_data->count] = '\0';
+
+	result = log_policy_storage_write(policy, batch_data->buffer, batch_data->count + 1);
+
+	batch_data->count = 0;
+
+	return result;
+}
+
 static int log_policy_storage_batch_append(log_policy policy, const log_record record)
 {
-	(void)policy;
-	(void)record;
+	log_policy_storage_batch_data batch_data = log_policy_instance(policy);
 
-	/* TODO */
+	log_aspect format = log_policy_storage_sibling(policy, LOG_ASPECT_FORMAT);
 
-	return 0;
+	log_aspect_format_impl format_impl;
+
+	size_t size;
+
+	int result = 0;
+
+	if (format == NULL)
+	{
+		return 1;
+	}
+
+	format_impl = log_aspect_derived(format);
+
+	size = format_impl->size(format, record);
+
+	if (size == 0)
+	{
+		return 1;
+	}
+
+	threading_mutex_lock(&batch_data->mutex);
+
+	if (batch_data->count + size > batch_data->size)
+	{
+		result = log_policy_storage_batch_flush_impl(policy, batch_data);
+
+		/* The record does not fit in an empty buffer, write it without coalescing */
+		if (size > batch_data->size)
+		{
+			result |= log_policy_storage_batch_append_direct(policy, format, record, size);
+
+			threading_mutex_unlock(&batch_data->mutex);
+
+			return result;
+		}
+	}
+
+	if (format_impl->serialize(format, record, &batch_data->buffer[batch_data->count], size) != 0)
+	{
+		threading_mutex_unlock(&batch_data->mutex);
+
+		return 1;
+	}
+
+	if (batch_data->count == 0 && batch_data->flush_interval > 0)
+	{
+		batch_data->timestamp = log_policy_storage_batch_time();
+	}
+
+	/* Coalesce text records by dropping their null character, binary records are kept as they are */
+	batch_data->count += (batch_data->buffer[batch_data->count + size - 1] == '\0') ? size - 1 : size;
+
+	if (log_record_level(record) >= batch_data->flush_level ||
+		(batch_data->flush_interval > 0 && log_policy_storage_batch_time() - batch_data->timestamp >= batch_data->flush_interval))
+	{
+		result |= log_policy_storage_batch_flush_impl(policy, batch_data);
+	}
+
+	threading_mutex_unlock(&batch_data->mutex);
+
+	return result;
 }
 
 static int log_policy_storage_batch_flush(log_policy policy)
 {
-	(void)policy;
+	log_policy_storage_batch_data batch_data = log_policy_instance(policy);
 
-	/* TODO */
+	int result;
 
-	return 0;
+	threading_mutex_lock(&batch_data->mutex);
+
+	result = log_policy_storage_batch_flush_impl(policy, batch_data);
+
+	threading_mutex_unlock(&batch_data->mutex);
+
+	return result;
 }
 
 static int log_policy_storage_batch_destroy(log_policy policy)
 {
 	log_policy_storage_batch_data batch_data = log_policy_instance(policy);
 
+	int result = 0;
+
 	if (batch_data != NULL)
 	{
+		/* The streams are destroyed after the storage, so the pending records are
+		written when the logger is deleted or when the log is destroyed at exit */
+		result = log_policy_storage_batch_flush(policy);
+
+		threading_mutex_destroy(&batch_data->mutex);
+
 		if (batch_data->buffer != NULL)
 		{
 			free(batch_data->buffer);
@@ -130,5 +312,5 @@ static int log_policy_storage_batch_destroy(log_policy policy)
 		free(batch_data);
 	}
 
-	return 0;
+	return result;
 }
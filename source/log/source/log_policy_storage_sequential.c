@@ -8,6 +8,7 @@
 
 /* -- Headers -- */
 
+#include <log/log_aspect_format.h>
 #include <log/log_policy_storage.h>
 #include <log/log_policy_storage_sequential.h>
 
@@ -50,20 +51,53 @@ static int log_policy_storage_sequential_create(log_policy policy, const log_pol
 
 static int log_policy_storage_sequential_append(log_policy policy, const log_record record)
 {
-	(void)policy;
-	(void)record;
+	log_aspect format = log_policy_storage_sibling(policy, LOG_ASPECT_FORMAT);
 
-	/* TODO */
+	log_aspect_format_impl format_impl;
 
-	return 0;
+	size_t size;
+
+	void *buffer;
+
+	int result = 1;
+
+	if (format == NULL)
+	{
+		return 1;
+	}
+
+	format_impl = log_aspect_derived(format);
+
+	size = format_impl->size(format, record);
+
+	if (size == 0)
+	{
+		return 1;
+	}
+
+	buffer = malloc(size);
+
+	if (buffer == NULL)
+	{
+		return 1;
+	}
+
+	/* Each record is formatted once and written immediately into all the streams */
+	if (format_impl->serialize(format, record, buffer, size) == 0)
+	{
+		result = log_policy_storage_write(policy, buffer, size);
+	}
+
+	free(buffer);
+
+	return result;
 }
 
 static int log_policy_storage_sequential_flush(log_policy policy)
 {
+	/* Records are never retained, so there is nothing to flush */
 	(void)policy;
 
-	/* TODO */
-
 	return 0;
 }
 
@@ -58,8 +58,24 @@ log_policy log_policy_stream_socket(const char *ip, uint16_t port)
 {
 	struct log_policy_stream_socket_ctor_type socket_ctor;
 
+	socket_ctor.type = LOG_POLICY_STREAM_SOCKET_UDP;
 	socket_ctor.ip = ip;
 	socket_ctor.port = port;
+	socket_ctor.path = NULL;
+	socket_ctor.size = 0;
+
+	return log_policy_create(LOG_ASPECT_STREAM, log_policy_stream(LOG_POLICY_STREAM_SOCKET), &socket_ctor);
+}
+
+log_policy log_policy_stream_socket_unix(const char *path, enum log_policy_stream_socket_type_id type, size_t size)
+{
+	struct log_policy_stream_socket_ctor_type socket_ctor;
+
+	socket_ctor.type = type;
+	socket_ctor.ip = NULL;
+	socket_ctor.port = 0;
+	socket_ctor.path = path;
+	socket_ctor.size = size;
 
 	return log_policy_create(LOG_ASPECT_STREAM, log_policy_stream(LOG_POLICY_STREAM_SOCKET), &socket_ctor);
 }
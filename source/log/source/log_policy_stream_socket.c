@@ -11,6 +11,38 @@
 #include <log/log_policy_stream.h>
 #include <log/log_policy_stream_socket.h>
 
+#include <threading/threading_mutex.h>
+
+#include <stdio.h>
+#include <string.h>
+
+#if defined(linux) || defined(__linux__) || defined(__linux) || defined(__gnu_linux) || \
+	defined(__FreeBSD__) || defined(__NetBSD__) || defined(__OpenBSD__) || \
+	(defined(__APPLE__) && defined(__MACH__)) || defined(__MACOSX__)
+	#define LOG_POLICY_STREAM_SOCKET_POSIX 1
+
+	#include <errno.h>
+	#include <fcntl.h>
+	#include <netdb.h>
+	#include <sys/socket.h>
+	#include <sys/un.h>
+	#include <time.h>
+	#include <unistd.h>
+#endif
+
+/* -- Definitions -- */
+
+#define LOG_POLICY_STREAM_SOCKET_DEFAULT_SIZE ((size_t)0x00010000)
+#define LOG_POLICY_STREAM_SOCKET_MAX_SIZE	  ((size_t)0x01000000)
+#define LOG_POLICY_STREAM_SOCKET_BACKOFF_MIN  ((uint64_t)100)
+#define LOG_POLICY_STREAM_SOCKET_BACKOFF_MAX  ((uint64_t)10000)
+
+#if defined(MSG_NOSIGNAL)
+	#define LOG_POLICY_STREAM_SOCKET_SEND_FLAGS MSG_NOSIGNAL
+#else
+	#define LOG_POLICY_STREAM_SOCKET_SEND_FLAGS 0
+#endif
+
 /* -- Forward Declarations -- */
 
 struct log_policy_stream_socket_data_type;
@@ -23,8 +55,26 @@ typedef struct log_policy_stream_socket_data_type *log_policy_stream_socket_data
 
 struct log_policy_stream_socket_data_type
 {
-	/* TODO */
-	void *socket;
+	enum log_policy_stream_socket_type_id type;
+#if defined(LOG_POLICY_STREAM_SOCKET_POSIX)
+	union
+	{
+		struct sockaddr base;
+		struct sockaddr_storage storage;
+		struct sockaddr_un local;
+	} address;
+	socklen_t address_length;
+	int family;
+	int fd;
+#endif
+	char *pending;
+	size_t count;
+	size_t size;
+	size_t offset;
+	uint64_t dropped;
+	uint64_t backoff;
+	uint64_t retry;
+	threading_mutex_type mutex;
 };
 
 /* -- Private Methods -- */
@@ -37,6 +87,22 @@ static int log_policy_stream_socket_flush(log_policy policy);
 
 static int log_policy_stream_socket_destroy(log_policy policy);
 
+#if defined(LOG_POLICY_STREAM_SOCKET_POSIX)
+static int log_policy_stream_socket_address(log_policy_stream_socket_data socket_data, const log_policy_stream_socket_ctor socket_ctor);
+
+static uint64_t log_policy_stream_socket_time(void);
+
+static void log_policy_stream_socket_disconnect(log_policy_stream_socket_data socket_data);
+
+static void log_policy_stream_socket_connect(log_policy_stream_socket_data socket_data);
+
+static int log_policy_stream_socket_send(log_policy_stream_socket_data socket_data, const char *buffer, size_t size, size_t *sent);
+
+static void log_policy_stream_socket_drain(log_policy_stream_socket_data socket_data);
+
+static void log_policy_stream_socket_enqueue(log_policy_stream_socket_data socket_data, const char *buffer, size_t size);
+#endif
+
 /* -- Methods -- */
 
 log_policy_interface log_policy_stream_socket_interface(void)
@@ -55,47 +121,443 @@ log_policy_interface log_policy_stream_socket_interface(void)
 	return &policy_interface_stream;
 }
 
+uint64_t log_policy_stream_socket_dropped(log_policy policy)
+{
+	log_policy_stream_socket_data socket_data = log_policy_instance(policy);
+
+	uint64_t dropped;
+
+	/* The socket stream is a no-op in the platforms without support */
+	if (socket_data == NULL)
+	{
+		return 0;
+	}
+
+	threading_mutex_lock(&socket_data->mutex);
+
+	dropped = socket_data->dropped;
+
+	threading_mutex_unlock(&socket_data->mutex);
+
+	return dropped;
+}
+
 static int log_policy_stream_socket_create(log_policy policy, const log_policy_ctor ctor)
 {
-	log_policy_stream_socket_data socket_data = malloc(sizeof(struct log_policy_stream_socket_data_type));
+#if defined(LOG_POLICY_STREAM_SOCKET_POSIX)
+	log_policy_stream_socket_data socket_data;
 
 	const log_policy_stream_socket_ctor socket_ctor = ctor;
 
+	if (socket_ctor == NULL || socket_ctor->type >= LOG_POLICY_STREAM_SOCKET_TYPE_SIZE)
+	{
+		return 1;
+	}
+
+	socket_data = malloc(sizeof(struct log_policy_stream_socket_data_type));
+
 	if (socket_data == NULL)
 	{
 		return 1;
 	}
 
-/* TODO: open socket */
-#define socket_open(ip, port) /* NULL */ (void *)socket_ctor
+	socket_data->type = socket_ctor->type;
+	socket_data->fd = -1;
+	socket_data->count = 0;
+	socket_data->offset = 0;
+	socket_data->dropped = 0;
+	socket_data->backoff = LOG_POLICY_STREAM_SOCKET_BACKOFF_MIN;
+	socket_data->retry = 0;
+
+	if (socket_ctor->size > 0 && socket_ctor->size <= LOG_POLICY_STREAM_SOCKET_MAX_SIZE)
+	{
+		socket_data->size = socket_ctor->size;
+	}
+	else
+	{
+		socket_data->size = LOG_POLICY_STREAM_SOCKET_DEFAULT_SIZE;
+	}
+
+	if (log_policy_stream_socket_address(socket_data, socket_ctor) != 0)
+	{
+		free(socket_data);
+
+		return 1;
+	}
+
+	socket_data->pending = malloc(socket_data->size);
+
+	if (socket_data->pending == NULL)
+	{
+		free(socket_data);
+
+		return 1;
+	}
 
-	socket_data->socket = socket_open(socket_ctor->ip, socket_ctor->port);
+	if (threading_mutex_initialize(&socket_data->mutex) != 0)
+	{
+		free(socket_data->pending);
+		free(socket_data);
+
+		return 1;
+	}
+
+	/* The collector may not be listening yet, in that case the records are
+	buffered until the connection is established by a later write */
+	log_policy_stream_socket_connect(socket_data);
 
 	log_policy_instantiate(policy, socket_data, LOG_POLICY_STREAM_SOCKET);
 
 	return 0;
+#else
+	/* The socket stream is not supported in this platform, the records are discarded
+	so the logger can be configured in the same way in all of them */
+	(void)policy;
+	(void)ctor;
+
+	return 0;
+#endif
+}
+
+#if defined(LOG_POLICY_STREAM_SOCKET_POSIX)
+static int log_policy_stream_socket_address(log_policy_stream_socket_data socket_data, const log_policy_stream_socket_ctor socket_ctor)
+{
+	if (socket_ctor->type == LOG_POLICY_STREAM_SOCKET_UDP)
+	{
+		struct addrinfo hints, *result;
+		char port[6];
+
+		if (socket_ctor->ip == NULL)
+		{
+			return 1;
+		}
+
+		memset(&hints, 0, sizeof(struct addrinfo));
+
+		hints.ai_family = AF_UNSPEC;
+		hints.ai_socktype = SOCK_DGRAM;
+
+		snprintf(port, sizeof(port), "%u", (unsigned int)socket_ctor->port);
+
+		if (getaddrinfo(socket_ctor->ip, port, &hints, &result) != 0)
+		{
+			return 1;
+		}
+
+		memcpy(&socket_data->address.storage, result->ai_addr, result->ai_addrlen);
+		socket_data->address_length = (socklen_t)result->ai_addrlen;
+		socket_data->family = result->ai_family;
+
+		freeaddrinfo(result);
+	}
+	else
+	{
+		struct sockaddr_un *address = &socket_data->address.local;
+		size_t length;
+
+		if (socket_ctor->path == NULL)
+		{
+			return 1;
+		}
+
+		length = strlen(socket_ctor->path);
+
+		if (length == 0 || length >= sizeof(address->sun_path))
+		{
+			return 1;
+		}
+
+		memset(address, 0, sizeof(struct sockaddr_un));
+
+		address->sun_family = AF_UNIX;
+		memcpy(address->sun_path, socket_ctor->path, length + 1);
+
+		socket_data->address_length = (socklen_t)sizeof(struct sockaddr_un);
+		socket_data->family = AF_UNIX;
+	}
+
+	return 0;
+}
+
+static uint64_t log_policy_stream_socket_time(void)
+{
+	struct timespec now;
+
+	if (clock_gettime(CLOCK_MONOTONIC, &now) != 0)
+	{
+		return 0;
+	}
+
+	return (uint64_t)now.tv_sec * 1000 + (uint64_t)now.tv_nsec / 1000000;
+}
+
+static void log_policy_stream_socket_disconnect(log_policy_stream_socket_data socket_data)
+{
+	if (socket_data->fd != -1)
+	{
+		close(socket_data->fd);
+
+		socket_data->fd = -1;
+	}
+
+	/* A partially sent record cannot be resumed in a new connection */
+	if (socket_data->offset > 0)
+	{
+		uint32_t length;
+
+		memcpy(&length, socket_data->pending, sizeof(uint32_t));
+
+		socket_data->count -= sizeof(uint32_t) + length;
+		memmove(socket_data->pending, &socket_data->pending[sizeof(uint32_t) + length], socket_data->count);
+
+		socket_data->offset = 0;
+		++socket_data->dropped;
+	}
+
+	socket_data->retry = log_policy_stream_socket_time() + socket_data->backoff;
+
+	socket_data->backoff <<= 1;
+
+	if (socket_data->backoff > LOG_POLICY_STREAM_SOCKET_BACKOFF_MAX)
+	{
+		socket_data->backoff = LOG_POLICY_STREAM_SOCKET_BACKOFF_MAX;
+	}
 }
 
+static void log_policy_stream_socket_connect(log_policy_stream_socket_data socket_data)
+{
+	int type = socket_data->type == LOG_POLICY_STREAM_SOCKET_UNIX_STREAM ? SOCK_STREAM : SOCK_DGRAM;
+	int flags;
+
+	if (socket_data->fd != -1 || log_policy_stream_socket_time() < socket_data->retry)
+	{
+		return;
+	}
+
+	socket_data->fd = socket(socket_data->family, type, 0);
+
+	if (socket_data->fd == -1)
+	{
+		log_policy_stream_socket_disconnect(socket_data);
+
+		return;
+	}
+
+	flags = fcntl(socket_data->fd, F_GETFL, 0);
+
+	if (flags == -1 || fcntl(socket_data->fd, F_SETFL, flags | O_NONBLOCK) == -1 || fcntl(socket_data->fd, F_SETFD, FD_CLOEXEC) == -1)
+	{
+		log_policy_stream_socket_disconnect(socket_data);
+
+		return;
+	}
+
+#if defined(SO_NOSIGPIPE)
+	{
+		int enable = 1;
+
+		setsockopt(socket_data->fd, SOL_SOCKET, SO_NOSIGPIPE, &enable, sizeof(int));
+	}
+#endif
+
+	/* Datagram sockets are connected too, so the destination is fixed and the errors are reported
+	on send, local sockets do not return EINPROGRESS so the connection is established or fails here */
+	if (connect(socket_data->fd, &socket_data->address.base, socket_data->address_length) != 0)
+	{
+		log_policy_stream_socket_disconnect(socket_data);
+
+		return;
+	}
+
+	socket_data->backoff = LOG_POLICY_STREAM_SOCKET_BACKOFF_MIN;
+}
+
+static int log_policy_stream_socket_send(log_policy_stream_socket_data socket_data, const char *buffer, size_t size, size_t *sent)
+{
+	ssize_t result;
+
+	do
+	{
+		result = send(socket_data->fd, buffer, size, LOG_POLICY_STREAM_SOCKET_SEND_FLAGS);
+	} while (result == -1 && errno == EINTR);
+
+	if (result >= 0)
+	{
+		*sent = (size_t)result;
+
+		return 0;
+	}
+
+	*sent = 0;
+
+	if (errno == EAGAIN || errno == ENOBUFS)
+	{
+		return 0;
+	}
+
+#if defined(EWOULDBLOCK) && (EWOULDBLOCK != EAGAIN)
+	if (errno == EWOULDBLOCK)
+	{
+		return 0;
+	}
+#endif
+
+	/* The receiver is gone (or it refused the datagram), so it must be reconnected */
+	return 1;
+}
+
+static void log_policy_stream_socket_drain(log_policy_stream_socket_data socket_data)
+{
+	size_t position = 0;
+	int error = 0;
+
+	while (socket_data->fd != -1 && position < socket_data->count)
+	{
+		uint32_t length;
+		size_t sent;
+
+		memcpy(&length, &socket_data->pending[position], sizeof(uint32_t));
+
+		error = log_policy_stream_socket_send(socket_data, &socket_data->pending[position + sizeof(uint32_t) + socket_data->offset], length - socket_data->offset, &sent);
+
+		if (error != 0 || sent == 0)
+		{
+			break;
+		}
+
+		socket_data->offset += sent;
+
+		if (socket_data->offset < length)
+		{
+			break;
+		}
+
+		socket_data->offset = 0;
+		position += sizeof(uint32_t) + length;
+	}
+
+	if (position > 0)
+	{
+		socket_data->count -= position;
+		memmove(socket_data->pending, &socket_data->pending[position], socket_data->count);
+	}
+
+	if (error != 0)
+	{
+		log_policy_stream_socket_disconnect(socket_data);
+	}
+}
+
+static void log_policy_stream_socket_enqueue(log_policy_stream_socket_data socket_data, const char *buffer, size_t size)
+{
+	uint32_t length = (uint32_t)size;
+
+	if (socket_data->size - socket_data->count < sizeof(uint32_t) + size)
+	{
+		++socket_data->dropped;
+
+		return;
+	}
+
+	memcpy(&socket_data->pending[socket_data->count], &length, sizeof(uint32_t));
+	memcpy(&socket_data->pending[socket_data->count + sizeof(uint32_t)], buffer, size);
+
+	socket_data->count += sizeof(uint32_t) + size;
+}
+#endif
+
 static int log_policy_stream_socket_write(log_policy policy, const void *buffer, const size_t size)
 {
+#if defined(LOG_POLICY_STREAM_SOCKET_POSIX)
 	log_policy_stream_socket_data socket_data = log_policy_instance(policy);
 
-	/* TODO: write to socket */
-	(void)socket_data;
+	const char *record = buffer;
+
+	/* Records are null terminated, the terminator is not sent */
+	size_t length = (size > 0 && record[size - 1] == '\0') ? size - 1 : size;
+
+	if (length == 0)
+	{
+		return 0;
+	}
+
+	threading_mutex_lock(&socket_data->mutex);
+
+	/* A partially sent record is resumed from the buffer, so a record that does not fit
+	in it is dropped as a whole instead of leaving a truncated record in the stream */
+	if (sizeof(uint32_t) + length > socket_data->size)
+	{
+		++socket_data->dropped;
+
+		threading_mutex_unlock(&socket_data->mutex);
+
+		return 0;
+	}
+
+	log_policy_stream_socket_connect(socket_data);
+
+	log_policy_stream_socket_drain(socket_data);
+
+	/* Send the record directly if nothing is queued before it, so the order is preserved */
+	if (socket_data->fd != -1 && socket_data->count == 0)
+	{
+		size_t sent;
+
+		if (log_policy_stream_socket_send(socket_data, record, length, &sent) != 0)
+		{
+			log_policy_stream_socket_disconnect(socket_data);
+		}
+		else if (sent > 0)
+		{
+			/* Only stream sockets send partially, queue the record and skip the part already sent,
+			the queue is empty and the record fits in it, so it cannot be dropped here */
+			if (sent < length)
+			{
+				log_policy_stream_socket_enqueue(socket_data, record, length);
+
+				socket_data->offset = sent;
+			}
+
+			threading_mutex_unlock(&socket_data->mutex);
+
+			return 0;
+		}
+	}
+
+	/* The socket is not writable or it is disconnected, the record is dropped if the buffer is full */
+	log_policy_stream_socket_enqueue(socket_data, record, length);
+
+	threading_mutex_unlock(&socket_data->mutex);
+
+	return 0;
+#else
+	(void)policy;
 	(void)buffer;
 	(void)size;
 
 	return 0;
+#endif
 }
 
 static int log_policy_stream_socket_flush(log_policy policy)
 {
+#if defined(LOG_POLICY_STREAM_SOCKET_POSIX)
 	log_policy_stream_socket_data socket_data = log_policy_instance(policy);
 
-	/* TODO: flush socket */
-	(void)socket_data;
+	threading_mutex_lock(&socket_data->mutex);
+
+	log_policy_stream_socket_connect(socket_data);
+
+	log_policy_stream_socket_drain(socket_data);
+
+	threading_mutex_unlock(&socket_data->mutex);
+
+	return 0;
+#else
+	(void)policy;
 
 	return 0;
+#endif
 }
 
 static int log_policy_stream_socket_destroy(log_policy policy)
@@ -104,8 +566,19 @@ static int log_policy_stream_socket_destroy(log_policy policy)
 
 	if (socket_data != NULL)
 	{
-		/* TODO: close socket */
+#if defined(LOG_POLICY_STREAM_SOCKET_POSIX)
+		/* Last attempt to deliver the pending records, without blocking */
+		log_policy_stream_socket_flush(policy);
+
+		if (socket_data->fd != -1)
+		{
+			close(socket_data->fd);
+		}
+#endif
+
+		threading_mutex_destroy(&socket_data->mutex);
 
+		free(socket_data->pending);
 		free(socket_data);
 	}
 
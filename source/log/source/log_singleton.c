@@ -11,6 +11,8 @@
 
 #include <portability/portability_atexit.h>
 
+#include <threading/threading_atomic.h>
+
 #include <stdlib.h>
 
 /* -- Definitions -- */
@@ -22,8 +24,14 @@
 struct log_singleton_type
 {
 	log_map map;
+	atomic_size_t generation; /* Incremented when the loggers change, it invalidates the loggers cached by the call sites */
 };
 
+/* -- Private Data -- */
+
+/* Generations are never reused, even if the singleton is destroyed and created again */
+static size_t log_singleton_generation_seed = 1;
+
 /* -- Private Methods -- */
 
 static log_singleton log_singleton_create(void);
@@ -59,6 +67,8 @@ log_singleton log_singleton_create(void)
 		return NULL;
 	}
 
+	atomic_init(&s->generation, log_singleton_generation_seed);
+
 	return s;
 }
 
@@ -80,6 +90,8 @@ int log_singleton_destroy(void)
 
 	(*s)->map = NULL;
 
+	log_singleton_generation_seed = atomic_load(&(*s)->generation) + 1;
+
 	free(*s);
 
 	*s = NULL;
@@ -141,11 +153,22 @@ size_t log_singleton_size(void)
 	return log_map_size(s->map);
 }
 
+size_t log_singleton_generation(void)
+{
+	log_singleton s = log_singleton_instance_impl();
+
+	return atomic_load_explicit(&s->generation, memory_order_acquire);
+}
+
 int log_singleton_insert(const char *name, log_impl impl)
 {
 	log_singleton s = log_singleton_instance_impl();
 
-	return log_map_insert(s->map, name, impl);
+	int result = log_map_insert(s->map, name, impl);
+
+	atomic_fetch_add_explicit(&s->generation, 1, memory_order_release);
+
+	return result;
 }
 
 log_impl log_singleton_get(const char *name)
@@ -159,7 +182,11 @@ log_impl log_singleton_remove(const char *name)
 {
 	log_singleton s = log_singleton_instance_impl();
 
-	return (log_impl)log_map_remove(s->map, name);
+	log_impl impl = (log_impl)log_map_remove(s->map, name);
+
+	atomic_fetch_add_explicit(&s->generation, 1, memory_order_release);
+
+	return impl;
 }
 
 void log_singleton_clear(void)
@@ -170,4 +197,6 @@ void log_singleton_clear(void)
 	{
 		/* ... */
 	}
+
+	atomic_fetch_add_explicit(&s->generation, 1, memory_order_release);
 }
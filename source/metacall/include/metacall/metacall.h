@@ -28,6 +28,7 @@
 #include <metacall/metacall_allocator.h>
 #include <metacall/metacall_def.h>
 #include <metacall/metacall_error.h>
+#include <metacall/metacall_future.h>
 #include <metacall/metacall_link.h>
 #include <metacall/metacall_log.h>
 #include <metacall/metacall_value.h>
@@ -96,7 +97,9 @@ METACALL_API extern void *metacall_null_args[1];
 
 /**
 *  @brief
-*    Returns default serializer used by MetaCall
+*    Returns default serializer used by MetaCall, it can be
+*    overriden with the METACALL_SERIAL environment variable,
+*    only JSON serializers (rapid_json or simd_json) are accepted
 *
 *  @return
 *    Name of the serializer to be used with serialization methods
@@ -625,7 +628,9 @@ METACALL_API void *metacallht_s(void *handle, const char *name, const enum metac
 *    Name of the function
 *
 *  @return
-*    Function reference, null if the function does not exist
+*    Function reference, null if the function does not exist, it is valid
+*    until the handle which defines it is cleared, unlike the calls by name
+*    which keep the function alive during the call
 */
 METACALL_API void *metacall_function(const char *name);
 
@@ -1497,6 +1502,71 @@ METACALL_API void *metacallv_object(void *obj, const char *name, void *args[], s
 */
 METACALL_API void *metacallt_object(void *obj, const char *name, const enum metacall_value_id ret, void *args[], size_t size);
 
+/**
+*  @brief
+*    Create an inline cache for calling methods named @name, the method resolution of each class and
+*    argument types is cached in it, so repeated calls do not allocate nor resolve the overloads again,
+*    it is not thread safe, each thread must use its own cache
+*
+*  @param[in] name
+*    Name of the method
+*
+*  @return
+*    Pointer to the method cache, null if there was an error
+*/
+METACALL_API void *metacall_method_cache(const char *name);
+
+/**
+*  @brief
+*    Call a class method by value array @args resolving it through the inline cache @cache (overloaded methods are resolved by the argument types)
+*
+*  @param[in] cls
+*    Pointer to the class
+*
+*  @param[in] cache
+*    Pointer to the method cache created with metacall_method_cache
+*
+*  @param[in] args
+*    Array of pointers to data
+*
+*  @param[in] size
+*    Number of elements of args array
+*
+*  @return
+*    Pointer to value containing the result of the call
+*/
+METACALL_API void *metacallv_class_cache(void *cls, void *cache, void *args[], size_t size);
+
+/**
+*  @brief
+*    Call an object method by value array @args resolving it through the inline cache @cache (overloaded methods are resolved by the argument types)
+*
+*  @param[in] obj
+*    Pointer to the object
+*
+*  @param[in] cache
+*    Pointer to the method cache created with metacall_method_cache
+*
+*  @param[in] args
+*    Array of pointers to data
+*
+*  @param[in] size
+*    Number of elements of args array
+*
+*  @return
+*    Pointer to value containing the result of the call
+*/
+METACALL_API void *metacallv_object_cache(void *obj, void *cache, void *args[], size_t size);
+
+/**
+*  @brief
+*    Destroy an inline method cache
+*
+*  @param[in] cache
+*    Pointer to the method cache created with metacall_method_cache
+*/
+METACALL_API void metacall_method_cache_destroy(void *cache);
+
 /**
 *  @brief
 *    Get an attribute from @obj by @key name
@@ -1557,6 +1627,17 @@ METACALL_API void *metacall_throwable_value(void *th);
 */
 METACALL_API char *metacall_inspect(size_t *size, void *allocator);
 
+/**
+*  @brief
+*    Get the generation of the introspection information, it changes
+*    each time a handle is loaded, cleared or its scope is modified,
+*    so callers can avoid calling to metacall_inspect when nothing changed
+*
+*  @return
+*    Current generation of the introspection information
+*/
+METACALL_API uint64_t metacall_inspect_generation(void);
+
 /**
 *  @brief
 *    Provide information about all loaded objects as a value
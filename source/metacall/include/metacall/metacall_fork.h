@@ -85,6 +85,21 @@ METACALL_API int metacall_fork_initialize(void);
 */
 METACALL_API void metacall_fork(metacall_pre_fork_callback_ptr pre_callback, metacall_post_fork_callback_ptr post_callback);
 
+/**
+*  @brief
+*    Fork a worker process that inherits the initialized loaders and the
+*    loaded handles of the current process, each loader is prepared before
+*    the fork and it is resumed after it in both processes, so the worker
+*    does not need to initialize or load again (prefork template), unlike
+*    the fork hook, MetaCall is not destroyed and initialized again
+*
+*  @return
+*    Zero in the worker, the process id of the worker in the parent,
+*    or -1 if the loaders cannot be forked or the fork fails, if a loader
+*    cannot be resumed in the worker, the worker exits with failure status
+*/
+METACALL_API metacall_pid metacall_spawn_worker(void);
+
 /**
 *  @brief
 *    Unregister fork detours and destroy shared memory
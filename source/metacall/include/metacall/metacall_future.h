@@ -0,0 +1,181 @@
+/*
+ *	MetaCall Library by Parra Studios
+ *	A library for providing a foreign function interface calls.
+ *
+ *	Copyright (C) 2016 - 2026 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+#ifndef METACALL_FUTURE_H
+#define METACALL_FUTURE_H 1
+
+/* -- Headers -- */
+
+#include <metacall/metacall_api.h>
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* -- Enumerations -- */
+
+enum metacall_future_status_id
+{
+	METACALL_FUTURE_PENDING = 0,
+	METACALL_FUTURE_RESOLVED = 1,
+	METACALL_FUTURE_REJECTED = 2
+};
+
+/* -- Methods -- */
+
+/**
+*  @brief
+*    Track the completion of a future, so it can be waited, combined or polled
+*    through a file descriptor instead of chaining callbacks; the resolve and reject
+*    callbacks run in the thread of the loader, so a tracked future can be completed
+*    while the caller is blocked in metacall_future_wait
+*
+*  @param[in] f
+*    Pointer to a value of type METACALL_FUTURE, it is not owned by the tracked future
+*
+*  @return
+*    Pointer to the tracked future or null if the future cannot be awaited
+*/
+METACALL_API void *metacall_future_create(void *f);
+
+/**
+*  @brief
+*    Call asynchronously to the function @func and track its completion
+*
+*  @param[in] func
+*    Pointer to the function to be called asynchronously
+*
+*  @param[in] args
+*    Array of pointers to the values to be passed to the function
+*
+*  @param[in] size
+*    Number of elements of the array @args
+*
+*  @return
+*    Pointer to the tracked future or null if the call could not be started
+*/
+METACALL_API void *metacall_future_call(void *func, void *args[], size_t size);
+
+/**
+*  @brief
+*    Combine tracked futures, possibly from different loaders, into a future that
+*    is resolved with an array of their values (in the same order) once all of them
+*    are resolved, or rejected with the value of the first one that is rejected
+*
+*  @param[in] futures
+*    Array of tracked futures, they are not owned by the combined future
+*
+*  @param[in] size
+*    Number of elements of the array @futures, if it is zero the future is resolved with an empty array
+*
+*  @return
+*    Pointer to the combined future or null on error
+*/
+METACALL_API void *metacall_future_when_all(void *futures[], size_t size);
+
+/**
+*  @brief
+*    Combine tracked futures, possibly from different loaders, into a future that
+*    is completed with the status and the value of the first one that completes,
+*    the status of each of @futures tells which ones have completed
+*
+*  @param[in] futures
+*    Array of tracked futures, they are not owned by the combined future
+*
+*  @param[in] size
+*    Number of elements of the array @futures, it must be greater than zero
+*
+*  @return
+*    Pointer to the combined future or null on error
+*/
+METACALL_API void *metacall_future_when_any(void *futures[], size_t size);
+
+/**
+*  @brief
+*    Block the current thread until the tracked future @f completes or @timeout expires
+*
+*  @param[in] f
+*    Pointer to the tracked future
+*
+*  @param[in] timeout
+*    Maximum time to wait in milliseconds, zero polls the status and a negative value waits forever
+*
+*  @return
+*    Zero if the future has completed, different from zero if the timeout expired
+*/
+METACALL_API int metacall_future_wait(void *f, long timeout);
+
+/**
+*  @brief
+*    Get the status of the tracked future @f without blocking
+*
+*  @param[in] f
+*    Pointer to the tracked future
+*
+*  @return
+*    The status of the future, METACALL_FUTURE_PENDING while it has not completed
+*/
+METACALL_API enum metacall_future_status_id metacall_future_status(void *f);
+
+/**
+*  @brief
+*    Get the value which the tracked future @f has been resolved or rejected with
+*
+*  @param[in] f
+*    Pointer to the tracked future
+*
+*  @return
+*    Pointer to the value, it is owned by @f and it is valid until @f is destroyed,
+*    null if the future is still pending
+*/
+METACALL_API void *metacall_future_value(void *f);
+
+/**
+*  @brief
+*    Get a file descriptor that becomes readable when the tracked future @f completes,
+*    it can be registered in an event loop (epoll, kqueue, io_uring...) so a single
+*    thread can multiplex many futures, it is an eventfd in Linux and a pipe in other
+*    POSIX platforms, it is owned by @f and closed when @f is destroyed
+*
+*  @param[in] f
+*    Pointer to the tracked future
+*
+*  @return
+*    The file descriptor or -1 if it is not supported in this platform
+*/
+METACALL_API int metacall_future_fd(void *f);
+
+/**
+*  @brief
+*    Destroy the tracked future @f, if it is still pending it will be released
+*    when the loader completes it, and its callbacks will be ignored
+*
+*  @param[in] f
+*    Pointer to the tracked future
+*/
+METACALL_API void metacall_future_destroy(void *f);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* METACALL_FUTURE_H */
@@ -27,12 +27,16 @@
 
 #include <reflect/reflect.h>
 
+#include <adt/adt_intern.h>
+
 #include <configuration/configuration.h>
 
 #include <log/log.h>
 
 #include <serial/serial.h>
 
+#include <memory/memory_allocator_std.h>
+
 #include <detour/detour.h>
 
 #include <environment/environment_variable.h>
@@ -40,6 +44,8 @@
 #include <portability/portability_atexit.h>
 #include <portability/portability_constructor.h>
 
+#include <threading/threading_mutex.h>
+
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -47,6 +53,7 @@
 /* -- Definitions -- */
 
 #define METACALL_ARGS_SIZE 0x10
+#define METACALL_FRAME_SIZE 0x400
 #define METACALL_SERIAL	   "rapid_json"
 #define METACALL_DETOUR	   "plthook"
 
@@ -68,13 +75,21 @@ static char **metacall_initialize_argv = NULL;
 static void *plugin_extension_handle = NULL;
 static void *plugin_core_handle = NULL;
 static loader_path plugin_path = { 0 };
+static memory_allocator metacall_inspect_cache_allocator = NULL;
+static char *metacall_inspect_cache = NULL;
+static size_t metacall_inspect_cache_size = 0;
+static uint64_t metacall_inspect_cache_generation = 0;
+static threading_mutex_type metacall_inspect_cache_mutex = THREADING_MUTEX_INITIALIZE;
 
 /* -- Private Methods -- */
 
 static int metacall_plugin_extension_load(void);
-static void *metacallv_method(void *target, const char *name, method_invoke_ptr call, vector v, void *args[], size_t size);
-static type_id *metacall_type_ids(void *args[], size_t size);
+static void metacallv_method_error(void *target, const char *name, vector v);
+static void *metacallv_method(void *target, method m, method_invoke_ptr call, void *args[], size_t size);
+static type_id *metacall_type_ids(void *args[], size_t size, type_id ids[], size_t ids_size);
 static void metacall_detour_destructor(void);
+static int metacall_inspect_cache_update(uint64_t generation);
+static void metacall_inspect_cache_destroy(void);
 
 /* -- Costructors -- */
 
@@ -128,6 +143,26 @@ const char *metacall_serial(void)
 {
 	static const char metacall_serial_str[] = METACALL_SERIAL;
 
+	/* The configuration, inspect and the function calls from buffers are JSON, so only JSON serializers can be selected */
+	static const char *metacall_serial_json[] = {
+		"rapid_json",
+		"simd_json"
+	};
+
+	/* The serializer can be selected at run time, for example: METACALL_SERIAL=simd_json */
+	const char *serial_name = environment_variable_get("METACALL_SERIAL", metacall_serial_str);
+	size_t iterator;
+
+	for (iterator = 0; iterator < sizeof(metacall_serial_json) / sizeof(metacall_serial_json[0]); ++iterator)
+	{
+		if (strcmp(serial_name, metacall_serial_json[iterator]) == 0)
+		{
+			return serial_name;
+		}
+	}
+
+	log_write("metacall", LOG_LEVEL_WARNING, "Serial %s selected by METACALL_SERIAL is not JSON compatible, using %s instead", serial_name, metacall_serial_str);
+
 	return metacall_serial_str;
 }
 
@@ -535,28 +570,24 @@ int metacall_load_from_configuration(const char *path, void **handle, void *allo
 
 void *metacallv(const char *name, void *args[])
 {
-	value f_val = loader_get(name);
-	function f = NULL;
+	function f = loader_get_function(name);
 
-	if (value_type_id(f_val) == TYPE_FUNCTION)
-	{
-		f = value_to_function(f_val);
-	}
+	void *ret = metacallfv(f, args);
+
+	function_destroy(f);
 
-	return metacallfv(f, args);
+	return ret;
 }
 
 void *metacallv_s(const char *name, void *args[], size_t size)
 {
-	value f_val = loader_get(name);
-	function f = NULL;
+	function f = loader_get_function(name);
 
-	if (value_type_id(f_val) == TYPE_FUNCTION)
-	{
-		f = value_to_function(f_val);
-	}
+	void *ret = metacallfv_s(f, args, size);
+
+	function_destroy(f);
 
-	return metacallfv_s(f, args, size);
+	return ret;
 }
 
 void *metacallhv(void *handle, const char *name, void *args[])
@@ -568,15 +599,13 @@ void *metacallhv(void *handle, const char *name, void *args[])
 		return NULL;
 	}
 
-	value f_val = loader_handle_get(handle, name);
-	function f = NULL;
+	function f = loader_handle_get_function(handle, name);
 
-	if (value_type_id(f_val) == TYPE_FUNCTION)
-	{
-		f = value_to_function(f_val);
-	}
+	void *ret = metacallfv(f, args);
+
+	function_destroy(f);
 
-	return metacallfv(f, args);
+	return ret;
 }
 
 void *metacallhv_s(void *handle, const char *name, void *args[], size_t size)
@@ -588,31 +617,28 @@ void *metacallhv_s(void *handle, const char *name, void *args[], size_t size)
 		return NULL;
 	}
 
-	value f_val = loader_handle_get(handle, name);
-	function f = NULL;
+	function f = loader_handle_get_function(handle, name);
 
-	if (value_type_id(f_val) == TYPE_FUNCTION)
-	{
-		f = value_to_function(f_val);
-	}
+	void *ret = metacallfv_s(f, args, size);
+
+	function_destroy(f);
 
-	return metacallfv_s(f, args, size);
+	return ret;
 }
 
 void *metacall(const char *name, ...)
 {
-	value f_val = loader_get(name);
-	function f = NULL;
-
-	if (value_type_id(f_val) == TYPE_FUNCTION)
-	{
-		f = value_to_function(f_val);
-	}
+	function f = loader_get_function(name);
 
 	if (f != NULL)
 	{
 		void *args[METACALL_ARGS_SIZE];
 
+		/* Arguments only live until the call, so they are allocated in the stack of the caller */
+		unsigned char frame_buffer[METACALL_FRAME_SIZE];
+
+		struct value_frame_type frame;
+
 		value ret = NULL;
 
 		signature s = function_signature(f);
@@ -623,6 +649,8 @@ void *metacall(const char *name, ...)
 
 		va_start(va, name);
 
+		value_frame_begin(&frame, frame_buffer, sizeof(frame_buffer));
+
 		for (iterator = 0; iterator < args_count; ++iterator)
 		{
 			type t = signature_get_type(s, iterator);
@@ -674,6 +702,8 @@ void *metacall(const char *name, ...)
 			}
 		}
 
+		value_frame_end(&frame);
+
 		va_end(va);
 
 		ret = function_call(f, args, args_count);
@@ -695,11 +725,16 @@ void *metacall(const char *name, ...)
 				{
 					value cast_ret = value_type_cast(ret, id);
 
-					return (cast_ret == NULL) ? ret : cast_ret;
+					if (cast_ret != NULL)
+					{
+						ret = cast_ret;
+					}
 				}
 			}
 		}
 
+		function_destroy(f);
+
 		return ret;
 	}
 
@@ -708,18 +743,17 @@ void *metacall(const char *name, ...)
 
 void *metacallt(const char *name, const enum metacall_value_id ids[], ...)
 {
-	value f_val = loader_get(name);
-	function f = NULL;
-
-	if (value_type_id(f_val) == TYPE_FUNCTION)
-	{
-		f = value_to_function(f_val);
-	}
+	function f = loader_get_function(name);
 
 	if (f != NULL)
 	{
 		void *args[METACALL_ARGS_SIZE];
 
+		/* Arguments only live until the call, so they are allocated in the stack of the caller */
+		unsigned char frame_buffer[METACALL_FRAME_SIZE];
+
+		struct value_frame_type frame;
+
 		value ret = NULL;
 
 		signature s = function_signature(f);
@@ -730,6 +764,8 @@ void *metacallt(const char *name, const enum metacall_value_id ids[], ...)
 
 		va_start(va, ids);
 
+		value_frame_begin(&frame, frame_buffer, sizeof(frame_buffer));
+
 		for (iterator = 0; iterator < args_count; ++iterator)
 		{
 			type t = signature_get_type(s, iterator);
@@ -790,6 +826,8 @@ void *metacallt(const char *name, const enum metacall_value_id ids[], ...)
 			}
 		}
 
+		value_frame_end(&frame);
+
 		va_end(va);
 
 		ret = function_call(f, args, args_count);
@@ -799,6 +837,8 @@ void *metacallt(const char *name, const enum metacall_value_id ids[], ...)
 			value_type_destroy(args[iterator]);
 		}
 
+		function_destroy(f);
+
 		return ret;
 	}
 
@@ -807,18 +847,17 @@ void *metacallt(const char *name, const enum metacall_value_id ids[], ...)
 
 void *metacallt_s(const char *name, const enum metacall_value_id ids[], size_t size, ...)
 {
-	value f_val = loader_get(name);
-	function f = NULL;
-
-	if (value_type_id(f_val) == TYPE_FUNCTION)
-	{
-		f = value_to_function(f_val);
-	}
+	function f = loader_get_function(name);
 
 	if (f != NULL)
 	{
 		void *args[METACALL_ARGS_SIZE];
 
+		/* Arguments only live until the call, so they are allocated in the stack of the caller */
+		unsigned char frame_buffer[METACALL_FRAME_SIZE];
+
+		struct value_frame_type frame;
+
 		value ret = NULL;
 
 		signature s = function_signature(f);
@@ -829,6 +868,8 @@ void *metacallt_s(const char *name, const enum metacall_value_id ids[], size_t s
 
 		va_start(va, size);
 
+		value_frame_begin(&frame, frame_buffer, sizeof(frame_buffer));
+
 		for (iterator = 0; iterator < size; ++iterator)
 		{
 			type t = signature_get_type(s, iterator);
@@ -889,6 +930,8 @@ void *metacallt_s(const char *name, const enum metacall_value_id ids[], size_t s
 			}
 		}
 
+		value_frame_end(&frame);
+
 		va_end(va);
 
 		ret = function_call(f, args, size);
@@ -898,6 +941,8 @@ void *metacallt_s(const char *name, const enum metacall_value_id ids[], size_t s
 			value_type_destroy(args[iterator]);
 		}
 
+		function_destroy(f);
+
 		return ret;
 	}
 
@@ -913,18 +958,17 @@ void *metacallht_s(void *handle, const char *name, const enum metacall_value_id
 		return NULL;
 	}
 
-	value f_val = loader_handle_get(handle, name);
-	function f = NULL;
-
-	if (value_type_id(f_val) == TYPE_FUNCTION)
-	{
-		f = value_to_function(f_val);
-	}
+	function f = loader_handle_get_function(handle, name);
 
 	if (f != NULL)
 	{
 		void *args[METACALL_ARGS_SIZE];
 
+		/* Arguments only live until the call, so they are allocated in the stack of the caller */
+		unsigned char frame_buffer[METACALL_FRAME_SIZE];
+
+		struct value_frame_type frame;
+
 		value ret = NULL;
 
 		signature s = function_signature(f);
@@ -935,6 +979,8 @@ void *metacallht_s(void *handle, const char *name, const enum metacall_value_id
 
 		va_start(va, size);
 
+		value_frame_begin(&frame, frame_buffer, sizeof(frame_buffer));
+
 		for (iterator = 0; iterator < size; ++iterator)
 		{
 			type t = signature_get_type(s, iterator);
@@ -995,6 +1041,8 @@ void *metacallht_s(void *handle, const char *name, const enum metacall_value_id
 			}
 		}
 
+		value_frame_end(&frame);
+
 		va_end(va);
 
 		ret = function_call(f, args, size);
@@ -1004,6 +1052,8 @@ void *metacallht_s(void *handle, const char *name, const enum metacall_value_id
 			value_type_destroy(args[iterator]);
 		}
 
+		function_destroy(f);
+
 		return ret;
 	}
 
@@ -1241,6 +1291,11 @@ void *metacallf(void *func, ...)
 	{
 		void *args[METACALL_ARGS_SIZE];
 
+		/* Arguments only live until the call, so they are allocated in the stack of the caller */
+		unsigned char frame_buffer[METACALL_FRAME_SIZE];
+
+		struct value_frame_type frame;
+
 		value ret = NULL;
 
 		signature s = function_signature(f);
@@ -1251,6 +1306,8 @@ void *metacallf(void *func, ...)
 
 		va_start(va, func);
 
+		value_frame_begin(&frame, frame_buffer, sizeof(frame_buffer));
+
 		for (iterator = 0; iterator < args_count; ++iterator)
 		{
 			type t = signature_get_type(s, iterator);
@@ -1302,6 +1359,8 @@ void *metacallf(void *func, ...)
 			}
 		}
 
+		value_frame_end(&frame);
+
 		va_end(va);
 
 		ret = function_call(f, args, args_count);
@@ -1691,17 +1750,15 @@ int metacall_register_loaderv(void *loader, void *handle, const char *name, void
 
 void *metacall_await(const char *name, void *args[], void *(*resolve_callback)(void *, void *), void *(*reject_callback)(void *, void *), void *data)
 {
-	value f_val = loader_get(name);
-	function f = NULL;
-
-	if (value_type_id(f_val) == TYPE_FUNCTION)
-	{
-		f = value_to_function(f_val);
-	}
+	function f = loader_get_function(name);
 
 	signature s = function_signature(f);
 
-	return function_await(f, args, signature_count(s), resolve_callback, reject_callback, data);
+	void *ret = function_await(f, args, signature_count(s), resolve_callback, reject_callback, data);
+
+	function_destroy(f);
+
+	return ret;
 }
 
 void *metacall_await_future(void *f, void *(*resolve_callback)(void *, void *), void *(*reject_callback)(void *, void *), void *data)
@@ -1717,15 +1774,13 @@ void *metacall_await_future(void *f, void *(*resolve_callback)(void *, void *),
 
 void *metacall_await_s(const char *name, void *args[], size_t size, void *(*resolve_callback)(void *, void *), void *(*reject_callback)(void *, void *), void *data)
 {
-	value f_val = loader_get(name);
-	function f = NULL;
+	function f = loader_get_function(name);
 
-	if (value_type_id(f_val) == TYPE_FUNCTION)
-	{
-		f = value_to_function(f_val);
-	}
+	void *ret = function_await(f, args, size, resolve_callback, reject_callback, data);
+
+	function_destroy(f);
 
-	return function_await(f, args, size, resolve_callback, reject_callback, data);
+	return ret;
 }
 
 void *metacallfv_await(void *func, void *args[], void *(*resolve_callback)(void *, void *), void *(*reject_callback)(void *, void *), void *data)
@@ -2113,17 +2168,19 @@ void *metacall_class(const char *name)
 
 void *metacall_class_new(void *cls, const char *name, void *args[], size_t size)
 {
-	type_id *ids = metacall_type_ids(args, size);
+	type_id ids_stack[METACALL_ARGS_SIZE];
 
-	constructor ctor = class_constructor(cls, ids, size);
+	type_id *ids = metacall_type_ids(args, size, ids_stack, METACALL_ARGS_SIZE);
 
-	object o = class_new(cls, name, ctor, args, size);
+	constructor ctor = class_constructor(cls, ids, size);
 
-	if (ids != NULL)
+	if (ids != ids_stack && ids != NULL)
 	{
 		free(ids);
 	}
 
+	object o = class_new(cls, name, ctor, args, size);
+
 	if (o == NULL)
 	{
 		return NULL;
@@ -2149,41 +2206,36 @@ int metacall_class_static_set(void *cls, const char *key, void *v)
 	return class_static_set(cls, key, v);
 }
 
-void *metacallv_method(void *target, const char *name, method_invoke_ptr call, vector v, void *args[], size_t size)
+void metacallv_method_error(void *target, const char *name, vector v)
 {
 	if (v == NULL)
 	{
 		// TODO: Implement type error return a value
 		log_write("metacall", LOG_LEVEL_ERROR, "Method %s in %p is not implemented (bad allocation)", name, target);
-		return NULL;
+		return;
 	}
 
 	if (vector_size(v) == 0)
 	{
 		// TODO: Implement type error return a value
 		log_write("metacall", LOG_LEVEL_ERROR, "Method %s in %p is not implemented", name, target);
-		vector_destroy(v);
-		return NULL;
 	}
-
-	if (vector_size(v) > 1)
+	else if (vector_size(v) > 1)
 	{
 		// TODO: Implement type error return a value
 		log_write("metacall", LOG_LEVEL_ERROR, "Method %s in %p is overloaded, you should use 'metacallt_class' instead for disambiguate the call", name, target);
-		vector_destroy(v);
-		return NULL;
 	}
-
-	method m = vector_at_type(v, 0, method);
-
-	if (m == NULL)
+	else
 	{
 		// TODO: Implement type error return a value
 		log_write("metacall", LOG_LEVEL_ERROR, "Method %s in %p is invalid (NULL)", name, target);
-		vector_destroy(v);
-		return NULL;
 	}
 
+	vector_destroy(v);
+}
+
+void *metacallv_method(void *target, method m, method_invoke_ptr call, void *args[], size_t size)
+{
 	signature s = method_signature(m);
 	size_t iterator;
 
@@ -2193,7 +2245,6 @@ void *metacallv_method(void *target, const char *name, method_invoke_ptr call, v
 		{
 			// TODO: Implement type error return a value
 			log_write("metacall", LOG_LEVEL_ERROR, "Invalid argument at position %" PRIuS " when calling to metacallv_method", iterator);
-			vector_destroy(v);
 			return NULL;
 		}
 
@@ -2217,8 +2268,6 @@ void *metacallv_method(void *target, const char *name, method_invoke_ptr call, v
 
 	value ret = call(target, m, args, size);
 
-	vector_destroy(v);
-
 	if (ret != NULL)
 	{
 		type t = signature_get_return(s);
@@ -2241,36 +2290,53 @@ void *metacallv_method(void *target, const char *name, method_invoke_ptr call, v
 
 void *metacallv_class(void *cls, const char *name, void *args[], size_t size)
 {
-	return metacallv_method(cls, name, (method_invoke_ptr)&class_static_call, class_static_methods(cls, name), args, size);
+	/* Non overloaded methods are resolved without allocating the overload list */
+	method m = class_static_method_single(cls, name);
+
+	if (m == NULL)
+	{
+		metacallv_method_error(cls, name, class_static_methods(cls, name));
+		return NULL;
+	}
+
+	return metacallv_method(cls, m, (method_invoke_ptr)&class_static_call, args, size);
 }
 
-type_id *metacall_type_ids(void *args[], size_t size)
+type_id *metacall_type_ids(void *args[], size_t size, type_id ids[], size_t ids_size)
 {
-	type_id *ids = NULL;
+	if (size == 0)
+	{
+		return NULL;
+	}
 
-	if (size > 0)
+	/* Use the buffer provided by the caller when the arguments fit on it */
+	if (size > ids_size)
 	{
 		ids = (type_id *)malloc(sizeof(type_id) * size);
 
-		if (ids != NULL)
+		if (ids == NULL)
 		{
-			for (size_t iterator = 0; iterator < size; ++iterator)
-			{
-				ids[iterator] = metacall_value_id(args[iterator]);
-			}
+			return NULL;
 		}
 	}
 
+	for (size_t iterator = 0; iterator < size; ++iterator)
+	{
+		ids[iterator] = metacall_value_id(args[iterator]);
+	}
+
 	return ids;
 }
 
 void *metacallt_class(void *cls, const char *name, const enum metacall_value_id ret, void *args[], size_t size)
 {
-	type_id *ids = metacall_type_ids(args, size);
+	type_id ids_stack[METACALL_ARGS_SIZE];
+
+	type_id *ids = metacall_type_ids(args, size, ids_stack, METACALL_ARGS_SIZE);
 
 	method m = class_static_method(cls, name, ret, ids, size);
 
-	if (ids != NULL)
+	if (ids != ids_stack && ids != NULL)
 	{
 		free(ids);
 	}
@@ -2286,29 +2352,26 @@ void *metacallt_class(void *cls, const char *name, const enum metacall_value_id
 
 void *metacallv_object(void *obj, const char *name, void *args[], size_t size)
 {
-	return metacallv_method(obj, name, (method_invoke_ptr)&object_call, object_methods(obj, name), args, size);
+	method m = class_method_single(object_class(obj), name);
+
+	if (m == NULL)
+	{
+		metacallv_method_error(obj, name, object_methods(obj, name));
+		return NULL;
+	}
+
+	return metacallv_method(obj, m, (method_invoke_ptr)&object_call, args, size);
 }
 
 void *metacallt_object(void *obj, const char *name, const enum metacall_value_id ret, void *args[], size_t size)
 {
-	type_id *ids = NULL;
-
-	if (size > 0)
-	{
-		ids = (type_id *)malloc(sizeof(type_id) * size);
+	type_id ids_stack[METACALL_ARGS_SIZE];
 
-		if (ids != NULL)
-		{
-			for (size_t iterator = 0; iterator < size; ++iterator)
-			{
-				ids[iterator] = metacall_value_id(args[iterator]);
-			}
-		}
-	}
+	type_id *ids = metacall_type_ids(args, size, ids_stack, METACALL_ARGS_SIZE);
 
 	method m = object_method(obj, name, ret, ids, size);
 
-	if (ids != NULL)
+	if (ids != ids_stack && ids != NULL)
 	{
 		free(ids);
 	}
@@ -2322,6 +2385,42 @@ void *metacallt_object(void *obj, const char *name, const enum metacall_value_id
 	return object_call(obj, m, args, size);
 }
 
+void *metacall_method_cache(const char *name)
+{
+	return method_cache_create(name);
+}
+
+void *metacallv_class_cache(void *cls, void *cache, void *args[], size_t size)
+{
+	method m = method_cache_resolve(cache, cls, METHOD_CACHE_STATIC, (value *)args, size);
+
+	if (m == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Method %s in class <%p> is not implemented with the parameter types being received", method_cache_name(cache), cls);
+		return NULL;
+	}
+
+	return metacallv_method(cls, m, (method_invoke_ptr)&class_static_call, args, size);
+}
+
+void *metacallv_object_cache(void *obj, void *cache, void *args[], size_t size)
+{
+	method m = method_cache_resolve(cache, object_class(obj), METHOD_CACHE_INSTANCE, (value *)args, size);
+
+	if (m == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Method %s in object <%p> is not implemented with the parameter types being received", method_cache_name(cache), obj);
+		return NULL;
+	}
+
+	return metacallv_method(obj, m, (method_invoke_ptr)&object_call, args, size);
+}
+
+void metacall_method_cache_destroy(void *cache)
+{
+	method_cache_destroy(cache);
+}
+
 void *metacall_object_get(void *obj, const char *key)
 {
 	return object_get(obj, key);
@@ -2337,7 +2436,7 @@ void *metacall_throwable_value(void *th)
 	return throwable_value(th);
 }
 
-char *metacall_inspect(size_t *size, void *allocator)
+int metacall_inspect_cache_update(uint64_t generation)
 {
 	serial s;
 
@@ -2345,6 +2444,8 @@ char *metacall_inspect(size_t *size, void *allocator)
 
 	char *str;
 
+	size_t size = 0;
+
 	if (v == NULL)
 	{
 		v = value_create_map(NULL, 0);
@@ -2353,19 +2454,109 @@ char *metacall_inspect(size_t *size, void *allocator)
 		{
 			log_write("metacall", LOG_LEVEL_ERROR, "Invalid MetaCall inspect map creation");
 
-			return NULL;
+			return 1;
+		}
+	}
+
+	if (metacall_inspect_cache_allocator == NULL)
+	{
+		metacall_inspect_cache_allocator = memory_allocator_std(&malloc, &realloc, &free);
+
+		if (metacall_inspect_cache_allocator == NULL)
+		{
+			log_write("metacall", LOG_LEVEL_ERROR, "Invalid MetaCall inspect cache allocator creation");
+
+			value_type_destroy(v);
+
+			return 1;
 		}
 	}
 
 	s = serial_create(metacall_serial());
 
-	str = serial_serialize(s, v, size, allocator);
+	str = serial_serialize(s, v, &size, metacall_inspect_cache_allocator);
 
 	value_type_destroy(v);
 
+	if (str == NULL)
+	{
+		return 1;
+	}
+
+	if (metacall_inspect_cache != NULL)
+	{
+		memory_allocator_deallocate(metacall_inspect_cache_allocator, metacall_inspect_cache);
+	}
+
+	metacall_inspect_cache = str;
+	metacall_inspect_cache_size = size;
+	metacall_inspect_cache_generation = generation;
+
+	return 0;
+}
+
+void metacall_inspect_cache_destroy(void)
+{
+	if (metacall_inspect_cache_allocator != NULL)
+	{
+		if (metacall_inspect_cache != NULL)
+		{
+			memory_allocator_deallocate(metacall_inspect_cache_allocator, metacall_inspect_cache);
+		}
+
+		memory_allocator_destroy(metacall_inspect_cache_allocator);
+	}
+
+	metacall_inspect_cache_allocator = NULL;
+	metacall_inspect_cache = NULL;
+	metacall_inspect_cache_size = 0;
+	metacall_inspect_cache_generation = 0;
+}
+
+char *metacall_inspect(size_t *size, void *allocator)
+{
+	uint64_t generation = loader_metadata_generation();
+
+	char *str = NULL;
+
+	threading_mutex_lock(&metacall_inspect_cache_mutex);
+
+	/* Serialize the metadata again only if a handle has been loaded, cleared or modified */
+	if (metacall_inspect_cache == NULL || metacall_inspect_cache_generation != generation)
+	{
+		if (metacall_inspect_cache_update(generation) != 0)
+		{
+			goto inspect_cache_error;
+		}
+	}
+
+	str = memory_allocator_allocate((memory_allocator)allocator, metacall_inspect_cache_size);
+
+	if (str == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid MetaCall inspect string allocation");
+
+		goto inspect_cache_error;
+	}
+
+	memcpy(str, metacall_inspect_cache, metacall_inspect_cache_size);
+
+	if (size != NULL)
+	{
+		*size = metacall_inspect_cache_size;
+	}
+
+inspect_cache_error:
+	threading_mutex_unlock(&metacall_inspect_cache_mutex);
+
 	return str;
 }
 
+uint64_t metacall_inspect_generation(void)
+{
+	return loader_metadata_generation();
+}
+
 void *metacall_inspect_value(void)
 {
 	return loader_metadata();
@@ -2424,12 +2615,18 @@ void metacall_destroy(void)
 		/* Destroy loaders */
 		loader_destroy();
 
+		/* Destroy the inspect cache */
+		metacall_inspect_cache_destroy();
+
 		/* Destroy configurations */
 		configuration_destroy();
 
 		/* Print stats from functions, classes, objects and exceptions */
 		reflect_memory_tracker_debug();
 
+		/* Release the names interned by the reflect objects, all of them are destroyed by now */
+		intern_destroy();
+
 		/* Set to null the plugin extension and core plugin handles */
 		plugin_extension_handle = NULL;
 		plugin_core_handle = NULL;
@@ -25,6 +25,8 @@
 
 #include <detour/detour.h>
 
+#include <loader/loader.h>
+
 #include <log/log.h>
 
 #include <stdlib.h>
@@ -310,6 +312,63 @@ void metacall_fork(metacall_pre_fork_callback_ptr pre_callback, metacall_post_fo
 	metacall_post_fork_callback = post_callback;
 }
 
+metacall_pid metacall_spawn_worker(void)
+{
+#if defined(WIN32) || defined(_WIN32) || \
+	defined(__CYGWIN__) || defined(__CYGWIN32__) || \
+	defined(__MINGW32__) || defined(__MINGW64__)
+
+	log_write("metacall", LOG_LEVEL_ERROR, "MetaCall spawn worker is not supported on this platform");
+
+	return -1;
+#else
+	pid_t pid;
+
+	if (metacall_is_initialized(NULL) != 0)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "MetaCall must be initialized before spawning a worker");
+
+		return -1;
+	}
+
+	/* Stop the background threads of the runtimes and take their locks */
+	if (loader_fork(LOADER_IMPL_FORK_PREPARE) != 0)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "MetaCall spawn worker failed to prepare the loaders");
+
+		return -1;
+	}
+
+	/* Bypass the fork hook if it is installed, the loaders must not be destroyed */
+	pid = (metacall_fork_trampoline != NULL) ? metacall_fork_trampoline() : fork();
+
+	if (pid == 0)
+	{
+		/* The worker is unusable if any runtime could not be recovered */
+		if (loader_fork(LOADER_IMPL_FORK_CHILD) != 0)
+		{
+			log_write("metacall", LOG_LEVEL_ERROR, "MetaCall spawn worker failed to resume the loaders in the worker");
+
+			_exit(EXIT_FAILURE);
+		}
+
+		return 0;
+	}
+
+	if (loader_fork(LOADER_IMPL_FORK_PARENT) != 0)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "MetaCall spawn worker failed to resume the loaders");
+	}
+
+	if (pid == -1)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "MetaCall spawn worker fork failed");
+	}
+
+	return pid;
+#endif
+}
+
 void metacall_fork_destroy(void)
 {
 	if (detour_fork_handle != NULL)
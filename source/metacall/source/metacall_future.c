@@ -0,0 +1,765 @@
+/*
+ *	MetaCall Library by Parra Studios
+ *	A library for providing a foreign function interface calls.
+ *
+ *	Copyright (C) 2016 - 2026 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+/* -- Headers -- */
+
+#include <metacall/metacall.h>
+#include <metacall/metacall_future.h>
+
+#include <reflect/reflect_future.h>
+#include <reflect/reflect_value_type.h>
+
+#include <log/log.h>
+
+#include <stdlib.h>
+
+#if defined(WIN32) || defined(_WIN32)
+	#ifndef NOMINMAX
+		#define NOMINMAX
+	#endif
+
+	#ifndef WIN32_LEAN_AND_MEAN
+		#define WIN32_LEAN_AND_MEAN
+	#endif
+
+	#include <windows.h>
+#else
+	#include <errno.h>
+	#include <fcntl.h>
+	#include <pthread.h>
+	#include <stdint.h>
+	#include <time.h>
+	#include <unistd.h>
+
+	#if defined(__linux__) || defined(__linux) || defined(__gnu_linux)
+		#include <sys/eventfd.h>
+
+		#define METACALL_FUTURE_EVENTFD 1
+	#endif
+
+	#define METACALL_FUTURE_FD 1
+#endif
+
+/* -- Type Definitions -- */
+
+#if defined(WIN32) || defined(_WIN32)
+typedef CRITICAL_SECTION metacall_future_mutex_type;
+typedef CONDITION_VARIABLE metacall_future_cond_type;
+#else
+typedef pthread_mutex_t metacall_future_mutex_type;
+typedef pthread_cond_t metacall_future_cond_type;
+#endif
+
+enum metacall_future_kind_id
+{
+	METACALL_FUTURE_KIND_AWAIT = 0,
+	METACALL_FUTURE_KIND_ALL = 1,
+	METACALL_FUTURE_KIND_ANY = 2
+};
+
+/* -- Member Data -- */
+
+/*
+*  A tracked future is shared by its owner, by the loader while the await is pending and
+*  by each future it has been combined with until it notifies them, so it is reference
+*  counted; the state only changes once from pending to completed, after that the value
+*  is immutable and it can be read without holding the lock
+*/
+struct metacall_future_listener_type
+{
+	struct metacall_future_type *parent;
+	size_t index;
+	struct metacall_future_listener_type *next;
+};
+
+struct metacall_future_type
+{
+	metacall_future_mutex_type mutex;
+	metacall_future_cond_type cond;
+	size_t ref;
+	enum metacall_future_kind_id kind;
+	enum metacall_future_status_id status;
+	value v;
+	int awaiting;
+	size_t remaining;
+	value results;
+	int fd[2];
+	struct metacall_future_listener_type *listeners;
+};
+
+/* -- Private Methods -- */
+
+static struct metacall_future_type *metacall_future_allocate(enum metacall_future_kind_id kind, size_t ref);
+
+static void metacall_future_ref(struct metacall_future_type *f);
+
+static void metacall_future_unref(struct metacall_future_type *f);
+
+static struct metacall_future_listener_type *metacall_future_complete_locked(struct metacall_future_type *f, enum metacall_future_status_id status, value v);
+
+static void metacall_future_dispatch(struct metacall_future_type *f, struct metacall_future_listener_type *listeners);
+
+static void metacall_future_notify(struct metacall_future_type *parent, size_t index, struct metacall_future_type *child);
+
+static void *metacall_future_settle(struct metacall_future_type *f, enum metacall_future_status_id status, value result);
+
+static void *metacall_future_resolve(void *result, void *data);
+
+static void *metacall_future_reject(void *result, void *data);
+
+static void *metacall_future_started(struct metacall_future_type *f, value chain);
+
+static void *metacall_future_combine(enum metacall_future_kind_id kind, void *futures[], size_t size);
+
+static void metacall_future_fd_signal(struct metacall_future_type *f);
+
+static void metacall_future_fd_close(struct metacall_future_type *f);
+
+/* -- Methods -- */
+
+struct metacall_future_type *metacall_future_allocate(enum metacall_future_kind_id kind, size_t ref)
+{
+	struct metacall_future_type *f = malloc(sizeof(struct metacall_future_type));
+
+	if (f == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid tracked future allocation");
+		return NULL;
+	}
+
+#if defined(WIN32) || defined(_WIN32)
+	InitializeCriticalSection(&f->mutex);
+	InitializeConditionVariable(&f->cond);
+#else
+	if (pthread_mutex_init(&f->mutex, NULL) != 0)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid tracked future mutex initialization");
+		free(f);
+		return NULL;
+	}
+
+	if (pthread_cond_init(&f->cond, NULL) != 0)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid tracked future condition initialization");
+		pthread_mutex_destroy(&f->mutex);
+		free(f);
+		return NULL;
+	}
+#endif
+
+	f->ref = ref;
+	f->kind = kind;
+	f->status = METACALL_FUTURE_PENDING;
+	f->v = NULL;
+	f->awaiting = 0;
+	f->remaining = 0;
+	f->results = NULL;
+	f->fd[0] = -1;
+	f->fd[1] = -1;
+	f->listeners = NULL;
+
+	return f;
+}
+
+static void metacall_future_lock(struct metacall_future_type *f)
+{
+#if defined(WIN32) || defined(_WIN32)
+	EnterCriticalSection(&f->mutex);
+#else
+	pthread_mutex_lock(&f->mutex);
+#endif
+}
+
+static void metacall_future_unlock(struct metacall_future_type *f)
+{
+#if defined(WIN32) || defined(_WIN32)
+	LeaveCriticalSection(&f->mutex);
+#else
+	pthread_mutex_unlock(&f->mutex);
+#endif
+}
+
+void metacall_future_ref(struct metacall_future_type *f)
+{
+	metacall_future_lock(f);
+	++f->ref;
+	metacall_future_unlock(f);
+}
+
+void metacall_future_unref(struct metacall_future_type *f)
+{
+	size_t ref;
+
+	metacall_future_lock(f);
+	ref = --f->ref;
+	metacall_future_unlock(f);
+
+	if (ref > 0)
+	{
+		return;
+	}
+
+	metacall_future_fd_close(f);
+	value_type_destroy(f->v);
+	value_type_destroy(f->results);
+
+#if defined(WIN32) || defined(_WIN32)
+	DeleteCriticalSection(&f->mutex);
+#else
+	pthread_cond_destroy(&f->cond);
+	pthread_mutex_destroy(&f->mutex);
+#endif
+
+	free(f);
+}
+
+struct metacall_future_listener_type *metacall_future_complete_locked(struct metacall_future_type *f, enum metacall_future_status_id status, value v)
+{
+	struct metacall_future_listener_type *listeners = f->listeners;
+
+	f->status = status;
+	f->v = v;
+	f->listeners = NULL;
+
+#if defined(WIN32) || defined(_WIN32)
+	WakeAllConditionVariable(&f->cond);
+#else
+	pthread_cond_broadcast(&f->cond);
+#endif
+
+	metacall_future_fd_signal(f);
+
+	return listeners;
+}
+
+void metacall_future_dispatch(struct metacall_future_type *f, struct metacall_future_listener_type *listeners)
+{
+	while (listeners != NULL)
+	{
+		struct metacall_future_listener_type *next = listeners->next;
+
+		metacall_future_notify(listeners->parent, listeners->index, f);
+		metacall_future_unref(listeners->parent);
+
+		free(listeners);
+
+		listeners = next;
+	}
+}
+
+void metacall_future_notify(struct metacall_future_type *parent, size_t index, struct metacall_future_type *child)
+{
+	struct metacall_future_listener_type *listeners = NULL;
+
+	metacall_future_lock(parent);
+
+	if (parent->status != METACALL_FUTURE_PENDING)
+	{
+		metacall_future_unlock(parent);
+		return;
+	}
+
+	if (parent->kind == METACALL_FUTURE_KIND_ALL && child->status == METACALL_FUTURE_RESOLVED)
+	{
+		value *results = value_to_array(parent->results);
+
+		results[index] = value_type_copy(child->v);
+
+		if (--parent->remaining == 0)
+		{
+			value v = parent->results;
+
+			parent->results = NULL;
+
+			listeners = metacall_future_complete_locked(parent, METACALL_FUTURE_RESOLVED, v);
+		}
+	}
+	else
+	{
+		/* A rejection completes a when all, any completion completes a when any */
+		listeners = metacall_future_complete_locked(parent, child->status, value_type_copy(child->v));
+	}
+
+	metacall_future_unlock(parent);
+
+	metacall_future_dispatch(parent, listeners);
+}
+
+void *metacall_future_settle(struct metacall_future_type *f, enum metacall_future_status_id status, value result)
+{
+	struct metacall_future_listener_type *listeners;
+
+	metacall_future_lock(f);
+
+	if (f->awaiting == 0)
+	{
+		metacall_future_unlock(f);
+		return NULL;
+	}
+
+	f->awaiting = 0;
+
+	/* The result is destroyed by the loader after the callback, so it must be copied */
+	listeners = metacall_future_complete_locked(f, status, value_type_copy(result));
+
+	metacall_future_unlock(f);
+
+	metacall_future_dispatch(f, listeners);
+
+	/* Release the reference held by the loader */
+	metacall_future_unref(f);
+
+	return NULL;
+}
+
+void *metacall_future_resolve(void *result, void *data)
+{
+	return metacall_future_settle(data, METACALL_FUTURE_RESOLVED, result);
+}
+
+void *metacall_future_reject(void *result, void *data)
+{
+	return metacall_future_settle(data, METACALL_FUTURE_REJECTED, result);
+}
+
+void *metacall_future_started(struct metacall_future_type *f, value chain)
+{
+	if (chain != NULL)
+	{
+		/* The chained future is not needed, the callbacks keep being executed without it */
+		value_type_destroy(chain);
+
+		return f;
+	}
+
+	metacall_future_lock(f);
+
+	if (f->awaiting == 0)
+	{
+		/* The loader has completed it synchronously */
+		metacall_future_unlock(f);
+
+		return f;
+	}
+
+	f->awaiting = 0;
+
+	metacall_future_unlock(f);
+
+	/* Release both the reference of the loader and the owner */
+	metacall_future_unref(f);
+	metacall_future_unref(f);
+
+	return NULL;
+}
+
+void *metacall_future_create(void *f)
+{
+	struct metacall_future_type *tracked;
+
+	if (f == NULL || value_type_id(f) != TYPE_FUTURE)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid tracked future creation, the value is not a future");
+		return NULL;
+	}
+
+	tracked = metacall_future_allocate(METACALL_FUTURE_KIND_AWAIT, 2);
+
+	if (tracked == NULL)
+	{
+		return NULL;
+	}
+
+	tracked->awaiting = 1;
+
+	if (metacall_future_started(tracked, future_await(value_to_future(f), &metacall_future_resolve, &metacall_future_reject, tracked)) == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid tracked future creation, the future cannot be awaited");
+		return NULL;
+	}
+
+	return tracked;
+}
+
+void *metacall_future_call(void *func, void *args[], size_t size)
+{
+	struct metacall_future_type *tracked;
+
+	if (func == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid tracked future call, the function is null");
+		return NULL;
+	}
+
+	tracked = metacall_future_allocate(METACALL_FUTURE_KIND_AWAIT, 2);
+
+	if (tracked == NULL)
+	{
+		return NULL;
+	}
+
+	tracked->awaiting = 1;
+
+	if (metacall_future_started(tracked, metacallfv_await_s(func, args, size, &metacall_future_resolve, &metacall_future_reject, tracked)) == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid tracked future call, the asynchronous call could not be started");
+		return NULL;
+	}
+
+	return tracked;
+}
+
+void *metacall_future_combine(enum metacall_future_kind_id kind, void *futures[], size_t size)
+{
+	struct metacall_future_type *combined;
+	size_t iterator;
+
+	if (size > 0 && futures == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid tracked future combination, the futures are null");
+		return NULL;
+	}
+
+	for (iterator = 0; iterator < size; ++iterator)
+	{
+		if (futures[iterator] == NULL)
+		{
+			log_write("metacall", LOG_LEVEL_ERROR, "Invalid tracked future combination, the future at position %" PRIuS " is null", iterator);
+			return NULL;
+		}
+	}
+
+	combined = metacall_future_allocate(kind, 1);
+
+	if (combined == NULL)
+	{
+		return NULL;
+	}
+
+	if (kind == METACALL_FUTURE_KIND_ALL)
+	{
+		combined->results = value_create_array(NULL, size);
+
+		if (combined->results == NULL)
+		{
+			log_write("metacall", LOG_LEVEL_ERROR, "Invalid tracked future combination results allocation");
+			metacall_future_unref(combined);
+			return NULL;
+		}
+
+		combined->remaining = size;
+
+		if (size == 0)
+		{
+			combined->status = METACALL_FUTURE_RESOLVED;
+			combined->v = combined->results;
+			combined->results = NULL;
+
+			return combined;
+		}
+	}
+
+	for (iterator = 0; iterator < size; ++iterator)
+	{
+		struct metacall_future_type *child = futures[iterator];
+
+		struct metacall_future_listener_type *listener = malloc(sizeof(struct metacall_future_listener_type));
+
+		if (listener == NULL)
+		{
+			/* The listeners already registered keep a reference, so they are released when the children complete */
+			log_write("metacall", LOG_LEVEL_ERROR, "Invalid tracked future combination listener allocation");
+			metacall_future_unref(combined);
+			return NULL;
+		}
+
+		listener->parent = combined;
+		listener->index = iterator;
+
+		metacall_future_ref(combined);
+
+		metacall_future_lock(child);
+
+		if (child->status == METACALL_FUTURE_PENDING)
+		{
+			listener->next = child->listeners;
+			child->listeners = listener;
+
+			metacall_future_unlock(child);
+		}
+		else
+		{
+			metacall_future_unlock(child);
+
+			listener->next = NULL;
+
+			metacall_future_dispatch(child, listener);
+		}
+	}
+
+	return combined;
+}
+
+void *metacall_future_when_all(void *futures[], size_t size)
+{
+	return metacall_future_combine(METACALL_FUTURE_KIND_ALL, futures, size);
+}
+
+void *metacall_future_when_any(void *futures[], size_t size)
+{
+	if (size == 0)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid tracked future combination, when any requires at least one future");
+		return NULL;
+	}
+
+	return metacall_future_combine(METACALL_FUTURE_KIND_ANY, futures, size);
+}
+
+int metacall_future_wait(void *f, long timeout)
+{
+	struct metacall_future_type *tracked = f;
+	int result;
+
+	if (tracked == NULL)
+	{
+		return 1;
+	}
+
+	metacall_future_lock(tracked);
+
+#if defined(WIN32) || defined(_WIN32)
+	{
+		ULONGLONG deadline = GetTickCount64() + (ULONGLONG)(timeout > 0 ? timeout : 0);
+
+		while (tracked->status == METACALL_FUTURE_PENDING && timeout != 0)
+		{
+			DWORD milliseconds = INFINITE;
+
+			if (timeout > 0)
+			{
+				ULONGLONG now = GetTickCount64();
+
+				if (now >= deadline)
+				{
+					break;
+				}
+
+				milliseconds = (DWORD)(deadline - now);
+			}
+
+			SleepConditionVariableCS(&tracked->cond, &tracked->mutex, milliseconds);
+		}
+	}
+#else
+	if (timeout < 0)
+	{
+		while (tracked->status == METACALL_FUTURE_PENDING)
+		{
+			pthread_cond_wait(&tracked->cond, &tracked->mutex);
+		}
+	}
+	else if (timeout > 0)
+	{
+		struct timespec deadline;
+
+		clock_gettime(CLOCK_REALTIME, &deadline);
+
+		deadline.tv_sec += timeout / 1000;
+		deadline.tv_nsec += (timeout % 1000) * 1000000L;
+
+		if (deadline.tv_nsec >= 1000000000L)
+		{
+			deadline.tv_sec += 1;
+			deadline.tv_nsec -= 1000000000L;
+		}
+
+		while (tracked->status == METACALL_FUTURE_PENDING)
+		{
+			if (pthread_cond_timedwait(&tracked->cond, &tracked->mutex, &deadline) == ETIMEDOUT)
+			{
+				break;
+			}
+		}
+	}
+#endif
+
+	result = (tracked->status == METACALL_FUTURE_PENDING);
+
+	metacall_future_unlock(tracked);
+
+	return result;
+}
+
+enum metacall_future_status_id metacall_future_status(void *f)
+{
+	struct metacall_future_type *tracked = f;
+	enum metacall_future_status_id status;
+
+	if (tracked == NULL)
+	{
+		return METACALL_FUTURE_PENDING;
+	}
+
+	metacall_future_lock(tracked);
+	status = tracked->status;
+	metacall_future_unlock(tracked);
+
+	return status;
+}
+
+void *metacall_future_value(void *f)
+{
+	struct metacall_future_type *tracked = f;
+	value v;
+
+	if (tracked == NULL)
+	{
+		return NULL;
+	}
+
+	metacall_future_lock(tracked);
+	v = tracked->v;
+	metacall_future_unlock(tracked);
+
+	return v;
+}
+
+void metacall_future_fd_signal(struct metacall_future_type *f)
+{
+#if defined(METACALL_FUTURE_FD)
+	if (f->fd[1] != -1)
+	{
+	#if defined(METACALL_FUTURE_EVENTFD)
+		uint64_t event = 1;
+	#else
+		unsigned char event = 1;
+	#endif
+
+		/* The descriptor is level triggered, if the write fails it is already readable */
+		if (write(f->fd[1], &event, sizeof(event)) < 0)
+		{
+			return;
+		}
+	}
+#else
+	(void)f;
+#endif
+}
+
+void metacall_future_fd_close(struct metacall_future_type *f)
+{
+#if defined(METACALL_FUTURE_FD)
+	if (f->fd[0] != -1)
+	{
+		close(f->fd[0]);
+	}
+
+	if (f->fd[1] != -1 && f->fd[1] != f->fd[0])
+	{
+		close(f->fd[1]);
+	}
+
+	f->fd[0] = -1;
+	f->fd[1] = -1;
+#else
+	(void)f;
+#endif
+}
+
+int metacall_future_fd(void *f)
+{
+	struct metacall_future_type *tracked = f;
+	int fd;
+
+	if (tracked == NULL)
+	{
+		return -1;
+	}
+
+#if defined(METACALL_FUTURE_FD)
+	metacall_future_lock(tracked);
+
+	if (tracked->fd[0] == -1)
+	{
+	#if defined(METACALL_FUTURE_EVENTFD)
+		int event_fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+
+		if (event_fd != -1)
+		{
+			tracked->fd[0] = event_fd;
+			tracked->fd[1] = event_fd;
+		}
+	#else
+		int pipe_fd[2];
+
+		if (pipe(pipe_fd) == 0)
+		{
+			size_t iterator;
+
+			for (iterator = 0; iterator < 2; ++iterator)
+			{
+				fcntl(pipe_fd[iterator], F_SETFD, FD_CLOEXEC);
+				fcntl(pipe_fd[iterator], F_SETFL, fcntl(pipe_fd[iterator], F_GETFL) | O_NONBLOCK);
+			}
+
+			tracked->fd[0] = pipe_fd[0];
+			tracked->fd[1] = pipe_fd[1];
+		}
+	#endif
+
+		if (tracked->fd[0] == -1)
+		{
+			log_write("metacall", LOG_LEVEL_ERROR, "Invalid tracked future descriptor creation");
+		}
+		else if (tracked->status != METACALL_FUTURE_PENDING)
+		{
+			metacall_future_fd_signal(tracked);
+		}
+	}
+
+	fd = tracked->fd[0];
+
+	metacall_future_unlock(tracked);
+#else
+	log_write("metacall", LOG_LEVEL_ERROR, "Tracked future descriptors are not supported in this platform");
+
+	fd = -1;
+#endif
+
+	return fd;
+}
+
+void metacall_future_destroy(void *f)
+{
+	struct metacall_future_type *tracked = f;
+
+	if (tracked == NULL)
+	{
+		return;
+	}
+
+	/* The descriptor is closed now even if the loader still holds a reference */
+	metacall_future_lock(tracked);
+	metacall_future_fd_close(tracked);
+	metacall_future_unlock(tracked);
+
+	metacall_future_unref(tracked);
+}
@@ -25,7 +25,9 @@
 
 #include <detour/detour.h>
 
+#include <threading/threading_atomic.h>
 #include <threading/threading_mutex.h>
+#include <threading/threading_yield.h>
 
 #include <dynlink/dynlink_type.h>
 
@@ -36,12 +38,198 @@
 #include <loader/loader.h>
 
 #include <stdlib.h>
+#include <string.h>
+
+/* -- Definitions -- */
+
+#define METACALL_LINK_SNAPSHOT_MIN_SIZE 0x08
+
+/* -- Type Definitions -- */
+
+/*
+*  The link table is only read by the hook, which is executed on every dlsym of the hooked
+*  runtimes, so the readers never lock: the writers (register and unregister) are serialized
+*  by link_mutex, they rebuild an immutable open addressing snapshot of metacall_link_table
+*  and publish it atomically. Readers announce themselves in the counter of the current epoch,
+*  after publishing, the writer moves to the next epoch and waits until the readers of the
+*  previous one have finished, then no reader can be probing the previous snapshot anymore
+*/
+struct metacall_link_entry_type
+{
+	hash h;
+	const char *symbol;
+	void *ptr;
+};
+
+struct metacall_link_snapshot_type
+{
+	size_t mask;
+	struct metacall_link_entry_type entries[];
+};
 
 /* -- Private Variables -- */
 
 static set metacall_link_table = NULL;
+static atomic_uintptr_t metacall_link_snapshot = 0;
+static atomic_uint metacall_link_epoch = 0;
+static atomic_size_t metacall_link_readers[2] = { 0, 0 };
 static threading_mutex_type link_mutex = THREADING_MUTEX_INITIALIZE;
 
+/* -- Private Methods -- */
+
+static void *metacall_link_find(const char *symbol)
+{
+	struct metacall_link_snapshot_type *snapshot;
+	unsigned int epoch;
+	void *ptr = NULL;
+
+	/* If the epoch changed while entering, the writer may not be waiting for this counter, so enter again */
+	for (;;)
+	{
+		epoch = atomic_load(&metacall_link_epoch) & 1;
+
+		atomic_fetch_add(&metacall_link_readers[epoch], 1);
+
+		if ((atomic_load(&metacall_link_epoch) & 1) == epoch)
+		{
+			break;
+		}
+
+		atomic_fetch_sub(&metacall_link_readers[epoch], 1);
+	}
+
+	snapshot = (struct metacall_link_snapshot_type *)atomic_load(&metacall_link_snapshot);
+
+	if (snapshot != NULL)
+	{
+		hash h = hash_callback_str((hash_key)symbol);
+		size_t index;
+
+		/* The snapshot is at most half full, so there is always an empty slot ending the probe */
+		for (index = h & snapshot->mask; snapshot->entries[index].symbol != NULL; index = (index + 1) & snapshot->mask)
+		{
+			struct metacall_link_entry_type *entry = &snapshot->entries[index];
+
+			if (entry->h == h && strcmp(entry->symbol, symbol) == 0)
+			{
+				ptr = entry->ptr;
+				break;
+			}
+		}
+	}
+
+	atomic_fetch_sub_explicit(&metacall_link_readers[epoch], 1, memory_order_release);
+
+	return ptr;
+}
+
+static void metacall_link_synchronize(void)
+{
+	unsigned int epoch = atomic_fetch_add(&metacall_link_epoch, 1) & 1;
+
+	/* The probes are short and never block, so the wait is bounded by the slowest reader of the previous epoch */
+	while (atomic_load(&metacall_link_readers[epoch]) != 0)
+	{
+		threading_yield();
+	}
+}
+
+static int metacall_link_publish(void)
+{
+	struct metacall_link_snapshot_type *snapshot = NULL, *previous;
+	size_t count = set_size(metacall_link_table);
+
+	if (count > 0)
+	{
+		struct set_iterator_type it;
+		size_t capacity = METACALL_LINK_SNAPSHOT_MIN_SIZE, length = 0, entries_size;
+		char *strings;
+
+		while (capacity < count * 2)
+		{
+			capacity <<= 1;
+		}
+
+		for (set_iterator_begin(&it, metacall_link_table); set_iterator_end(&it) != 0; set_iterator_next(&it))
+		{
+			length += strlen((const char *)set_iterator_key(&it)) + 1;
+		}
+
+		/* Entries and symbol names are stored in a single block */
+		entries_size = sizeof(struct metacall_link_snapshot_type) + sizeof(struct metacall_link_entry_type) * capacity;
+
+		snapshot = malloc(entries_size + length);
+
+		if (snapshot == NULL)
+		{
+			log_write("metacall", LOG_LEVEL_ERROR, "MetaCall failed to allocate the link table snapshot");
+
+			return 1;
+		}
+
+		snapshot->mask = capacity - 1;
+
+		memset(snapshot->entries, 0, sizeof(struct metacall_link_entry_type) * capacity);
+
+		strings = (char *)snapshot + entries_size;
+
+		for (set_iterator_begin(&it, metacall_link_table); set_iterator_end(&it) != 0; set_iterator_next(&it))
+		{
+			const char *symbol = (const char *)set_iterator_key(&it);
+			size_t size = strlen(symbol) + 1;
+			hash h = hash_callback_str((hash_key)symbol);
+			size_t index = h & snapshot->mask;
+
+			while (snapshot->entries[index].symbol != NULL)
+			{
+				index = (index + 1) & snapshot->mask;
+			}
+
+			memcpy(strings, symbol, size);
+
+			snapshot->entries[index].h = h;
+			snapshot->entries[index].symbol = strings;
+			snapshot->entries[index].ptr = set_iterator_value(&it);
+
+			strings += size;
+		}
+	}
+
+	previous = (struct metacall_link_snapshot_type *)atomic_load_explicit(&metacall_link_snapshot, memory_order_relaxed);
+
+	atomic_store(&metacall_link_snapshot, (uintptr_t)snapshot);
+
+	if (previous != NULL)
+	{
+		metacall_link_synchronize();
+
+		free(previous);
+	}
+
+	return 0;
+}
+
+static int metacall_link_insert(const char *symbol, void *ptr)
+{
+	int result = 1;
+
+	threading_mutex_lock(&link_mutex);
+
+	if (set_insert(metacall_link_table, (set_key)symbol, ptr) == 0)
+	{
+		result = metacall_link_publish();
+
+		if (result != 0)
+		{
+			set_remove(metacall_link_table, (set_key)symbol);
+		}
+	}
+
+	threading_mutex_unlock(&link_mutex);
+
+	return result;
+}
+
 #if defined(WIN32) || defined(_WIN32) || \
 	defined(__CYGWIN__) || defined(__CYGWIN32__) || \
 	defined(__MINGW32__) || defined(__MINGW64__)
@@ -60,14 +248,8 @@ static metacall_link_trampoline_type metacall_link_func(void)
 
 FARPROC metacall_link_hook(HMODULE handle, LPCSTR symbol)
 {
-	void *ptr;
-
-	threading_mutex_lock(&link_mutex);
-
 	/* Intercept if any */
-	ptr = set_get(metacall_link_table, (set_key)symbol);
-
-	threading_mutex_unlock(&link_mutex);
+	void *ptr = metacall_link_find(symbol);
 
 	if (ptr != NULL)
 	{
@@ -100,18 +282,12 @@ static metacall_link_trampoline_type metacall_link_func(void)
 
 void *metacall_link_hook(void *handle, const char *symbol)
 {
-	void *ptr;
-
-	threading_mutex_lock(&link_mutex);
-
 	/* Intercept function if any */
-	ptr = set_get(metacall_link_table, (set_key)symbol);
+	void *ptr = metacall_link_find(symbol);
 
 	/* TODO: Disable logs here until log is completely thread safe and async signal safe */
 	/* log_write("metacall", LOG_LEVEL_DEBUG, "MetaCall detour link interception: %s -> %p", symbol, ptr); */
 
-	threading_mutex_unlock(&link_mutex);
-
 	if (ptr != NULL)
 	{
 		return ptr;
@@ -184,7 +360,7 @@ int metacall_link_register(const char *tag, const char *library, const char *sym
 
 	dynlink_symbol_uncast(fn, ptr);
 
-	return set_insert(metacall_link_table, (set_key)symbol, ptr);
+	return metacall_link_insert(symbol, ptr);
 }
 
 int metacall_link_register_loader(void *loader, const char *library, const char *symbol, void (*fn)(void))
@@ -203,7 +379,7 @@ int metacall_link_register_loader(void *loader, const char *library, const char
 
 	dynlink_symbol_uncast(fn, ptr);
 
-	return set_insert(metacall_link_table, (set_key)symbol, ptr);
+	return metacall_link_insert(symbol, ptr);
 }
 
 int metacall_link_unregister(const char *tag, const char *library, const char *symbol)
@@ -213,16 +389,25 @@ int metacall_link_unregister(const char *tag, const char *library, const char *s
 		return 1;
 	}
 
-	if (set_get(metacall_link_table, (set_key)symbol) == NULL)
-	{
-		return 0;
-	}
+	int result = 0;
 
 	/* TODO: Restore the hook? We need support for this on the detour API */
 	(void)tag;
 	(void)library;
 
-	return (set_remove(metacall_link_table, (set_key)symbol) == NULL);
+	threading_mutex_lock(&link_mutex);
+
+	if (set_get(metacall_link_table, (set_key)symbol) != NULL)
+	{
+		if (set_remove(metacall_link_table, (set_key)symbol) == NULL || metacall_link_publish() != 0)
+		{
+			result = 1;
+		}
+	}
+
+	threading_mutex_unlock(&link_mutex);
+
+	return result;
 }
 
 void metacall_link_destroy(void)
@@ -231,6 +416,17 @@ void metacall_link_destroy(void)
 
 	if (metacall_link_table != NULL)
 	{
+		struct metacall_link_snapshot_type *snapshot = (struct metacall_link_snapshot_type *)atomic_load_explicit(&metacall_link_snapshot, memory_order_relaxed);
+
+		atomic_store(&metacall_link_snapshot, (uintptr_t)0);
+
+		if (snapshot != NULL)
+		{
+			metacall_link_synchronize();
+
+			free(snapshot);
+		}
+
 		set_destroy(metacall_link_table);
 
 		metacall_link_table = NULL;
@@ -27,6 +27,8 @@
 
 #include <portability/portability_path.h>
 
+#include <stdint.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -72,6 +74,19 @@ PORTABILITY_API int portability_library_path_find(const char name[], portability
 */
 PORTABILITY_API int portability_library_path_list(portability_library_path_list_cb callback, void *data);
 
+/**
+*  @brief
+*    Get a counter that changes each time a library is loaded or unloaded in the current process,
+*    it allows to reuse the result of portability_library_path_list while the counter does not change
+*
+*  @param[out] generation
+*    The current value of the counter
+*
+*  @return
+*    Returns zero if the platform supports the counter, different from zero otherwise (the list must be always refreshed)
+*/
+PORTABILITY_API int portability_library_path_generation(uint64_t *generation);
+
 #ifdef __cplusplus
 }
 #endif
@@ -42,6 +42,9 @@ static int portability_library_path_ends_with(const char path[], const char name
 
 	#include <mach-o/dyld.h>
 
+	#include <pthread.h>
+	#include <stdatomic.h>
+
 #elif defined(WIN32) || defined(_WIN32) || \
 	defined(__CYGWIN__) || defined(__CYGWIN32__) || \
 	defined(__MINGW32__) || defined(__MINGW64__)
@@ -120,6 +123,100 @@ static int portability_library_path_list_phdr_callback(struct dl_phdr_info *info
 	return list_phdr->callback(info->dlpi_name, list_phdr->data);
 }
 
+static int portability_library_path_generation_phdr_callback(struct dl_phdr_info *info, size_t size, void *data)
+{
+	uint64_t *generation = (uint64_t *)data;
+
+	/* Old implementations do not provide the counters, check if they are inside of the structure */
+	if (size < offsetof(struct dl_phdr_info, dlpi_subs) + sizeof(info->dlpi_subs))
+	{
+		return -1;
+	}
+
+	/* The counters are global to the process, so the first library is enough */
+	*generation = (uint64_t)info->dlpi_adds + (uint64_t)info->dlpi_subs;
+
+	return 1;
+}
+
+#elif (defined(__APPLE__) && defined(__MACH__)) || defined(__MACOSX__)
+
+/* -- Private Member Data -- */
+
+static atomic_uint_fast64_t portability_library_path_generation_counter = 0;
+
+static pthread_once_t portability_library_path_generation_once = PTHREAD_ONCE_INIT;
+
+/* -- Private Methods -- */
+
+static void portability_library_path_generation_image_callback(const struct mach_header *mh, intptr_t vmaddr_slide)
+{
+	(void)mh;
+	(void)vmaddr_slide;
+
+	atomic_fetch_add_explicit(&portability_library_path_generation_counter, 1, memory_order_release);
+}
+
+static void portability_library_path_generation_register(void)
+{
+	/* The add callback is also invoked for each of the images already loaded when registering it */
+	_dyld_register_func_for_add_image(&portability_library_path_generation_image_callback);
+	_dyld_register_func_for_remove_image(&portability_library_path_generation_image_callback);
+}
+
+#elif defined(WIN32) || defined(_WIN32)
+
+/* -- Type Definitions -- */
+
+/* The notification data is not used, so it is not needed to define the LDR_DLL_NOTIFICATION_DATA structure */
+typedef VOID(CALLBACK *portability_library_path_dll_notification)(ULONG reason, const void *notification_data, PVOID context);
+
+typedef LONG(NTAPI *portability_library_path_register_dll_notification)(ULONG flags, portability_library_path_dll_notification callback, PVOID context, PVOID *cookie);
+
+/* -- Private Member Data -- */
+
+static volatile LONG64 portability_library_path_generation_counter = 0;
+
+static INIT_ONCE portability_library_path_generation_once = INIT_ONCE_STATIC_INIT;
+
+/* -- Private Methods -- */
+
+static VOID CALLBACK portability_library_path_generation_dll_callback(ULONG reason, const void *notification_data, PVOID context)
+{
+	(void)reason;
+	(void)notification_data;
+	(void)context;
+
+	InterlockedIncrement64(&portability_library_path_generation_counter);
+}
+
+static BOOL CALLBACK portability_library_path_generation_register(PINIT_ONCE once, PVOID parameter, PVOID *context)
+{
+	HMODULE ntdll = GetModuleHandleA("ntdll.dll");
+	portability_library_path_register_dll_notification register_dll_notification;
+	PVOID cookie = NULL;
+
+	(void)once;
+	(void)parameter;
+	(void)context;
+
+	if (ntdll == NULL)
+	{
+		return FALSE;
+	}
+
+	/* LdrRegisterDllNotification is exported by ntdll but it is not available in the import libraries */
+	register_dll_notification = (portability_library_path_register_dll_notification)GetProcAddress(ntdll, "LdrRegisterDllNotification");
+
+	if (register_dll_notification == NULL)
+	{
+		return FALSE;
+	}
+
+	/* The notification stays registered for the lifetime of the process */
+	return register_dll_notification(0, &portability_library_path_generation_dll_callback, NULL, &cookie) == 0 ? TRUE : FALSE;
+}
+
 #endif
 
 int portability_library_path_find(const char name[], portability_library_path_str path, size_t *length)
@@ -288,3 +385,37 @@ int portability_library_path_list(portability_library_path_list_cb callback, voi
 	#error "Unsupported platform for portability_library_path"
 #endif
 }
+
+int portability_library_path_generation(uint64_t *generation)
+{
+	if (generation == NULL)
+	{
+		return 1;
+	}
+
+#if defined(linux) || defined(__linux__) || defined(__linux) || defined(__gnu_linux) || \
+	defined(__FreeBSD__)
+	return dl_iterate_phdr(&portability_library_path_generation_phdr_callback, (void *)generation) != 1;
+#elif (defined(__APPLE__) && defined(__MACH__)) || defined(__MACOSX__)
+	if (pthread_once(&portability_library_path_generation_once, &portability_library_path_generation_register) != 0)
+	{
+		return 1;
+	}
+
+	*generation = (uint64_t)atomic_load_explicit(&portability_library_path_generation_counter, memory_order_acquire);
+
+	return 0;
+#elif defined(WIN32) || defined(_WIN32)
+	if (InitOnceExecuteOnce(&portability_library_path_generation_once, &portability_library_path_generation_register, NULL, NULL) == FALSE)
+	{
+		return 1;
+	}
+
+	*generation = (uint64_t)InterlockedCompareExchange64(&portability_library_path_generation_counter, 0, 0);
+
+	return 0;
+#else
+	/* Other platforms do not provide a way to track the loaded libraries, so the list must be always refreshed */
+	return 1;
+#endif
+}
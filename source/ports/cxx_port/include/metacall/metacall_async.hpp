@@ -0,0 +1,493 @@
+/*
+ *	MetaCall Library by Parra Studios
+ *	A library for providing a foreign function interface calls.
+ *
+ *	Copyright (C) 2016 - 2026 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+#ifndef METACALL_ASYNC_HPP
+#define METACALL_ASYNC_HPP 1
+
+/* -- Headers -- */
+
+#include <metacall/metacall.hpp>
+
+#if !defined(__cpp_impl_coroutine) || (__cpp_impl_coroutine < 201902L)
+	#error "MetaCall asynchronous API requires C++20 coroutines"
+#endif
+
+#include <array>
+#include <coroutine>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace metacall
+{
+// Resumes the coroutines awaiting an asynchronous call, it is executed in the thread
+// of the loader that completes the call (for example the Node thread or the asyncio thread)
+class executor
+{
+public:
+	virtual ~executor() = default;
+
+	virtual void execute(std::coroutine_handle<> handle) = 0;
+};
+
+// Default executor, it resumes the coroutine in the thread of the loader
+class inline_executor : public executor
+{
+public:
+	void execute(std::coroutine_handle<> handle) override
+	{
+		handle.resume();
+	}
+
+	static inline_executor &instance()
+	{
+		static inline_executor ex;
+
+		return ex;
+	}
+};
+
+class async_rejected : public std::runtime_error
+{
+public:
+	explicit async_rejected(const std::string &message) :
+		std::runtime_error(message) {}
+};
+
+class async_cancelled : public std::runtime_error
+{
+public:
+	async_cancelled() :
+		std::runtime_error("MetaCall asynchronous call has been cancelled") {}
+};
+
+namespace detail
+{
+struct cancellation_state
+{
+	std::mutex mutex;
+	bool cancelled = false;
+	std::size_t next = 0;
+	std::vector<std::pair<std::size_t, std::function<void()>>> callbacks;
+};
+} /* namespace detail */
+
+// Observes the cancellation of a cancellation_source, a default constructed token is never cancelled
+class cancellation_token
+{
+public:
+	cancellation_token() = default;
+
+	bool cancelled() const
+	{
+		if (state == nullptr)
+		{
+			return false;
+		}
+
+		std::lock_guard<std::mutex> lock(state->mutex);
+
+		return state->cancelled;
+	}
+
+	// Register a callback executed on cancellation (immediately if it is already cancelled),
+	// returns the id used to unsubscribe it or zero if it will not be executed later
+	std::size_t subscribe(std::function<void()> callback) const
+	{
+		if (state == nullptr)
+		{
+			return 0;
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(state->mutex);
+
+			if (state->cancelled == false)
+			{
+				state->callbacks.emplace_back(++state->next, std::move(callback));
+
+				return state->next;
+			}
+		}
+
+		callback();
+
+		return 0;
+	}
+
+	void unsubscribe(std::size_t id) const
+	{
+		if (state == nullptr || id == 0)
+		{
+			return;
+		}
+
+		std::lock_guard<std::mutex> lock(state->mutex);
+
+		for (auto it = state->callbacks.begin(); it != state->callbacks.end(); ++it)
+		{
+			if (it->first == id)
+			{
+				state->callbacks.erase(it);
+				break;
+			}
+		}
+	}
+
+private:
+	friend class cancellation_source;
+
+	explicit cancellation_token(std::shared_ptr<detail::cancellation_state> state) :
+		state(std::move(state)) {}
+
+	std::shared_ptr<detail::cancellation_state> state;
+};
+
+class cancellation_source
+{
+public:
+	cancellation_source() :
+		state(std::make_shared<detail::cancellation_state>()) {}
+
+	cancellation_token token() const
+	{
+		return cancellation_token(state);
+	}
+
+	void cancel()
+	{
+		std::vector<std::pair<std::size_t, std::function<void()>>> callbacks;
+
+		{
+			std::lock_guard<std::mutex> lock(state->mutex);
+
+			if (state->cancelled)
+			{
+				return;
+			}
+
+			state->cancelled = true;
+			callbacks.swap(state->callbacks);
+		}
+
+		for (auto &callback : callbacks)
+		{
+			callback.second();
+		}
+	}
+
+	bool cancelled() const
+	{
+		std::lock_guard<std::mutex> lock(state->mutex);
+
+		return state->cancelled;
+	}
+
+private:
+	std::shared_ptr<detail::cancellation_state> state;
+};
+
+namespace detail
+{
+// Shared between the awaitable and the loader callbacks, the loader may complete the
+// call before it is awaited, after the awaitable is destroyed or never (if cancelled)
+struct async_state
+{
+	enum status_id
+	{
+		pending,
+		resolved,
+		rejected,
+		cancelled
+	};
+
+	std::mutex mutex;
+	status_id status = pending;
+	void *result = nullptr;
+	bool started = false;
+	std::coroutine_handle<> handle;
+	executor *ex = &inline_executor::instance();
+
+	~async_state()
+	{
+		if (result != nullptr)
+		{
+			metacall_value_destroy(result);
+		}
+	}
+
+	void complete(status_id completion, void *v)
+	{
+		std::coroutine_handle<> resume;
+		executor *resume_ex;
+
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+
+			if (status != pending)
+			{
+				if (v != nullptr)
+				{
+					metacall_value_destroy(v);
+				}
+
+				return;
+			}
+
+			status = completion;
+			result = v;
+			resume = std::exchange(handle, nullptr);
+			resume_ex = ex;
+		}
+
+		if (resume)
+		{
+			resume_ex->execute(resume);
+		}
+	}
+};
+
+template <typename R>
+R async_result(void *v)
+{
+	if constexpr (std::is_void_v<R>)
+	{
+		(void)v;
+	}
+	else
+	{
+		return value<R>(v).to_value();
+	}
+}
+} /* namespace detail */
+
+// Awaitable asynchronous call, the call starts on construction so many calls can be
+// in flight before awaiting them, and the result is converted to R when it is resumed,
+// for example: long result = co_await metacall::async_call<long>("fn", 3L, 4.0);
+template <typename R>
+class async_call
+{
+public:
+	static_assert(!detail::is_array_v<R> && !detail::is_map_v<R> && !std::is_same_v<std::decay_t<R>, const char *>,
+		"MetaCall asynchronous call result must be a type that owns its contents (use std::string instead of const char *)");
+
+	template <typename... Args>
+	explicit async_call(const std::string &name, Args &&...args) :
+		state(std::make_shared<detail::async_state>())
+	{
+		void *func = metacall_function(name.c_str());
+
+		if (func == NULL)
+		{
+			throw std::runtime_error("MetaCall asynchronous call to '" + name + "' has failed, the function does not exist");
+		}
+
+		constexpr std::size_t size = sizeof...(Args);
+		std::array<value_base, size> value_args = { { detail::to_value_base(std::forward<Args>(args))... } };
+		std::array<void *, size> raw_args;
+
+		for (std::size_t i = 0; i < size; ++i)
+		{
+			raw_args[i] = value_args[i].to_raw();
+		}
+
+		// The context keeps the state alive until the loader completes the call
+		auto *context = new std::shared_ptr<detail::async_state>(state);
+
+		void *future = metacallfv_await_s(func, detail::null_safe_args(raw_args.data()), size, &async_call::resolve, &async_call::reject, context);
+
+		if (future == NULL)
+		{
+			bool started;
+
+			{
+				std::lock_guard<std::mutex> lock(state->mutex);
+
+				started = std::exchange(state->started, true);
+			}
+
+			if (started == false)
+			{
+				delete context;
+
+				throw std::runtime_error("MetaCall asynchronous call to '" + name + "' has failed by returning NULL");
+			}
+		}
+		else
+		{
+			metacall_value_destroy(future);
+		}
+	}
+
+	async_call(const async_call &) = delete;
+	async_call &operator=(const async_call &) = delete;
+
+	async_call(async_call &&other) noexcept :
+		state(std::move(other.state)), token(std::move(other.token)), subscription(std::exchange(other.subscription, 0)) {}
+
+	~async_call()
+	{
+		token.unsubscribe(subscription);
+	}
+
+	// Resume the awaiting coroutine through @ex, it must outlive the call
+	async_call &via(executor &ex) &
+	{
+		std::lock_guard<std::mutex> lock(state->mutex);
+
+		state->ex = &ex;
+
+		return *this;
+	}
+
+	async_call &&via(executor &ex) &&
+	{
+		return std::move(via(ex));
+	}
+
+	// Stop waiting for the call when @cancel is cancelled, the call itself keeps
+	// running in the loader (promises and tasks cannot be aborted) but its result is discarded
+	async_call &with(cancellation_token cancel) &
+	{
+		token.unsubscribe(subscription);
+
+		token = std::move(cancel);
+
+		std::weak_ptr<detail::async_state> weak = state;
+
+		subscription = token.subscribe([weak]() {
+			if (auto shared = weak.lock())
+			{
+				shared->complete(detail::async_state::cancelled, nullptr);
+			}
+		});
+
+		return *this;
+	}
+
+	async_call &&with(cancellation_token cancel) &&
+	{
+		return std::move(with(std::move(cancel)));
+	}
+
+	bool await_ready() const
+	{
+		std::lock_guard<std::mutex> lock(state->mutex);
+
+		return state->status != detail::async_state::pending;
+	}
+
+	bool await_suspend(std::coroutine_handle<> handle)
+	{
+		std::lock_guard<std::mutex> lock(state->mutex);
+
+		if (state->status != detail::async_state::pending)
+		{
+			return false;
+		}
+
+		state->handle = handle;
+
+		return true;
+	}
+
+	R await_resume()
+	{
+		switch (state->status)
+		{
+			case detail::async_state::resolved:
+				return detail::async_result<R>(state->result);
+
+			case detail::async_state::rejected: {
+				struct metacall_exception_type ex;
+
+				// Loaders reject with an exception or, as Python does, with the arguments of the exception
+				if (state->result != nullptr && metacall_error_from_value(state->result, &ex) == 0 && ex.message != nullptr)
+				{
+					throw async_rejected(ex.message);
+				}
+				else if (state->result != nullptr && metacall_value_id(state->result) == METACALL_STRING)
+				{
+					throw async_rejected(metacall_value_to_string(state->result));
+				}
+
+				throw async_rejected("MetaCall asynchronous call has been rejected");
+			}
+
+			case detail::async_state::cancelled:
+				throw async_cancelled();
+
+			default:
+				throw std::runtime_error("MetaCall asynchronous call resumed before completion");
+		}
+	}
+
+	// Value which the call has been resolved or rejected with, owned by the awaitable
+	void *raw() const
+	{
+		std::lock_guard<std::mutex> lock(state->mutex);
+
+		return state->result;
+	}
+
+private:
+	static void *settle(detail::async_state::status_id status, void *result, void *data)
+	{
+		auto *context = static_cast<std::shared_ptr<detail::async_state> *>(data);
+		std::shared_ptr<detail::async_state> shared = std::move(*context);
+
+		{
+			std::lock_guard<std::mutex> lock(shared->mutex);
+
+			shared->started = true;
+		}
+
+		delete context;
+
+		// The result is destroyed by the loader after the callback, so it must be copied
+		shared->complete(status, result != nullptr ? metacall_value_copy(result) : nullptr);
+
+		return NULL;
+	}
+
+	static void *resolve(void *result, void *data)
+	{
+		return settle(detail::async_state::resolved, result, data);
+	}
+
+	static void *reject(void *result, void *data)
+	{
+		return settle(detail::async_state::rejected, result, data);
+	}
+
+	std::shared_ptr<detail::async_state> state;
+	cancellation_token token;
+	std::size_t subscription = 0;
+};
+
+} /* namespace metacall */
+
+#endif /* METACALL_ASYNC_HPP */
@@ -2,6 +2,7 @@ declare module "metacall" {
   export function metacall(name: string, ...args: any): any;
   export function metacallfms(name: string, buffer: string): any;
   export function metacall_await(name: string, ...args: any): any;
+  export function metacall_function(name: string): (...args: any) => any;
   export function metacall_execution_path(tag: string, path: string): number;
   export function metacall_load_from_file(tag: string, paths: string[]): number;
   export function metacall_load_from_file_export(
@@ -186,6 +186,14 @@ const metacall_await = (name, ...args) => {
 	return addon.metacall_await(name, ...args);
 };
 
+const metacall_function = (name) => {
+	if (Object.prototype.toString.call(name) !== '[object String]') {
+		throw Error('Function name should be of string type.');
+	}
+
+	return addon.metacall_function(name);
+};
+
 const metacall_execution_path = (tag, path) => {
 	if (Object.prototype.toString.call(tag) !== '[object String]') {
 		throw Error('Tag should be a string indicating the id of the loader to be used [py, rb, cs, js, node, mock...].');
@@ -342,6 +350,7 @@ const module_exports = {
 	metacall,
 	metacallfms,
 	metacall_await,
+	metacall_function,
 	metacall_inspect,
 	metacall_execution_path,
 	metacall_load_from_file,
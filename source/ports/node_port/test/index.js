@@ -25,6 +25,7 @@ const assert = require('assert');
 const {
 	metacall,
 	metacallfms,
+	metacall_function,
 	metacall_load_from_file,
 	metacall_load_from_file_export,
 	metacall_load_from_memory,
@@ -39,6 +40,7 @@ describe('metacall', () => {
 		it('functions metacall and metacall_load_from_file must be defined', () => {
 			assert.notStrictEqual(metacall, undefined);
 			assert.notStrictEqual(metacallfms, undefined);
+			assert.notStrictEqual(metacall_function, undefined);
 			assert.notStrictEqual(metacall_load_from_memory, undefined);
 			assert.notStrictEqual(metacall_load_from_file, undefined);
 			assert.notStrictEqual(metacall_load_from_memory_export, undefined);
@@ -282,6 +284,21 @@ describe('metacall', () => {
 		}
 	});
 
+	describe('call by handle', () => {
+		it('metacall_function (py)', () => {
+			const s_sum = metacall_function('s_sum');
+			assert.strictEqual(typeof s_sum, 'function');
+			assert.strictEqual(s_sum(2, 2), 4);
+			assert.strictEqual(s_sum(3, 4), 7);
+		});
+		it('metacall_function (rb)', () => {
+			assert.strictEqual(metacall_function('get_second')(5, 12), 12);
+		});
+		it('metacall_function (not found)', () => {
+			assert.throws(() => metacall_function('this_function_does_not_exist'));
+		});
+	});
+
 	describe('call by map', () => {
 		it('metacallfms (py)', () => {
 			assert.strictEqual(metacallfms('s_sum', '{"left":2,"right":2}'), 4);
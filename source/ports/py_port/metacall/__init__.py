@@ -17,4 +17,4 @@
 #	See the License for the specific language governing permissions and
 #	limitations under the License.
 
-from metacall.api import metacall, metacall_load_from_file, metacall_load_from_file_export, metacall_load_from_memory, metacall_load_from_package, metacall_load_from_package_ex, metacall_inspect, metacall_value_create_ptr, metacall_value_reference, metacall_value_dereference
+from metacall.api import metacall, metacall_function, metacall_load_from_file, metacall_load_from_file_export, metacall_load_from_memory, metacall_load_from_package, metacall_load_from_package_ex, metacall_inspect, metacall_value_create_ptr, metacall_value_reference, metacall_value_dereference
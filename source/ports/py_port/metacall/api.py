@@ -23,6 +23,14 @@ import sys
 import json
 import ctypes
 
+def find_files(root_dir, pattern):
+	regex = re.compile(pattern)
+	try:
+		filenames = sorted(os.listdir(root_dir))
+	except OSError:
+		return []
+	return [os.path.join(root_dir, filename) for filename in filenames if regex.search(filename) and os.path.isfile(os.path.join(root_dir, filename))]
+
 def find_files_recursively(root_dir, pattern):
 	regex = re.compile(pattern)
 	matches = []
@@ -61,13 +69,72 @@ def search_paths():
 
 	return platform_install_paths()
 
+# Location manifest generated at build time with the path where the library is installed
+def library_manifest():
+	manifest_path = os.path.join(os.path.dirname(os.path.abspath(__file__)), 'library.json')
+	try:
+		with open(manifest_path, 'r') as f:
+			return json.load(f).get('path')
+	except (OSError, ValueError, AttributeError):
+		return None
+
+def library_cache_path():
+	if sys.platform == 'win32':
+		cache_dir = os.environ.get('LOCALAPPDATA', '')
+	else:
+		cache_dir = os.environ.get('XDG_CACHE_HOME', os.path.join(os.path.expanduser('~'), '.cache'))
+	return os.path.join(cache_dir, 'metacall', 'py_port_library.json')
+
+# The cached path is only valid for the same search paths and while the library exists
+def library_cache_load(search_data):
+	try:
+		with open(library_cache_path(), 'r') as f:
+			cache = json.load(f)
+		if cache.get('paths') == search_data['paths'] and os.path.isfile(cache.get('path', '')):
+			return cache['path']
+	except (OSError, ValueError, AttributeError, TypeError):
+		pass
+	return None
+
+def library_cache_store(search_data, library_path):
+	cache_path = library_cache_path()
+	try:
+		os.makedirs(os.path.dirname(cache_path), exist_ok=True)
+		cache_tmp = cache_path + '.' + str(os.getpid())
+		with open(cache_tmp, 'w') as f:
+			json.dump({ 'paths': search_data['paths'], 'path': library_path }, f)
+		os.replace(cache_tmp, cache_path)
+	except OSError:
+		pass
+
 def find_library():
+	# The library has been specified explicitly, do not search for it
+	library_path = os.environ.get('METACALL_LIBRARY')
+	if library_path:
+		if os.path.isfile(library_path):
+			return library_path
+		raise ImportError('MetaCall library not found in METACALL_LIBRARY: ' + library_path)
+
 	search_data = search_paths()
 
-	for path in search_data['paths']:
-		files = find_files_recursively(path, search_data['name'])
-		if files:
-			return files[0]
+	# Use the path of the installation unless the search paths have been overwritten
+	if not os.environ.get('METACALL_INSTALL_PATH'):
+		library_path = library_manifest()
+		if library_path and os.path.isfile(library_path):
+			return library_path
+
+	library_path = library_cache_load(search_data)
+	if library_path:
+		return library_path
+
+	# Look first in the top level of the search paths, which is where the library is installed,
+	# and walk the whole tree only if it is not there, this is slow for big folders like /usr/local/lib
+	for find in (find_files, find_files_recursively):
+		for path in search_data['paths']:
+			files = find(path, search_data['name'])
+			if files:
+				library_cache_store(search_data, files[0])
+				return files[0]
 
 	raise ImportError("""
 		MetaCall library not found, if you have it in a special folder, define it through METACALL_INSTALL_PATH'.
@@ -135,6 +202,10 @@ def metacall_load_from_memory(tag, buffer):
 def metacall(function_name, *args):
 	return module.metacall(function_name, *args)
 
+# Get a callable to a function, calling it skips the lookup of the function by name
+def metacall_function(function_name):
+	return module.metacall_function(function_name)
+
 # Wrap metacall inspect and transform the json string into a dict
 def metacall_inspect():
 	data = module.metacall_inspect()
@@ -0,0 +1,77 @@
+#!/usr/bin/env python3
+
+import os
+import sys
+import time
+import tempfile
+import unittest
+
+# Load metacall from Python Port path
+abspath = os.path.dirname(os.path.abspath(__file__))
+relpath = '..'
+path = os.path.normpath(os.path.join(abspath, relpath))
+
+# Insert first in the sys path so we make sure we load the correct port
+sys.path.insert(0, path)
+
+from metacall import api
+
+class py_port_import_test(unittest.TestCase):
+
+	iterations = 20
+
+	def setUp(self):
+		self.environ = dict(os.environ)
+		self.cache_dir = tempfile.TemporaryDirectory()
+		os.environ['XDG_CACHE_HOME'] = self.cache_dir.name
+		os.environ.pop('METACALL_LIBRARY', None)
+
+	def tearDown(self):
+		os.environ.clear()
+		os.environ.update(self.environ)
+		self.cache_dir.cleanup()
+
+	def measure(self, setup = None):
+		elapsed = 0.0
+		library_path = None
+		for _ in range(self.iterations):
+			if setup:
+				setup()
+			start = time.perf_counter()
+			library_path = api.find_library()
+			elapsed += time.perf_counter() - start
+		return library_path, elapsed * 1000.0 / self.iterations
+
+	def remove_cache(self):
+		try:
+			os.remove(api.library_cache_path())
+		except OSError:
+			pass
+
+	# Time spent in finding the library when importing the port, for each of the lookup strategies
+	def test_find_library(self):
+		try:
+			scan_path, scan_time = self.measure(self.remove_cache)
+		except ImportError:
+			self.skipTest('MetaCall library not found')
+
+		cache_path, cache_time = self.measure()
+
+		os.environ['METACALL_LIBRARY'] = scan_path
+		env_path, env_time = self.measure()
+
+		self.assertEqual(scan_path, cache_path)
+		self.assertEqual(scan_path, env_path)
+
+		print('\nFind library (scan): ' + '{:.3f}'.format(scan_time) + 'ms')
+		print('Find library (cache): ' + '{:.3f}'.format(cache_time) + 'ms')
+		print('Find library (METACALL_LIBRARY): ' + '{:.3f}'.format(env_time) + 'ms')
+
+	def test_find_library_invalid(self):
+		os.environ['METACALL_LIBRARY'] = os.path.join(self.cache_dir.name, 'does_not_exist')
+
+		with self.assertRaises(ImportError):
+			api.find_library()
+
+if __name__ == '__main__':
+	unittest.main()
@@ -37,6 +37,8 @@
 extern "C" {
 #endif
 
+#include <stdint.h>
+
 typedef void *class_args[];
 
 typedef value (*class_resolve_callback)(value, void *);
@@ -79,6 +81,8 @@ REFLECT_API int class_decrement_reference(klass cls);
 
 REFLECT_API class_impl class_impl_get(klass cls);
 
+REFLECT_API uintptr_t class_id(klass cls);
+
 REFLECT_API object class_new(klass cls, const char *name, constructor ctor, class_args args, size_t argc);
 
 REFLECT_API value class_static_get(klass cls, const char *key);
@@ -95,6 +99,10 @@ REFLECT_API vector class_static_methods(klass cls, const char *key);
 
 REFLECT_API vector class_methods(klass cls, const char *key);
 
+REFLECT_API method class_static_method_single(klass cls, const char *key);
+
+REFLECT_API method class_method_single(klass cls, const char *key);
+
 REFLECT_API method class_static_method(klass cls, const char *key, type_id ret, type_id args[], size_t size);
 
 REFLECT_API method class_method(klass cls, const char *key, type_id ret, type_id args[], size_t size);
@@ -51,12 +51,15 @@ typedef function_return (*function_impl_interface_await)(function, function_impl
 
 typedef void (*function_impl_interface_destroy)(function, function_impl);
 
+typedef signature (*function_impl_interface_discover)(function, function_impl, enum async_id *);
+
 typedef struct function_interface_type
 {
 	function_impl_interface_create create;
 	function_impl_interface_invoke invoke;
 	function_impl_interface_await await;
 	function_impl_interface_destroy destroy;
+	function_impl_interface_discover discover; /* Optional, it returns a new signature and sets the async behavior on first use */
 
 } * function_interface;
 
@@ -115,6 +118,24 @@ REFLECT_API int function_decrement_reference(function func);
 */
 REFLECT_API void function_async(function func, enum async_id async);
 
+/**
+*  @brief
+*    Run the discover callback of the function interface if it has not been
+*    run yet, it allows the loaders to create the functions by name and defer
+*    the introspection of the signature until it is accessed, the signature
+*    and the async identifier accessors call it implicitly; the callback runs
+*    without holding any lock, so concurrent threads may run it at the same
+*    time, the first signature completed is published and the others discarded
+*
+*  @param[in] func
+*    Pointer to the function
+*
+*  @return
+*    Zero on success or if it was already discovered, different from zero on
+*    failure or if it is called from the discover callback of the same function
+*/
+REFLECT_API int function_discover(function func);
+
 /**
 *  @brief
 *    Get the async identifier of a function
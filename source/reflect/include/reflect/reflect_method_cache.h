@@ -0,0 +1,66 @@
+/*
+ *	Reflect Library by Parra Studios
+ *	A library for provide reflection and metadata representation.
+ *
+ *	Copyright (C) 2016 - 2026 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+#ifndef REFLECT_METHOD_CACHE_H
+#define REFLECT_METHOD_CACHE_H 1
+
+#include <reflect/reflect_api.h>
+
+#include <reflect/reflect_class.h>
+#include <reflect/reflect_method.h>
+#include <reflect/reflect_value.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+*  Inline cache of the methods resolved for a method name, it starts monomorphic and it
+*  keeps up to METHOD_CACHE_SIZE (class, argument types) pairs, once it is full the entries
+*  are recycled in round robin, a cache is not thread safe so each caller must own its cache
+*/
+#define METHOD_CACHE_SIZE	   0x04
+#define METHOD_CACHE_ARGS_SIZE 0x08
+
+enum method_cache_kind_id
+{
+	METHOD_CACHE_INSTANCE = 0,
+	METHOD_CACHE_STATIC = 1
+};
+
+struct method_cache_type;
+
+typedef struct method_cache_type *method_cache;
+
+REFLECT_API method_cache method_cache_create(const char *name);
+
+REFLECT_API const char *method_cache_name(method_cache mc);
+
+REFLECT_API size_t method_cache_size(method_cache mc);
+
+REFLECT_API method method_cache_resolve(method_cache mc, klass cls, enum method_cache_kind_id kind, value args[], size_t size);
+
+REFLECT_API void method_cache_destroy(method_cache mc);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* REFLECT_METHOD_CACHE_H */
@@ -45,6 +45,18 @@ typedef void *value;
 
 typedef void (*value_finalizer_cb)(value, void *);
 
+typedef struct value_frame_type *value_frame;
+
+/* -- Member Data -- */
+
+struct value_frame_type
+{
+	void *buffer;	  /* Memory where the values of the frame are allocated, owned by the caller (usually in the stack) */
+	size_t size;	  /* Size in bytes of the buffer */
+	size_t offset;	  /* Position of the next allocation inside the buffer */
+	value_frame prev; /* Frame which was in use before this one in the current thread */
+};
+
 /* -- Methods -- */
 
 /**
@@ -223,6 +235,36 @@ REFLECT_API value value_from(value v, const void *data, size_t bytes);
 */
 REFLECT_API void value_destroy(value v);
 
+/**
+*  @brief
+*    Start allocating the values created by the current thread from @buffer,
+*    the values are bump allocated, if the buffer runs out they are allocated
+*    from the heap as usual; destroying a value of the frame does not free any
+*    memory, the whole frame is released at once when @buffer goes out of scope
+*
+*  @param[in] frame
+*    Frame to be initialized, it must live as long as its values
+*
+*  @param[in] buffer
+*    Memory block where the values will be allocated
+*
+*  @param[in] size
+*    Size in bytes of the memory block @buffer
+*/
+REFLECT_API void value_frame_begin(value_frame frame, void *buffer, size_t size);
+
+/**
+*  @brief
+*    Stop allocating values from @frame and restore the previous frame of
+*    the current thread, the values already allocated remain valid, so this
+*    must be called before the values are passed to code which can retain new
+*    values (like loaders)
+*
+*  @param[in] frame
+*    Frame started with value_frame_begin in the current thread
+*/
+REFLECT_API void value_frame_end(value_frame frame);
+
 #ifdef __cplusplus
 }
 #endif
@@ -27,6 +27,7 @@
 
 #include <reflect/reflect_accessor.h>
 
+#include <threading/threading_atomic.h>
 #include <threading/threading_atomic_ref_count.h>
 
 #include <reflect/reflect_memory_tracker.h>
@@ -39,6 +40,7 @@
 struct class_type
 {
 	char *name;
+	uintptr_t id;
 	enum accessor_type_id accessor;
 	class_impl impl;
 	class_interface interface;
@@ -46,10 +48,17 @@ struct class_type
 	vector constructors;
 	map methods;
 	map static_methods;
+	set methods_single;
+	set static_methods_single;
 	set attributes;
 	set static_attributes;
 };
 
+/* Marks a method name with more than one overload in the single method sets */
+static char class_method_overloaded;
+
+static atomic_uintptr_t class_id_generator = 0;
+
 reflect_memory_tracker(class_stats);
 
 static value class_metadata_name(klass cls);
@@ -61,6 +70,8 @@ static value class_metadata_attributes_impl(const char name[], size_t size, set
 static value class_metadata_attributes(klass cls);
 static value class_metadata_static_attributes(klass cls);
 static method class_get_method_type_safe(vector v, type_id ret, type_id args[], size_t size);
+static int class_register_method_single(set methods_single, method m);
+static method class_method_single_impl(set methods_single, const char *key);
 static void class_constructors_destroy(klass cls);
 
 klass class_create(const char *name, enum accessor_type_id accessor, class_impl impl, class_impl_interface_singleton singleton)
@@ -94,6 +105,7 @@ klass class_create(const char *name, enum accessor_type_id accessor, class_impl
 		cls->name = NULL;
 	}
 
+	cls->id = atomic_fetch_add_explicit(&class_id_generator, 1, memory_order_relaxed) + 1;
 	cls->impl = impl;
 	cls->accessor = accessor;
 	threading_atomic_ref_count_initialize(&cls->ref);
@@ -101,6 +113,8 @@ klass class_create(const char *name, enum accessor_type_id accessor, class_impl
 	cls->constructors = vector_create_type(constructor);
 	cls->methods = map_create(&hash_callback_str, &comparable_callback_str);
 	cls->static_methods = map_create(&hash_callback_str, &comparable_callback_str);
+	cls->methods_single = set_create(&hash_callback_str, &comparable_callback_str);
+	cls->static_methods_single = set_create(&hash_callback_str, &comparable_callback_str);
 	cls->attributes = set_create(&hash_callback_str, &comparable_callback_str);
 	cls->static_attributes = set_create(&hash_callback_str, &comparable_callback_str);
 
@@ -115,6 +129,8 @@ klass class_create(const char *name, enum accessor_type_id accessor, class_impl
 			vector_destroy(cls->constructors);
 			map_destroy(cls->methods);
 			map_destroy(cls->static_methods);
+			set_destroy(cls->methods_single);
+			set_destroy(cls->static_methods_single);
 			set_destroy(cls->attributes);
 			set_destroy(cls->static_attributes);
 			free(cls);
@@ -167,6 +183,11 @@ class_impl class_impl_get(klass cls)
 	return cls->impl;
 }
 
+uintptr_t class_id(klass cls)
+{
+	return cls->id;
+}
+
 const char *class_name(klass cls)
 {
 	if (cls != NULL)
@@ -614,6 +635,33 @@ vector class_methods(klass cls, const char *key)
 	return map_get(cls->methods, (map_key)key);
 }
 
+method class_method_single_impl(set methods_single, const char *key)
+{
+	set_value v = set_get(methods_single, (set_key)key);
+
+	return v == (set_value)&class_method_overloaded ? NULL : (method)v;
+}
+
+method class_static_method_single(klass cls, const char *key)
+{
+	if (cls == NULL || key == NULL)
+	{
+		return NULL;
+	}
+
+	return class_method_single_impl(cls->static_methods_single, key);
+}
+
+method class_method_single(klass cls, const char *key)
+{
+	if (cls == NULL || key == NULL)
+	{
+		return NULL;
+	}
+
+	return class_method_single_impl(cls->methods_single, key);
+}
+
 method class_get_method_type_safe(vector v, type_id ret, type_id args[], size_t size)
 {
 	if (v != NULL)
@@ -639,11 +687,26 @@ method class_get_method_type_safe(vector v, type_id ret, type_id args[], size_t
 
 method class_static_method(klass cls, const char *key, type_id ret, type_id args[], size_t size)
 {
+	method m = class_static_method_single(cls, key);
+
+	/* Avoid allocating the overload list when the method is not overloaded */
+	if (m != NULL)
+	{
+		return signature_compare(method_signature(m), ret, args, size) == 0 ? m : NULL;
+	}
+
 	return class_get_method_type_safe(class_static_methods(cls, key), ret, args, size);
 }
 
 method class_method(klass cls, const char *key, type_id ret, type_id args[], size_t size)
 {
+	method m = class_method_single(cls, key);
+
+	if (m != NULL)
+	{
+		return signature_compare(method_signature(m), ret, args, size) == 0 ? m : NULL;
+	}
+
 	return class_get_method_type_safe(class_methods(cls, key), ret, args, size);
 }
 
@@ -679,6 +742,21 @@ int class_register_constructor(klass cls, constructor ctor)
 	return 0;
 }
 
+int class_register_method_single(set methods_single, method m)
+{
+	const char *key = method_name(m);
+
+	if (set_get(methods_single, (set_key)key) == NULL)
+	{
+		return set_insert(methods_single, (set_key)key, m);
+	}
+
+	/* The method is overloaded, sets do not support updating the value so the entry is replaced */
+	(void)set_remove(methods_single, (set_key)key);
+
+	return set_insert(methods_single, (set_key)key, (set_value)&class_method_overloaded);
+}
+
 int class_register_static_method(klass cls, method m)
 {
 	if (cls == NULL || m == NULL)
@@ -686,7 +764,12 @@ int class_register_static_method(klass cls, method m)
 		return 1;
 	}
 
-	return map_insert(cls->static_methods, (map_key)method_name(m), m);
+	if (map_insert(cls->static_methods, (map_key)method_name(m), m) != 0)
+	{
+		return 1;
+	}
+
+	return class_register_method_single(cls->static_methods_single, m);
 }
 
 int class_register_method(klass cls, method m)
@@ -696,7 +779,12 @@ int class_register_method(klass cls, method m)
 		return 1;
 	}
 
-	return map_insert(cls->methods, (map_key)method_name(m), m);
+	if (map_insert(cls->methods, (map_key)method_name(m), m) != 0)
+	{
+		return 1;
+	}
+
+	return class_register_method_single(cls->methods_single, m);
 }
 
 int class_register_static_attribute(klass cls, attribute attr)
@@ -778,12 +866,20 @@ void class_destroy(klass cls)
 {
 	if (cls != NULL)
 	{
-		if (class_decrement_reference(cls) != 0)
+		int last;
+
+		if (threading_atomic_ref_count_release(&cls->ref, &last) != 0)
 		{
 			log_write("metacall", LOG_LEVEL_ERROR, "Invalid reference counter in class: %s", cls->name ? cls->name : "<anonymous>");
+
+			last = 1;
+		}
+		else
+		{
+			reflect_memory_tracker_decrement(class_stats);
 		}
 
-		if (threading_atomic_ref_count_load(&cls->ref) == 0)
+		if (last == 1)
 		{
 			/* TODO: Disable logs here until log is completely thread safe and async signal safe */
 
@@ -855,6 +951,16 @@ void class_destroy(klass cls)
 				map_destroy(cls->static_methods);
 			}
 
+			if (cls->methods_single != NULL)
+			{
+				set_destroy(cls->methods_single);
+			}
+
+			if (cls->static_methods_single != NULL)
+			{
+				set_destroy(cls->static_methods_single);
+			}
+
 			if (cls->attributes != NULL)
 			{
 				set_destroy(cls->attributes);
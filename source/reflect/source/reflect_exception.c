@@ -303,12 +303,20 @@ void exception_destroy(exception ex)
 {
 	if (ex != NULL)
 	{
-		if (exception_decrement_reference(ex) != 0)
+		int last;
+
+		if (threading_atomic_ref_count_release(&ex->ref, &last) != 0)
 		{
 			log_write("metacall", LOG_LEVEL_ERROR, "Invalid reference counter in exception: %s", ex->label ? ex->label : "<anonymous>");
+
+			last = 1;
+		}
+		else
+		{
+			reflect_memory_tracker_decrement(exception_stats);
 		}
 
-		if (threading_atomic_ref_count_load(&ex->ref) == 0)
+		if (last == 1)
 		{
 			if (ex->message != NULL)
 			{
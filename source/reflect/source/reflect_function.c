@@ -21,28 +21,48 @@
 #include <reflect/reflect_function.h>
 #include <reflect/reflect_value_type.h>
 
+#include <threading/threading_atomic.h>
 #include <threading/threading_atomic_ref_count.h>
+#include <threading/threading_mutex.h>
+
+#include <portability/portability_compiler.h>
 
 #include <reflect/reflect_memory_tracker.h>
 
+#include <adt/adt_intern.h>
+
 #include <log/log.h>
 
 #include <stdlib.h>
 #include <string.h>
 
+enum function_discover_id
+{
+	FUNCTION_DISCOVER_PENDING = 0,
+	FUNCTION_DISCOVER_DONE = 1,
+	FUNCTION_DISCOVER_FAILED = 2
+};
+
 struct function_type
 {
-	char *name;
+	const char *name;
 	signature s;
 	function_impl impl;
 	function_interface interface;
 	threading_atomic_ref_count_type ref;
 	enum async_id async;
 	void *data;
+	atomic_int discovered;				 /* State of the discover callback (function_discover_id), the signature is only published once */
+	threading_mutex_type discover_mutex; /* Serializes the publication of the signature, it is never held while running the callback */
 };
 
 reflect_memory_tracker(function_stats);
 
+#if defined(PORTABILITY_THREAD_LOCAL)
+/* Function whose discover callback is running in the current thread, its signature is not complete yet */
+static PORTABILITY_THREAD_LOCAL function function_discover_current = NULL;
+#endif
+
 static value function_metadata_name(function func);
 static value function_metadata_async(function func);
 static value function_metadata_signature(function func);
@@ -58,9 +78,7 @@ function function_create(const char *name, size_t args_count, function_impl impl
 
 	if (name != NULL)
 	{
-		size_t func_name_size = strlen(name) + 1;
-
-		func->name = malloc(sizeof(char) * func_name_size);
+		func->name = intern_string(name);
 
 		if (func->name == NULL)
 		{
@@ -68,8 +86,6 @@ function function_create(const char *name, size_t args_count, function_impl impl
 
 			goto name_error;
 		}
-
-		memcpy(func->name, name, func_name_size);
 	}
 	else
 	{
@@ -93,6 +109,22 @@ function function_create(const char *name, size_t args_count, function_impl impl
 
 	func->interface = singleton ? singleton() : NULL;
 
+	if (func->interface == NULL || func->interface->discover == NULL)
+	{
+		atomic_store_explicit(&func->discovered, FUNCTION_DISCOVER_DONE, memory_order_relaxed);
+	}
+	else
+	{
+		atomic_store_explicit(&func->discovered, FUNCTION_DISCOVER_PENDING, memory_order_relaxed);
+
+		if (threading_mutex_initialize(&func->discover_mutex) != 0)
+		{
+			log_write("metacall", LOG_LEVEL_ERROR, "Invalid function (%s) discover mutex initialization", func->name);
+
+			goto discover_mutex_error;
+		}
+	}
+
 	if (func->interface != NULL && func->interface->create != NULL)
 	{
 		if (func->interface->create(func, impl) != 0)
@@ -108,12 +140,14 @@ function function_create(const char *name, size_t args_count, function_impl impl
 	return func;
 
 interface_create_error:
-	signature_destroy(func->s);
-signature_error:
-	if (func->name != NULL)
+	if (atomic_load_explicit(&func->discovered, memory_order_relaxed) == FUNCTION_DISCOVER_PENDING)
 	{
-		free(func->name);
+		threading_mutex_destroy(&func->discover_mutex);
 	}
+discover_mutex_error:
+	threading_atomic_ref_count_destroy(&func->ref);
+	signature_destroy(func->s);
+signature_error:
 name_error:
 	free(func);
 
@@ -159,8 +193,88 @@ void function_async(function func, enum async_id async)
 	func->async = async;
 }
 
+int function_discover(function func)
+{
+	enum async_id async = SYNCHRONOUS;
+	signature s;
+	int discovered;
+
+	if (func == NULL)
+	{
+		return 1;
+	}
+
+	discovered = atomic_load_explicit(&func->discovered, memory_order_acquire);
+
+	if (discovered != FUNCTION_DISCOVER_PENDING)
+	{
+		return discovered == FUNCTION_DISCOVER_FAILED;
+	}
+
+#if defined(PORTABILITY_THREAD_LOCAL)
+	/* The callback may access to the function again, the signature is not discovered until it returns */
+	if (function_discover_current == func)
+	{
+		return 1;
+	}
+	else
+	{
+		function prev = function_discover_current;
+
+		function_discover_current = func;
+
+		s = func->interface->discover(func, func->impl, &async);
+
+		function_discover_current = prev;
+	}
+#else
+	s = func->interface->discover(func, func->impl, &async);
+#endif
+
+	/* The callback runs without the lock, because the loaders may take their own locks in it (like the GIL),
+	so other threads can discover the same function meanwhile, only the first complete signature is published */
+	threading_mutex_lock(&func->discover_mutex);
+
+	discovered = atomic_load_explicit(&func->discovered, memory_order_relaxed);
+
+	if (discovered == FUNCTION_DISCOVER_PENDING)
+	{
+		if (s == NULL)
+		{
+			log_write("metacall", LOG_LEVEL_ERROR, "Invalid function (%s) discover callback <%p>", func->name, func->interface->discover);
+
+			discovered = FUNCTION_DISCOVER_FAILED;
+		}
+		else
+		{
+			signature undiscovered = func->s;
+
+			func->s = s;
+			func->async = async;
+
+			/* The signature created with the function is not accessed until the discover has been done */
+			s = undiscovered;
+
+			discovered = FUNCTION_DISCOVER_DONE;
+		}
+
+		atomic_store_explicit(&func->discovered, discovered, memory_order_release);
+	}
+
+	threading_mutex_unlock(&func->discover_mutex);
+
+	if (s != NULL)
+	{
+		signature_destroy(s);
+	}
+
+	return discovered == FUNCTION_DISCOVER_FAILED;
+}
+
 enum async_id function_async_id(function func)
 {
+	(void)function_discover(func);
+
 	return func->async;
 }
 
@@ -193,6 +307,8 @@ signature function_signature(function func)
 {
 	if (func != NULL)
 	{
+		(void)function_discover(func);
+
 		return func->s;
 	}
 
@@ -223,7 +339,7 @@ value function_metadata_name(function func)
 		return NULL;
 	}
 
-	name_array[1] = value_create_string(func->name, strlen(func->name));
+	name_array[1] = value_create_string(func->name, intern_length(func->name));
 
 	if (name_array[1] == NULL)
 	{
@@ -259,7 +375,7 @@ value function_metadata_async(function func)
 		return NULL;
 	}
 
-	async_array[1] = value_create_bool(func->async == SYNCHRONOUS ? 0L : 1L);
+	async_array[1] = value_create_bool(function_async_id(func) == SYNCHRONOUS ? 0L : 1L);
 
 	if (async_array[1] == NULL)
 	{
@@ -295,7 +411,7 @@ value function_metadata_signature(function func)
 		return NULL;
 	}
 
-	sig_array[1] = signature_metadata(func->s);
+	sig_array[1] = signature_metadata(function_signature(func));
 
 	if (sig_array[1] == NULL)
 	{
@@ -605,6 +721,12 @@ function_return function_call(function func, function_args args, size_t size)
 	#endif
 	*/
 
+	/* Run the discover before the invoke so the loader does not introspect while it holds its own locks */
+	if (function_discover(func) != 0)
+	{
+		return NULL;
+	}
+
 	return func->interface->invoke(func, func->impl, args, size);
 }
 
@@ -627,6 +749,11 @@ function_return function_await(function func, function_args args, size_t size, f
 			}
 			*/
 
+			if (function_discover(func) != 0)
+			{
+				return NULL;
+			}
+
 			return func->interface->await(func, func->impl, args, size, resolve_callback, reject_callback, context);
 		}
 	}
@@ -643,12 +770,22 @@ void function_destroy(function func)
 {
 	if (func != NULL)
 	{
-		if (function_decrement_reference(func) != 0)
+		int last;
+
+		if (threading_atomic_ref_count_release(&func->ref, &last) != 0)
 		{
 			log_write("metacall", LOG_LEVEL_ERROR, "Invalid reference counter in function: %s", func->name ? func->name : "<anonymous>");
+
+			/* Nobody else holds a reference, so the caller owns it */
+			last = 1;
+		}
+		else
+		{
+			reflect_memory_tracker_decrement(function_stats);
 		}
 
-		if (threading_atomic_ref_count_load(&func->ref) == 0)
+		/* Only the caller that released the last reference destroys it, checking the counter again would let two callers free it */
+		if (last == 1)
 		{
 			/* TODO: Disable logs here until log is completely thread safe and async signal safe */
 
@@ -730,13 +867,13 @@ void function_destroy(function func)
 
 			signature_destroy(func->s);
 
-			if (func->name != NULL)
+			threading_atomic_ref_count_destroy(&func->ref);
+
+			if (func->interface != NULL && func->interface->discover != NULL)
 			{
-				free(func->name);
+				threading_mutex_destroy(&func->discover_mutex);
 			}
 
-			threading_atomic_ref_count_destroy(&func->ref);
-
 			free(func);
 
 			reflect_memory_tracker_deallocation(function_stats);
@@ -0,0 +1,256 @@
+/*
+ *	Reflect Library by Parra Studios
+ *	A library for provide reflection and metadata representation.
+ *
+ *	Copyright (C) 2016 - 2026 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+#include <reflect/reflect_method_cache.h>
+#include <reflect/reflect_value_type.h>
+
+#include <log/log.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+struct method_cache_entry_type
+{
+	uintptr_t id; /* Class id, it is used instead of the class pointer because the address can be reused */
+	enum method_cache_kind_id kind;
+	int generic; /* The method is not overloaded, so it matches any argument types */
+	size_t size;
+	type_id args[METHOD_CACHE_ARGS_SIZE];
+	method m;
+};
+
+struct method_cache_type
+{
+	char *name;
+	size_t count;
+	size_t next;
+	struct method_cache_entry_type entries[METHOD_CACHE_SIZE];
+};
+
+static int method_cache_entry_match(struct method_cache_entry_type *entry, uintptr_t id, enum method_cache_kind_id kind, value args[], size_t size);
+static method method_cache_overload(vector v, value args[], size_t size);
+
+method_cache method_cache_create(const char *name)
+{
+	method_cache mc;
+	size_t size;
+
+	if (name == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid method cache name");
+		return NULL;
+	}
+
+	mc = malloc(sizeof(struct method_cache_type));
+
+	if (mc == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid method cache allocation");
+		return NULL;
+	}
+
+	size = strlen(name) + 1;
+
+	mc->name = malloc(sizeof(char) * size);
+
+	if (mc->name == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid method cache name allocation <%s>", name);
+		free(mc);
+		return NULL;
+	}
+
+	memcpy(mc->name, name, size);
+
+	mc->count = 0;
+	mc->next = 0;
+
+	return mc;
+}
+
+const char *method_cache_name(method_cache mc)
+{
+	if (mc == NULL)
+	{
+		return NULL;
+	}
+
+	return mc->name;
+}
+
+size_t method_cache_size(method_cache mc)
+{
+	if (mc == NULL)
+	{
+		return 0;
+	}
+
+	return mc->count;
+}
+
+int method_cache_entry_match(struct method_cache_entry_type *entry, uintptr_t id, enum method_cache_kind_id kind, value args[], size_t size)
+{
+	size_t iterator;
+
+	if (entry->id != id || entry->kind != kind)
+	{
+		return 1;
+	}
+
+	if (entry->generic == 0)
+	{
+		if (entry->size != size)
+		{
+			return 1;
+		}
+
+		for (iterator = 0; iterator < size; ++iterator)
+		{
+			if (entry->args[iterator] != value_type_id(args[iterator]))
+			{
+				return 1;
+			}
+		}
+	}
+
+	return 0;
+}
+
+method method_cache_overload(vector v, value args[], size_t size)
+{
+	method result = NULL;
+
+	if (v != NULL)
+	{
+		size_t iterator, methods_size = vector_size(v);
+
+		for (iterator = 0; iterator < methods_size && result == NULL; ++iterator)
+		{
+			method m = vector_at_type(v, iterator, method);
+			signature s = method_signature(m);
+			size_t arg;
+
+			if (signature_count(s) != size)
+			{
+				continue;
+			}
+
+			/* Untyped parameters accept any argument, the return type is not taken into account */
+			for (arg = 0; arg < size; ++arg)
+			{
+				type t = signature_get_type(s, arg);
+
+				if (t != NULL && type_index(t) != value_type_id(args[arg]))
+				{
+					break;
+				}
+			}
+
+			if (arg == size)
+			{
+				result = m;
+			}
+		}
+
+		vector_destroy(v);
+	}
+
+	return result;
+}
+
+method method_cache_resolve(method_cache mc, klass cls, enum method_cache_kind_id kind, value args[], size_t size)
+{
+	struct method_cache_entry_type *entry;
+	uintptr_t id;
+	method m;
+	int generic = 1;
+	size_t iterator;
+
+	if (mc == NULL || cls == NULL)
+	{
+		return NULL;
+	}
+
+	id = class_id(cls);
+
+	/* Fast path, the method has already been resolved for this class and argument types */
+	for (iterator = 0; iterator < mc->count; ++iterator)
+	{
+		entry = &mc->entries[iterator];
+
+		if (method_cache_entry_match(entry, id, kind, args, size) == 0)
+		{
+			return entry->m;
+		}
+	}
+
+	/* Slow path, resolve the method and cache it */
+	m = (kind == METHOD_CACHE_STATIC) ? class_static_method_single(cls, mc->name) : class_method_single(cls, mc->name);
+
+	if (m == NULL)
+	{
+		vector v = (kind == METHOD_CACHE_STATIC) ? class_static_methods(cls, mc->name) : class_methods(cls, mc->name);
+
+		m = method_cache_overload(v, args, size);
+
+		/* Overloads called with too many arguments are resolved on each call */
+		if (m == NULL || size > METHOD_CACHE_ARGS_SIZE)
+		{
+			return m;
+		}
+
+		generic = 0;
+	}
+
+	if (mc->count < METHOD_CACHE_SIZE)
+	{
+		entry = &mc->entries[mc->count++];
+	}
+	else
+	{
+		entry = &mc->entries[mc->next];
+		mc->next = (mc->next + 1) % METHOD_CACHE_SIZE;
+	}
+
+	entry->id = id;
+	entry->kind = kind;
+	entry->generic = generic;
+	entry->size = size;
+	entry->m = m;
+
+	if (generic == 0)
+	{
+		for (iterator = 0; iterator < size; ++iterator)
+		{
+			entry->args[iterator] = value_type_id(args[iterator]);
+		}
+	}
+
+	return m;
+}
+
+void method_cache_destroy(method_cache mc)
+{
+	if (mc != NULL)
+	{
+		free(mc->name);
+		free(mc);
+	}
+}
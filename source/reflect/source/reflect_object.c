@@ -148,6 +148,16 @@ object_impl object_impl_get(object obj)
 	return obj->impl;
 }
 
+klass object_class(object obj)
+{
+	if (obj == NULL)
+	{
+		return NULL;
+	}
+
+	return obj->cls;
+}
+
 vector object_methods(object obj, const char *key)
 {
 	if (obj == NULL || key == NULL)
@@ -393,12 +403,20 @@ void object_destroy(object obj)
 {
 	if (obj != NULL)
 	{
-		if (object_decrement_reference(obj) != 0)
+		int last;
+
+		if (threading_atomic_ref_count_release(&obj->ref, &last) != 0)
 		{
 			log_write("metacall", LOG_LEVEL_ERROR, "Invalid reference counter in object: %s", obj->name ? obj->name : "<anonymous>");
+
+			last = 1;
+		}
+		else
+		{
+			reflect_memory_tracker_decrement(object_stats);
 		}
 
-		if (threading_atomic_ref_count_load(&obj->ref) == 0)
+		if (last == 1)
 		{
 			/* TODO: Disable logs here until log is completely thread safe and async signal safe */
 
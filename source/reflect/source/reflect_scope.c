@@ -22,6 +22,7 @@
 #include <reflect/reflect_scope.h>
 #include <reflect/reflect_value_type.h>
 
+#include <adt/adt_intern.h>
 #include <adt/adt_set.h>
 #include <adt/adt_vector.h>
 
@@ -33,7 +34,7 @@
 struct scope_type
 {
 	char *name;		   /**< Scope name */
-	set objects;	   /**< Map of scope objects indexed by name string */
+	set objects;	   /**< Map of scope objects indexed by interned name string */
 	vector call_stack; /**< Scope call stack */
 };
 
@@ -68,7 +69,7 @@ scope scope_create(const char *name)
 
 			memcpy(sp->name, name, sp_name_size);
 
-			sp->objects = set_create(&hash_callback_str, &comparable_callback_str);
+			sp->objects = set_create(&hash_callback_intern, &comparable_callback_ptr);
 
 			if (sp->objects == NULL)
 			{
@@ -151,14 +152,23 @@ int scope_define(scope sp, const char *key, value val)
 {
 	if (sp != NULL && key != NULL && val != NULL)
 	{
-		if (set_contains(sp->objects, (set_key)key) == 0)
+		const char *interned = intern_string(key);
+
+		if (interned == NULL)
+		{
+			log_write("metacall", LOG_LEVEL_ERROR, "Scope failed to define a object with key '%s', the key could not be interned", key);
+
+			return 1;
+		}
+
+		if (set_contains(sp->objects, (set_key)interned) == 0)
 		{
-			log_write("metacall", LOG_LEVEL_ERROR, "Scope failed to define a object with key '%s', this key as already been defined", (char *)key);
+			log_write("metacall", LOG_LEVEL_ERROR, "Scope failed to define a object with key '%s', this key as already been defined", interned);
 
 			return 1;
 		}
 
-		return set_insert(sp->objects, (set_key)key, (set_value)val);
+		return set_insert(sp->objects, (set_key)interned, (set_value)val);
 	}
 
 	return 1;
@@ -400,7 +410,13 @@ value scope_get(scope sp, const char *key)
 {
 	if (sp != NULL && key != NULL)
 	{
-		return (value)set_get(sp->objects, (set_key)key);
+		/* Names that have never been interned cannot be defined in any scope */
+		const char *interned = intern_find(key);
+
+		if (interned != NULL)
+		{
+			return (value)set_get(sp->objects, (set_key)interned);
+		}
 	}
 
 	return NULL;
@@ -410,7 +426,12 @@ value scope_undef(scope sp, const char *key)
 {
 	if (sp != NULL && key != NULL)
 	{
-		return (value)set_remove(sp->objects, (set_key)key);
+		const char *interned = intern_find(key);
+
+		if (interned != NULL)
+		{
+			return (value)set_remove(sp->objects, (set_key)interned);
+		}
 	}
 
 	return NULL;
@@ -21,19 +21,22 @@
 #include <reflect/reflect_signature.h>
 #include <reflect/reflect_value_type.h>
 
-#include <adt/adt_set.h>
+#include <adt/adt_intern.h>
 
 #include <log/log.h>
 
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 
 #define REFLECT_SIGNATURE_INVALID_INDEX ((size_t)~0)
 
+/* Signatures are allocated in a single block: the signature header, followed by the array of
+nodes (one per argument), followed by the name index, which is an open addressing table that
+stores the argument position plus one (zero means empty slot) */
 typedef struct signature_node_type
 {
-	size_t index;
-	char *name;
+	const char *name;
 	type t;
 
 } * signature_node;
@@ -41,14 +44,24 @@ typedef struct signature_node_type
 struct signature_type
 {
 	type ret;
-	set map;
 	size_t count;
+	size_t named;		/* Amount of nodes with a name, the index is only built once all of them have one */
+	size_t capacity;	/* Amount of slots of the name index, it is always zero or power of two */
+	unsigned int shift; /* Shift applied to the name hash, chosen so the index is a perfect hash when possible */
 };
 
 static signature_node signature_head(signature s);
 
 static signature_node signature_at(signature s, size_t index);
 
+static size_t signature_index_capacity(size_t count);
+
+static size_t signature_size(size_t count, size_t capacity);
+
+static uint32_t *signature_index(signature s);
+
+static void signature_index_build(signature s);
+
 static value signature_metadata_return(signature s);
 
 static value signature_metadata_args_map_name(const char *name);
@@ -79,58 +92,163 @@ signature_node signature_at(signature s, size_t index)
 	return NULL;
 }
 
-signature signature_create(size_t count)
+size_t signature_index_capacity(size_t count)
 {
-	signature s = malloc(sizeof(struct signature_type) + sizeof(struct signature_node_type) * count);
+	size_t capacity = 1;
 
-	if (s != NULL)
+	if (count == 0)
 	{
-		size_t index;
+		return 0;
+	}
 
-		s->map = set_create(&hash_callback_str, &comparable_callback_str);
+	/* Keep the load factor of the index under 1/2 */
+	while (capacity < count * 2)
+	{
+		capacity <<= 1;
+	}
+
+	return capacity;
+}
 
-		if (s->map == NULL)
+size_t signature_size(size_t count, size_t capacity)
+{
+	return sizeof(struct signature_type) + sizeof(struct signature_node_type) * count + sizeof(uint32_t) * capacity;
+}
+
+uint32_t *signature_index(signature s)
+{
+	return (uint32_t *)(signature_head(s) + s->count);
+}
+
+void signature_index_build(signature s)
+{
+	uint32_t *slots = signature_index(s);
+	const size_t mask = s->capacity - 1;
+	unsigned int shift, shift_max = 0;
+	size_t index;
+
+	if (s->capacity == 0)
+	{
+		return;
+	}
+
+	while ((s->capacity << shift_max) != 0 && shift_max < (sizeof(hash) * 8) - 1)
+	{
+		++shift_max;
+	}
+
+	/* Look for a shift of the hash that maps each name into a different slot, so a lookup
+	is resolved with a single probe and a pointer comparison */
+	for (shift = 0; shift <= shift_max; ++shift)
+	{
+		memset(slots, 0, sizeof(uint32_t) * s->capacity);
+
+		for (index = 0; index < s->count; ++index)
 		{
-			log_write("metacall", LOG_LEVEL_ERROR, "Invalid signature set allocation");
+			signature_node node = signature_at(s, index);
 
-			free(s);
+			if (node->name != NULL)
+			{
+				size_t slot = (size_t)(intern_hash(node->name) >> shift) & mask;
 
-			return NULL;
+				if (slots[slot] != 0)
+				{
+					break;
+				}
+
+				slots[slot] = (uint32_t)(index + 1);
+			}
+		}
+
+		if (index == s->count)
+		{
+			s->shift = shift;
+
+			return;
+		}
+	}
+
+	/* There is no perfect hash (for example, with duplicated names), fall back to linear probing */
+	memset(slots, 0, sizeof(uint32_t) * s->capacity);
+
+	s->shift = 0;
+
+	for (index = 0; index < s->count; ++index)
+	{
+		signature_node node = signature_at(s, index);
+
+		if (node->name != NULL)
+		{
+			size_t slot = (size_t)intern_hash(node->name) & mask;
+
+			while (slots[slot] != 0)
+			{
+				slot = (slot + 1) & mask;
+			}
+
+			slots[slot] = (uint32_t)(index + 1);
 		}
+	}
+}
+
+signature signature_create(size_t count)
+{
+	size_t capacity = signature_index_capacity(count);
+
+	signature s;
+
+	if (count > UINT32_MAX - 1)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid signature size");
+
+		return NULL;
+	}
+
+	s = malloc(signature_size(count, capacity));
+
+	if (s != NULL)
+	{
+		size_t index;
 
 		s->ret = NULL;
 
 		s->count = count;
 
+		s->named = 0;
+
+		s->capacity = capacity;
+
+		s->shift = 0;
+
 		for (index = 0; index < count; ++index)
 		{
 			signature_node node = signature_at(s, index);
 
-			if (node != NULL)
-			{
-				node->index = REFLECT_SIGNATURE_INVALID_INDEX;
-				node->name = NULL;
-				node->t = NULL;
-			}
+			node->name = NULL;
+			node->t = NULL;
 		}
 
+		memset(signature_index(s), 0, sizeof(uint32_t) * capacity);
+
 		return s;
 	}
 
+	log_write("metacall", LOG_LEVEL_ERROR, "Invalid signature allocation");
+
 	return NULL;
 }
 
 signature signature_resize(signature s, size_t count)
 {
 	signature new_s;
-	size_t index;
+	size_t index, capacity = signature_index_capacity(count);
 
-	if (s == NULL)
+	if (s == NULL || count > UINT32_MAX - 1)
 	{
 		return NULL;
 	}
 
-	new_s = realloc(s, sizeof(struct signature_type) + sizeof(struct signature_node_type) * count);
+	new_s = realloc(s, signature_size(count, capacity));
 
 	if (new_s == NULL)
 	{
@@ -139,18 +257,36 @@ signature signature_resize(signature s, size_t count)
 
 	for (index = new_s->count; index < count; ++index)
 	{
-		signature_node node = signature_at(new_s, index);
+		signature_node node = &signature_head(new_s)[index];
 
-		if (node != NULL)
+		node->name = NULL;
+		node->t = NULL;
+	}
+
+	if (count < new_s->count)
+	{
+		/* Names of the nodes removed by shrinking are not counted anymore */
+		new_s->named = 0;
+
+		for (index = 0; index < count; ++index)
 		{
-			node->index = REFLECT_SIGNATURE_INVALID_INDEX;
-			node->name = NULL;
-			node->t = NULL;
+			if (signature_head(new_s)[index].name != NULL)
+			{
+				++new_s->named;
+			}
 		}
 	}
 
 	new_s->count = count;
 
+	new_s->capacity = capacity;
+
+	/* The index is placed after the nodes, so it must be rebuilt when the amount of nodes changes */
+	if (new_s->named == count)
+	{
+		signature_index_build(new_s);
+	}
+
 	return new_s;
 }
 
@@ -166,13 +302,41 @@ size_t signature_count(signature s)
 
 size_t signature_get_index(signature s, const char *name)
 {
-	if (s != NULL && name != NULL)
+	if (s != NULL && name != NULL && s->capacity > 0)
 	{
-		signature_node node = set_get(s->map, (set_key)name);
+		/* Argument names are interned, so if the name has not been interned, it cannot be in the signature */
+		const char *interned = intern_find(name);
 
-		if (node != NULL)
+		if (interned != NULL && s->named != s->count)
 		{
-			return node->index;
+			size_t index;
+
+			/* The index is not built until every argument has a name, search the nodes instead */
+			for (index = 0; index < s->count; ++index)
+			{
+				if (signature_head(s)[index].name == interned)
+				{
+					return index;
+				}
+			}
+		}
+		else if (interned != NULL)
+		{
+			const uint32_t *slots = signature_index(s);
+			const size_t mask = s->capacity - 1;
+			size_t slot = (size_t)(intern_hash(interned) >> s->shift) & mask;
+
+			while (slots[slot] != 0)
+			{
+				const size_t index = (size_t)slots[slot] - 1;
+
+				if (signature_head(s)[index].name == interned)
+				{
+					return index;
+				}
+
+				slot = (slot + 1) & mask;
+			}
 		}
 	}
 
@@ -219,39 +383,31 @@ void signature_set(signature s, size_t index, const char *name, type t)
 	{
 		signature_node node = signature_at(s, index);
 
-		size_t name_size = strlen(name) + 1;
-
-		char *name_node = malloc(sizeof(char) * name_size);
+		const char *interned = intern_string(name);
 
-		if (name_node == NULL)
+		if (interned == NULL)
 		{
 			log_write("metacall", LOG_LEVEL_ERROR, "Invalid signature name allocation");
 
 			return;
 		}
 
-		if (node->name != NULL)
-		{
-			free(node->name);
-		}
-
-		node->name = name_node;
-
-		memcpy(node->name, name, name_size);
-
 		node->t = t;
 
-		node->index = index;
-
-		if (set_insert(s->map, (set_key)node->name, (set_value)node) != 0)
+		if (node->name != interned)
 		{
-			free(node->name);
+			if (node->name == NULL)
+			{
+				++s->named;
+			}
 
-			node->index = REFLECT_SIGNATURE_INVALID_INDEX;
-			node->name = NULL;
-			node->t = NULL;
+			node->name = interned;
 
-			log_write("metacall", LOG_LEVEL_ERROR, "Invalid signature set insertion");
+			/* Build the index once after the last name is set, and rebuild it if a name changes later */
+			if (s->named == s->count)
+			{
+				signature_index_build(s);
+			}
 		}
 	}
 }
@@ -365,7 +521,7 @@ value signature_metadata_args_map_name(const char *name)
 		return NULL;
 	}
 
-	v_array[1] = name ? value_create_string(name, strlen(name)) : value_create_string("", 0);
+	v_array[1] = name ? value_create_string(name, intern_length(name)) : value_create_string("", 0);
 
 	if (v_array[1] == NULL)
 	{
@@ -516,20 +672,6 @@ void signature_destroy(signature s)
 {
 	if (s != NULL)
 	{
-		size_t index;
-
-		for (index = 0; index < s->count; ++index)
-		{
-			signature_node node = signature_at(s, index);
-
-			if (node != NULL && node->name != NULL)
-			{
-				free(node->name);
-			}
-		}
-
-		set_destroy(s->map);
-
 		free(s);
 	}
 }
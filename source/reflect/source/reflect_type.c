@@ -21,13 +21,15 @@
 #include <reflect/reflect_type.h>
 #include <reflect/reflect_value_type.h>
 
+#include <adt/adt_intern.h>
+
 #include <stdlib.h>
 #include <string.h>
 
 struct type_type
 {
 	type_id id;
-	char *name;
+	const char *name;
 	type_impl impl;
 	type_interface interface;
 };
@@ -42,9 +44,7 @@ type type_create(type_id id, const char *name, type_impl impl, type_impl_interfa
 
 		if (t)
 		{
-			size_t name_size = strlen(name) + 1;
-
-			t->name = malloc(sizeof(char) * name_size);
+			t->name = intern_string(name);
 
 			if (t->name == NULL)
 			{
@@ -55,8 +55,6 @@ type type_create(type_id id, const char *name, type_impl impl, type_impl_interfa
 				return NULL;
 			}
 
-			memcpy(t->name, name, name_size);
-
 			t->id = id;
 
 			t->impl = impl;
@@ -258,8 +256,6 @@ void type_destroy(type t)
 			t->interface->destroy(t, t->impl);
 		}
 
-		free(t->name);
-
 		free(t);
 	}
 }
@@ -22,9 +22,15 @@
 
 #include <reflect/reflect_value.h>
 
+#include <portability/portability_compiler.h>
+
 #include <stdint.h>
 #include <string.h>
 
+/* -- Definitions -- */
+
+#define VALUE_FRAME_ALIGNMENT ((uintptr_t)0x10)
+
 /* -- Forward Declarations -- */
 
 struct value_impl_type;
@@ -47,8 +53,14 @@ struct value_impl_type
 /* -- Private Member Data -- */
 
 static const char value_impl_magic_alloc[] = "value_impl_magic_alloc";
+static const char value_impl_magic_frame[] = "value_impl_magic_frame";
 static const char value_impl_magic_free[] = "value_impl_magic_free";
 
+#if defined(PORTABILITY_THREAD_LOCAL)
+/* Frame where the values created by the current thread are allocated, null when they are allocated from the heap */
+static PORTABILITY_THREAD_LOCAL value_frame value_frame_current = NULL;
+#endif
+
 /* -- Private Methods -- */
 
 /**
@@ -63,6 +75,18 @@ static const char value_impl_magic_free[] = "value_impl_magic_free";
 */
 value_impl value_descriptor(value v);
 
+/**
+*  @brief
+*    Allocate memory for a value from the frame of the current thread
+*
+*  @param[in] size
+*    Size in bytes of the value including its header
+*
+*  @return
+*    Pointer to the header of the value if success, null if there is no frame or it is full
+*/
+static value_impl value_frame_alloc(size_t size);
+
 /* -- Methods -- */
 
 value_impl value_descriptor(value v)
@@ -75,16 +99,53 @@ value_impl value_descriptor(value v)
 	return (value_impl)(((uintptr_t)v) - sizeof(struct value_impl_type));
 }
 
+static value_impl value_frame_alloc(size_t size)
+{
+#if defined(PORTABILITY_THREAD_LOCAL)
+	value_frame frame = value_frame_current;
+
+	if (frame != NULL)
+	{
+		/* Keep the same alignment as malloc so any type can be stored in the value */
+		uintptr_t base = (uintptr_t)frame->buffer;
+		uintptr_t address = (base + frame->offset + (VALUE_FRAME_ALIGNMENT - 1)) & ~(VALUE_FRAME_ALIGNMENT - 1);
+
+		if (address + size <= base + frame->size)
+		{
+			frame->offset = (size_t)(address + size - base);
+
+			return (value_impl)address;
+		}
+	}
+#else
+	(void)size;
+#endif
+
+	return NULL;
+}
+
 value value_alloc(size_t bytes)
 {
-	value_impl impl = malloc(sizeof(struct value_impl_type) + bytes);
+	const size_t size = sizeof(struct value_impl_type) + bytes;
 
-	if (impl == NULL)
+	value_impl impl = value_frame_alloc(size);
+
+	if (impl != NULL)
 	{
-		return NULL;
+		impl->magic = (uintptr_t)value_impl_magic_frame;
+	}
+	else
+	{
+		impl = malloc(size);
+
+		if (impl == NULL)
+		{
+			return NULL;
+		}
+
+		impl->magic = (uintptr_t)value_impl_magic_alloc;
 	}
 
-	impl->magic = (uintptr_t)value_impl_magic_alloc;
 	impl->bytes = bytes;
 	impl->ref_count = 1;
 	impl->finalizer = NULL;
@@ -111,7 +172,7 @@ int value_validate(value v)
 {
 	value_impl impl = value_descriptor(v);
 
-	return !(impl != NULL && impl->magic == (uintptr_t)value_impl_magic_alloc);
+	return !(impl != NULL && (impl->magic == (uintptr_t)value_impl_magic_alloc || impl->magic == (uintptr_t)value_impl_magic_frame));
 }
 
 value value_copy(value v)
@@ -256,6 +317,9 @@ void value_destroy(value v)
 
 	if (impl != NULL && impl->ref_count <= 1)
 	{
+		/* The memory of the values allocated in a frame is released with the frame */
+		int frame = (impl->magic == (uintptr_t)value_impl_magic_frame);
+
 		if (impl->finalizer != NULL)
 		{
 			impl->finalizer(v, impl->finalizer_data);
@@ -263,6 +327,32 @@ void value_destroy(value v)
 
 		impl->magic = (uintptr_t)value_impl_magic_free;
 
-		free(impl);
+		if (frame == 0)
+		{
+			free(impl);
+		}
 	}
 }
+
+void value_frame_begin(value_frame frame, void *buffer, size_t size)
+{
+	frame->buffer = buffer;
+	frame->size = size;
+	frame->offset = 0;
+
+#if defined(PORTABILITY_THREAD_LOCAL)
+	frame->prev = value_frame_current;
+	value_frame_current = frame;
+#else
+	frame->prev = NULL;
+#endif
+}
+
+void value_frame_end(value_frame frame)
+{
+#if defined(PORTABILITY_THREAD_LOCAL)
+	value_frame_current = frame->prev;
+#else
+	(void)frame;
+#endif
+}
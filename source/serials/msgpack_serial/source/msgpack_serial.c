@@ -0,0 +1,46 @@
+/*
+ *	Serial Library by Parra Studios
+ *	Copyright (C) 2016 - 2026 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	A cross-platform library for managing multiple serialization and deserialization formats.
+ *
+ */
+
+/* -- Headers -- */
+
+#include <metacall/metacall_version.h>
+
+#include <msgpack_serial/msgpack_serial.h>
+#include <msgpack_serial/msgpack_serial_impl.h>
+
+/* -- Methods -- */
+
+serial_interface msgpack_serial_impl_interface_singleton(void)
+{
+	static struct serial_interface_type interface_instance_msgpack = {
+		&msgpack_serial_impl_extension,
+		&msgpack_serial_impl_initialize,
+		&msgpack_serial_impl_serialize,
+		&msgpack_serial_impl_deserialize,
+		&msgpack_serial_impl_destroy
+	};
+
+	return &interface_instance_msgpack;
+}
+
+const char *msgpack_serial_print_info(void)
+{
+	static const char msgpack_serial_info[] =
+		"MessagePack Serial Plugin " METACALL_VERSION "\n"
+		"Copyright (C) 2016 - 2026 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>\n"
+
+#ifdef MSGPACK_SERIAL_STATIC_DEFINE
+		"Compiled as static library type\n"
+#else
+		"Compiled as shared library type\n"
+#endif
+
+		"\n";
+
+	return msgpack_serial_info;
+}
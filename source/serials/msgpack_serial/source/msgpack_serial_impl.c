@@ -0,0 +1,783 @@
+/*
+ *	Serial Library by Parra Studios
+ *	Copyright (C) 2016 - 2026 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	A cross-platform library for managing multiple serialization and deserialization formats.
+ *
+ */
+
+/* -- Headers -- */
+
+#include <msgpack_serial/msgpack_serial_impl.h>
+
+#include <metacall/metacall_error.h>
+
+#include <log/log.h>
+
+#include <limits.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+/* -- Definitions -- */
+
+/*
+*  The numbers are encoded with the width of their type, so they are deserialized with the same type:
+*  char as int8, short as int16, int as int32 (or a fixint when it fits), long as int64, float as float32
+*  and double as float64; the unsigned formats produced by other encoders are deserialized as int or long
+*/
+#define MSGPACK_SERIAL_NIL		0xC0
+#define MSGPACK_SERIAL_FALSE	0xC2
+#define MSGPACK_SERIAL_TRUE		0xC3
+#define MSGPACK_SERIAL_BIN8		0xC4
+#define MSGPACK_SERIAL_BIN16	0xC5
+#define MSGPACK_SERIAL_BIN32	0xC6
+#define MSGPACK_SERIAL_FLOAT32	0xCA
+#define MSGPACK_SERIAL_FLOAT64	0xCB
+#define MSGPACK_SERIAL_UINT8	0xCC
+#define MSGPACK_SERIAL_UINT16	0xCD
+#define MSGPACK_SERIAL_UINT32	0xCE
+#define MSGPACK_SERIAL_UINT64	0xCF
+#define MSGPACK_SERIAL_INT8		0xD0
+#define MSGPACK_SERIAL_INT16	0xD1
+#define MSGPACK_SERIAL_INT32	0xD2
+#define MSGPACK_SERIAL_INT64	0xD3
+#define MSGPACK_SERIAL_STR8		0xD9
+#define MSGPACK_SERIAL_STR16	0xDA
+#define MSGPACK_SERIAL_STR32	0xDB
+#define MSGPACK_SERIAL_ARRAY16	0xDC
+#define MSGPACK_SERIAL_ARRAY32	0xDD
+#define MSGPACK_SERIAL_MAP16	0xDE
+#define MSGPACK_SERIAL_MAP32	0xDF
+#define MSGPACK_SERIAL_FIXMAP	0x80
+#define MSGPACK_SERIAL_FIXARRAY 0x90
+#define MSGPACK_SERIAL_FIXSTR	0xA0
+#define MSGPACK_SERIAL_NEGFIX	0xE0
+
+#define MSGPACK_SERIAL_PTR_SIZE	0x20	/* Upper bound of the characters of a pointer printed with %p */
+#define MSGPACK_SERIAL_MAX_DEPTH 0x400 /* Maximum nesting of arrays and maps, it bounds the recursion of the deserialization */
+
+/* -- Type Definitions -- */
+
+typedef struct msgpack_serial_writer_type
+{
+	unsigned char *buffer; /* When it is null only the length is calculated */
+	size_t length;
+	int error;
+
+} * msgpack_serial_writer;
+
+typedef struct msgpack_serial_reader_type
+{
+	const unsigned char *buffer;
+	size_t size;
+	size_t position;
+	size_t depth;
+
+} * msgpack_serial_reader;
+
+/* -- Private Methods -- */
+
+static void msgpack_serial_impl_write(msgpack_serial_writer writer, const void *data, size_t size);
+
+static void msgpack_serial_impl_write_number(msgpack_serial_writer writer, unsigned char marker, uint64_t number, size_t size);
+
+static void msgpack_serial_impl_write_header(msgpack_serial_writer writer, unsigned char fix, size_t fix_size, unsigned char marker8, unsigned char marker16, size_t size);
+
+static void msgpack_serial_impl_write_str(msgpack_serial_writer writer, const char *str, size_t length);
+
+static void msgpack_serial_impl_serialize_value(value v, msgpack_serial_writer writer);
+
+static const unsigned char *msgpack_serial_impl_read(msgpack_serial_reader reader, size_t size);
+
+static int msgpack_serial_impl_read_number(msgpack_serial_reader reader, size_t size, uint64_t *number);
+
+static value msgpack_serial_impl_deserialize_value(msgpack_serial_reader reader);
+
+/* -- Methods -- */
+
+const char *msgpack_serial_impl_extension(void)
+{
+	static const char extension[] = "msgpack";
+
+	return extension;
+}
+
+serial_handle msgpack_serial_impl_initialize(memory_allocator allocator)
+{
+	return allocator;
+}
+
+void msgpack_serial_impl_write(msgpack_serial_writer writer, const void *data, size_t size)
+{
+	if (writer->buffer != NULL && size > 0)
+	{
+		memcpy(&writer->buffer[writer->length], data, size);
+	}
+
+	writer->length += size;
+}
+
+void msgpack_serial_impl_write_number(msgpack_serial_writer writer, unsigned char marker, uint64_t number, size_t size)
+{
+	unsigned char data[sizeof(uint64_t) + 1];
+	size_t iterator;
+
+	data[0] = marker;
+
+	/* MessagePack numbers are stored in big endian */
+	for (iterator = 0; iterator < size; ++iterator)
+	{
+		data[size - iterator] = (unsigned char)(number >> (iterator * 8));
+	}
+
+	msgpack_serial_impl_write(writer, data, size + 1);
+}
+
+void msgpack_serial_impl_write_header(msgpack_serial_writer writer, unsigned char fix, size_t fix_size, unsigned char marker8, unsigned char marker16, size_t size)
+{
+	/* The 32 bit length marker always follows the 16 bit one, arrays and maps do not have an 8 bit length */
+	if (size < fix_size)
+	{
+		unsigned char data = (unsigned char)(fix | size);
+
+		msgpack_serial_impl_write(writer, &data, 1);
+	}
+	else if (size <= UINT8_MAX && marker8 != 0)
+	{
+		msgpack_serial_impl_write_number(writer, marker8, (uint64_t)size, 1);
+	}
+	else if (size <= UINT16_MAX)
+	{
+		msgpack_serial_impl_write_number(writer, marker16, (uint64_t)size, 2);
+	}
+	else if ((uint64_t)size <= UINT32_MAX)
+	{
+		msgpack_serial_impl_write_number(writer, (unsigned char)(marker16 + 1), (uint64_t)size, 4);
+	}
+	else
+	{
+		writer->error = 1;
+	}
+}
+
+void msgpack_serial_impl_write_str(msgpack_serial_writer writer, const char *str, size_t length)
+{
+	msgpack_serial_impl_write_header(writer, MSGPACK_SERIAL_FIXSTR, 32, MSGPACK_SERIAL_STR8, MSGPACK_SERIAL_STR16, length);
+	msgpack_serial_impl_write(writer, str, length);
+}
+
+void msgpack_serial_impl_serialize_value(value v, msgpack_serial_writer writer)
+{
+	type_id id = value_type_id(v);
+
+	if (id == TYPE_BOOL)
+	{
+		unsigned char data = value_to_bool(v) == 1L ? MSGPACK_SERIAL_TRUE : MSGPACK_SERIAL_FALSE;
+
+		msgpack_serial_impl_write(writer, &data, 1);
+	}
+	else if (id == TYPE_CHAR)
+	{
+		msgpack_serial_impl_write_number(writer, MSGPACK_SERIAL_INT8, (uint64_t)(int64_t)value_to_char(v), 1);
+	}
+	else if (id == TYPE_SHORT)
+	{
+		msgpack_serial_impl_write_number(writer, MSGPACK_SERIAL_INT16, (uint64_t)(int64_t)value_to_short(v), 2);
+	}
+	else if (id == TYPE_INT)
+	{
+		int i = value_to_int(v);
+
+		if (i >= -32 && i <= 127)
+		{
+			unsigned char data = (unsigned char)(signed char)i;
+
+			msgpack_serial_impl_write(writer, &data, 1);
+		}
+		else
+		{
+			msgpack_serial_impl_write_number(writer, MSGPACK_SERIAL_INT32, (uint64_t)(int64_t)i, 4);
+		}
+	}
+	else if (id == TYPE_LONG)
+	{
+		msgpack_serial_impl_write_number(writer, MSGPACK_SERIAL_INT64, (uint64_t)(int64_t)value_to_long(v), 8);
+	}
+	else if (id == TYPE_FLOAT)
+	{
+		float f = value_to_float(v);
+		uint32_t bits;
+
+		memcpy(&bits, &f, sizeof(bits));
+
+		msgpack_serial_impl_write_number(writer, MSGPACK_SERIAL_FLOAT32, (uint64_t)bits, 4);
+	}
+	else if (id == TYPE_DOUBLE)
+	{
+		double d = value_to_double(v);
+		uint64_t bits;
+
+		memcpy(&bits, &d, sizeof(bits));
+
+		msgpack_serial_impl_write_number(writer, MSGPACK_SERIAL_FLOAT64, bits, 8);
+	}
+	else if (id == TYPE_STRING)
+	{
+		size_t size = value_type_size(v);
+
+		msgpack_serial_impl_write_str(writer, value_to_string(v), size > 0 ? size - 1 : 0);
+	}
+	else if (id == TYPE_BUFFER)
+	{
+		size_t size = value_type_size(v);
+
+		msgpack_serial_impl_write_header(writer, 0, 0, MSGPACK_SERIAL_BIN8, MSGPACK_SERIAL_BIN16, size);
+		msgpack_serial_impl_write(writer, value_to_buffer(v), size);
+	}
+	else if (id == TYPE_ARRAY)
+	{
+		value *value_array = value_to_array(v);
+		size_t iterator, array_size = value_type_count(v);
+
+		msgpack_serial_impl_write_header(writer, MSGPACK_SERIAL_FIXARRAY, 16, 0, MSGPACK_SERIAL_ARRAY16, array_size);
+
+		for (iterator = 0; iterator < array_size; ++iterator)
+		{
+			msgpack_serial_impl_serialize_value(value_array[iterator], writer);
+		}
+	}
+	else if (id == TYPE_MAP)
+	{
+		value *value_map = value_to_map(v);
+		size_t iterator, map_size = value_type_count(v);
+
+		msgpack_serial_impl_write_header(writer, MSGPACK_SERIAL_FIXMAP, 16, 0, MSGPACK_SERIAL_MAP16, map_size);
+
+		/* MessagePack keys can be of any type, so they are not converted into strings */
+		for (iterator = 0; iterator < map_size; ++iterator)
+		{
+			value *tupla_array = value_to_array(value_map[iterator]);
+
+			msgpack_serial_impl_serialize_value(tupla_array[0], writer);
+			msgpack_serial_impl_serialize_value(tupla_array[1], writer);
+		}
+	}
+	else if (id == TYPE_FUTURE)
+	{
+		/* TODO: Improve future serialization */
+		static const char str[] = "[Future]";
+
+		msgpack_serial_impl_write_str(writer, str, sizeof(str) - 1);
+	}
+	else if (id == TYPE_FUNCTION)
+	{
+		/* TODO: Improve function serialization */
+		static const char str[] = "[Function]";
+
+		msgpack_serial_impl_write_str(writer, str, sizeof(str) - 1);
+	}
+	else if (id == TYPE_CLASS)
+	{
+		/* TODO: Improve class serialization */
+		static const char str[] = "[Class]";
+
+		msgpack_serial_impl_write_str(writer, str, sizeof(str) - 1);
+	}
+	else if (id == TYPE_OBJECT)
+	{
+		/* TODO: Improve object serialization */
+		static const char str[] = "[Object]";
+
+		msgpack_serial_impl_write_str(writer, str, sizeof(str) - 1);
+	}
+	else if (id == TYPE_EXCEPTION)
+	{
+		static const char message_str[] = "message";
+		static const char label_str[] = "label";
+		static const char code_str[] = "code";
+		static const char stacktrace_str[] = "stacktrace";
+
+		exception ex = value_to_exception(v);
+
+		msgpack_serial_impl_write_header(writer, MSGPACK_SERIAL_FIXMAP, 16, 0, MSGPACK_SERIAL_MAP16, 4);
+
+		msgpack_serial_impl_write_str(writer, message_str, sizeof(message_str) - 1);
+		msgpack_serial_impl_write_str(writer, exception_message(ex), strlen(exception_message(ex)));
+
+		msgpack_serial_impl_write_str(writer, label_str, sizeof(label_str) - 1);
+		msgpack_serial_impl_write_str(writer, exception_label(ex), strlen(exception_label(ex)));
+
+		msgpack_serial_impl_write_str(writer, code_str, sizeof(code_str) - 1);
+		msgpack_serial_impl_write_number(writer, MSGPACK_SERIAL_INT64, (uint64_t)exception_error_code(ex), 8);
+
+		msgpack_serial_impl_write_str(writer, stacktrace_str, sizeof(stacktrace_str) - 1);
+		msgpack_serial_impl_write_str(writer, exception_stacktrace(ex), strlen(exception_stacktrace(ex)));
+	}
+	else if (id == TYPE_THROWABLE)
+	{
+		static const char str[] = "ExceptionThrown";
+
+		msgpack_serial_impl_write_header(writer, MSGPACK_SERIAL_FIXMAP, 16, 0, MSGPACK_SERIAL_MAP16, 1);
+
+		msgpack_serial_impl_write_str(writer, str, sizeof(str) - 1);
+
+		msgpack_serial_impl_serialize_value(throwable_value(value_to_throwable(v)), writer);
+	}
+	else if (id == TYPE_PTR)
+	{
+		char str[MSGPACK_SERIAL_PTR_SIZE];
+
+		int length = snprintf(str, sizeof(str), "%p", value_to_ptr(v));
+
+		msgpack_serial_impl_write_str(writer, str, length > 0 ? (size_t)length : 0);
+	}
+	else if (id == TYPE_NULL)
+	{
+		unsigned char data = MSGPACK_SERIAL_NIL;
+
+		msgpack_serial_impl_write(writer, &data, 1);
+	}
+	else
+	{
+		writer->error = 1;
+	}
+}
+
+char *msgpack_serial_impl_serialize(serial_handle handle, value v, size_t *size)
+{
+	memory_allocator allocator;
+
+	struct msgpack_serial_writer_type writer = { NULL, 0, 0 };
+
+	if (handle == NULL || v == NULL || size == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Serialization called with wrong arguments in MessagePack implementation");
+
+		return NULL;
+	}
+
+	allocator = (memory_allocator)handle;
+
+	/* Calculate the exact size first, so the buffer is allocated only once */
+	msgpack_serial_impl_serialize_value(v, &writer);
+
+	if (writer.error != 0 || writer.length == 0)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Serialization unsupported value in MessagePack implementation");
+
+		*size = 0;
+
+		return NULL;
+	}
+
+	writer.buffer = memory_allocator_allocate(allocator, sizeof(unsigned char) * writer.length);
+
+	if (writer.buffer == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Serialization invalid buffer allocation in MessagePack implementation");
+
+		*size = 0;
+
+		return NULL;
+	}
+
+	*size = writer.length;
+
+	writer.length = 0;
+
+	msgpack_serial_impl_serialize_value(v, &writer);
+
+	return (char *)writer.buffer;
+}
+
+const unsigned char *msgpack_serial_impl_read(msgpack_serial_reader reader, size_t size)
+{
+	const unsigned char *data;
+
+	if (size > reader->size - reader->position)
+	{
+		return NULL;
+	}
+
+	data = &reader->buffer[reader->position];
+
+	reader->position += size;
+
+	return data;
+}
+
+int msgpack_serial_impl_read_number(msgpack_serial_reader reader, size_t size, uint64_t *number)
+{
+	const unsigned char *data = msgpack_serial_impl_read(reader, size);
+	size_t iterator;
+
+	if (data == NULL)
+	{
+		return 1;
+	}
+
+	*number = 0;
+
+	for (iterator = 0; iterator < size; ++iterator)
+	{
+		*number = (*number << 8) | data[iterator];
+	}
+
+	return 0;
+}
+
+value msgpack_serial_impl_deserialize_value(msgpack_serial_reader reader)
+{
+	const unsigned char *data = msgpack_serial_impl_read(reader, 1);
+	unsigned char marker;
+	uint64_t number = 0;
+	size_t length, iterator;
+
+	if (data == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Deserialization unexpected end of buffer in MessagePack implementation");
+		return NULL;
+	}
+
+	marker = *data;
+
+	/* Fixed size formats, the value or the length is stored in the marker */
+	if (marker <= 0x7F)
+	{
+		return value_create_int((int)marker);
+	}
+	else if (marker >= MSGPACK_SERIAL_NEGFIX)
+	{
+		return value_create_int((int)(signed char)marker);
+	}
+	else if (marker < MSGPACK_SERIAL_FIXARRAY)
+	{
+		number = marker & 0x0F;
+		marker = MSGPACK_SERIAL_MAP16;
+	}
+	else if (marker < MSGPACK_SERIAL_FIXSTR)
+	{
+		number = marker & 0x0F;
+		marker = MSGPACK_SERIAL_ARRAY16;
+	}
+	else if (marker < MSGPACK_SERIAL_NIL)
+	{
+		number = marker & 0x1F;
+		marker = MSGPACK_SERIAL_STR8;
+	}
+	else
+	{
+		size_t size;
+
+		/* Formats with the number or the length after the marker */
+		switch (marker)
+		{
+			case MSGPACK_SERIAL_BIN8:
+			case MSGPACK_SERIAL_UINT8:
+			case MSGPACK_SERIAL_INT8:
+			case MSGPACK_SERIAL_STR8:
+				size = 1;
+				break;
+			case MSGPACK_SERIAL_BIN16:
+			case MSGPACK_SERIAL_UINT16:
+			case MSGPACK_SERIAL_INT16:
+			case MSGPACK_SERIAL_STR16:
+			case MSGPACK_SERIAL_ARRAY16:
+			case MSGPACK_SERIAL_MAP16:
+				size = 2;
+				break;
+			case MSGPACK_SERIAL_BIN32:
+			case MSGPACK_SERIAL_FLOAT32:
+			case MSGPACK_SERIAL_UINT32:
+			case MSGPACK_SERIAL_INT32:
+			case MSGPACK_SERIAL_STR32:
+			case MSGPACK_SERIAL_ARRAY32:
+			case MSGPACK_SERIAL_MAP32:
+				size = 4;
+				break;
+			case MSGPACK_SERIAL_FLOAT64:
+			case MSGPACK_SERIAL_UINT64:
+			case MSGPACK_SERIAL_INT64:
+				size = 8;
+				break;
+			default:
+				size = 0;
+				break;
+		}
+
+		if (size > 0 && msgpack_serial_impl_read_number(reader, size, &number) != 0)
+		{
+			log_write("metacall", LOG_LEVEL_ERROR, "Deserialization unexpected end of buffer in MessagePack implementation");
+			return NULL;
+		}
+	}
+
+	/* Strings, buffers and arrays can not be longer than the remaining buffer (each element takes at least
+	one byte), neither maps longer than half of it, so nothing bigger than the buffer is ever allocated */
+	length = reader->size - reader->position;
+
+	if (number <= (uint64_t)length)
+	{
+		length = (size_t)number;
+	}
+	else
+	{
+		++length;
+	}
+
+	switch (marker)
+	{
+		case MSGPACK_SERIAL_NIL:
+			return value_create_null();
+
+		case MSGPACK_SERIAL_FALSE:
+			return value_create_bool(0L);
+
+		case MSGPACK_SERIAL_TRUE:
+			return value_create_bool(1L);
+
+		case MSGPACK_SERIAL_INT8:
+			return value_create_char((char)(int8_t)number);
+
+		case MSGPACK_SERIAL_INT16:
+			return value_create_short((short)(int16_t)number);
+
+		case MSGPACK_SERIAL_INT32:
+			return value_create_int((int)(int32_t)number);
+
+		case MSGPACK_SERIAL_INT64: {
+			int64_t i = (int64_t)number;
+
+			/* On 32-bit, long is 32 bits so int64_t values outside [LONG_MIN, LONG_MAX]
+			 * would be silently truncated. Guard with a compile-time check to avoid a
+			 * -Wtype-limits warning on 64-bit where long == int64_t. */
+#if LONG_MAX < INT64_MAX
+			if (i < (int64_t)LONG_MIN || i > (int64_t)LONG_MAX)
+			{
+				return (value)metacall_error_throw("MessagePack", -1, NULL, "64-bit signed integer value overflows long in MessagePack implementation");
+			}
+#endif
+
+			return value_create_long((long)i);
+		}
+
+		case MSGPACK_SERIAL_UINT8:
+		case MSGPACK_SERIAL_UINT16:
+		case MSGPACK_SERIAL_UINT32:
+		case MSGPACK_SERIAL_UINT64:
+			if (number <= (uint64_t)INT_MAX)
+			{
+				return value_create_int((int)number);
+			}
+			else if (number <= (uint64_t)LONG_MAX)
+			{
+				return value_create_long((long)number);
+			}
+
+			return (value)metacall_error_throw("MessagePack", -1, NULL, "Unsigned integer value overflows long in MessagePack implementation");
+
+		case MSGPACK_SERIAL_FLOAT32: {
+			uint32_t bits = (uint32_t)number;
+			float f;
+
+			memcpy(&f, &bits, sizeof(f));
+
+			return value_create_float(f);
+		}
+
+		case MSGPACK_SERIAL_FLOAT64: {
+			double d;
+
+			memcpy(&d, &number, sizeof(d));
+
+			return value_create_double(d);
+		}
+
+		case MSGPACK_SERIAL_STR8:
+		case MSGPACK_SERIAL_STR16:
+		case MSGPACK_SERIAL_STR32: {
+			const unsigned char *str = msgpack_serial_impl_read(reader, length);
+			value v;
+
+			if (str == NULL)
+			{
+				break;
+			}
+
+			/* The strings are not null terminated in the buffer, so they are copied into a zeroed value */
+			v = value_create_string(NULL, length);
+
+			if (v == NULL)
+			{
+				log_write("metacall", LOG_LEVEL_ERROR, "Deserialization invalid string allocation in MessagePack implementation");
+				return NULL;
+			}
+
+			memcpy(value_to_string(v), str, length);
+
+			return v;
+		}
+
+		case MSGPACK_SERIAL_BIN8:
+		case MSGPACK_SERIAL_BIN16:
+		case MSGPACK_SERIAL_BIN32: {
+			const unsigned char *buffer = msgpack_serial_impl_read(reader, length);
+
+			if (buffer == NULL)
+			{
+				break;
+			}
+
+			return value_create_buffer(buffer, length);
+		}
+
+		case MSGPACK_SERIAL_ARRAY16:
+		case MSGPACK_SERIAL_ARRAY32: {
+			value v;
+			value *v_array;
+
+			if (length > reader->size - reader->position)
+			{
+				break;
+			}
+
+			if (reader->depth == MSGPACK_SERIAL_MAX_DEPTH)
+			{
+				log_write("metacall", LOG_LEVEL_ERROR, "Deserialization maximum nesting depth (%d) exceeded in MessagePack implementation", MSGPACK_SERIAL_MAX_DEPTH);
+				return NULL;
+			}
+
+			v = value_create_array(NULL, length);
+
+			if (v == NULL)
+			{
+				log_write("metacall", LOG_LEVEL_ERROR, "Deserialization invalid array allocation in MessagePack implementation");
+				return NULL;
+			}
+
+			v_array = value_to_array(v);
+
+			++reader->depth;
+
+			for (iterator = 0; iterator < length; ++iterator)
+			{
+				v_array[iterator] = msgpack_serial_impl_deserialize_value(reader);
+
+				if (v_array[iterator] == NULL)
+				{
+					value_type_destroy(v);
+					return NULL;
+				}
+			}
+
+			--reader->depth;
+
+			return v;
+		}
+
+		case MSGPACK_SERIAL_MAP16:
+		case MSGPACK_SERIAL_MAP32: {
+			value v;
+			value *v_map;
+
+			if (length > (reader->size - reader->position) / 2)
+			{
+				break;
+			}
+
+			if (reader->depth == MSGPACK_SERIAL_MAX_DEPTH)
+			{
+				log_write("metacall", LOG_LEVEL_ERROR, "Deserialization maximum nesting depth (%d) exceeded in MessagePack implementation", MSGPACK_SERIAL_MAX_DEPTH);
+				return NULL;
+			}
+
+			v = value_create_map(NULL, length);
+
+			if (v == NULL)
+			{
+				log_write("metacall", LOG_LEVEL_ERROR, "Deserialization invalid map allocation in MessagePack implementation");
+				return NULL;
+			}
+
+			v_map = value_to_map(v);
+
+			++reader->depth;
+
+			for (iterator = 0; iterator < length; ++iterator)
+			{
+				value *tupla_array;
+
+				v_map[iterator] = value_create_array(NULL, 2);
+
+				if (v_map[iterator] == NULL)
+				{
+					log_write("metacall", LOG_LEVEL_ERROR, "Deserialization invalid map allocation in MessagePack implementation");
+					value_type_destroy(v);
+					return NULL;
+				}
+
+				tupla_array = value_to_array(v_map[iterator]);
+
+				tupla_array[0] = msgpack_serial_impl_deserialize_value(reader);
+
+				if (tupla_array[0] == NULL || (tupla_array[1] = msgpack_serial_impl_deserialize_value(reader)) == NULL)
+				{
+					value_type_destroy(v);
+					return NULL;
+				}
+			}
+
+			--reader->depth;
+
+			return v;
+		}
+
+		default:
+			log_write("metacall", LOG_LEVEL_ERROR, "Deserialization unsupported format (0x%02X) in MessagePack implementation", (unsigned int)marker);
+			return NULL;
+	}
+
+	log_write("metacall", LOG_LEVEL_ERROR, "Deserialization unexpected end of buffer in MessagePack implementation");
+
+	return NULL;
+}
+
+value msgpack_serial_impl_deserialize(serial_handle handle, const char *buffer, size_t size)
+{
+	struct msgpack_serial_reader_type reader;
+
+	value v;
+
+	if (handle == NULL || buffer == NULL || size == 0)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Deserialization called with wrong arguments in MessagePack implementation");
+
+		return NULL;
+	}
+
+	reader.buffer = (const unsigned char *)buffer;
+	reader.size = size;
+	reader.position = 0;
+	reader.depth = 0;
+
+	v = msgpack_serial_impl_deserialize_value(&reader);
+
+	if (v != NULL && reader.position != reader.size)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Deserialization trailing data (%" PRIuS " bytes) in MessagePack implementation", reader.size - reader.position);
+
+		value_type_destroy(v);
+
+		return NULL;
+	}
+
+	return v;
+}
+
+int msgpack_serial_impl_destroy(serial_handle handle)
+{
+	(void)handle;
+
+	return 0;
+}
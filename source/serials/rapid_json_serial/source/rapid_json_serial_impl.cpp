@@ -23,8 +23,10 @@
 	#pragma GCC diagnostic ignored "-Wstrict-overflow"
 #endif
 
-#include <rapidjson/document.h>
+#include <rapidjson/encodedstream.h>
 #include <rapidjson/error/en.h>
+#include <rapidjson/memorystream.h>
+#include <rapidjson/reader.h>
 #include <rapidjson/stringbuffer.h>
 #include <rapidjson/writer.h>
 
@@ -36,28 +38,336 @@
 #endif
 
 #include <climits>
+#include <cstring>
 #include <sstream>
+#include <vector>
+
+/* -- Definitions -- */
+
+#define RAPID_JSON_SERIAL_IMPL_NUMBER_SIZE 0x20 /* Upper bound of the characters of a number written by RapidJSON */
 
 /* -- Type Definitions -- */
 
 typedef struct rapid_json_document_type
 {
-	rapidjson::Document impl;
 	memory_allocator allocator;
 
 } * rapid_json_document;
 
-/* -- Private Methods -- */
+/* -- Classes -- */
 
-static void rapid_json_serial_impl_serialize_value(value v, rapidjson::Value *json_v);
+/* Output stream that writes directly into a buffer of the serial allocator, the buffer is
+reserved with the estimated size of the value and it only grows if the estimation falls short */
+class rapid_json_serial_impl_stream
+{
+public:
+	typedef char Ch;
 
-static char *rapid_json_serial_impl_document_stringify(rapid_json_document document, size_t *size);
+	rapid_json_serial_impl_stream(memory_allocator allocator, size_t capacity) :
+		allocator(allocator), buffer(NULL), length(0), capacity(capacity), error(false)
+	{
+		buffer = static_cast<char *>(memory_allocator_allocate(allocator, sizeof(char) * capacity));
 
-static value rapid_json_serial_impl_deserialize_value(const rapidjson::Value *v);
+		if (buffer == NULL)
+		{
+			error = true;
+		}
+	}
 
-/* -- Classes -- */
+	~rapid_json_serial_impl_stream()
+	{
+		if (buffer != NULL)
+		{
+			memory_allocator_deallocate(allocator, buffer);
+		}
+	}
+
+	void Put(Ch c)
+	{
+		/* The buffer may be NULL if the first allocation failed */
+		if (error == true || (length == capacity && Grow() == false))
+		{
+			return;
+		}
+
+		buffer[length++] = c;
+	}
+
+	void Flush()
+	{
+	}
+
+	bool Failed() const
+	{
+		return error;
+	}
+
+	/* Terminate the string and give the ownership of the buffer to the caller */
+	char *Release(size_t *size)
+	{
+		char *result;
+
+		Put('\0');
+
+		if (error == true)
+		{
+			return NULL;
+		}
 
-static thread_local rapidjson::MemoryPoolAllocator<> rapid_json_allocator;
+		result = buffer;
+		*size = length;
+		buffer = NULL;
+
+		return result;
+	}
+
+private:
+	bool Grow()
+	{
+		size_t new_capacity = capacity * 2;
+		char *new_buffer;
+
+		if (error == true)
+		{
+			return false;
+		}
+
+		new_buffer = static_cast<char *>(memory_allocator_reallocate(allocator, buffer, capacity, sizeof(char) * new_capacity));
+
+		if (new_buffer == NULL)
+		{
+			error = true;
+			return false;
+		}
+
+		buffer = new_buffer;
+		capacity = new_capacity;
+
+		return true;
+	}
+
+	memory_allocator allocator;
+	char *buffer;
+	size_t length;
+	size_t capacity;
+	bool error;
+};
+
+/* SAX handler that builds the values while the input is being parsed, the values of the containers
+that are not closed yet are kept in a single stack and they are moved into the container on its end event */
+class rapid_json_serial_impl_handler : public rapidjson::BaseReaderHandler<rapidjson::UTF8<>, rapid_json_serial_impl_handler>
+{
+public:
+	~rapid_json_serial_impl_handler()
+	{
+		for (value v : stack)
+		{
+			if (v != NULL)
+			{
+				value_type_destroy(v);
+			}
+		}
+	}
+
+	bool Null()
+	{
+		return Push(value_create_null());
+	}
+
+	bool Bool(bool b)
+	{
+		return Push(value_create_bool(b == true ? 1L : 0L));
+	}
+
+	bool Int(int i)
+	{
+		return Push(value_create_int(i));
+	}
+
+	bool Uint(unsigned int ui)
+	{
+		/* Happy path: value fits in a signed int */
+		if (ui <= (unsigned int)INT_MAX)
+		{
+			return Push(value_create_int((int)ui));
+		}
+
+		/* On 64-bit platforms unsigned int's full range (0..UINT_MAX = 4294967295)
+		 * fits within long (LONG_MAX = 9223372036854775807) so we can upcast without
+		 * loss.  On 32-bit where LONG_MAX == INT_MAX this branch is unreachable and
+		 * we return an error.  The compile-time guard avoids -Wtype-limits. */
+#if LONG_MAX >= UINT_MAX
+		return Push(value_create_long((long)ui));
+#else
+		log_write("metacall", LOG_LEVEL_ERROR, "Unsigned integer value overflows both int and long in RapidJSON implementation");
+		return Push((value)metacall_error_throw("RapidJSON", -1, NULL, "Unsigned integer value overflows both int and long in RapidJSON implementation"));
+#endif
+	}
+
+	bool Int64(int64_t i)
+	{
+		/* On 32-bit, long is 32 bits so int64_t values outside [LONG_MIN, LONG_MAX]
+		 * would be silently truncated. Guard with a compile-time check to avoid a
+		 * -Wtype-limits warning on 64-bit where long == int64_t and the comparison
+		 * is trivially false. */
+#if LONG_MAX < INT64_MAX
+		if (i < (int64_t)LONG_MIN || i > (int64_t)LONG_MAX)
+		{
+			return Push((value)metacall_error_throw("RapidJSON", -1, NULL, "64-bit signed integer value overflows long in RapidJSON implementation"));
+		}
+#endif
+
+		return Push(value_create_long((long)i));
+	}
+
+	bool Uint64(uint64_t ui)
+	{
+		if (ui > (uint64_t)LONG_MAX)
+		{
+			return Push((value)metacall_error_throw("RapidJSON", -1, NULL, "64-bit unsigned integer value overflows long in RapidJSON implementation"));
+		}
+
+		return Push(value_create_long((long)ui));
+	}
+
+	bool Double(double d)
+	{
+		/* Same criteria as rapidjson::Value::IsFloat, the numbers in the float range are stored as float */
+		if (d >= -3.4028234e38 && d <= 3.4028234e38)
+		{
+			return Push(value_create_float((float)d));
+		}
+
+		return Push(value_create_double(d));
+	}
+
+	bool String(const Ch *str, rapidjson::SizeType length, bool copy)
+	{
+		(void)copy;
+
+		return Push(value_create_string(str, (size_t)length));
+	}
+
+	bool Key(const Ch *str, rapidjson::SizeType length, bool copy)
+	{
+		return String(str, length, copy);
+	}
+
+	bool StartObject()
+	{
+		return true;
+	}
+
+	bool EndObject(rapidjson::SizeType member_count)
+	{
+		const size_t start = stack.size() - 2 * (size_t)member_count;
+		size_t iterator;
+
+		tuples.clear();
+
+		for (iterator = 0; iterator < (size_t)member_count; ++iterator)
+		{
+			value tupla = value_create_array(&stack[start + 2 * iterator], 2);
+
+			if (tupla == NULL)
+			{
+				/* The tuples own their key and value, remove them from the stack before destroying them */
+				for (size_t index = 0; index < 2 * iterator; ++index)
+				{
+					stack[start + index] = NULL;
+				}
+
+				for (value created : tuples)
+				{
+					value_type_destroy(created);
+				}
+
+				return false;
+			}
+
+			tuples.push_back(tupla);
+		}
+
+		value v_map = value_create_map(tuples.data(), tuples.size());
+
+		if (v_map == NULL)
+		{
+			for (size_t index = 0; index < 2 * (size_t)member_count; ++index)
+			{
+				stack[start + index] = NULL;
+			}
+
+			for (value created : tuples)
+			{
+				value_type_destroy(created);
+			}
+
+			return false;
+		}
+
+		stack.resize(start);
+
+		return Push(v_map);
+	}
+
+	bool StartArray()
+	{
+		return true;
+	}
+
+	bool EndArray(rapidjson::SizeType element_count)
+	{
+		const size_t start = stack.size() - (size_t)element_count;
+
+		value v_array = value_create_array(element_count == 0 ? NULL : &stack[start], (size_t)element_count);
+
+		if (v_array == NULL)
+		{
+			return false;
+		}
+
+		stack.resize(start);
+
+		return Push(v_array);
+	}
+
+	/* Give the ownership of the root value to the caller */
+	value Release()
+	{
+		value v = NULL;
+
+		if (stack.size() == 1)
+		{
+			v = stack.back();
+			stack.clear();
+		}
+
+		return v;
+	}
+
+private:
+	bool Push(value v)
+	{
+		if (v == NULL)
+		{
+			return false;
+		}
+
+		stack.push_back(v);
+
+		return true;
+	}
+
+	std::vector<value> stack;
+	std::vector<value> tuples;
+};
+
+/* -- Private Methods -- */
+
+static size_t rapid_json_serial_impl_serialize_size(value v);
+
+template <typename Writer>
+static void rapid_json_serial_impl_serialize_value(value v, Writer &writer);
 
 /* -- Methods -- */
 
@@ -82,7 +392,75 @@ serial_handle rapid_json_serial_impl_initialize(memory_allocator allocator)
 	return (serial_handle)document;
 }
 
-void rapid_json_serial_impl_serialize_value(value v, rapidjson::Value *json_v)
+size_t rapid_json_serial_impl_serialize_size(value v)
+{
+	type_id id = value_type_id(v);
+
+	if (id == TYPE_BOOL || id == TYPE_NULL)
+	{
+		return sizeof("false") - 1;
+	}
+	else if (id == TYPE_CHAR)
+	{
+		return sizeof("\"c\"") - 1;
+	}
+	else if (id == TYPE_SHORT || id == TYPE_INT || id == TYPE_LONG || id == TYPE_FLOAT || id == TYPE_DOUBLE || id == TYPE_PTR)
+	{
+		return RAPID_JSON_SERIAL_IMPL_NUMBER_SIZE;
+	}
+	else if (id == TYPE_STRING)
+	{
+		/* Quotes included, the escaped characters are not taken into account */
+		return value_type_size(v) + 1;
+	}
+	else if (id == TYPE_BUFFER)
+	{
+		return sizeof("{\"data\":[],\"length\":}") + RAPID_JSON_SERIAL_IMPL_NUMBER_SIZE + value_type_size(v) * 4;
+	}
+	else if (id == TYPE_ARRAY)
+	{
+		value *value_array = value_to_array(v);
+		size_t iterator, array_size = value_type_count(v), size = 2 + array_size;
+
+		for (iterator = 0; iterator < array_size; ++iterator)
+		{
+			size += rapid_json_serial_impl_serialize_size(value_array[iterator]);
+		}
+
+		return size;
+	}
+	else if (id == TYPE_MAP)
+	{
+		value *value_map = value_to_map(v);
+		size_t iterator, map_size = value_type_count(v), size = 2 + map_size * 2;
+
+		for (iterator = 0; iterator < map_size; ++iterator)
+		{
+			value *tupla_array = value_to_array(value_map[iterator]);
+
+			size += rapid_json_serial_impl_serialize_size(tupla_array[0]) + rapid_json_serial_impl_serialize_size(tupla_array[1]);
+		}
+
+		return size;
+	}
+	else if (id == TYPE_EXCEPTION)
+	{
+		exception ex = value_to_exception(v);
+
+		return sizeof("{\"message\":\"\",\"label\":\"\",\"code\":,\"stacktrace\":\"\"}") + RAPID_JSON_SERIAL_IMPL_NUMBER_SIZE +
+			   strlen(exception_message(ex)) + strlen(exception_label(ex)) + strlen(exception_stacktrace(ex));
+	}
+	else if (id == TYPE_THROWABLE)
+	{
+		return sizeof("{\"ExceptionThrown\":}") + rapid_json_serial_impl_serialize_size(throwable_value(value_to_throwable(v)));
+	}
+
+	/* Future, function, class and object are serialized as a short string */
+	return sizeof("\"[Function]\"");
+}
+
+template <typename Writer>
+void rapid_json_serial_impl_serialize_value(value v, Writer &writer)
 {
 	type_id id = value_type_id(v);
 
@@ -90,7 +468,7 @@ void rapid_json_serial_impl_serialize_value(value v, rapidjson::Value *json_v)
 	{
 		boolean b = value_to_bool(v);
 
-		json_v->SetBool(b == 1L ? true : false);
+		writer.Bool(b == 1L ? true : false);
 	}
 	else if (id == TYPE_CHAR)
 	{
@@ -100,37 +478,37 @@ void rapid_json_serial_impl_serialize_value(value v, rapidjson::Value *json_v)
 
 		str[0] = value_to_char(v);
 
-		json_v->SetString(str, length);
+		writer.String(str, length);
 	}
 	else if (id == TYPE_SHORT)
 	{
 		short s = value_to_short(v);
 
-		json_v->SetInt((int)s);
+		writer.Int((int)s);
 	}
 	else if (id == TYPE_INT)
 	{
 		int i = value_to_int(v);
 
-		json_v->SetInt(i);
+		writer.Int(i);
 	}
 	else if (id == TYPE_LONG)
 	{
 		long l = value_to_long(v);
 
-		json_v->SetInt64((int64_t)l);
+		writer.Int64((int64_t)l);
 	}
 	else if (id == TYPE_FLOAT)
 	{
 		float f = value_to_float(v);
 
-		json_v->SetFloat(f);
+		writer.Double((double)f);
 	}
 	else if (id == TYPE_DOUBLE)
 	{
 		double d = value_to_double(v);
 
-		json_v->SetDouble(d);
+		writer.Double(d);
 	}
 	else if (id == TYPE_STRING)
 	{
@@ -140,188 +518,172 @@ void rapid_json_serial_impl_serialize_value(value v, rapidjson::Value *json_v)
 
 		rapidjson::SizeType length = size > 0 ? static_cast<rapidjson::SizeType>(size - 1) : 0;
 
-		json_v->SetString(str, length);
+		writer.String(str, length);
 	}
 	else if (id == TYPE_BUFFER)
 	{
-		rapidjson::Value &json_map = json_v->SetObject();
-
-		rapidjson::Value json_array(rapidjson::kArrayType);
-
 		void *buffer = value_to_buffer(v);
 
 		size_t size = value_type_size(v);
 
-		for (size_t iterator = 0; iterator < size; ++iterator)
-		{
-			const char *data = (const char *)(((uintptr_t)buffer) + iterator);
+		writer.StartObject();
 
-			rapidjson::Value json_inner_value;
+		// Set data
+		{
+			static const char data_str[] = "data";
 
-			json_inner_value.SetUint((unsigned int)*data);
+			writer.Key(data_str, static_cast<rapidjson::SizeType>(sizeof(data_str) - 1));
 
-			json_array.PushBack(json_inner_value, rapid_json_allocator);
-		}
+			writer.StartArray();
 
-		// Set data
-		{
-			rapidjson::Value json_member;
+			for (size_t iterator = 0; iterator < size; ++iterator)
+			{
+				const char *data = (const char *)(((uintptr_t)buffer) + iterator);
 
-			json_member.SetString("data");
+				writer.Uint((unsigned int)*data);
+			}
 
-			json_map.AddMember(json_member, json_array, rapid_json_allocator);
+			writer.EndArray();
 		}
 
 		// Set length
 		{
-			rapidjson::Value json_member, json_inner_value;
+			static const char length_str[] = "length";
 
-			json_member.SetString("length");
+			writer.Key(length_str, static_cast<rapidjson::SizeType>(sizeof(length_str) - 1));
 
-			json_inner_value.SetUint64((uint64_t)size);
-
-			json_map.AddMember(json_member, json_inner_value, rapid_json_allocator);
+			writer.Uint64((uint64_t)size);
 		}
+
+		writer.EndObject();
 	}
 	else if (id == TYPE_ARRAY)
 	{
-		rapidjson::Value &json_array = json_v->SetArray();
-
 		value *value_array = value_to_array(v);
 
 		size_t array_size = value_type_count(v);
 
+		writer.StartArray();
+
 		for (size_t iterator = 0; iterator < array_size; ++iterator)
 		{
-			value current_value = value_array[iterator];
-
-			rapidjson::Value json_inner_value;
-
-			rapid_json_serial_impl_serialize_value(current_value, &json_inner_value);
-
-			json_array.PushBack(json_inner_value, rapid_json_allocator);
+			rapid_json_serial_impl_serialize_value(value_array[iterator], writer);
 		}
+
+		writer.EndArray();
 	}
 	else if (id == TYPE_MAP)
 	{
-		rapidjson::Value &json_map = json_v->SetObject();
-
 		value *value_map = value_to_map(v);
 
 		size_t map_size = value_type_count(v);
 
+		writer.StartObject();
+
 		for (size_t iterator = 0; iterator < map_size; ++iterator)
 		{
 			value tupla = value_map[iterator];
 
 			value *tupla_array = value_to_array(tupla);
 
-			rapidjson::Value json_member, json_inner_value;
+			if (value_type_id(tupla_array[0]) == TYPE_STRING)
+			{
+				const char *str = value_to_string(tupla_array[0]);
+
+				size_t size = value_type_size(tupla_array[0]);
 
-			rapid_json_serial_impl_serialize_value(tupla_array[0], &json_member);
+				writer.Key(str, size > 0 ? static_cast<rapidjson::SizeType>(size - 1) : 0);
+			}
+			else if (value_type_id(tupla_array[0]) == TYPE_CHAR)
+			{
+				char str[1];
+
+				str[0] = value_to_char(tupla_array[0]);
+
+				writer.Key(str, 1);
+			}
+			else
+			{
+				/* JSON keys must be strings, the other keys are written as their JSON representation */
+				rapidjson::StringBuffer key_buffer;
+				rapidjson::Writer<rapidjson::StringBuffer> key_writer(key_buffer);
 
-			rapid_json_serial_impl_serialize_value(tupla_array[1], &json_inner_value);
+				rapid_json_serial_impl_serialize_value(tupla_array[0], key_writer);
 
-			json_map.AddMember(json_member, json_inner_value, rapid_json_allocator);
+				writer.Key(key_buffer.GetString(), static_cast<rapidjson::SizeType>(key_buffer.GetSize()));
+			}
+
+			rapid_json_serial_impl_serialize_value(tupla_array[1], writer);
 		}
+
+		writer.EndObject();
 	}
 	else if (id == TYPE_FUTURE)
 	{
 		/* TODO: Improve future serialization */
 		static const char str[] = "[Future]";
 
-		size_t size = sizeof(str);
-
-		rapidjson::SizeType length = size > 0 ? static_cast<rapidjson::SizeType>(size - 1) : 0;
-
-		json_v->SetString(str, length);
+		writer.String(str, static_cast<rapidjson::SizeType>(sizeof(str) - 1));
 	}
 	else if (id == TYPE_FUNCTION)
 	{
 		/* TODO: Improve function serialization */
 		static const char str[] = "[Function]";
 
-		size_t size = sizeof(str);
-
-		rapidjson::SizeType length = size > 0 ? static_cast<rapidjson::SizeType>(size - 1) : 0;
-
-		json_v->SetString(str, length);
+		writer.String(str, static_cast<rapidjson::SizeType>(sizeof(str) - 1));
 	}
 	else if (id == TYPE_CLASS)
 	{
 		/* TODO: Improve class serialization */
 		static const char str[] = "[Class]";
 
-		size_t size = sizeof(str);
-
-		rapidjson::SizeType length = size > 0 ? static_cast<rapidjson::SizeType>(size - 1) : 0;
-
-		json_v->SetString(str, length);
+		writer.String(str, static_cast<rapidjson::SizeType>(sizeof(str) - 1));
 	}
 	else if (id == TYPE_OBJECT)
 	{
 		/* TODO: Improve object serialization */
 		static const char str[] = "[Object]";
 
-		size_t size = sizeof(str);
-
-		rapidjson::SizeType length = size > 0 ? static_cast<rapidjson::SizeType>(size - 1) : 0;
-
-		json_v->SetString(str, length);
+		writer.String(str, static_cast<rapidjson::SizeType>(sizeof(str) - 1));
 	}
 	else if (id == TYPE_EXCEPTION)
 	{
-		rapidjson::Value &json_map = json_v->SetObject();
-
 		exception ex = value_to_exception(v);
 
-		rapidjson::Value message_member, message_value;
 		static const char message_str[] = "message";
-
-		message_member.SetString(message_str, static_cast<rapidjson::SizeType>(sizeof(message_str) - 1));
-		message_value.SetString(exception_message(ex), static_cast<rapidjson::SizeType>(strlen(exception_message(ex))));
-		json_map.AddMember(message_member, message_value, rapid_json_allocator);
-
-		rapidjson::Value label_member, label_value;
 		static const char label_str[] = "label";
+		static const char code_str[] = "code";
+		static const char stacktrace_str[] = "stacktrace";
 
-		label_member.SetString(label_str, static_cast<rapidjson::SizeType>(sizeof(label_str) - 1));
-		label_value.SetString(exception_label(ex), static_cast<rapidjson::SizeType>(strlen(exception_label(ex))));
-		json_map.AddMember(label_member, label_value, rapid_json_allocator);
+		writer.StartObject();
 
-		rapidjson::Value code_member, code_value;
-		static const char code_str[] = "code";
+		writer.Key(message_str, static_cast<rapidjson::SizeType>(sizeof(message_str) - 1));
+		writer.String(exception_message(ex), static_cast<rapidjson::SizeType>(strlen(exception_message(ex))));
 
-		code_member.SetString(code_str, static_cast<rapidjson::SizeType>(sizeof(code_str) - 1));
-		code_value.SetInt64(exception_error_code(ex));
-		json_map.AddMember(code_member, code_value, rapid_json_allocator);
+		writer.Key(label_str, static_cast<rapidjson::SizeType>(sizeof(label_str) - 1));
+		writer.String(exception_label(ex), static_cast<rapidjson::SizeType>(strlen(exception_label(ex))));
 
-		rapidjson::Value stacktrace_member, stacktrace_value;
-		static const char stacktrace_str[] = "stacktrace";
+		writer.Key(code_str, static_cast<rapidjson::SizeType>(sizeof(code_str) - 1));
+		writer.Int64(exception_error_code(ex));
 
-		stacktrace_member.SetString(stacktrace_str, static_cast<rapidjson::SizeType>(sizeof(stacktrace_str) - 1));
-		stacktrace_value.SetString(exception_stacktrace(ex), static_cast<rapidjson::SizeType>(strlen(exception_stacktrace(ex))));
-		json_map.AddMember(stacktrace_member, stacktrace_value, rapid_json_allocator);
+		writer.Key(stacktrace_str, static_cast<rapidjson::SizeType>(sizeof(stacktrace_str) - 1));
+		writer.String(exception_stacktrace(ex), static_cast<rapidjson::SizeType>(strlen(exception_stacktrace(ex))));
+
+		writer.EndObject();
 	}
 	else if (id == TYPE_THROWABLE)
 	{
-		rapidjson::Value &json_map = json_v->SetObject();
-
 		throwable th = value_to_throwable(v);
 
 		static const char str[] = "ExceptionThrown";
 
-		size_t size = sizeof(str);
-
-		rapidjson::SizeType length = static_cast<rapidjson::SizeType>(size - 1);
+		writer.StartObject();
 
-		rapidjson::Value json_member, json_inner_value;
+		writer.Key(str, static_cast<rapidjson::SizeType>(sizeof(str) - 1));
 
-		json_member.SetString(str, length);
+		rapid_json_serial_impl_serialize_value(throwable_value(th), writer);
 
-		rapid_json_serial_impl_serialize_value(throwable_value(th), &json_inner_value);
-
-		json_map.AddMember(json_member, json_inner_value, rapid_json_allocator);
+		writer.EndObject();
 	}
 	else if (id == TYPE_PTR)
 	{
@@ -331,36 +693,12 @@ void rapid_json_serial_impl_serialize_value(value v, rapidjson::Value *json_v)
 
 		std::string s = ostream.str();
 
-		json_v->SetString(s.c_str(), static_cast<rapidjson::SizeType>(s.length()));
+		writer.String(s.c_str(), static_cast<rapidjson::SizeType>(s.length()));
 	}
 	else if (id == TYPE_NULL)
 	{
-		json_v->SetNull();
-	}
-}
-
-char *rapid_json_serial_impl_document_stringify(rapid_json_document document, size_t *size)
-{
-	rapidjson::StringBuffer buffer;
-	rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
-	document->impl.Accept(writer);
-	size_t buffer_size = buffer.GetSize();
-	size_t buffer_str_size = buffer_size + 1;
-	char *buffer_str = static_cast<char *>(memory_allocator_allocate(document->allocator, sizeof(char) * buffer_str_size));
-
-	if (buffer_str == NULL)
-	{
-		log_write("metacall", LOG_LEVEL_ERROR, "Invalid string allocation for document stringifycation in RapidJSON implementation");
-		return NULL;
+		writer.Null();
 	}
-
-	strncpy(buffer_str, buffer.GetString(), buffer_size);
-
-	buffer_str[buffer_size] = '\0';
-
-	*size = buffer_str_size;
-
-	return buffer_str;
 }
 
 char *rapid_json_serial_impl_serialize(serial_handle handle, value v, size_t *size)
@@ -374,196 +712,27 @@ char *rapid_json_serial_impl_serialize(serial_handle handle, value v, size_t *si
 		return NULL;
 	}
 
-	rapid_json_serial_impl_serialize_value(v, &document->impl);
+	/* Write directly into the allocator buffer instead of building a document and copying its string */
+	rapid_json_serial_impl_stream stream(document->allocator, rapid_json_serial_impl_serialize_size(v) + 1);
+	rapidjson::Writer<rapid_json_serial_impl_stream> writer(stream);
 
-	return rapid_json_serial_impl_document_stringify(document, size);
-}
-
-value rapid_json_serial_impl_deserialize_value(const rapidjson::Value *v)
-{
-	if (v->IsNull())
+	if (stream.Failed() == false)
 	{
-		return value_create_null();
+		rapid_json_serial_impl_serialize_value(v, writer);
 	}
-	else if (v->IsBool() == true)
-	{
-		return value_create_bool(v->GetBool() == true ? 1L : 0L);
-	}
-	/*else if (v->IsString() == true && v->GetStringLength() == 1)
-	{
-		const char * str = v->GetString();
 
-		return value_create_char(str[0]);
-	}*/
-	else if (v->IsInt() == true)
-	{
-		int i = v->GetInt();
+	char *buffer_str = stream.Release(size);
 
-		return value_create_int(i);
-	}
-	else if (v->IsUint() == true)
-	{
-		unsigned int ui = v->GetUint();
-
-		/* Happy path: value fits in a signed int */
-		if (ui <= (unsigned int)INT_MAX)
-		{
-			return value_create_int((int)ui);
-		}
-
-		/* On 64-bit platforms unsigned int's full range (0..UINT_MAX = 4294967295)
-		 * fits within long (LONG_MAX = 9223372036854775807) so we can upcast without
-		 * loss.  On 32-bit where LONG_MAX == INT_MAX this branch is unreachable and
-		 * we return NULL.  The compile-time guard avoids -Wtype-limits. */
-#if LONG_MAX >= UINT_MAX
-		return value_create_long((long)ui);
-#else
-		log_write("metacall", LOG_LEVEL_ERROR, "Unsigned integer value overflows both int and long in RapidJSON implementation");
-		return (value)metacall_error_throw("RapidJSON", -1, NULL, "Unsigned integer value overflows both int and long in RapidJSON implementation");
-#endif
-	}
-	else if (v->IsInt64() == true)
-	{
-		int64_t i = v->GetInt64();
-
-		/* On 32-bit, long is 32 bits so int64_t values outside [LONG_MIN, LONG_MAX]
-		 * would be silently truncated. Guard with a compile-time check to avoid a
-		 * -Wtype-limits warning on 64-bit where long == int64_t and the comparison
-		 * is trivially false. */
-#if LONG_MAX < INT64_MAX
-		if (i < (int64_t)LONG_MIN || i > (int64_t)LONG_MAX)
-		{
-			return (value)metacall_error_throw("RapidJSON", -1, NULL, "64-bit signed integer value overflows long in RapidJSON implementation");
-		}
-#endif
-
-		return value_create_long((long)i);
-	}
-	else if (v->IsUint64() == true)
-	{
-		uint64_t ui = v->GetUint64();
-
-		if (ui > (uint64_t)LONG_MAX)
-		{
-			return (value)metacall_error_throw("RapidJSON", -1, NULL, "64-bit unsigned integer value overflows long in RapidJSON implementation");
-		}
-
-		return value_create_long((long)ui);
-	}
-	else if (v->IsFloat() == true || v->IsLosslessFloat() == true)
-	{
-		float f = v->GetFloat();
-
-		return value_create_float(f);
-	}
-	else if (v->IsDouble() == true || v->IsLosslessDouble() == true)
-	{
-		double d = v->GetDouble();
-
-		return value_create_double((double)d);
-	}
-	else if (v->IsString() == true /*&& v->GetStringLength() > 1*/)
-	{
-		rapidjson::SizeType length = v->GetStringLength();
-
-		const char *str = v->GetString();
-
-		return value_create_string(str, (size_t)length);
-	}
-	else if (v->IsArray() == true)
-	{
-		rapidjson::SizeType size = v->Size();
-
-		value v_array = value_create_array(NULL, size);
-
-		value *values;
-
-		size_t index = 0;
-
-		if (size == 0 || v_array == NULL)
-		{
-			return v_array;
-		}
-
-		values = static_cast<value *>(value_to_array(v_array));
-
-		for (rapidjson::Value::ConstValueIterator it = v->Begin(); it != v->End(); ++it)
-		{
-			values[index] = rapid_json_serial_impl_deserialize_value(it);
-
-			if (values[index] == NULL)
-			{
-				for (size_t iterator = 0; iterator < index; ++iterator)
-				{
-					value_type_destroy(values[iterator]);
-				}
-
-				value_destroy(v_array);
-
-				return NULL;
-			}
-
-			++index;
-		}
-
-		return v_array;
-	}
-	else if (v->IsObject() == true)
+	if (buffer_str == NULL)
 	{
-		const rapidjson::SizeType size = v->MemberCount();
-
-		value v_map = value_create_map(NULL, size);
-
-		value *tuples;
-
-		size_t index = 0;
-
-		if (size == 0 || v_map == NULL)
-		{
-			return v_map;
-		}
-
-		tuples = static_cast<value *>(value_to_map(v_map));
-
-		for (rapidjson::Value::ConstMemberIterator it = v->MemberBegin(); it != v->MemberEnd(); ++it)
-		{
-			const value tupla[] = {
-				rapid_json_serial_impl_deserialize_value(&it->name),
-				rapid_json_serial_impl_deserialize_value(&it->value)
-			};
-
-			if (tupla[0] == NULL || tupla[1] == NULL)
-			{
-				if (tupla[0] != NULL)
-				{
-					value_type_destroy(tupla[0]);
-				}
-
-				if (tupla[1] != NULL)
-				{
-					value_type_destroy(tupla[1]);
-				}
-
-				value_type_destroy(v_map);
-
-				return NULL;
-			}
-
-			tuples[index++] = value_create_array(tupla, sizeof(tupla) / sizeof(tupla[0]));
-		}
-
-		return v_map;
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid string allocation for document stringifycation in RapidJSON implementation");
 	}
 
-	log_write("metacall", LOG_LEVEL_ERROR, "Unsupported value type in RapidJSON implementation");
-
-	return NULL;
+	return buffer_str;
 }
 
 value rapid_json_serial_impl_deserialize(serial_handle handle, const char *buffer, size_t size)
 {
-	rapid_json_document document = static_cast<rapid_json_document>(handle);
-
 	if (handle == NULL || buffer == NULL || size == 0)
 	{
 		log_write("metacall", LOG_LEVEL_ERROR, "Deserialization called with wrong arguments in RapidJSON implementation");
@@ -571,19 +740,33 @@ value rapid_json_serial_impl_deserialize(serial_handle handle, const char *buffe
 		return NULL;
 	}
 
-	rapidjson::ParseResult parse_result = document->impl.Parse(buffer, size - 1);
+	/* Build the values from the parser events instead of parsing into a document and copying it */
+	rapidjson::MemoryStream memory_stream(buffer, size - 1);
+	rapidjson::EncodedInputStream<rapidjson::UTF8<>, rapidjson::MemoryStream> stream(memory_stream);
+	rapidjson::Reader reader;
+	rapid_json_serial_impl_handler handler;
+
+	rapidjson::ParseResult parse_result = reader.Parse(stream, handler);
 
 	if (parse_result.IsError() == true)
 	{
-		const RAPIDJSON_ERROR_CHARTYPE *error_message = rapidjson::GetParseError_En(parse_result.Code());
+		if (parse_result.Code() == rapidjson::kParseErrorTermination)
+		{
+			log_write("metacall", LOG_LEVEL_ERROR, "Invalid value creation while parsing the document (%s) in RapidJSON implementation at %" PRIuS,
+				buffer, parse_result.Offset());
+		}
+		else
+		{
+			const RAPIDJSON_ERROR_CHARTYPE *error_message = rapidjson::GetParseError_En(parse_result.Code());
 
-		log_write("metacall", LOG_LEVEL_ERROR, "Invalid parsing of document (%s) in RapidJSON implementation: %s at %" PRIuS,
-			buffer, error_message, parse_result.Offset());
+			log_write("metacall", LOG_LEVEL_ERROR, "Invalid parsing of document (%s) in RapidJSON implementation: %s at %" PRIuS,
+				buffer, error_message, parse_result.Offset());
+		}
 
 		return NULL;
 	}
 
-	return rapid_json_serial_impl_deserialize_value(&document->impl);
+	return handler.Release();
 }
 
 int rapid_json_serial_impl_destroy(serial_handle handle)
@@ -0,0 +1,948 @@
+/*
+ *	Serial Library by Parra Studios
+ *	Copyright (C) 2016 - 2026 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	A cross-platform library for managing multiple serialization and deserialization formats.
+ *
+ */
+
+/* -- Headers -- */
+
+#include <simd_json_serial/simd_json_serial_impl.h>
+
+#include <metacall/metacall_error.h>
+
+#include <log/log.h>
+
+/* Disable warnings from simdjson */
+#if defined(__clang__)
+	#pragma clang diagnostic push
+	#pragma clang diagnostic ignored "-Wstrict-overflow"
+#elif defined(__GNUC__)
+	#pragma GCC diagnostic push
+	#pragma GCC diagnostic ignored "-Wstrict-overflow"
+#endif
+
+/* The boolean macro defined by reflect collides with the simdjson type names */
+#pragma push_macro("boolean")
+#undef boolean
+
+#include <simdjson.h>
+
+static constexpr simdjson::ondemand::json_type simd_json_type_boolean = simdjson::ondemand::json_type::boolean;
+
+#pragma pop_macro("boolean")
+
+/* Disable warnings from simdjson */
+#if defined(__clang__)
+	#pragma clang diagnostic pop
+#elif defined(__GNUC__)
+	#pragma GCC diagnostic pop
+#endif
+
+#include <charconv>
+#include <climits>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <sstream>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+/* -- Definitions -- */
+
+#define SIMD_JSON_SERIAL_IMPL_NUMBER_SIZE 0x20 /* Upper bound of the characters of a serialized number */
+
+/* -- Type Definitions -- */
+
+typedef struct simd_json_document_type
+{
+	simdjson::ondemand::parser parser;
+	std::vector<char> padded; /* Copy of the input buffer with the padding required by simdjson */
+	memory_allocator allocator;
+
+} * simd_json_document;
+
+/* -- Classes -- */
+
+/* Writer that generates the JSON directly into a buffer of the serial allocator, the buffer
+is reserved with the estimated size of the value and it only grows if the estimation falls short */
+class simd_json_serial_impl_writer
+{
+public:
+	simd_json_serial_impl_writer(memory_allocator allocator, size_t capacity) :
+		allocator(allocator), buffer(NULL), length(0), capacity(capacity), error(false)
+	{
+		buffer = static_cast<char *>(memory_allocator_allocate(allocator, sizeof(char) * capacity));
+
+		if (buffer == NULL)
+		{
+			error = true;
+		}
+	}
+
+	~simd_json_serial_impl_writer()
+	{
+		if (buffer != NULL)
+		{
+			memory_allocator_deallocate(allocator, buffer);
+		}
+	}
+
+	void Put(char c)
+	{
+		/* The buffer may be NULL if the first allocation failed */
+		if (error == true || (length == capacity && Reserve(1) == false))
+		{
+			return;
+		}
+
+		buffer[length++] = c;
+	}
+
+	void Write(const char *str, size_t size)
+	{
+		if (error == true || (length + size > capacity && Reserve(size) == false))
+		{
+			return;
+		}
+
+		memcpy(&buffer[length], str, size);
+		length += size;
+	}
+
+	void String(const char *str, size_t size)
+	{
+		static const char hex[] = "0123456789abcdef";
+		size_t iterator, last = 0;
+
+		Put('"');
+
+		for (iterator = 0; iterator < size; ++iterator)
+		{
+			const unsigned char c = static_cast<unsigned char>(str[iterator]);
+			char escape[6] = { '\\', 'u', '0', '0', 0, 0 };
+			size_t escape_size = 2;
+
+			if (c >= 0x20 && c != '"' && c != '\\')
+			{
+				continue;
+			}
+
+			switch (c)
+			{
+				case '"':
+				case '\\':
+					escape[1] = static_cast<char>(c);
+					break;
+				case '\b':
+					escape[1] = 'b';
+					break;
+				case '\f':
+					escape[1] = 'f';
+					break;
+				case '\n':
+					escape[1] = 'n';
+					break;
+				case '\r':
+					escape[1] = 'r';
+					break;
+				case '\t':
+					escape[1] = 't';
+					break;
+				default:
+					escape[4] = hex[c >> 4];
+					escape[5] = hex[c & 0x0F];
+					escape_size = sizeof(escape);
+					break;
+			}
+
+			/* Write the characters that do not need to be escaped in a single block */
+			Write(&str[last], iterator - last);
+			Write(escape, escape_size);
+			last = iterator + 1;
+		}
+
+		Write(&str[last], size - last);
+
+		Put('"');
+	}
+
+	template <typename T>
+	void Integer(T i)
+	{
+		char number[SIMD_JSON_SERIAL_IMPL_NUMBER_SIZE];
+
+		std::to_chars_result result = std::to_chars(number, number + sizeof(number), i);
+
+		Write(number, static_cast<size_t>(result.ptr - number));
+	}
+
+	template <typename T>
+	void Decimal(T d)
+	{
+		char number[SIMD_JSON_SERIAL_IMPL_NUMBER_SIZE];
+		size_t size;
+
+		/* JSON does not support infinite or not a number values */
+		if (d != d || d > std::numeric_limits<T>::max() || d < std::numeric_limits<T>::lowest())
+		{
+			static const char null_str[] = "null";
+
+			Write(null_str, sizeof(null_str) - 1);
+
+			return;
+		}
+
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+		/* Shortest representation that round trips to the same number */
+		std::to_chars_result result = std::to_chars(number, number + sizeof(number), d);
+
+		size = static_cast<size_t>(result.ptr - number);
+#else
+		int written = snprintf(number, sizeof(number), "%.*g", std::numeric_limits<T>::max_digits10, static_cast<double>(d));
+
+		size = written > 0 ? static_cast<size_t>(written) : 0;
+#endif
+
+		Write(number, size);
+
+		/* Keep the number as a decimal when it is parsed again */
+		if (std::string_view(number, size).find_first_of(".eE") == std::string_view::npos)
+		{
+			Write(".0", 2);
+		}
+	}
+
+	memory_allocator Allocator() const
+	{
+		return allocator;
+	}
+
+	bool Failed() const
+	{
+		return error;
+	}
+
+	const char *Data() const
+	{
+		return buffer;
+	}
+
+	size_t Length() const
+	{
+		return length;
+	}
+
+	/* Terminate the string and give the ownership of the buffer to the caller */
+	char *Release(size_t *size)
+	{
+		char *result;
+
+		if (error == true)
+		{
+			return NULL;
+		}
+
+		Put('\0');
+
+		if (error == true)
+		{
+			return NULL;
+		}
+
+		result = buffer;
+		*size = length;
+		buffer = NULL;
+
+		return result;
+	}
+
+private:
+	bool Reserve(size_t size)
+	{
+		size_t new_capacity = capacity * 2;
+		char *new_buffer;
+
+		if (error == true)
+		{
+			return false;
+		}
+
+		while (new_capacity < length + size)
+		{
+			new_capacity *= 2;
+		}
+
+		new_buffer = static_cast<char *>(memory_allocator_reallocate(allocator, buffer, capacity, sizeof(char) * new_capacity));
+
+		if (new_buffer == NULL)
+		{
+			error = true;
+			return false;
+		}
+
+		buffer = new_buffer;
+		capacity = new_capacity;
+
+		return true;
+	}
+
+	memory_allocator allocator;
+	char *buffer;
+	size_t length;
+	size_t capacity;
+	bool error;
+};
+
+/* -- Private Methods -- */
+
+static size_t simd_json_serial_impl_serialize_size(value v);
+
+static void simd_json_serial_impl_serialize_value(value v, simd_json_serial_impl_writer &writer);
+
+template <typename T>
+static value simd_json_serial_impl_deserialize_value(T &json_v, simdjson::error_code &error);
+
+static value simd_json_serial_impl_deserialize_string(std::string_view str);
+
+static void simd_json_serial_impl_deserialize_destroy(std::vector<value> &values);
+
+/* -- Methods -- */
+
+const char *simd_json_serial_impl_extension()
+{
+	static const char extension[] = "json";
+
+	return extension;
+}
+
+serial_handle simd_json_serial_impl_initialize(memory_allocator allocator)
+{
+	simd_json_document document = new simd_json_document_type();
+
+	if (document == nullptr)
+	{
+		return NULL;
+	}
+
+	document->allocator = allocator;
+
+	return (serial_handle)document;
+}
+
+size_t simd_json_serial_impl_serialize_size(value v)
+{
+	type_id id = value_type_id(v);
+
+	if (id == TYPE_BOOL || id == TYPE_NULL)
+	{
+		return sizeof("false") - 1;
+	}
+	else if (id == TYPE_CHAR)
+	{
+		return sizeof("\"c\"") - 1;
+	}
+	else if (id == TYPE_SHORT || id == TYPE_INT || id == TYPE_LONG || id == TYPE_FLOAT || id == TYPE_DOUBLE || id == TYPE_PTR)
+	{
+		return SIMD_JSON_SERIAL_IMPL_NUMBER_SIZE;
+	}
+	else if (id == TYPE_STRING)
+	{
+		/* Quotes included, the escaped characters are not taken into account */
+		return value_type_size(v) + 1;
+	}
+	else if (id == TYPE_BUFFER)
+	{
+		return sizeof("{\"data\":[],\"length\":}") + SIMD_JSON_SERIAL_IMPL_NUMBER_SIZE + value_type_size(v) * 4;
+	}
+	else if (id == TYPE_ARRAY)
+	{
+		value *value_array = value_to_array(v);
+		size_t iterator, array_size = value_type_count(v), size = 2 + array_size;
+
+		for (iterator = 0; iterator < array_size; ++iterator)
+		{
+			size += simd_json_serial_impl_serialize_size(value_array[iterator]);
+		}
+
+		return size;
+	}
+	else if (id == TYPE_MAP)
+	{
+		value *value_map = value_to_map(v);
+		size_t iterator, map_size = value_type_count(v), size = 2 + map_size * 2;
+
+		for (iterator = 0; iterator < map_size; ++iterator)
+		{
+			value *tupla_array = value_to_array(value_map[iterator]);
+
+			size += simd_json_serial_impl_serialize_size(tupla_array[0]) + simd_json_serial_impl_serialize_size(tupla_array[1]);
+		}
+
+		return size;
+	}
+	else if (id == TYPE_EXCEPTION)
+	{
+		exception ex = value_to_exception(v);
+
+		return sizeof("{\"message\":\"\",\"label\":\"\",\"code\":,\"stacktrace\":\"\"}") + SIMD_JSON_SERIAL_IMPL_NUMBER_SIZE +
+			   strlen(exception_message(ex)) + strlen(exception_label(ex)) + strlen(exception_stacktrace(ex));
+	}
+	else if (id == TYPE_THROWABLE)
+	{
+		return sizeof("{\"ExceptionThrown\":}") + simd_json_serial_impl_serialize_size(throwable_value(value_to_throwable(v)));
+	}
+
+	/* Future, function, class and object are serialized as a short string */
+	return sizeof("\"[Function]\"");
+}
+
+void simd_json_serial_impl_serialize_value(value v, simd_json_serial_impl_writer &writer)
+{
+	type_id id = value_type_id(v);
+
+	if (id == TYPE_BOOL)
+	{
+		static const char true_str[] = "true";
+		static const char false_str[] = "false";
+
+		if (value_to_bool(v) == 1L)
+		{
+			writer.Write(true_str, sizeof(true_str) - 1);
+		}
+		else
+		{
+			writer.Write(false_str, sizeof(false_str) - 1);
+		}
+	}
+	else if (id == TYPE_CHAR)
+	{
+		char c = value_to_char(v);
+
+		writer.String(&c, 1);
+	}
+	else if (id == TYPE_SHORT)
+	{
+		writer.Integer(value_to_short(v));
+	}
+	else if (id == TYPE_INT)
+	{
+		writer.Integer(value_to_int(v));
+	}
+	else if (id == TYPE_LONG)
+	{
+		writer.Integer(value_to_long(v));
+	}
+	else if (id == TYPE_FLOAT)
+	{
+		writer.Decimal(value_to_float(v));
+	}
+	else if (id == TYPE_DOUBLE)
+	{
+		writer.Decimal(value_to_double(v));
+	}
+	else if (id == TYPE_STRING)
+	{
+		size_t size = value_type_size(v);
+
+		writer.String(value_to_string(v), size > 0 ? size - 1 : 0);
+	}
+	else if (id == TYPE_BUFFER)
+	{
+		static const char data_str[] = "{\"data\":[";
+		static const char length_str[] = "],\"length\":";
+
+		void *buffer = value_to_buffer(v);
+
+		size_t size = value_type_size(v);
+
+		writer.Write(data_str, sizeof(data_str) - 1);
+
+		for (size_t iterator = 0; iterator < size; ++iterator)
+		{
+			const char *data = (const char *)(((uintptr_t)buffer) + iterator);
+
+			if (iterator > 0)
+			{
+				writer.Put(',');
+			}
+
+			writer.Integer((unsigned int)*data);
+		}
+
+		writer.Write(length_str, sizeof(length_str) - 1);
+		writer.Integer(size);
+		writer.Put('}');
+	}
+	else if (id == TYPE_ARRAY)
+	{
+		value *value_array = value_to_array(v);
+
+		size_t array_size = value_type_count(v);
+
+		writer.Put('[');
+
+		for (size_t iterator = 0; iterator < array_size; ++iterator)
+		{
+			if (iterator > 0)
+			{
+				writer.Put(',');
+			}
+
+			simd_json_serial_impl_serialize_value(value_array[iterator], writer);
+		}
+
+		writer.Put(']');
+	}
+	else if (id == TYPE_MAP)
+	{
+		value *value_map = value_to_map(v);
+
+		size_t map_size = value_type_count(v);
+
+		writer.Put('{');
+
+		for (size_t iterator = 0; iterator < map_size; ++iterator)
+		{
+			value *tupla_array = value_to_array(value_map[iterator]);
+
+			type_id key_id = value_type_id(tupla_array[0]);
+
+			if (iterator > 0)
+			{
+				writer.Put(',');
+			}
+
+			if (key_id == TYPE_STRING || key_id == TYPE_CHAR)
+			{
+				simd_json_serial_impl_serialize_value(tupla_array[0], writer);
+			}
+			else
+			{
+				/* JSON keys must be strings, the other keys are written as their JSON representation */
+				simd_json_serial_impl_writer key_writer(writer.Allocator(), simd_json_serial_impl_serialize_size(tupla_array[0]));
+
+				simd_json_serial_impl_serialize_value(tupla_array[0], key_writer);
+
+				writer.String(key_writer.Data(), key_writer.Length());
+			}
+
+			writer.Put(':');
+
+			simd_json_serial_impl_serialize_value(tupla_array[1], writer);
+		}
+
+		writer.Put('}');
+	}
+	else if (id == TYPE_FUTURE)
+	{
+		/* TODO: Improve future serialization */
+		static const char str[] = "[Future]";
+
+		writer.String(str, sizeof(str) - 1);
+	}
+	else if (id == TYPE_FUNCTION)
+	{
+		/* TODO: Improve function serialization */
+		static const char str[] = "[Function]";
+
+		writer.String(str, sizeof(str) - 1);
+	}
+	else if (id == TYPE_CLASS)
+	{
+		/* TODO: Improve class serialization */
+		static const char str[] = "[Class]";
+
+		writer.String(str, sizeof(str) - 1);
+	}
+	else if (id == TYPE_OBJECT)
+	{
+		/* TODO: Improve object serialization */
+		static const char str[] = "[Object]";
+
+		writer.String(str, sizeof(str) - 1);
+	}
+	else if (id == TYPE_EXCEPTION)
+	{
+		static const char message_str[] = "{\"message\":";
+		static const char label_str[] = ",\"label\":";
+		static const char code_str[] = ",\"code\":";
+		static const char stacktrace_str[] = ",\"stacktrace\":";
+
+		exception ex = value_to_exception(v);
+
+		writer.Write(message_str, sizeof(message_str) - 1);
+		writer.String(exception_message(ex), strlen(exception_message(ex)));
+
+		writer.Write(label_str, sizeof(label_str) - 1);
+		writer.String(exception_label(ex), strlen(exception_label(ex)));
+
+		writer.Write(code_str, sizeof(code_str) - 1);
+		writer.Integer(exception_error_code(ex));
+
+		writer.Write(stacktrace_str, sizeof(stacktrace_str) - 1);
+		writer.String(exception_stacktrace(ex), strlen(exception_stacktrace(ex)));
+
+		writer.Put('}');
+	}
+	else if (id == TYPE_THROWABLE)
+	{
+		static const char str[] = "{\"ExceptionThrown\":";
+
+		writer.Write(str, sizeof(str) - 1);
+
+		simd_json_serial_impl_serialize_value(throwable_value(value_to_throwable(v)), writer);
+
+		writer.Put('}');
+	}
+	else if (id == TYPE_PTR)
+	{
+		std::ostringstream ostream;
+
+		ostream << value_to_ptr(v);
+
+		std::string s = ostream.str();
+
+		writer.String(s.c_str(), s.length());
+	}
+	else if (id == TYPE_NULL)
+	{
+		static const char null_str[] = "null";
+
+		writer.Write(null_str, sizeof(null_str) - 1);
+	}
+}
+
+char *simd_json_serial_impl_serialize(serial_handle handle, value v, size_t *size)
+{
+	simd_json_document document = static_cast<simd_json_document>(handle);
+
+	if (handle == NULL || v == NULL || size == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Serialization called with wrong arguments in simdjson implementation");
+
+		return NULL;
+	}
+
+	simd_json_serial_impl_writer writer(document->allocator, simd_json_serial_impl_serialize_size(v) + 1);
+
+	if (writer.Failed() == false)
+	{
+		simd_json_serial_impl_serialize_value(v, writer);
+	}
+
+	char *buffer_str = writer.Release(size);
+
+	if (buffer_str == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid string allocation for document stringifycation in simdjson implementation");
+	}
+
+	return buffer_str;
+}
+
+value simd_json_serial_impl_deserialize_string(std::string_view str)
+{
+	/* The unescaped strings are not null terminated, so they are copied into a zeroed value */
+	value v = value_create_string(NULL, str.size());
+
+	if (v != NULL)
+	{
+		memcpy(value_to_string(v), str.data(), str.size());
+	}
+
+	return v;
+}
+
+void simd_json_serial_impl_deserialize_destroy(std::vector<value> &values)
+{
+	for (value v : values)
+	{
+		value_type_destroy(v);
+	}
+
+	values.clear();
+}
+
+template <typename T>
+value simd_json_serial_impl_deserialize_value(T &json_v, simdjson::error_code &error)
+{
+	simdjson::ondemand::json_type json_type;
+
+	if ((error = json_v.type().get(json_type)) != simdjson::SUCCESS)
+	{
+		return NULL;
+	}
+
+	switch (json_type)
+	{
+		case simdjson::ondemand::json_type::null: {
+			bool is_null = false;
+
+			if ((error = json_v.is_null().get(is_null)) != simdjson::SUCCESS)
+			{
+				return NULL;
+			}
+
+			if (is_null == false)
+			{
+				error = simdjson::N_ATOM_ERROR;
+				return NULL;
+			}
+
+			return value_create_null();
+		}
+
+		case simd_json_type_boolean: {
+			bool b;
+
+			if ((error = json_v.get_bool().get(b)) != simdjson::SUCCESS)
+			{
+				return NULL;
+			}
+
+			return value_create_bool(b == true ? 1L : 0L);
+		}
+
+		case simdjson::ondemand::json_type::number: {
+			simdjson::ondemand::number_type number_type;
+
+			if ((error = json_v.get_number_type().get(number_type)) != simdjson::SUCCESS)
+			{
+				return NULL;
+			}
+
+			if (number_type == simdjson::ondemand::number_type::signed_integer)
+			{
+				int64_t i;
+
+				if ((error = json_v.get_int64().get(i)) != simdjson::SUCCESS)
+				{
+					return NULL;
+				}
+
+				if (i >= INT_MIN && i <= INT_MAX)
+				{
+					return value_create_int((int)i);
+				}
+
+				/* On 32-bit, long is 32 bits so int64_t values outside [LONG_MIN, LONG_MAX]
+				 * would be silently truncated. Guard with a compile-time check to avoid a
+				 * -Wtype-limits warning on 64-bit where long == int64_t. */
+#if LONG_MAX < INT64_MAX
+				if (i < (int64_t)LONG_MIN || i > (int64_t)LONG_MAX)
+				{
+					return (value)metacall_error_throw("simdjson", -1, NULL, "64-bit signed integer value overflows long in simdjson implementation");
+				}
+#endif
+
+				return value_create_long((long)i);
+			}
+			else if (number_type == simdjson::ondemand::number_type::unsigned_integer)
+			{
+				uint64_t ui;
+
+				if ((error = json_v.get_uint64().get(ui)) != simdjson::SUCCESS)
+				{
+					return NULL;
+				}
+
+				if (ui > (uint64_t)LONG_MAX)
+				{
+					return (value)metacall_error_throw("simdjson", -1, NULL, "64-bit unsigned integer value overflows long in simdjson implementation");
+				}
+
+				return value_create_long((long)ui);
+			}
+			else if (number_type == simdjson::ondemand::number_type::floating_point_number)
+			{
+				double d;
+
+				if ((error = json_v.get_double().get(d)) != simdjson::SUCCESS)
+				{
+					return NULL;
+				}
+
+				/* Same criteria as RapidJSON serial, the numbers in the float range are stored as float */
+				if (d >= -3.4028234e38 && d <= 3.4028234e38)
+				{
+					return value_create_float((float)d);
+				}
+
+				return value_create_double(d);
+			}
+
+			error = simdjson::BIGINT_ERROR;
+
+			return NULL;
+		}
+
+		case simdjson::ondemand::json_type::string: {
+			std::string_view str;
+
+			if ((error = json_v.get_string().get(str)) != simdjson::SUCCESS)
+			{
+				return NULL;
+			}
+
+			return simd_json_serial_impl_deserialize_string(str);
+		}
+
+		case simdjson::ondemand::json_type::array: {
+			simdjson::ondemand::array json_array;
+			std::vector<value> values;
+
+			if ((error = json_v.get_array().get(json_array)) != simdjson::SUCCESS)
+			{
+				return NULL;
+			}
+
+			for (auto element : json_array)
+			{
+				simdjson::ondemand::value json_element;
+				value v;
+
+				if ((error = std::move(element).get(json_element)) != simdjson::SUCCESS || (v = simd_json_serial_impl_deserialize_value(json_element, error)) == NULL)
+				{
+					simd_json_serial_impl_deserialize_destroy(values);
+					return NULL;
+				}
+
+				values.push_back(v);
+			}
+
+			value v_array = value_create_array(values.empty() ? NULL : values.data(), values.size());
+
+			if (v_array == NULL)
+			{
+				simd_json_serial_impl_deserialize_destroy(values);
+				error = simdjson::MEMALLOC;
+			}
+
+			return v_array;
+		}
+
+		case simdjson::ondemand::json_type::object: {
+			simdjson::ondemand::object json_object;
+			std::vector<value> tuples;
+
+			if ((error = json_v.get_object().get(json_object)) != simdjson::SUCCESS)
+			{
+				return NULL;
+			}
+
+			for (auto field_result : json_object)
+			{
+				simdjson::ondemand::field field;
+				std::string_view key;
+				value tupla[2] = { NULL, NULL }, v_tupla = NULL;
+
+				if ((error = std::move(field_result).get(field)) == simdjson::SUCCESS && (error = field.unescaped_key().get(key)) == simdjson::SUCCESS)
+				{
+					tupla[0] = simd_json_serial_impl_deserialize_string(key);
+
+					if (tupla[0] != NULL)
+					{
+						tupla[1] = simd_json_serial_impl_deserialize_value(field.value(), error);
+					}
+
+					if (tupla[1] != NULL)
+					{
+						v_tupla = value_create_array(tupla, 2);
+					}
+				}
+
+				if (v_tupla == NULL)
+				{
+					value_type_destroy(tupla[0]);
+					value_type_destroy(tupla[1]);
+					simd_json_serial_impl_deserialize_destroy(tuples);
+
+					if (error == simdjson::SUCCESS)
+					{
+						error = simdjson::MEMALLOC;
+					}
+
+					return NULL;
+				}
+
+				tuples.push_back(v_tupla);
+			}
+
+			value v_map = value_create_map(tuples.empty() ? NULL : tuples.data(), tuples.size());
+
+			if (v_map == NULL)
+			{
+				simd_json_serial_impl_deserialize_destroy(tuples);
+				error = simdjson::MEMALLOC;
+			}
+
+			return v_map;
+		}
+
+		default:
+			break;
+	}
+
+	error = simdjson::INCORRECT_TYPE;
+
+	return NULL;
+}
+
+value simd_json_serial_impl_deserialize(serial_handle handle, const char *buffer, size_t size)
+{
+	simd_json_document document = static_cast<simd_json_document>(handle);
+
+	if (handle == NULL || buffer == NULL || size == 0)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Deserialization called with wrong arguments in simdjson implementation");
+
+		return NULL;
+	}
+
+	const size_t length = size - 1;
+
+	/* The parser reads in blocks past the end of the input, so it is copied into a padded buffer */
+	document->padded.resize(length + simdjson::SIMDJSON_PADDING);
+
+	memcpy(document->padded.data(), buffer, length);
+
+	simdjson::ondemand::document json_document;
+	simdjson::error_code error = document->parser.iterate(document->padded.data(), length, document->padded.size()).get(json_document);
+	value v = NULL;
+
+	if (error == simdjson::SUCCESS)
+	{
+		v = simd_json_serial_impl_deserialize_value(json_document, error);
+
+		/* Reject trailing content after the root value */
+		if (v != NULL && json_document.at_end() == false)
+		{
+			value_type_destroy(v);
+			v = NULL;
+			error = simdjson::TRAILING_CONTENT;
+		}
+	}
+
+	if (v == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid parsing of document (%s) in simdjson implementation: %s",
+			buffer, simdjson::error_message(error));
+	}
+
+	return v;
+}
+
+int simd_json_serial_impl_destroy(serial_handle handle)
+{
+	simd_json_document document = static_cast<simd_json_document>(handle);
+
+	if (document != NULL)
+	{
+		delete document;
+	}
+
+	return 0;
+}
@@ -0,0 +1,180 @@
+/*
+ *	Abstract Data Type Library by Parra Studios
+ *	A abstract data type library providing generic containers.
+ *
+ *	Copyright (C) 2016 - 2026 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <adt/adt_hash.h>
+#include <adt/adt_intern.h>
+#include <adt/adt_set.h>
+
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+class adt_intern_test : public testing::Test
+{
+public:
+};
+
+TEST_F(adt_intern_test, HashString)
+{
+	/* All bytes of the string must contribute to the hash */
+	EXPECT_NE((hash)hash_callback_str((hash_key) "abc"), (hash)hash_callback_str((hash_key) "xbc"));
+	EXPECT_NE((hash)hash_callback_str((hash_key) "abc"), (hash)hash_callback_str((hash_key) "abx"));
+	EXPECT_NE((hash)hash_callback_str((hash_key) ""), (hash)hash_callback_str((hash_key) "a"));
+
+	for (size_t length = 0; length < 128; ++length)
+	{
+		std::string str(length, 'a');
+		std::string other(str);
+
+		EXPECT_EQ((hash)hash_callback_str((hash_key)str.c_str()), (hash)hash_buffer(str.c_str(), length));
+
+		if (length > 0)
+		{
+			other[length - 1] = 'b';
+
+			EXPECT_NE((hash)hash_buffer(str.c_str(), length), (hash)hash_buffer(other.c_str(), length));
+
+			other = str;
+			other[0] = 'b';
+
+			EXPECT_NE((hash)hash_buffer(str.c_str(), length), (hash)hash_buffer(other.c_str(), length));
+		}
+	}
+}
+
+TEST_F(adt_intern_test, InternString)
+{
+	static const char name[] = "adt_intern_test_function";
+
+	char copy[sizeof(name)];
+
+	memcpy(copy, name, sizeof(name));
+
+	EXPECT_EQ((const char *)NULL, (const char *)intern_find(name));
+
+	const char *interned = intern_string(name);
+
+	ASSERT_NE((const char *)NULL, (const char *)interned);
+	EXPECT_NE((const char *)name, (const char *)interned);
+	EXPECT_STREQ(name, interned);
+	EXPECT_EQ((const char *)interned, (const char *)intern_string(copy));
+	EXPECT_EQ((const char *)interned, (const char *)intern_find(copy));
+	EXPECT_EQ((const char *)interned, (const char *)intern_string(interned));
+	EXPECT_EQ((hash)hash_callback_str((hash_key)name), (hash)intern_hash(interned));
+	EXPECT_EQ((size_t)sizeof(name) - 1, (size_t)intern_length(interned));
+	EXPECT_EQ((const char *)NULL, (const char *)intern_find("adt_intern_test_missing"));
+}
+
+TEST_F(adt_intern_test, InternSet)
+{
+	static const size_t size = 10000;
+
+	std::vector<std::string> names;
+	std::vector<const char *> interned;
+
+	set s = set_create(&hash_callback_intern, &comparable_callback_ptr);
+
+	ASSERT_NE((set)NULL, (set)s);
+
+	names.reserve(size);
+
+	for (size_t iterator = 0; iterator < size; ++iterator)
+	{
+		names.push_back("name_" + std::to_string(iterator));
+		interned.push_back(intern_string(names.back().c_str()));
+
+		ASSERT_NE((const char *)NULL, (const char *)interned.back());
+		EXPECT_EQ((int)0, (int)set_insert(s, (set_key)interned.back(), (set_value)&names.back()));
+	}
+
+	for (size_t iterator = 0; iterator < size; ++iterator)
+	{
+		const char *key = intern_find(names[iterator].c_str());
+
+		EXPECT_EQ((const char *)interned[iterator], (const char *)key);
+		EXPECT_EQ((void *)&names[iterator], (void *)set_get(s, (set_key)key));
+	}
+
+	set_destroy(s);
+}
+
+TEST_F(adt_intern_test, InternConcurrent)
+{
+	static const size_t threads_size = 8;
+	static const size_t size = 5000;
+
+	std::vector<std::vector<const char *>> results(threads_size);
+	std::vector<std::thread> threads;
+
+	/* All threads intern the same strings while the table grows, and all of them must
+	obtain the same pointers */
+	for (size_t thread = 0; thread < threads_size; ++thread)
+	{
+		threads.emplace_back([thread, &results]() {
+			for (size_t iterator = 0; iterator < size; ++iterator)
+			{
+				std::string name = "concurrent_" + std::to_string(iterator);
+
+				results[thread].push_back(intern_string(name.c_str()));
+			}
+		});
+	}
+
+	for (std::thread &t : threads)
+	{
+		t.join();
+	}
+
+	for (size_t iterator = 0; iterator < size; ++iterator)
+	{
+		ASSERT_NE((const char *)NULL, (const char *)results[0][iterator]);
+
+		for (size_t thread = 1; thread < threads_size; ++thread)
+		{
+			EXPECT_EQ((const char *)results[0][iterator], (const char *)results[thread][iterator]);
+		}
+	}
+}
+
+TEST_F(adt_intern_test, InternDestroy)
+{
+	for (size_t iterator = 0; iterator < 0x400; ++iterator)
+	{
+		std::string name = "destroy_" + std::to_string(iterator);
+
+		ASSERT_NE((const char *)NULL, (const char *)intern_string(name.c_str()));
+	}
+
+	intern_destroy();
+
+	/* The table is empty after destroying it, and it is created again on the next insertion */
+	EXPECT_EQ((const char *)NULL, (const char *)intern_find("destroy_0"));
+
+	const char *interned = intern_string("destroy_0");
+
+	ASSERT_NE((const char *)NULL, (const char *)interned);
+	EXPECT_STREQ("destroy_0", interned);
+	EXPECT_EQ((const char *)interned, (const char *)intern_find("destroy_0"));
+
+	intern_destroy();
+}
@@ -248,3 +248,78 @@ TEST_F(adt_set_test, DefaultConstructor)
 		set_destroy(s);
 	}
 }
+
+TEST_F(adt_set_test, InsertRemoveInterleaved)
+{
+	set s = set_create(&hash_callback_ptr, &comparable_callback_ptr);
+
+	static const size_t size = 10000;
+
+	std::vector<int> values(size);
+
+	for (size_t i = 0; i < size; ++i)
+	{
+		values[i] = (int)i;
+
+		EXPECT_EQ((int)0, (int)set_insert(s, &values[i], &values[i]));
+	}
+
+	EXPECT_EQ((size_t)size, (size_t)set_size(s));
+
+	/* Remove the odd keys, leaving deleted slots in between */
+	for (size_t i = 1; i < size; i += 2)
+	{
+		EXPECT_EQ((int *)&values[i], (int *)set_remove(s, &values[i]));
+	}
+
+	EXPECT_EQ((size_t)(size / 2), (size_t)set_size(s));
+
+	for (size_t i = 0; i < size; ++i)
+	{
+		if (i % 2 == 0)
+		{
+			EXPECT_EQ((int *)&values[i], (int *)set_get(s, &values[i]));
+		}
+		else
+		{
+			EXPECT_EQ((int)1, (int)set_contains(s, &values[i]));
+		}
+	}
+
+	/* Insert the removed keys again and remove them many times, for reusing the deleted slots */
+	for (size_t iteration = 0; iteration < 8; ++iteration)
+	{
+		for (size_t i = 1; i < size; i += 2)
+		{
+			EXPECT_EQ((int)0, (int)set_insert(s, &values[i], &values[i]));
+		}
+
+		EXPECT_EQ((size_t)size, (size_t)set_size(s));
+
+		for (size_t i = 1; i < size; i += 2)
+		{
+			EXPECT_EQ((int *)&values[i], (int *)set_remove(s, &values[i]));
+		}
+	}
+
+	/* Iterate and remove at the same time */
+	size_t count = 0;
+	struct set_iterator_type it;
+
+	for (set_iterator_begin(&it, s); set_iterator_end(&it) != 0; set_iterator_next(&it))
+	{
+		int *value = (int *)set_iterator_value(&it);
+
+		EXPECT_EQ((int)0, (int)(*value % 2));
+
+		EXPECT_EQ((int *)value, (int *)set_remove(s, set_iterator_key(&it)));
+
+		++count;
+	}
+
+	EXPECT_EQ((size_t)(size / 2), (size_t)count);
+
+	EXPECT_EQ((size_t)0, (size_t)set_size(s));
+
+	set_destroy(s);
+}
@@ -21,6 +21,7 @@
 #include <gtest/gtest.h>
 
 #include <configuration/configuration.h>
+#include <configuration/configuration_cache.h>
 
 #include <environment/environment_variable.h>
 
@@ -28,6 +29,9 @@
 
 #include <log/log.h>
 
+#include <fstream>
+#include <string>
+
 #define CONFIGURATION_PATH "CONFIGURATION_PATH"
 
 class configuration_test : public testing::Test
@@ -169,3 +173,88 @@ TEST_F(configuration_test, DefaultConstructor)
 
 	memory_allocator_destroy(allocator);
 }
+
+TEST_F(configuration_test, Cache)
+{
+	EXPECT_EQ((int)0, (int)log_configure("metacall",
+						  log_policy_format_text(),
+						  log_policy_schedule_sync(),
+						  log_policy_storage_sequential(),
+						  log_policy_stream_stdio(stdout)));
+
+	const char key_value[] = "value";
+
+	char *configuration_path = environment_variable_create(CONFIGURATION_PATH, NULL);
+
+	ASSERT_NE((char *)NULL, (char *)configuration_path);
+
+	std::string global_path(configuration_path);
+
+	std::string cache_path = global_path.substr(0, global_path.find_last_of("/\\") + 1) + "cache.json";
+
+	memory_allocator allocator = memory_allocator_std(&std::malloc, &std::realloc, &std::free);
+
+	ASSERT_NE((memory_allocator)NULL, (memory_allocator)allocator);
+
+	/* Initialize twice, the second time the trees are copied from the cache */
+	for (int iterator = 0; iterator < 2; ++iterator)
+	{
+		ASSERT_EQ((int)0, (int)configuration_initialize("rapid_json", configuration_path, allocator));
+
+		configuration child_a = configuration_scope("child_a");
+
+		ASSERT_NE((configuration)NULL, (configuration)child_a);
+
+		value v = configuration_value_type(child_a, key_value, TYPE_INT);
+
+		ASSERT_NE((value)NULL, (value)v);
+
+		EXPECT_EQ((int)65432345, (int)value_to_int(v));
+
+		configuration_destroy();
+	}
+
+	struct configuration_cache_stamp_type stamp;
+
+	ASSERT_EQ((int)0, (int)configuration_cache_stat(configuration_path, &stamp));
+
+	value cached = configuration_cache_get(configuration_path, &stamp);
+
+	ASSERT_NE((value)NULL, (value)cached);
+
+	value_type_destroy(cached);
+
+	environment_variable_destroy(configuration_path);
+
+	/* Modifying the file invalidates the cached tree */
+	ASSERT_EQ((int)0, (int)configuration_initialize("rapid_json", global_path.c_str(), allocator));
+
+	const int cache_values[] = { 1, 22 };
+
+	for (int cache_value : cache_values)
+	{
+		{
+			std::ofstream file(cache_path, std::ios::out | std::ios::trunc);
+
+			file << "{ \"value\": " << cache_value << " }";
+		}
+
+		configuration config = configuration_create("cache", cache_path.c_str(), NULL, allocator);
+
+		ASSERT_NE((configuration)NULL, (configuration)config);
+
+		value v = configuration_value_type(config, key_value, TYPE_INT);
+
+		ASSERT_NE((value)NULL, (value)v);
+
+		EXPECT_EQ((int)cache_value, (int)value_to_int(v));
+
+		EXPECT_EQ((int)0, (int)configuration_clear(config));
+	}
+
+	configuration_destroy();
+
+	std::remove(cache_path.c_str());
+
+	memory_allocator_destroy(allocator);
+}
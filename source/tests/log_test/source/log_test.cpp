@@ -25,6 +25,21 @@
 #include <log/log_level.h>
 #include <log/log_map.h>
 
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if !defined(_WIN32)
+	#include <arpa/inet.h>
+	#include <netinet/in.h>
+	#include <poll.h>
+	#include <sys/socket.h>
+	#include <sys/un.h>
+	#include <unistd.h>
+#endif
+
 class log_test : public testing::Test
 {
 public:
@@ -138,31 +153,31 @@ TEST_F(log_test, DefaultConstructor)
 		EXPECT_EQ((int)0, (int)log_configure(log_name_list[5].name,
 							  log_policy_format_binary(),
 							  log_policy_schedule_async(),
-							  log_policy_storage_batch(storage_batch_size),
+							  log_policy_storage_batch(storage_batch_size, LOG_LEVEL_ERROR, 0),
 							  log_policy_stream_stdio(stdout)));
 
 		EXPECT_EQ((int)0, (int)log_configure(log_name_list[6].name,
 							  log_policy_format_binary(),
 							  log_policy_schedule_async(),
-							  log_policy_storage_batch(storage_batch_size),
+							  log_policy_storage_batch(storage_batch_size, LOG_LEVEL_ERROR, 0),
 							  log_policy_stream_stdio(stderr)));
 
 		EXPECT_EQ((int)0, (int)log_configure(log_name_list[7].name,
 							  log_policy_format_binary(),
 							  log_policy_schedule_async(),
-							  log_policy_storage_batch(storage_batch_size),
+							  log_policy_storage_batch(storage_batch_size, LOG_LEVEL_ERROR, 0),
 							  log_policy_stream_file(log_name_list[7].name, "a+")));
 
 		EXPECT_EQ((int)0, (int)log_configure(log_name_list[8].name,
 							  log_policy_format_binary(),
 							  log_policy_schedule_async(),
-							  log_policy_storage_batch(storage_batch_size),
+							  log_policy_storage_batch(storage_batch_size, LOG_LEVEL_ERROR, 0),
 							  log_policy_stream_syslog(log_name_list[8].name)));
 
 		EXPECT_EQ((int)0, (int)log_configure(log_name_list[9].name,
 							  log_policy_format_binary(),
 							  log_policy_schedule_async(),
-							  log_policy_storage_batch(storage_batch_size),
+							  log_policy_storage_batch(storage_batch_size, LOG_LEVEL_ERROR, 0),
 							  log_policy_stream_socket("127.0.0.1", UINT16_C(0x0209))));
 	}
 
@@ -199,6 +214,10 @@ TEST_F(log_test, DefaultConstructor)
 		}
 	}
 
+	/* Remove the files written by the file streams once they are closed */
+	EXPECT_EQ((int)0, (int)std::remove(log_name_list[2].name));
+	EXPECT_EQ((int)0, (int)std::remove(log_name_list[7].name));
+
 	/* Policy format text flags */
 	{
 		EXPECT_EQ((int)0, (int)log_configure("newline",
@@ -227,3 +246,317 @@ TEST_F(log_test, DefaultConstructor)
 		EXPECT_EQ((int)0, (int)log_clear("nonewline"));
 	}
 }
+
+static int log_test_stream_write(void *context, const char *buffer, const size_t size)
+{
+	static_cast<std::vector<std::string> *>(context)->push_back(std::string(buffer, size - 1));
+
+	return 0;
+}
+
+static int log_test_stream_flush(void *context)
+{
+	(void)context;
+
+	return 0;
+}
+
+static int log_test_cache_write(const char *name, int id)
+{
+	/* A single call site, so the logger is resolved once per generation */
+	return log_write(name, LOG_LEVEL_INFO, "cache record %d", id);
+}
+
+TEST_F(log_test, CallSiteCache)
+{
+	std::vector<std::string> first, second;
+
+	/* Writing to a logger which does not exist is ignored */
+	EXPECT_EQ((int)0, (int)log_test_cache_write("cache", 0));
+
+	EXPECT_EQ((int)0, (int)log_configure("cache",
+						  log_policy_format_text(),
+						  log_policy_schedule_sync(),
+						  log_policy_storage_sequential(),
+						  log_policy_stream_custom(&first, &log_test_stream_write, &log_test_stream_flush)));
+
+	EXPECT_EQ((int)0, (int)log_test_cache_write("cache", 1));
+	EXPECT_EQ((int)0, (int)log_test_cache_write("cache", 2));
+
+	/* The same call site with another name is not served from the cache */
+	EXPECT_EQ((int)0, (int)log_test_cache_write("cache_other", 3));
+
+	ASSERT_EQ((size_t)2, (size_t)first.size());
+
+	EXPECT_NE(std::string::npos, first[1].find("cache record 2"));
+
+	/* Deleting and configuring the logger again invalidates the cached logger */
+	EXPECT_EQ((int)0, (int)log_delete("cache"));
+
+	EXPECT_EQ((int)0, (int)log_test_cache_write("cache", 4));
+
+	EXPECT_EQ((int)0, (int)log_configure("cache",
+						  log_policy_format_text(),
+						  log_policy_schedule_sync(),
+						  log_policy_storage_sequential(),
+						  log_policy_stream_custom(&second, &log_test_stream_write, &log_test_stream_flush)));
+
+	EXPECT_EQ((int)0, (int)log_test_cache_write("cache", 5));
+
+	EXPECT_EQ((size_t)2, (size_t)first.size());
+
+	ASSERT_EQ((size_t)1, (size_t)second.size());
+
+	EXPECT_NE(std::string::npos, second[0].find("cache record 5"));
+
+	EXPECT_EQ((int)0, (int)log_delete("cache"));
+}
+
+TEST_F(log_test, StorageBatch)
+{
+	std::vector<std::string> writes;
+
+	EXPECT_EQ((int)0, (int)log_configure("batch",
+						  log_policy_format_text_flags(LOG_POLICY_FORMAT_TEXT_NEWLINE),
+						  log_policy_schedule_sync(),
+						  log_policy_storage_batch((size_t)0x00000200, LOG_LEVEL_WARNING, 0),
+						  log_policy_stream_custom(&writes, &log_test_stream_write, &log_test_stream_flush)));
+
+	/* Records below the flush level are coalesced in the buffer */
+	EXPECT_EQ((int)0, (int)log_write("batch", LOG_LEVEL_INFO, "batch record a"));
+	EXPECT_EQ((int)0, (int)log_write("batch", LOG_LEVEL_INFO, "batch record b"));
+
+	EXPECT_EQ((size_t)0, (size_t)writes.size());
+
+	/* A record at the flush level writes the whole batch at once */
+	EXPECT_EQ((int)0, (int)log_write("batch", LOG_LEVEL_WARNING, "batch record c"));
+
+	ASSERT_EQ((size_t)1, (size_t)writes.size());
+
+	EXPECT_LT(writes[0].find("batch record a"), writes[0].find("batch record b"));
+	EXPECT_LT(writes[0].find("batch record b"), writes[0].find("batch record c"));
+	EXPECT_EQ(std::string::npos, writes[0].find('\0'));
+
+	/* The buffer is flushed when the next record does not fit */
+	const std::string large(0x00000100, 'x');
+
+	EXPECT_EQ((int)0, (int)log_write("batch", LOG_LEVEL_INFO, "%s", large.c_str()));
+	EXPECT_EQ((int)0, (int)log_write("batch", LOG_LEVEL_INFO, "%s", large.c_str()));
+
+	ASSERT_EQ((size_t)2, (size_t)writes.size());
+
+	/* Records larger than the buffer are written without coalescing */
+	const std::string huge(0x00000400, 'y');
+
+	EXPECT_EQ((int)0, (int)log_write("batch", LOG_LEVEL_INFO, "%s", huge.c_str()));
+
+	ASSERT_EQ((size_t)4, (size_t)writes.size());
+
+	EXPECT_NE(std::string::npos, writes[3].find(huge));
+
+	/* Pending records are written when the log is deleted */
+	EXPECT_EQ((int)0, (int)log_write("batch", LOG_LEVEL_INFO, "batch record d"));
+
+	EXPECT_EQ((size_t)4, (size_t)writes.size());
+
+	EXPECT_EQ((int)0, (int)log_delete("batch"));
+
+	ASSERT_EQ((size_t)5, (size_t)writes.size());
+
+	EXPECT_NE(std::string::npos, writes[4].find("batch record d"));
+}
+
+TEST_F(log_test, FormatBinary)
+{
+	std::vector<std::string> writes;
+
+	EXPECT_EQ((int)0, (int)log_configure("binary",
+						  log_policy_format_binary(),
+						  log_policy_schedule_sync(),
+						  log_policy_storage_sequential(),
+						  log_policy_stream_custom(&writes, &log_test_stream_write, &log_test_stream_flush)));
+
+	/* Arguments are stored as they are and formatted when the record is decoded */
+	EXPECT_EQ((int)0, (int)log_write("binary", LOG_LEVEL_INFO, "binary %d %s %.2f %" PRIuS " %x %%", -15, "record", 3.14159, (size_t)58, 255));
+	EXPECT_EQ((int)0, (int)log_write("binary", LOG_LEVEL_ERROR, "binary %s %c", (const char *)NULL, 'z'));
+	EXPECT_EQ((int)0, (int)log_write("binary", LOG_LEVEL_WARNING, "binary without arguments"));
+
+	ASSERT_EQ((size_t)3, (size_t)writes.size());
+
+	std::string binary = writes[0] + writes[1] + writes[2];
+
+	EXPECT_EQ(std::string::npos, writes[0].find("3.14"));
+
+	FILE *out = tmpfile();
+
+	ASSERT_NE((FILE *)NULL, (FILE *)out);
+
+	/* Incomplete records are left for the next call */
+	EXPECT_EQ((size_t)0, (size_t)log_policy_format_binary_decode(binary.data(), writes[0].size() - 1, out));
+
+	EXPECT_EQ((size_t)binary.size(), (size_t)log_policy_format_binary_decode(binary.data(), binary.size(), out));
+
+	std::string text(static_cast<size_t>(ftell(out)), '\0');
+
+	rewind(out);
+
+	ASSERT_EQ((size_t)text.size(), (size_t)fread(&text[0], 1, text.size(), out));
+
+	fclose(out);
+
+	EXPECT_NE(std::string::npos, text.find("binary -15 record 3.14 58 ff %\n"));
+	EXPECT_NE(std::string::npos, text.find("binary (null) z\n"));
+	EXPECT_NE(std::string::npos, text.find("binary without arguments\n"));
+	EXPECT_LT(text.find("binary -15"), text.find("binary (null)"));
+
+	/* Invalid data is not decoded */
+	const char invalid[0x40] = { 0 };
+
+	EXPECT_EQ((size_t)0, (size_t)log_policy_format_binary_decode(invalid, sizeof(invalid), stdout));
+
+	EXPECT_EQ((int)0, (int)log_delete("binary"));
+}
+
+#if !defined(_WIN32)
+static std::string log_test_socket_receive(int fd, const std::string &until)
+{
+	std::string received;
+	char buffer[0x200];
+
+	while (received.find(until) == std::string::npos)
+	{
+		struct pollfd pfd = { fd, POLLIN, 0 };
+
+		if (poll(&pfd, 1, 5000) != 1)
+		{
+			break;
+		}
+
+		ssize_t size = recv(fd, buffer, sizeof(buffer), 0);
+
+		if (size <= 0)
+		{
+			break;
+		}
+
+		received.append(buffer, static_cast<size_t>(size));
+	}
+
+	return received;
+}
+
+TEST_F(log_test, StreamSocketUDP)
+{
+	struct sockaddr_in address = {};
+	socklen_t length = sizeof(address);
+
+	int collector = socket(AF_INET, SOCK_DGRAM, 0);
+
+	ASSERT_NE((int)-1, (int)collector);
+
+	address.sin_family = AF_INET;
+	address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+	address.sin_port = 0;
+
+	ASSERT_EQ((int)0, (int)bind(collector, (struct sockaddr *)&address, sizeof(address)));
+	ASSERT_EQ((int)0, (int)getsockname(collector, (struct sockaddr *)&address, &length));
+
+	EXPECT_EQ((int)0, (int)log_configure("socket_udp",
+						  log_policy_format_text_flags(LOG_POLICY_FORMAT_TEXT_NEWLINE),
+						  log_policy_schedule_sync(),
+						  log_policy_storage_sequential(),
+						  log_policy_stream_socket("127.0.0.1", ntohs(address.sin_port))));
+
+	EXPECT_EQ((int)0, (int)log_write("socket_udp", LOG_LEVEL_INFO, "socket record %d", 1));
+	EXPECT_EQ((int)0, (int)log_write("socket_udp", LOG_LEVEL_INFO, "socket record %d", 2));
+
+	/* Each record is sent in its own datagram, without the null terminator */
+	std::string first = log_test_socket_receive(collector, "socket record 1");
+	std::string second = log_test_socket_receive(collector, "socket record 2");
+
+	EXPECT_NE(std::string::npos, first.find("socket record 1\n"));
+	EXPECT_EQ(std::string::npos, first.find("socket record 2"));
+	EXPECT_EQ(std::string::npos, first.find('\0'));
+	EXPECT_NE(std::string::npos, second.find("socket record 2\n"));
+
+	EXPECT_EQ((int)0, (int)log_delete("socket_udp"));
+
+	close(collector);
+}
+
+TEST_F(log_test, StreamSocketUnix)
+{
+	const std::string path = "/tmp/metacall-log-test-" + std::to_string(getpid()) + ".sock";
+	struct sockaddr_un address = {};
+
+	unlink(path.c_str());
+
+	address.sun_family = AF_UNIX;
+	path.copy(address.sun_path, sizeof(address.sun_path) - 1);
+
+	/* The collector is not listening yet, so the records are buffered until it reconnects */
+	log_policy stream = log_policy_stream_socket_unix(path.c_str(), LOG_POLICY_STREAM_SOCKET_UNIX_STREAM, (size_t)0x00000200);
+
+	ASSERT_NE((log_policy)NULL, (log_policy)stream);
+
+	EXPECT_EQ((int)0, (int)log_configure("socket_unix",
+						  log_policy_format_text_flags(LOG_POLICY_FORMAT_TEXT_NEWLINE),
+						  log_policy_schedule_sync(),
+						  log_policy_storage_sequential(),
+						  stream));
+
+	EXPECT_EQ((int)0, (int)log_write("socket_unix", LOG_LEVEL_INFO, "socket record a"));
+
+	/* Records that do not fit in the buffer are dropped */
+	const std::string large(0x00000400, 'x');
+
+	EXPECT_EQ((int)0, (int)log_write("socket_unix", LOG_LEVEL_INFO, "%s", large.c_str()));
+
+	EXPECT_EQ((uint64_t)1, (uint64_t)log_policy_stream_socket_dropped(stream));
+
+	int collector = socket(AF_UNIX, SOCK_STREAM, 0);
+
+	ASSERT_NE((int)-1, (int)collector);
+	ASSERT_EQ((int)0, (int)bind(collector, (struct sockaddr *)&address, sizeof(address)));
+	ASSERT_EQ((int)0, (int)listen(collector, 1));
+
+	/* Wait for the reconnection backoff */
+	std::this_thread::sleep_for(std::chrono::milliseconds(250));
+
+	EXPECT_EQ((int)0, (int)log_write("socket_unix", LOG_LEVEL_INFO, "socket record b"));
+
+	struct pollfd pfd = { collector, POLLIN, 0 };
+
+	ASSERT_EQ((int)1, (int)poll(&pfd, 1, 5000));
+
+	int connection = accept(collector, NULL, NULL);
+
+	ASSERT_NE((int)-1, (int)connection);
+
+	std::string received = log_test_socket_receive(connection, "socket record b\n");
+
+	EXPECT_NE(std::string::npos, received.find("socket record a\n"));
+	EXPECT_LT(received.find("socket record a"), received.find("socket record b"));
+	EXPECT_EQ(std::string::npos, received.find(large));
+
+	EXPECT_EQ((uint64_t)1, (uint64_t)log_policy_stream_socket_dropped(stream));
+
+	/* Records that do not fit in the buffer are dropped as a whole even if the socket is connected,
+	because a partial send could not be resumed and it would leave a truncated record in the stream */
+	EXPECT_EQ((int)0, (int)log_write("socket_unix", LOG_LEVEL_INFO, "%s", large.c_str()));
+	EXPECT_EQ((int)0, (int)log_write("socket_unix", LOG_LEVEL_INFO, "socket record c"));
+
+	EXPECT_EQ((uint64_t)2, (uint64_t)log_policy_stream_socket_dropped(stream));
+
+	received = log_test_socket_receive(connection, "socket record c\n");
+
+	EXPECT_NE(std::string::npos, received.find("socket record c\n"));
+	EXPECT_EQ(std::string::npos, received.find(large.substr(0, 0x10)));
+
+	EXPECT_EQ((int)0, (int)log_delete("socket_unix"));
+
+	close(connection);
+	close(collector);
+	unlink(path.c_str());
+}
+#endif
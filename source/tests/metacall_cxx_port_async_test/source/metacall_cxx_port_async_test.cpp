@@ -0,0 +1,304 @@
+/*
+ *	MetaCall Library by Parra Studios
+ *	A library for providing a foreign function interface calls.
+ *
+ *	Copyright (C) 2016 - 2026 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <metacall/metacall_async.hpp>
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <thread>
+
+using namespace metacall;
+
+// Fire and forget coroutine, the results are reported through a std::promise
+struct test_task
+{
+	struct promise_type
+	{
+		test_task get_return_object()
+		{
+			return {};
+		}
+
+		std::suspend_never initial_suspend() noexcept
+		{
+			return {};
+		}
+
+		std::suspend_never final_suspend() noexcept
+		{
+			return {};
+		}
+
+		void return_void() {}
+
+		void unhandled_exception()
+		{
+			std::terminate();
+		}
+	};
+};
+
+// Executor that queues the coroutines so they are resumed by the thread that drains it
+class queue_executor : public executor
+{
+public:
+	void execute(std::coroutine_handle<> handle) override
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+
+		queue.push_back(handle);
+		cv.notify_one();
+	}
+
+	template <typename T>
+	void run_until(std::future<T> &f)
+	{
+		while (f.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+
+			if (cv.wait_for(lock, std::chrono::milliseconds(10), [this]() { return !queue.empty(); }))
+			{
+				std::coroutine_handle<> handle = queue.front();
+
+				queue.pop_front();
+				lock.unlock();
+				handle.resume();
+			}
+		}
+	}
+
+private:
+	std::mutex mutex;
+	std::condition_variable cv;
+	std::deque<std::coroutine_handle<>> queue;
+};
+
+class metacall_cxx_port_async_test : public testing::Test
+{
+protected:
+	static void SetUpTestSuite()
+	{
+		static const char buffer[] =
+			"import asyncio\n"
+			"async def async_value(n, delay):\n"
+			"\tawait asyncio.sleep(delay)\n"
+			"\treturn n\n"
+			"async def async_text(delay):\n"
+			"\tawait asyncio.sleep(delay)\n"
+			"\treturn 'hello'\n"
+			"async def async_none(delay):\n"
+			"\tawait asyncio.sleep(delay)\n"
+			"async def async_fail(delay):\n"
+			"\tawait asyncio.sleep(delay)\n"
+			"\traise ValueError('async failure')\n";
+
+		metacall_log_null();
+
+		ASSERT_EQ((int)0, (int)metacall_initialize());
+
+		ASSERT_EQ((int)0, (int)metacall_load_from_memory("py", buffer, sizeof(buffer), NULL));
+	}
+
+	static void TearDownTestSuite()
+	{
+		metacall_destroy();
+	}
+};
+
+static test_task resolve_task(std::promise<long> &result)
+{
+	long n = co_await async_call<long>("async_value", 58L, 0.0);
+
+	result.set_value(n);
+}
+
+TEST_F(metacall_cxx_port_async_test, Resolve)
+{
+	std::promise<long> result;
+	std::future<long> f = result.get_future();
+
+	resolve_task(result);
+
+	ASSERT_EQ(std::future_status::ready, f.wait_for(std::chrono::seconds(10)));
+
+	EXPECT_EQ((long)58L, (long)f.get());
+}
+
+static test_task pipeline_task(std::promise<std::string> &result)
+{
+	// All the calls are started before awaiting any of them
+	async_call<long> a("async_value", 1L, 0.2);
+	async_call<long> b("async_value", 2L, 0.1);
+	async_call<std::string> c("async_text", 0.0);
+
+	long sum = co_await std::move(a);
+	sum += co_await std::move(b);
+
+	std::string text = co_await std::move(c);
+
+	co_await async_call<void>("async_none", 0.0);
+
+	result.set_value(text + " " + std::to_string(sum));
+}
+
+TEST_F(metacall_cxx_port_async_test, Pipeline)
+{
+	std::promise<std::string> result;
+	std::future<std::string> f = result.get_future();
+
+	auto start = std::chrono::steady_clock::now();
+
+	pipeline_task(result);
+
+	ASSERT_EQ(std::future_status::ready, f.wait_for(std::chrono::seconds(10)));
+
+	EXPECT_EQ((std::string) "hello 3", (std::string)f.get());
+
+	/* The calls overlap, so it takes less than the sum of their delays */
+	EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(300));
+}
+
+static test_task reject_task(std::promise<std::string> &result)
+{
+	try
+	{
+		co_await async_call<long>("async_fail", 0.0);
+
+		result.set_value("resolved");
+	}
+	catch (const async_rejected &e)
+	{
+		result.set_value(e.what());
+	}
+}
+
+TEST_F(metacall_cxx_port_async_test, Reject)
+{
+	std::promise<std::string> result;
+	std::future<std::string> f = result.get_future();
+
+	reject_task(result);
+
+	ASSERT_EQ(std::future_status::ready, f.wait_for(std::chrono::seconds(10)));
+
+	EXPECT_EQ((std::string) "async failure", (std::string)f.get());
+}
+
+static test_task mismatch_task(std::promise<bool> &result)
+{
+	try
+	{
+		co_await async_call<long>("async_text", 0.0);
+
+		result.set_value(false);
+	}
+	catch (const async_rejected &)
+	{
+		result.set_value(false);
+	}
+	catch (const std::runtime_error &)
+	{
+		result.set_value(true);
+	}
+}
+
+TEST_F(metacall_cxx_port_async_test, TypeMismatch)
+{
+	std::promise<bool> result;
+	std::future<bool> f = result.get_future();
+
+	mismatch_task(result);
+
+	ASSERT_EQ(std::future_status::ready, f.wait_for(std::chrono::seconds(10)));
+
+	EXPECT_EQ((bool)true, (bool)f.get());
+}
+
+static test_task cancel_task(cancellation_token token, std::promise<bool> &result)
+{
+	try
+	{
+		co_await async_call<long>("async_value", 1L, 1.0).with(token);
+
+		result.set_value(false);
+	}
+	catch (const async_cancelled &)
+	{
+		result.set_value(true);
+	}
+}
+
+TEST_F(metacall_cxx_port_async_test, Cancel)
+{
+	cancellation_source source;
+	std::promise<bool> result;
+	std::future<bool> f = result.get_future();
+
+	cancel_task(source.token(), result);
+
+	EXPECT_EQ(std::future_status::timeout, f.wait_for(std::chrono::milliseconds(50)));
+
+	source.cancel();
+
+	ASSERT_EQ(std::future_status::ready, f.wait_for(std::chrono::seconds(0)));
+
+	EXPECT_EQ((bool)true, (bool)f.get());
+
+	/* A token that is already cancelled completes the call without suspending */
+	std::promise<bool> cancelled;
+	std::future<bool> g = cancelled.get_future();
+
+	cancel_task(source.token(), cancelled);
+
+	ASSERT_EQ(std::future_status::ready, g.wait_for(std::chrono::seconds(0)));
+
+	EXPECT_EQ((bool)true, (bool)g.get());
+}
+
+static test_task executor_task(executor &ex, std::promise<std::thread::id> &result)
+{
+	co_await async_call<long>("async_value", 1L, 0.1).via(ex);
+
+	result.set_value(std::this_thread::get_id());
+}
+
+TEST_F(metacall_cxx_port_async_test, Executor)
+{
+	queue_executor ex;
+	std::promise<std::thread::id> result;
+	std::future<std::thread::id> f = result.get_future();
+
+	executor_task(ex, result);
+
+	ex.run_until(f);
+
+	/* The coroutine is resumed by the thread that drains the executor instead of the loader thread */
+	EXPECT_EQ(std::this_thread::get_id(), f.get());
+}
+
+TEST_F(metacall_cxx_port_async_test, Invalid)
+{
+	EXPECT_THROW(async_call<long>("async_does_not_exist", 1L), std::runtime_error);
+}
@@ -0,0 +1,296 @@
+/*
+ *	MetaCall Library by Parra Studios
+ *	A library for providing a foreign function interface calls.
+ *
+ *	Copyright (C) 2016 - 2026 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <metacall/metacall.h>
+#include <metacall/metacall_future.h>
+#include <metacall/metacall_loaders.h>
+#include <metacall/metacall_value.h>
+
+#if !defined(WIN32) && !defined(_WIN32)
+	#include <poll.h>
+#endif
+
+class metacall_future_test : public testing::Test
+{
+protected:
+	static void SetUpTestSuite()
+	{
+		static const char buffer[] =
+			"import asyncio\n"
+			"async def future_value(n, delay):\n"
+			"\tawait asyncio.sleep(delay)\n"
+			"\treturn n\n"
+			"async def future_fail(n, delay):\n"
+			"\tawait asyncio.sleep(delay)\n"
+			"\traise Exception(n)\n";
+
+		metacall_log_null();
+
+		ASSERT_EQ((int)0, (int)metacall_initialize());
+
+		ASSERT_EQ((int)0, (int)metacall_load_from_memory("py", buffer, sizeof(buffer), NULL));
+	}
+
+	static void TearDownTestSuite()
+	{
+		metacall_destroy();
+	}
+
+	static void *call(const char *name, long n, double delay)
+	{
+		void *args[] = {
+			metacall_value_create_long(n),
+			metacall_value_create_double(delay)
+		};
+
+		void *f = metacall_future_call(metacall_function(name), args, 2);
+
+		metacall_value_destroy(args[0]);
+		metacall_value_destroy(args[1]);
+
+		return f;
+	}
+};
+
+TEST_F(metacall_future_test, Resolve)
+{
+	void *f = call("future_value", 58L, 0.0);
+
+	ASSERT_NE((void *)NULL, (void *)f);
+
+	EXPECT_EQ((int)0, (int)metacall_future_wait(f, -1));
+
+	EXPECT_EQ((enum metacall_future_status_id)METACALL_FUTURE_RESOLVED, (enum metacall_future_status_id)metacall_future_status(f));
+
+	void *v = metacall_future_value(f);
+
+	ASSERT_EQ((enum metacall_value_id)METACALL_LONG, (enum metacall_value_id)metacall_value_id(v));
+
+	EXPECT_EQ((long)58L, (long)metacall_value_to_long(v));
+
+	metacall_future_destroy(f);
+}
+
+TEST_F(metacall_future_test, Reject)
+{
+	void *f = call("future_fail", 15L, 0.0);
+
+	ASSERT_NE((void *)NULL, (void *)f);
+
+	EXPECT_EQ((int)0, (int)metacall_future_wait(f, -1));
+
+	EXPECT_EQ((enum metacall_future_status_id)METACALL_FUTURE_REJECTED, (enum metacall_future_status_id)metacall_future_status(f));
+
+	void *v = metacall_future_value(f);
+
+	ASSERT_EQ((enum metacall_value_id)METACALL_LONG, (enum metacall_value_id)metacall_value_id(v));
+
+	EXPECT_EQ((long)15L, (long)metacall_value_to_long(v));
+
+	metacall_future_destroy(f);
+}
+
+TEST_F(metacall_future_test, Timeout)
+{
+	void *f = call("future_value", 3L, 0.5);
+
+	ASSERT_NE((void *)NULL, (void *)f);
+
+	EXPECT_EQ((int)1, (int)metacall_future_wait(f, 0));
+
+	EXPECT_EQ((int)1, (int)metacall_future_wait(f, 10));
+
+	EXPECT_EQ((enum metacall_future_status_id)METACALL_FUTURE_PENDING, (enum metacall_future_status_id)metacall_future_status(f));
+
+	EXPECT_EQ((void *)NULL, (void *)metacall_future_value(f));
+
+	EXPECT_EQ((int)0, (int)metacall_future_wait(f, 10000));
+
+	EXPECT_EQ((long)3L, (long)metacall_value_to_long(metacall_future_value(f)));
+
+	metacall_future_destroy(f);
+}
+
+#if !defined(WIN32) && !defined(_WIN32)
+TEST_F(metacall_future_test, Descriptor)
+{
+	void *pending = call("future_value", 4L, 0.1);
+	void *completed = call("future_value", 5L, 0.0);
+
+	ASSERT_NE((void *)NULL, (void *)pending);
+	ASSERT_NE((void *)NULL, (void *)completed);
+
+	ASSERT_EQ((int)0, (int)metacall_future_wait(completed, -1));
+
+	struct pollfd fds[] = {
+		{ metacall_future_fd(pending), POLLIN, 0 },
+		{ metacall_future_fd(completed), POLLIN, 0 }
+	};
+
+	ASSERT_NE((int)-1, (int)fds[0].fd);
+	ASSERT_NE((int)-1, (int)fds[1].fd);
+
+	/* The descriptor of a future that has already completed is readable from the beginning */
+	EXPECT_EQ((int)1, (int)poll(&fds[1], 1, 0));
+
+	ASSERT_EQ((int)1, (int)poll(&fds[0], 1, 10000));
+
+	EXPECT_NE((short)0, (short)(fds[0].revents & POLLIN));
+
+	EXPECT_EQ((enum metacall_future_status_id)METACALL_FUTURE_RESOLVED, (enum metacall_future_status_id)metacall_future_status(pending));
+
+	EXPECT_EQ((long)4L, (long)metacall_value_to_long(metacall_future_value(pending)));
+
+	metacall_future_destroy(pending);
+	metacall_future_destroy(completed);
+}
+#endif
+
+TEST_F(metacall_future_test, WhenAll)
+{
+	void *futures[] = {
+		call("future_value", 1L, 0.2),
+		call("future_value", 2L, 0.0),
+		call("future_value", 3L, 0.1)
+	};
+
+	void *all = metacall_future_when_all(futures, sizeof(futures) / sizeof(futures[0]));
+
+	ASSERT_NE((void *)NULL, (void *)all);
+
+	/* The children can be destroyed before the combined future completes */
+	for (void *f : futures)
+	{
+		metacall_future_destroy(f);
+	}
+
+	ASSERT_EQ((int)0, (int)metacall_future_wait(all, -1));
+
+	EXPECT_EQ((enum metacall_future_status_id)METACALL_FUTURE_RESOLVED, (enum metacall_future_status_id)metacall_future_status(all));
+
+	void *v = metacall_future_value(all);
+
+	ASSERT_EQ((enum metacall_value_id)METACALL_ARRAY, (enum metacall_value_id)metacall_value_id(v));
+
+	ASSERT_EQ((size_t)3, (size_t)metacall_value_count(v));
+
+	void **results = metacall_value_to_array(v);
+
+	for (size_t iterator = 0; iterator < 3; ++iterator)
+	{
+		EXPECT_EQ((long)(iterator + 1), (long)metacall_value_to_long(results[iterator]));
+	}
+
+	metacall_future_destroy(all);
+
+	/* Empty combinations are resolved immediately */
+	all = metacall_future_when_all(NULL, 0);
+
+	ASSERT_NE((void *)NULL, (void *)all);
+
+	EXPECT_EQ((int)0, (int)metacall_future_wait(all, 0));
+
+	EXPECT_EQ((size_t)0, (size_t)metacall_value_count(metacall_future_value(all)));
+
+	metacall_future_destroy(all);
+}
+
+TEST_F(metacall_future_test, WhenAllReject)
+{
+	void *futures[] = {
+		call("future_value", 1L, 1.0),
+		call("future_fail", 15L, 0.0)
+	};
+
+	void *all = metacall_future_when_all(futures, sizeof(futures) / sizeof(futures[0]));
+
+	ASSERT_NE((void *)NULL, (void *)all);
+
+	ASSERT_EQ((int)0, (int)metacall_future_wait(all, -1));
+
+	EXPECT_EQ((enum metacall_future_status_id)METACALL_FUTURE_REJECTED, (enum metacall_future_status_id)metacall_future_status(all));
+
+	EXPECT_EQ((long)15L, (long)metacall_value_to_long(metacall_future_value(all)));
+
+	/* The rejection does not wait for the rest of the futures */
+	EXPECT_EQ((enum metacall_future_status_id)METACALL_FUTURE_PENDING, (enum metacall_future_status_id)metacall_future_status(futures[0]));
+
+	metacall_future_destroy(all);
+	metacall_future_destroy(futures[0]);
+	metacall_future_destroy(futures[1]);
+}
+
+TEST_F(metacall_future_test, WhenAny)
+{
+	void *futures[] = {
+		call("future_value", 1L, 1.0),
+		call("future_value", 2L, 0.0)
+	};
+
+	void *any = metacall_future_when_any(futures, sizeof(futures) / sizeof(futures[0]));
+
+	ASSERT_NE((void *)NULL, (void *)any);
+
+	ASSERT_EQ((int)0, (int)metacall_future_wait(any, -1));
+
+	EXPECT_EQ((enum metacall_future_status_id)METACALL_FUTURE_RESOLVED, (enum metacall_future_status_id)metacall_future_status(any));
+
+	EXPECT_EQ((long)2L, (long)metacall_value_to_long(metacall_future_value(any)));
+
+	EXPECT_EQ((enum metacall_future_status_id)METACALL_FUTURE_RESOLVED, (enum metacall_future_status_id)metacall_future_status(futures[1]));
+
+	/* Nested combinations, the one that has already completed notifies immediately */
+	void *nested[] = { any, futures[0] };
+
+	void *all = metacall_future_when_all(nested, sizeof(nested) / sizeof(nested[0]));
+
+	ASSERT_NE((void *)NULL, (void *)all);
+
+	ASSERT_EQ((int)0, (int)metacall_future_wait(all, -1));
+
+	void **results = metacall_value_to_array(metacall_future_value(all));
+
+	EXPECT_EQ((long)2L, (long)metacall_value_to_long(results[0]));
+	EXPECT_EQ((long)1L, (long)metacall_value_to_long(results[1]));
+
+	metacall_future_destroy(all);
+	metacall_future_destroy(any);
+	metacall_future_destroy(futures[0]);
+	metacall_future_destroy(futures[1]);
+
+	EXPECT_EQ((void *)NULL, (void *)metacall_future_when_any(NULL, 0));
+}
+
+TEST_F(metacall_future_test, Invalid)
+{
+	void *v = metacall_value_create_long(1L);
+
+	EXPECT_EQ((void *)NULL, (void *)metacall_future_create(v));
+
+	metacall_value_destroy(v);
+
+	EXPECT_EQ((void *)NULL, (void *)metacall_future_call(NULL, NULL, 0));
+
+	void *futures[] = { NULL };
+
+	EXPECT_EQ((void *)NULL, (void *)metacall_future_when_all(futures, 1));
+}
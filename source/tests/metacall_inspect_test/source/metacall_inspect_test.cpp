@@ -24,6 +24,7 @@
 #include <metacall/metacall_loaders.h>
 
 #include <cstdio>
+#include <cstring>
 
 class metacall_inspect_test : public testing::Test
 {
@@ -129,6 +130,62 @@ TEST_F(metacall_inspect_test, DefaultConstructor)
 
 		printf("%s\n", inspect_str);
 
+		/* Inspect again without modifications, it must return the same cached information */
+		uint64_t generation = metacall_inspect_generation();
+
+		size_t cached_size = 0;
+
+		char *cached_inspect_str = metacall_inspect(&cached_size, allocator);
+
+		EXPECT_NE((char *)NULL, (char *)cached_inspect_str);
+
+		EXPECT_EQ((size_t)size, (size_t)cached_size);
+
+		EXPECT_EQ((int)0, (int)strcmp(inspect_str, cached_inspect_str));
+
+		EXPECT_EQ((uint64_t)generation, (uint64_t)metacall_inspect_generation());
+
+		metacall_allocator_free(allocator, cached_inspect_str);
+
+/* Mock */
+#if defined(OPTION_BUILD_LOADERS_MOCK)
+		{
+			static const char buffer[] = "inspect_generation_test";
+
+			void *handle = NULL;
+
+			/* Loading a script must invalidate the cached information */
+			EXPECT_EQ((int)0, (int)metacall_load_from_memory("mock", buffer, sizeof(buffer), &handle));
+
+			EXPECT_NE((uint64_t)generation, (uint64_t)metacall_inspect_generation());
+
+			generation = metacall_inspect_generation();
+
+			char *loaded_inspect_str = metacall_inspect(&cached_size, allocator);
+
+			EXPECT_NE((char *)NULL, (char *)loaded_inspect_str);
+
+			EXPECT_NE((int)0, (int)strcmp(inspect_str, loaded_inspect_str));
+
+			metacall_allocator_free(allocator, loaded_inspect_str);
+
+			/* Clearing the handle must invalidate it again and produce the initial information */
+			EXPECT_EQ((int)0, (int)metacall_clear(handle));
+
+			EXPECT_NE((uint64_t)generation, (uint64_t)metacall_inspect_generation());
+
+			char *cleared_inspect_str = metacall_inspect(&cached_size, allocator);
+
+			EXPECT_NE((char *)NULL, (char *)cleared_inspect_str);
+
+			EXPECT_EQ((size_t)size, (size_t)cached_size);
+
+			EXPECT_EQ((int)0, (int)strcmp(inspect_str, cleared_inspect_str));
+
+			metacall_allocator_free(allocator, cleared_inspect_str);
+		}
+#endif /* OPTION_BUILD_LOADERS_MOCK */
+
 		metacall_allocator_free(allocator, inspect_str);
 
 		metacall_allocator_destroy(allocator);
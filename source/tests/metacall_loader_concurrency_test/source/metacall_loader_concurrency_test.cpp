@@ -0,0 +1,438 @@
+/*
+ *	MetaCall Library by Parra Studios
+ *	A library for providing a foreign function interface calls.
+ *
+ *	Copyright (C) 2016 - 2026 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <metacall/metacall.h>
+#include <metacall/metacall_loaders.h>
+#include <metacall/metacall_value.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#define METACALL_LOADER_CONCURRENCY_READERS		4
+#define METACALL_LOADER_CONCURRENCY_WRITERS		2
+#define METACALL_LOADER_CONCURRENCY_ITERATIONS	2000
+#define METACALL_LOADER_CONCURRENCY_INSPECT_STEP 64
+#define METACALL_LOADER_CONCURRENCY_ROUNDS		64
+
+class metacall_loader_concurrency_test : public testing::Test
+{
+public:
+};
+
+/* Calls and lookups of the global scope, run while the handles are being loaded and cleared */
+static void metacall_loader_concurrency_reader(void *allocator, std::atomic<size_t> *errors)
+{
+	for (size_t iterator = 0; iterator < METACALL_LOADER_CONCURRENCY_ITERATIONS; ++iterator)
+	{
+		void *func = metacall_function("my_empty_func_int");
+
+		if (func == NULL)
+		{
+			++(*errors);
+			continue;
+		}
+
+		void *ret = metacallfv_s(func, metacall_null_args, 0);
+
+		if (ret == NULL || metacall_value_to_int(ret) != 1234)
+		{
+			++(*errors);
+		}
+
+		if (ret != NULL)
+		{
+			metacall_value_destroy(ret);
+		}
+
+		if (metacall_function("this_function_does_not_exist") != NULL)
+		{
+			++(*errors);
+		}
+
+		if ((iterator % METACALL_LOADER_CONCURRENCY_INSPECT_STEP) == 0)
+		{
+			size_t size = 0;
+
+			char *inspect_str = metacall_inspect(&size, allocator);
+
+			if (inspect_str == NULL || size == 0)
+			{
+				++(*errors);
+			}
+			else
+			{
+				metacall_allocator_free(allocator, inspect_str);
+			}
+		}
+	}
+}
+
+/* Loads a private handle, calls into it and clears it in a loop */
+static void metacall_loader_concurrency_writer(const char *buffer, std::atomic<size_t> *errors)
+{
+	for (size_t iterator = 0; iterator < METACALL_LOADER_CONCURRENCY_ITERATIONS; ++iterator)
+	{
+		void *handle = NULL;
+
+		if (metacall_load_from_memory("mock", buffer, std::strlen(buffer) + 1, &handle) != 0 || handle == NULL)
+		{
+			++(*errors);
+			continue;
+		}
+
+		void *func = metacall_handle_function(handle, "two_doubles");
+
+		if (func == NULL)
+		{
+			++(*errors);
+		}
+		else
+		{
+			void *args[] = {
+				metacall_value_create_double(3.0),
+				metacall_value_create_double(6.0)
+			};
+
+			void *ret = metacallfv_s(func, args, sizeof(args) / sizeof(args[0]));
+
+			if (ret == NULL || metacall_value_to_double(ret) != 3.1416)
+			{
+				++(*errors);
+			}
+
+			if (ret != NULL)
+			{
+				metacall_value_destroy(ret);
+			}
+
+			metacall_value_destroy(args[0]);
+			metacall_value_destroy(args[1]);
+		}
+
+		if (metacall_clear(handle) != 0)
+		{
+			++(*errors);
+		}
+	}
+}
+
+TEST_F(metacall_loader_concurrency_test, DefaultConstructor)
+{
+	metacall_print_info();
+
+	ASSERT_EQ((int)0, (int)metacall_initialize());
+
+	const char *mock_scripts[] = {
+		"empty.mock"
+	};
+
+	ASSERT_EQ((int)0, (int)metacall_load_from_file("mock", mock_scripts, sizeof(mock_scripts) / sizeof(mock_scripts[0]), NULL));
+
+	struct metacall_allocator_std_type std_ctx = { &std::malloc, &std::realloc, &std::free };
+
+	void *allocator = metacall_allocator_create(METACALL_ALLOCATOR_STD, (void *)&std_ctx);
+
+	ASSERT_NE((void *)NULL, (void *)allocator);
+
+	static const char *buffers[METACALL_LOADER_CONCURRENCY_WRITERS] = {
+		"first mock handle",
+		"second mock handle"
+	};
+
+	std::atomic<size_t> reader_errors(0), writer_errors(0);
+	std::vector<std::thread> threads;
+
+	for (size_t iterator = 0; iterator < METACALL_LOADER_CONCURRENCY_WRITERS; ++iterator)
+	{
+		threads.emplace_back(metacall_loader_concurrency_writer, buffers[iterator], &writer_errors);
+	}
+
+	for (size_t iterator = 0; iterator < METACALL_LOADER_CONCURRENCY_READERS; ++iterator)
+	{
+		threads.emplace_back(metacall_loader_concurrency_reader, allocator, &reader_errors);
+	}
+
+	for (std::thread &t : threads)
+	{
+		t.join();
+	}
+
+	EXPECT_EQ((size_t)0, (size_t)reader_errors);
+	EXPECT_EQ((size_t)0, (size_t)writer_errors);
+
+	metacall_allocator_destroy(allocator);
+
+	metacall_destroy();
+}
+
+/* Calls into the shared handle by name until it is cleared, the calls in flight must not use the freed functions */
+static void metacall_loader_concurrency_caller(std::atomic<size_t> *calls, std::atomic<bool> *cleared, std::atomic<size_t> *errors)
+{
+	size_t after_clear = 0;
+
+	while (after_clear < METACALL_LOADER_CONCURRENCY_INSPECT_STEP)
+	{
+		bool was_cleared = cleared->load();
+
+		void *ret = metacallv_s("my_empty_func_int", metacall_null_args, 0);
+
+		if (ret != NULL)
+		{
+			if (metacall_value_to_int(ret) != 1234)
+			{
+				++(*errors);
+			}
+
+			metacall_value_destroy(ret);
+		}
+		else if (was_cleared == false && calls->load() < METACALL_LOADER_CONCURRENCY_ITERATIONS)
+		{
+			/* The function can only be missing once the clear has started */
+			++(*errors);
+		}
+
+		void *args[] = {
+			metacall_value_create_double(3.0),
+			metacall_value_create_double(6.0)
+		};
+
+		ret = metacallv_s("two_doubles", args, sizeof(args) / sizeof(args[0]));
+
+		if (ret != NULL)
+		{
+			if (metacall_value_to_double(ret) != 3.1416)
+			{
+				++(*errors);
+			}
+
+			metacall_value_destroy(ret);
+		}
+
+		metacall_value_destroy(args[0]);
+		metacall_value_destroy(args[1]);
+
+		++(*calls);
+
+		if (was_cleared == true)
+		{
+			++after_clear;
+		}
+	}
+}
+
+TEST_F(metacall_loader_concurrency_test, ClearWhileCalling)
+{
+	ASSERT_EQ((int)0, (int)metacall_initialize());
+
+	const char *mock_scripts[] = {
+		"empty.mock"
+	};
+
+	ASSERT_EQ((int)0, (int)metacall_load_from_file("mock", mock_scripts, sizeof(mock_scripts) / sizeof(mock_scripts[0]), NULL));
+
+	void *handle = metacall_handle("mock", "empty.mock");
+
+	ASSERT_NE((void *)NULL, (void *)handle);
+
+	std::atomic<size_t> calls(0), errors(0);
+	std::atomic<bool> cleared(false);
+	std::vector<std::thread> threads;
+
+	for (size_t iterator = 0; iterator < METACALL_LOADER_CONCURRENCY_READERS; ++iterator)
+	{
+		threads.emplace_back(metacall_loader_concurrency_caller, &calls, &cleared, &errors);
+	}
+
+	/* Clear the handle while the callers are inside of the functions */
+	while (calls.load() < METACALL_LOADER_CONCURRENCY_ITERATIONS)
+	{
+		std::this_thread::yield();
+	}
+
+	EXPECT_EQ((int)0, (int)metacall_clear(handle));
+
+	cleared.store(true);
+
+	for (std::thread &t : threads)
+	{
+		t.join();
+	}
+
+	EXPECT_EQ((size_t)0, (size_t)errors);
+
+	EXPECT_EQ((void *)NULL, (void *)metacall_function("my_empty_func_int"));
+
+	metacall_destroy();
+}
+
+/* Calls by name until stopped, the function may be missing or released by a clear at any point of the call */
+static void metacall_loader_concurrency_stress_caller(std::atomic<bool> *stop, std::atomic<size_t> *calls, std::atomic<size_t> *errors)
+{
+	while (stop->load() == false)
+	{
+		void *ret = metacallv_s("my_empty_func_int", metacall_null_args, 0);
+
+		if (ret != NULL)
+		{
+			if (metacall_value_to_int(ret) != 1234)
+			{
+				++(*errors);
+			}
+
+			metacall_value_destroy(ret);
+
+			++(*calls);
+		}
+		else
+		{
+			/* Do not starve the load waiting for the write lock while the handle is missing */
+			std::this_thread::yield();
+		}
+	}
+}
+
+TEST_F(metacall_loader_concurrency_test, ClearWhileCallingStress)
+{
+	ASSERT_EQ((int)0, (int)metacall_initialize());
+
+	const char *mock_scripts[] = {
+		"empty.mock"
+	};
+
+	std::atomic<size_t> calls(0), errors(0);
+	std::atomic<bool> stop(false);
+	std::vector<std::thread> threads;
+
+	for (size_t iterator = 0; iterator < METACALL_LOADER_CONCURRENCY_READERS; ++iterator)
+	{
+		threads.emplace_back(metacall_loader_concurrency_stress_caller, &stop, &calls, &errors);
+	}
+
+	/* Each round races the release of the references held by the callers against the clear of the handle */
+	for (size_t round = 0; round < METACALL_LOADER_CONCURRENCY_ROUNDS; ++round)
+	{
+		ASSERT_EQ((int)0, (int)metacall_load_from_file("mock", mock_scripts, sizeof(mock_scripts) / sizeof(mock_scripts[0]), NULL));
+
+		void *handle = metacall_handle("mock", "empty.mock");
+
+		ASSERT_NE((void *)NULL, (void *)handle);
+
+		size_t target = calls.load() + METACALL_LOADER_CONCURRENCY_READERS;
+
+		while (calls.load() < target)
+		{
+			std::this_thread::yield();
+		}
+
+		EXPECT_EQ((int)0, (int)metacall_clear(handle));
+	}
+
+	stop.store(true);
+
+	for (std::thread &t : threads)
+	{
+		t.join();
+	}
+
+	EXPECT_EQ((size_t)0, (size_t)errors);
+
+	EXPECT_EQ((void *)NULL, (void *)metacall_function("my_empty_func_int"));
+
+	metacall_destroy();
+}
+
+/* Loads private handles, which must survive the failed loads done meanwhile by other threads */
+static void metacall_loader_concurrency_private_loader(size_t id, std::vector<void *> *handles)
+{
+	for (size_t iterator = 0; iterator < METACALL_LOADER_CONCURRENCY_ROUNDS; ++iterator)
+	{
+		std::string name = "private-" + std::to_string(id) + "-" + std::to_string(iterator) + ".mock";
+		const char *mock_scripts[] = { name.c_str() };
+		void *handle = NULL;
+
+		if (metacall_load_from_file("mock", mock_scripts, sizeof(mock_scripts) / sizeof(mock_scripts[0]), &handle) == 0)
+		{
+			handles->push_back(handle);
+		}
+	}
+}
+
+/* Loads into the global scope the same symbols already defined there, so every load fails and destroys its children */
+static void metacall_loader_concurrency_failing_loader(size_t id, std::atomic<size_t> *errors)
+{
+	for (size_t iterator = 0; iterator < METACALL_LOADER_CONCURRENCY_ROUNDS; ++iterator)
+	{
+		std::string name = "duplicated-" + std::to_string(id) + "-" + std::to_string(iterator) + ".mock";
+		const char *mock_scripts[] = { name.c_str() };
+
+		if (metacall_load_from_file("mock", mock_scripts, sizeof(mock_scripts) / sizeof(mock_scripts[0]), NULL) == 0)
+		{
+			++(*errors);
+		}
+	}
+}
+
+TEST_F(metacall_loader_concurrency_test, LoadFailureKeepsOtherHandles)
+{
+	ASSERT_EQ((int)0, (int)metacall_initialize());
+
+	const char *mock_scripts[] = {
+		"empty.mock"
+	};
+
+	ASSERT_EQ((int)0, (int)metacall_load_from_file("mock", mock_scripts, sizeof(mock_scripts) / sizeof(mock_scripts[0]), NULL));
+
+	std::atomic<size_t> errors(0);
+	std::vector<std::vector<void *>> handles(METACALL_LOADER_CONCURRENCY_WRITERS);
+	std::vector<std::thread> threads;
+
+	for (size_t iterator = 0; iterator < METACALL_LOADER_CONCURRENCY_WRITERS; ++iterator)
+	{
+		threads.emplace_back(metacall_loader_concurrency_private_loader, iterator, &handles[iterator]);
+		threads.emplace_back(metacall_loader_concurrency_failing_loader, iterator, &errors);
+	}
+
+	for (std::thread &t : threads)
+	{
+		t.join();
+	}
+
+	EXPECT_EQ((size_t)0, (size_t)errors);
+
+	for (std::vector<void *> &thread_handles : handles)
+	{
+		EXPECT_EQ((size_t)METACALL_LOADER_CONCURRENCY_ROUNDS, (size_t)thread_handles.size());
+
+		for (void *handle : thread_handles)
+		{
+			EXPECT_NE((void *)NULL, (void *)metacall_handle_function(handle, "my_empty_func"));
+
+			EXPECT_EQ((int)0, (int)metacall_clear(handle));
+		}
+	}
+
+	metacall_destroy();
+}
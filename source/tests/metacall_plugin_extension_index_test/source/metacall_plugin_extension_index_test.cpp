@@ -0,0 +1,220 @@
+/*
+ *	MetaCall Library by Parra Studios
+ *	A library for providing a foreign function interface calls.
+ *
+ *	Copyright (C) 2016 - 2026 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <metacall/metacall.h>
+#include <metacall/metacall_loaders.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+class metacall_plugin_extension_index_test : public testing::Test
+{
+public:
+};
+
+static void plugin_create(const fs::path &path)
+{
+	fs::create_directories(path);
+
+	std::ofstream(path / "plugin.mock");
+
+	std::ofstream config(path / "metacall.json");
+
+	config << "{ \"language_id\": \"mock\", \"path\": \".\", \"scripts\": [ \"plugin.mock\" ] }";
+}
+
+/* Initialize MetaCall, load the plugins of the path and check that the plugin functions are available */
+static void plugin_load(const fs::path &path)
+{
+	ASSERT_EQ((int)0, (int)metacall_initialize());
+
+	void *handle = metacall_plugin_extension();
+
+	ASSERT_NE((void *)NULL, (void *)handle);
+
+	std::string path_str = path.string();
+
+	void *args[] = {
+		metacall_value_create_string(path_str.c_str(), path_str.length())
+	};
+
+	void *result = metacallhv_s(handle, "plugin_load_from_path", args, sizeof(args) / sizeof(args[0]));
+
+	ASSERT_NE((void *)NULL, (void *)result);
+
+	EXPECT_EQ((enum metacall_value_id)METACALL_INT, (enum metacall_value_id)metacall_value_id(result));
+
+	EXPECT_EQ((int)0, (int)metacall_value_to_int(result));
+
+	EXPECT_NE((void *)NULL, (void *)metacall_function("my_empty_func"));
+
+	metacall_value_destroy(args[0]);
+	metacall_value_destroy(result);
+
+	metacall_destroy();
+}
+
+/* Return the indexes stored in the cache, temporary files must not be left behind */
+static std::vector<fs::path> plugin_index_list(const fs::path &cache_path)
+{
+	std::vector<fs::path> indexes;
+
+	for (const fs::directory_entry &entry : fs::directory_iterator(cache_path))
+	{
+		indexes.push_back(entry.path());
+	}
+
+	return indexes;
+}
+
+static std::string plugin_index_read(const fs::path &index_path)
+{
+	std::ifstream index(index_path);
+	std::stringstream buffer;
+
+	buffer << index.rdbuf();
+
+	return buffer.str();
+}
+
+/* Filesystems with coarse timestamps may not change the time of a directory modified right after the scan */
+static void plugin_index_touch(const fs::path &path, fs::file_time_type time)
+{
+	if (fs::last_write_time(path) == time)
+	{
+		fs::last_write_time(path, time + std::chrono::seconds(1));
+	}
+}
+
+TEST_F(metacall_plugin_extension_index_test, DefaultConstructor)
+{
+	metacall_print_info();
+
+	std::random_device random;
+	std::ostringstream name;
+
+	name << "metacall-plugin-extension-index-test-" << std::hex << random();
+
+	const fs::path root_path = fs::temp_directory_path() / name.str();
+	const fs::path cache_path = root_path / "cache";
+	const fs::path plugin_path = root_path / "plugins";
+
+	fs::create_directories(cache_path);
+
+	plugin_create(plugin_path / "a");
+
+	/* The index is not written unless it is enabled */
+	plugin_load(plugin_path);
+
+	EXPECT_EQ((size_t)0, (size_t)plugin_index_list(cache_path).size());
+
+#if defined(_WIN32)
+	ASSERT_EQ((int)0, (int)_putenv_s("METACALL_PLUGIN_INDEX_PATH", cache_path.string().c_str()));
+#else
+	ASSERT_EQ((int)0, (int)setenv("METACALL_PLUGIN_INDEX_PATH", cache_path.string().c_str(), 1));
+#endif
+
+	/* The first load scans the plugins and creates the index */
+	plugin_load(plugin_path);
+
+	std::vector<fs::path> indexes = plugin_index_list(cache_path);
+
+	ASSERT_EQ((size_t)1, (size_t)indexes.size());
+
+	const fs::path index_path = indexes[0];
+	const std::string index = plugin_index_read(index_path);
+	const fs::file_time_type index_time = fs::last_write_time(index_path);
+
+	EXPECT_NE(std::string::npos, index.find((plugin_path / "a" / "metacall.json").string()));
+
+	/* The second load reuses the index without writing it again */
+	plugin_load(plugin_path);
+
+	indexes = plugin_index_list(cache_path);
+
+	ASSERT_EQ((size_t)1, (size_t)indexes.size());
+
+	EXPECT_EQ(index_path, indexes[0]);
+
+	EXPECT_EQ(index, plugin_index_read(index_path));
+
+	EXPECT_TRUE(index_time == fs::last_write_time(index_path));
+
+	/* Replacing the plugin modifies the plugin directory, so the index must be invalidated */
+	const fs::file_time_type plugin_time = fs::last_write_time(plugin_path);
+
+	fs::remove_all(plugin_path / "a");
+
+	plugin_create(plugin_path / "b");
+
+	plugin_index_touch(plugin_path, plugin_time);
+
+	plugin_load(plugin_path);
+
+	indexes = plugin_index_list(cache_path);
+
+	ASSERT_EQ((size_t)1, (size_t)indexes.size());
+
+	const std::string invalidated_index = plugin_index_read(index_path);
+
+	EXPECT_EQ(std::string::npos, invalidated_index.find((plugin_path / "a" / "metacall.json").string()));
+
+	EXPECT_NE(std::string::npos, invalidated_index.find((plugin_path / "b" / "metacall.json").string()));
+
+	/* Adding a configuration inside of a plugin modifies its directory, so it must be invalidated too */
+	const fs::file_time_type config_time = fs::last_write_time(plugin_path / "b");
+
+	fs::rename(plugin_path / "b" / "metacall.json", plugin_path / "b" / "metacall-b.json");
+
+	plugin_index_touch(plugin_path / "b", config_time);
+
+	plugin_load(plugin_path);
+
+	EXPECT_NE(std::string::npos, plugin_index_read(index_path).find((plugin_path / "b" / "metacall-b.json").string()));
+
+	/* Adding a directory without changing the time of the plugin directory must be detected by the number of entries */
+	const fs::file_time_type added_time = fs::last_write_time(plugin_path);
+
+	fs::create_directories(plugin_path / "c");
+
+	fs::last_write_time(plugin_path, added_time);
+
+	plugin_load(plugin_path);
+
+	EXPECT_NE(std::string::npos, plugin_index_read(index_path).find((plugin_path / "c").string()));
+
+#if defined(_WIN32)
+	ASSERT_EQ((int)0, (int)_putenv_s("METACALL_PLUGIN_INDEX_PATH", ""));
+#else
+	ASSERT_EQ((int)0, (int)unsetenv("METACALL_PLUGIN_INDEX_PATH"));
+#endif
+
+	fs::remove_all(root_path);
+}
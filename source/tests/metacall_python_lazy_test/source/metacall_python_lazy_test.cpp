@@ -0,0 +1,224 @@
+/*
+ *	MetaCall Library by Parra Studios
+ *	A library for providing a foreign function interface calls.
+ *
+ *	Copyright (C) 2016 - 2026 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <metacall/metacall.h>
+#include <metacall/metacall_loaders.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+
+#define METACALL_PYTHON_LAZY_TEST_FUNCTIONS 0x20
+#define METACALL_PYTHON_LAZY_TEST_THREADS	0x08
+
+class metacall_python_lazy_test : public testing::Test
+{
+public:
+};
+
+static void *metacall_python_lazy_options(void)
+{
+	/* The options are owned by the loader once they are set */
+	void *options = metacall_value_create_map(NULL, 1);
+
+	void **options_map = metacall_value_to_map(options);
+
+	static const char lazy_key[] = "lazy";
+
+	options_map[0] = metacall_value_create_array(NULL, 2);
+
+	void **lazy_tuple = metacall_value_to_array(options_map[0]);
+
+	lazy_tuple[0] = metacall_value_create_string(lazy_key, sizeof(lazy_key) - 1);
+	lazy_tuple[1] = metacall_value_create_bool(1L);
+
+	return options;
+}
+
+TEST_F(metacall_python_lazy_test, DefaultConstructor)
+{
+	static char loader_name[] = "py";
+
+	struct metacall_initialize_configuration_type initialize_config[] = {
+		{ loader_name, metacall_python_lazy_options() },
+		{ NULL, NULL }
+	};
+
+	metacall_print_info();
+
+	ASSERT_EQ((int)0, (int)metacall_initialize_ex(initialize_config));
+
+	static const char python_script[] =
+		"#!/usr/bin/env python3\n"
+		"def lazy_multiply(left: int, right: int) -> int:\n"
+		"	return left * right\n"
+		"def lazy_untyped(left, right):\n"
+		"	return left + right\n"
+		"async def lazy_async(value: int) -> int:\n"
+		"	return value\n";
+
+	ASSERT_EQ((int)0, (int)metacall_load_from_memory(loader_name, python_script, sizeof(python_script), NULL));
+
+	/* The signature is discovered on first access */
+	void *func = metacall_function("lazy_multiply");
+
+	ASSERT_NE((void *)NULL, (void *)func);
+
+	enum metacall_value_id id = METACALL_INVALID;
+
+	EXPECT_EQ((size_t)2, (size_t)metacall_function_size(func));
+	EXPECT_EQ((int)0, (int)metacall_function_parameter_type(func, 0, &id));
+	EXPECT_EQ((enum metacall_value_id)METACALL_LONG, (enum metacall_value_id)id);
+	EXPECT_EQ((int)0, (int)metacall_function_return_type(func, &id));
+	EXPECT_EQ((enum metacall_value_id)METACALL_LONG, (enum metacall_value_id)id);
+	EXPECT_EQ((int)0, (int)metacall_function_async(func));
+
+	void *ret = metacall("lazy_multiply", 3, 4);
+
+	ASSERT_NE((void *)NULL, (void *)ret);
+	EXPECT_EQ((long)12, (long)metacall_value_to_long(ret));
+
+	metacall_value_destroy(ret);
+
+	/* The signature is discovered by the first call */
+	void *args[] = {
+		metacall_value_create_long(5),
+		metacall_value_create_long(6)
+	};
+
+	ret = metacallv_s("lazy_untyped", args, sizeof(args) / sizeof(args[0]));
+
+	ASSERT_NE((void *)NULL, (void *)ret);
+	EXPECT_EQ((long)11, (long)metacall_value_to_long(ret));
+
+	metacall_value_destroy(ret);
+	metacall_value_destroy(args[0]);
+	metacall_value_destroy(args[1]);
+
+	func = metacall_function("lazy_untyped");
+
+	ASSERT_NE((void *)NULL, (void *)func);
+
+	EXPECT_EQ((int)0, (int)metacall_function_parameter_type(func, 0, &id));
+	EXPECT_EQ((enum metacall_value_id)METACALL_INVALID, (enum metacall_value_id)id);
+
+	/* The async behavior is discovered when it is queried */
+	func = metacall_function("lazy_async");
+
+	ASSERT_NE((void *)NULL, (void *)func);
+	EXPECT_EQ((int)1, (int)metacall_function_async(func));
+
+	/* Inspect discovers all the pending signatures */
+	size_t size = 0;
+
+	struct metacall_allocator_std_type std_ctx = { &std::malloc, &std::realloc, &std::free };
+
+	void *allocator = metacall_allocator_create(METACALL_ALLOCATOR_STD, (void *)&std_ctx);
+
+	char *inspect_str = metacall_inspect(&size, allocator);
+
+	ASSERT_NE((char *)NULL, (char *)inspect_str);
+	EXPECT_GT((size_t)size, (size_t)0);
+
+	metacall_allocator_free(allocator, inspect_str);
+
+	metacall_allocator_destroy(allocator);
+
+	metacall_destroy();
+}
+
+/* Discovers and calls the same lazy functions from many threads, each signature must be published complete only once */
+static void metacall_python_lazy_caller(std::atomic<size_t> *errors)
+{
+	for (size_t iterator = 0; iterator < METACALL_PYTHON_LAZY_TEST_FUNCTIONS; ++iterator)
+	{
+		std::string name = "lazy_add_" + std::to_string(iterator);
+
+		void *func = metacall_function(name.c_str());
+
+		if (func == NULL || metacall_function_size(func) != 2)
+		{
+			++(*errors);
+			continue;
+		}
+
+		void *args[] = {
+			metacall_value_create_long((long)iterator),
+			metacall_value_create_long(1L)
+		};
+
+		void *ret = metacallfv_s(func, args, sizeof(args) / sizeof(args[0]));
+
+		if (ret == NULL || metacall_value_to_long(ret) != (long)iterator + 1L)
+		{
+			++(*errors);
+		}
+
+		if (ret != NULL)
+		{
+			metacall_value_destroy(ret);
+		}
+
+		metacall_value_destroy(args[0]);
+		metacall_value_destroy(args[1]);
+	}
+}
+
+TEST_F(metacall_python_lazy_test, Concurrent)
+{
+	static char loader_name[] = "py";
+
+	struct metacall_initialize_configuration_type initialize_config[] = {
+		{ loader_name, metacall_python_lazy_options() },
+		{ NULL, NULL }
+	};
+
+	ASSERT_EQ((int)0, (int)metacall_initialize_ex(initialize_config));
+
+	std::string python_script = "#!/usr/bin/env python3\n";
+
+	for (size_t iterator = 0; iterator < METACALL_PYTHON_LAZY_TEST_FUNCTIONS; ++iterator)
+	{
+		python_script += "def lazy_add_" + std::to_string(iterator) + "(left: int, right: int) -> int:\n\treturn left + right\n";
+	}
+
+	ASSERT_EQ((int)0, (int)metacall_load_from_memory(loader_name, python_script.c_str(), python_script.length() + 1, NULL));
+
+	std::atomic<size_t> errors(0);
+	std::vector<std::thread> threads;
+
+	for (size_t iterator = 0; iterator < METACALL_PYTHON_LAZY_TEST_THREADS; ++iterator)
+	{
+		threads.emplace_back(metacall_python_lazy_caller, &errors);
+	}
+
+	for (std::thread &t : threads)
+	{
+		t.join();
+	}
+
+	EXPECT_EQ((size_t)0, (size_t)errors);
+
+	metacall_destroy();
+}
@@ -197,6 +197,57 @@ TEST_F(metacall_python_class_test, DefaultConstructor)
 
 			metacall_value_destroy(obj_value);
 		}
+
+		{
+			void *obj_value = metacall("return_object_function");
+			ASSERT_EQ((enum metacall_value_id)METACALL_OBJECT, (enum metacall_value_id)metacall_value_id(obj_value));
+			void *obj = metacall_value_to_object(obj_value);
+
+			void *cache = metacall_method_cache("check_args");
+			ASSERT_NE((void *)NULL, (void *)cache);
+
+			/* The method is resolved once and reused by the following calls */
+			for (long iterator = 0; iterator < 10; ++iterator)
+			{
+				void *return_check_args[] = {
+					metacall_value_create_long(iterator),
+					metacall_value_create_long(7L)
+				};
+				void *ret = metacallv_object_cache(obj, cache, return_check_args, sizeof(return_check_args) / sizeof(return_check_args[0]));
+				metacall_value_destroy(return_check_args[0]);
+				metacall_value_destroy(return_check_args[1]);
+				ASSERT_EQ((enum metacall_value_id)METACALL_LONG, (enum metacall_value_id)metacall_value_id(ret));
+				ASSERT_EQ((long)(iterator == 4L ? 15L : 3L), (long)metacall_value_to_long(ret));
+				metacall_value_destroy(ret);
+			}
+
+			metacall_method_cache_destroy(cache);
+
+			void *myclass = metacall_class("MyClass");
+			ASSERT_NE((void *)NULL, (void *)myclass);
+
+			static const char works[] = "It works!";
+
+			cache = metacall_method_cache("static");
+			ASSERT_NE((void *)NULL, (void *)cache);
+
+			void *static_method_args[] = {
+				metacall_value_create_string(works, sizeof(works) - 1)
+			};
+			void *ret_value = metacallv_class_cache(myclass, cache, static_method_args, sizeof(static_method_args) / sizeof(static_method_args[0]));
+			ASSERT_EQ((enum metacall_value_id)METACALL_STRING, (enum metacall_value_id)metacall_value_id(ret_value));
+			metacall_value_destroy(ret_value);
+
+			metacall_value_destroy(static_method_args[0]);
+			metacall_method_cache_destroy(cache);
+
+			cache = metacall_method_cache("not_exists");
+			ASSERT_NE((void *)NULL, (void *)cache);
+			ASSERT_EQ((void *)NULL, (void *)metacallv_object_cache(obj, cache, metacall_null_args, 0));
+			metacall_method_cache_destroy(cache);
+
+			metacall_value_destroy(obj_value);
+		}
 	}
 #endif /* OPTION_BUILD_LOADERS_PY */
 
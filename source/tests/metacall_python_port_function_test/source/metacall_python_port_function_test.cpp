@@ -0,0 +1,75 @@
+/*
+ *	MetaCall Library by Parra Studios
+ *	A library for providing a foreign function interface calls.
+ *
+ *	Copyright (C) 2016 - 2026 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+
+#include <gtest/gtest.h>
+
+#include <metacall/metacall.h>
+#include <metacall/metacall_loaders.h>
+#include <metacall/metacall_value.h>
+
+class metacall_python_port_function_test : public testing::Test
+{
+public:
+};
+
+TEST_F(metacall_python_port_function_test, DefaultConstructor)
+{
+	ASSERT_EQ((int)0, (int)metacall_initialize());
+
+	static const char functions[] =
+		"def multiply(left, right):\n"
+		"	return left * right\n"
+		"def concat(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16):\n"
+		"	return a0 + a1 + a2 + a3 + a4 + a5 + a6 + a7 + a8 + a9 + a10 + a11 + a12 + a13 + a14 + a15 + a16\n";
+
+	ASSERT_EQ((int)0, (int)metacall_load_from_memory("py", functions, sizeof(functions), NULL));
+
+	static const char buffer[] =
+		"import sys\n"
+		"sys.path.insert(0, '" METACALL_PYTHON_PORT_PATH "')\n"
+		"from metacall import metacall, metacall_function\n"
+		"multiply_handle = metacall_function('multiply')\n"
+		"for i in range(100):\n"
+		"	if multiply_handle(i, 3) != metacall('multiply', i, 3):\n"
+		"		sys.exit(1)\n"
+		"concat_handle = metacall_function('concat')\n"
+		"if concat_handle(*[chr(ord('a') + i) for i in range(17)]) != 'abcdefghijklmnopq':\n"
+		"	sys.exit(1)\n"
+		"try:\n"
+		"	metacall_function('does_not_exist')\n"
+		"	sys.exit(1)\n"
+		"except ValueError:\n"
+		"	pass\n"
+		"def handle_multiply(left: int, right: int) -> int:\n"
+		"	return multiply_handle(left, right)\n";
+
+	ASSERT_EQ((int)0, (int)metacall_load_from_memory("py", buffer, sizeof(buffer), NULL));
+
+	void *ret = metacall("handle_multiply", 7L, 6L);
+
+	ASSERT_NE((void *)NULL, (void *)ret);
+
+	EXPECT_EQ((long)42, (long)metacall_value_to_long(ret));
+
+	metacall_value_destroy(ret);
+
+	metacall_destroy();
+}
@@ -0,0 +1,116 @@
+/*
+ *	MetaCall Library by Parra Studios
+ *	A library for providing a foreign function interface calls.
+ *
+ *	Copyright (C) 2016 - 2026 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <metacall/metacall.h>
+#include <metacall/metacall_fork.h>
+#include <metacall/metacall_loaders.h>
+
+#include <sys/wait.h>
+
+class metacall_spawn_worker_test : public testing::Test
+{
+public:
+};
+
+static int metacall_spawn_worker_test_call(void)
+{
+	void *ret = metacall("py_spawn_multiply", 3, 4);
+
+	if (ret == NULL || metacall_value_to_long(ret) != 12)
+	{
+		return 1;
+	}
+
+	metacall_value_destroy(ret);
+
+	ret = metacall("rb_spawn_add", 5, 6);
+
+	if (ret == NULL || metacall_value_to_int(ret) != 11)
+	{
+		return 2;
+	}
+
+	metacall_value_destroy(ret);
+
+	return 0;
+}
+
+TEST_F(metacall_spawn_worker_test, DefaultConstructor)
+{
+	static const char py_script[] =
+		"#!/usr/bin/env python3\n"
+		"import threading\n"
+		"def py_spawn_multiply(left: int, right: int) -> int:\n"
+		"	return left * right\n"
+		"def py_spawn_threads() -> int:\n"
+		"	return threading.active_count()\n";
+
+	static const char rb_script[] =
+		"def rb_spawn_add(left: Fixnum, right: Fixnum)\n"
+		"	return left + right\n"
+		"end\n";
+
+	metacall_print_info();
+
+	ASSERT_EQ((int)0, (int)metacall_initialize());
+
+	ASSERT_EQ((int)0, (int)metacall_load_from_memory("py", py_script, sizeof(py_script), NULL));
+	ASSERT_EQ((int)0, (int)metacall_load_from_memory("rb", rb_script, sizeof(rb_script), NULL));
+
+	/* Spawn several workers from the same template, each one uses the inherited handles and destroys them */
+	for (int iterator = 0; iterator < 3; ++iterator)
+	{
+		metacall_pid pid = metacall_spawn_worker();
+
+		ASSERT_NE((metacall_pid)-1, (metacall_pid)pid);
+
+		if (pid == 0)
+		{
+			int status = metacall_spawn_worker_test_call();
+
+			/* The main thread and the asyncio thread started again in the worker */
+			void *ret = metacall("py_spawn_threads");
+
+			if (status == 0 && (ret == NULL || metacall_value_to_long(ret) != 2))
+			{
+				status = 3;
+			}
+
+			metacall_value_destroy(ret);
+
+			metacall_destroy();
+
+			_exit(status);
+		}
+
+		int status = 0;
+
+		ASSERT_EQ((metacall_pid)pid, (metacall_pid)waitpid(pid, &status, 0));
+		ASSERT_NE((int)0, (int)WIFEXITED(status));
+		EXPECT_EQ((int)0, (int)WEXITSTATUS(status));
+	}
+
+	/* The template keeps working after spawning the workers */
+	EXPECT_EQ((int)0, (int)metacall_spawn_worker_test_call());
+
+	metacall_destroy();
+}
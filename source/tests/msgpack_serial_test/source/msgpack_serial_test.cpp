@@ -0,0 +1,362 @@
+/*
+ *	Serial Library by Parra Studios
+ *	A cross-platform library for managing multiple serialization and deserialization formats.
+ *
+ *	Copyright (C) 2016 - 2026 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <serial/serial.h>
+
+#include <log/log.h>
+
+#include <cfloat>
+#include <climits>
+#include <cstring>
+#include <string>
+#include <vector>
+
+class msgpack_serial_test : public testing::Test
+{
+protected:
+	void SetUp() override
+	{
+		ASSERT_EQ((int)0, (int)log_configure("metacall",
+							  log_policy_format_text(),
+							  log_policy_schedule_sync(),
+							  log_policy_storage_sequential(),
+							  log_policy_stream_stdio(stdout)));
+
+		allocator = memory_allocator_std(&malloc, &realloc, &free);
+
+		ASSERT_NE((memory_allocator)NULL, (memory_allocator)allocator);
+
+		ASSERT_EQ((int)0, (int)serial_initialize());
+
+		s = serial_create("msgpack");
+
+		ASSERT_NE((serial)NULL, (serial)s);
+	}
+
+	void TearDown() override
+	{
+		EXPECT_EQ((int)0, (int)serial_clear(s));
+
+		serial_destroy();
+
+		memory_allocator_destroy(allocator);
+	}
+
+	void expect_equal(value expected, value v)
+	{
+		ASSERT_NE((value)NULL, (value)v);
+		ASSERT_EQ((type_id)value_type_id(expected), (type_id)value_type_id(v));
+
+		switch (value_type_id(expected))
+		{
+			case TYPE_BOOL:
+				EXPECT_EQ((boolean)value_to_bool(expected), (boolean)value_to_bool(v));
+				break;
+			case TYPE_CHAR:
+				EXPECT_EQ((char)value_to_char(expected), (char)value_to_char(v));
+				break;
+			case TYPE_SHORT:
+				EXPECT_EQ((short)value_to_short(expected), (short)value_to_short(v));
+				break;
+			case TYPE_INT:
+				EXPECT_EQ((int)value_to_int(expected), (int)value_to_int(v));
+				break;
+			case TYPE_LONG:
+				EXPECT_EQ((long)value_to_long(expected), (long)value_to_long(v));
+				break;
+			case TYPE_FLOAT:
+			case TYPE_DOUBLE:
+			case TYPE_BUFFER:
+				/* Floating point numbers and buffers must be bit exact */
+				ASSERT_EQ((size_t)value_type_size(expected), (size_t)value_type_size(v));
+				EXPECT_EQ((int)0, (int)memcmp(value_data(expected), value_data(v), value_type_size(v)));
+				break;
+			case TYPE_STRING:
+				EXPECT_EQ((size_t)value_type_size(expected), (size_t)value_type_size(v));
+				EXPECT_STREQ(value_to_string(expected), value_to_string(v));
+				break;
+			case TYPE_ARRAY:
+			case TYPE_MAP: {
+				value *expected_array = value_to_array(expected), *v_array = value_to_array(v);
+
+				ASSERT_EQ((size_t)value_type_count(expected), (size_t)value_type_count(v));
+
+				for (size_t iterator = 0; iterator < value_type_count(v); ++iterator)
+				{
+					expect_equal(expected_array[iterator], v_array[iterator]);
+				}
+
+				break;
+			}
+			default:
+				break;
+		}
+	}
+
+	/* Serialize the value, check the encoded bytes if any and deserialize it back */
+	void round_trip(value v, const std::vector<unsigned char> &bytes = std::vector<unsigned char>())
+	{
+		size_t size = 0;
+
+		char *buffer = serial_serialize(s, v, &size, allocator);
+
+		ASSERT_NE((char *)NULL, (char *)buffer);
+		ASSERT_GT((size_t)size, (size_t)0);
+
+		if (!bytes.empty())
+		{
+			ASSERT_EQ((size_t)bytes.size(), (size_t)size);
+			EXPECT_EQ((int)0, (int)memcmp(bytes.data(), buffer, size));
+		}
+
+		value result = serial_deserialize(s, buffer, size, allocator);
+
+		expect_equal(v, result);
+
+		value_type_destroy(result);
+		value_type_destroy(v);
+
+		memory_allocator_deallocate(allocator, buffer);
+	}
+
+	memory_allocator allocator;
+	serial s;
+};
+
+TEST_F(msgpack_serial_test, Extension)
+{
+	EXPECT_STREQ("msgpack", serial_name(s));
+	EXPECT_STREQ("msgpack", serial_extension(s));
+}
+
+TEST_F(msgpack_serial_test, Scalars)
+{
+	static const char str[] = "hello world";
+	static const unsigned char buffer[] = { 0x00, 0xC1, 0xFF, 0x7F, 0x80 };
+
+	round_trip(value_create_null(), { 0xC0 });
+	round_trip(value_create_bool(0L), { 0xC2 });
+	round_trip(value_create_bool(1L), { 0xC3 });
+	round_trip(value_create_char('A'), { 0xD0, 0x41 });
+	round_trip(value_create_char((char)-5), { 0xD0, 0xFB });
+	round_trip(value_create_short(-2), { 0xD1, 0xFF, 0xFE });
+	round_trip(value_create_short(SHRT_MAX));
+	round_trip(value_create_int(0), { 0x00 });
+	round_trip(value_create_int(127), { 0x7F });
+	round_trip(value_create_int(-32), { 0xE0 });
+	round_trip(value_create_int(128), { 0xD2, 0x00, 0x00, 0x00, 0x80 });
+	round_trip(value_create_int(INT_MIN));
+	round_trip(value_create_int(INT_MAX));
+	round_trip(value_create_long(1L), { 0xD3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01 });
+	round_trip(value_create_long(LONG_MIN));
+	round_trip(value_create_long(LONG_MAX));
+	round_trip(value_create_float(1.5f), { 0xCA, 0x3F, 0xC0, 0x00, 0x00 });
+	round_trip(value_create_float(0.1f));
+	round_trip(value_create_float(FLT_MIN / 2.0f));
+	round_trip(value_create_double(1.0), { 0xCB, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 });
+	round_trip(value_create_double(0.1));
+	round_trip(value_create_double(DBL_MAX));
+	round_trip(value_create_double(-DBL_MIN / 3.0));
+	round_trip(value_create_string(str, sizeof(str) - 1), { 0xAB, 'h', 'e', 'l', 'l', 'o', ' ', 'w', 'o', 'r', 'l', 'd' });
+	round_trip(value_create_string("", 0), { 0xA0 });
+	round_trip(value_create_buffer(buffer, sizeof(buffer)), { 0xC4, 0x05, 0x00, 0xC1, 0xFF, 0x7F, 0x80 });
+}
+
+TEST_F(msgpack_serial_test, Lengths)
+{
+	/* Cover the fixed, 8, 16 and 32 bit length formats */
+	static const size_t lengths[] = { 31, 32, 255, 256, 65535, 65536 };
+
+	for (size_t length : lengths)
+	{
+		std::string str(length, 'x');
+		std::vector<unsigned char> data(length);
+
+		for (size_t iterator = 0; iterator < length; ++iterator)
+		{
+			data[iterator] = (unsigned char)iterator;
+		}
+
+		round_trip(value_create_string(str.c_str(), str.length()));
+		round_trip(value_create_buffer(data.data(), data.size()));
+
+		value v = value_create_array(NULL, length);
+		value *v_array = value_to_array(v);
+
+		for (size_t iterator = 0; iterator < length; ++iterator)
+		{
+			v_array[iterator] = value_create_int((int)iterator);
+		}
+
+		round_trip(v);
+	}
+}
+
+TEST_F(msgpack_serial_test, Containers)
+{
+	static const char key[] = "key";
+
+	/* Map with string and integer keys, containing a nested array and map */
+	value inner_array[] = {
+		value_create_int(1),
+		value_create_double(2.5),
+		value_create_null()
+	};
+
+	value inner_tupla[] = {
+		value_create_long(7L),
+		value_create_bool(1L)
+	};
+
+	value inner_map[] = {
+		value_create_array(inner_tupla, 2)
+	};
+
+	value tupla_a[] = {
+		value_create_string(key, sizeof(key) - 1),
+		value_create_array(inner_array, 3)
+	};
+
+	value tupla_b[] = {
+		value_create_int(42),
+		value_create_map(inner_map, 1)
+	};
+
+	value map[] = {
+		value_create_array(tupla_a, 2),
+		value_create_array(tupla_b, 2)
+	};
+
+	round_trip(value_create_map(map, 2));
+
+	round_trip(value_create_array(NULL, 0), { 0x90 });
+	round_trip(value_create_map(NULL, 0), { 0x80 });
+}
+
+TEST_F(msgpack_serial_test, Interoperability)
+{
+	/* Formats that are not generated by this serial but may be produced by other encoders */
+	static const unsigned char uint8[] = { 0xCC, 0xFF };
+	static const unsigned char uint32[] = { 0xCE, 0xFF, 0xFF, 0xFF, 0xFF };
+	static const unsigned char str8[] = { 0xD9, 0x01, 'a' };
+	static const unsigned char array16[] = { 0xDC, 0x00, 0x02, 0x01, 0xC0 };
+	static const unsigned char map32[] = { 0xDF, 0x00, 0x00, 0x00, 0x01, 0xA1, 'a', 0xC3 };
+
+	value v = serial_deserialize(s, (const char *)uint8, sizeof(uint8), allocator);
+
+	ASSERT_NE((value)NULL, (value)v);
+	EXPECT_EQ((type_id)TYPE_INT, (type_id)value_type_id(v));
+	EXPECT_EQ((int)255, (int)value_to_int(v));
+	value_type_destroy(v);
+
+	v = serial_deserialize(s, (const char *)uint32, sizeof(uint32), allocator);
+
+	ASSERT_NE((value)NULL, (value)v);
+	EXPECT_EQ((type_id)TYPE_LONG, (type_id)value_type_id(v));
+	EXPECT_EQ((long)4294967295L, (long)value_to_long(v));
+	value_type_destroy(v);
+
+	v = serial_deserialize(s, (const char *)str8, sizeof(str8), allocator);
+
+	ASSERT_NE((value)NULL, (value)v);
+	EXPECT_STREQ("a", value_to_string(v));
+	value_type_destroy(v);
+
+	v = serial_deserialize(s, (const char *)array16, sizeof(array16), allocator);
+
+	ASSERT_NE((value)NULL, (value)v);
+	EXPECT_EQ((size_t)2, (size_t)value_type_count(v));
+	value_type_destroy(v);
+
+	v = serial_deserialize(s, (const char *)map32, sizeof(map32), allocator);
+
+	ASSERT_NE((value)NULL, (value)v);
+	EXPECT_EQ((type_id)TYPE_MAP, (type_id)value_type_id(v));
+	EXPECT_EQ((size_t)1, (size_t)value_type_count(v));
+	value_type_destroy(v);
+}
+
+TEST_F(msgpack_serial_test, Malformed)
+{
+	static const unsigned char truncated_int[] = { 0xD2, 0x00, 0x01 };
+	static const unsigned char truncated_str[] = { 0xA5, 'a', 'b' };
+	static const unsigned char truncated_array[] = { 0x93, 0x01, 0x02 };
+	static const unsigned char trailing[] = { 0x01, 0x02 };
+	static const unsigned char unused[] = { 0xC1 };
+	static const unsigned char ext[] = { 0xD4, 0x01, 0x00 };
+	static const unsigned char huge_array[] = { 0xDD, 0xFF, 0xFF, 0xFF, 0xFF, 0x01 };
+	static const unsigned char huge_map[] = { 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x01 };
+
+	EXPECT_EQ((value)NULL, (value)serial_deserialize(s, (const char *)truncated_int, sizeof(truncated_int), allocator));
+	EXPECT_EQ((value)NULL, (value)serial_deserialize(s, (const char *)truncated_str, sizeof(truncated_str), allocator));
+	EXPECT_EQ((value)NULL, (value)serial_deserialize(s, (const char *)truncated_array, sizeof(truncated_array), allocator));
+	EXPECT_EQ((value)NULL, (value)serial_deserialize(s, (const char *)trailing, sizeof(trailing), allocator));
+	EXPECT_EQ((value)NULL, (value)serial_deserialize(s, (const char *)unused, sizeof(unused), allocator));
+	EXPECT_EQ((value)NULL, (value)serial_deserialize(s, (const char *)ext, sizeof(ext), allocator));
+	EXPECT_EQ((value)NULL, (value)serial_deserialize(s, (const char *)huge_array, sizeof(huge_array), allocator));
+	EXPECT_EQ((value)NULL, (value)serial_deserialize(s, (const char *)huge_map, sizeof(huge_map), allocator));
+}
+
+TEST_F(msgpack_serial_test, Depth)
+{
+	static const size_t max_depth = 0x400;
+
+	/* Nested arrays of one element up to the maximum depth */
+	std::vector<unsigned char> buffer(max_depth, 0x91);
+
+	buffer.push_back(0xC0);
+
+	value v = serial_deserialize(s, (const char *)buffer.data(), buffer.size(), allocator);
+
+	ASSERT_NE((value)NULL, (value)v);
+
+	value it = v;
+
+	for (size_t iterator = 0; iterator < max_depth; ++iterator)
+	{
+		ASSERT_EQ((type_id)TYPE_ARRAY, (type_id)value_type_id(it));
+
+		it = value_to_array(it)[0];
+	}
+
+	EXPECT_EQ((type_id)TYPE_NULL, (type_id)value_type_id(it));
+
+	value_type_destroy(v);
+
+	/* One more level of nesting must be rejected */
+	buffer.insert(buffer.begin(), 0x91);
+
+	EXPECT_EQ((value)NULL, (value)serial_deserialize(s, (const char *)buffer.data(), buffer.size(), allocator));
+
+	/* Deeply nested maps must be rejected without exhausting the stack */
+	std::vector<unsigned char> map_buffer;
+
+	for (size_t iterator = 0; iterator < 0x100000; ++iterator)
+	{
+		map_buffer.push_back(0x81);
+		map_buffer.push_back(0xC0);
+	}
+
+	map_buffer.push_back(0xC0);
+
+	EXPECT_EQ((value)NULL, (value)serial_deserialize(s, (const char *)map_buffer.data(), map_buffer.size(), allocator));
+}
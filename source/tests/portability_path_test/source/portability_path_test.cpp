@@ -8,6 +8,7 @@
 
 #include <gtest/gtest.h>
 
+#include <portability/portability_library_path.h>
 #include <portability/portability_path.h>
 
 #include <cstring>
@@ -779,3 +780,22 @@ TEST_F(portability_path_test, portability_path_test_fullname)
 
 	EXPECT_STREQ(exe_name, "qemu-riscv64");
 }
+
+TEST_F(portability_path_test, portability_path_test_library_generation)
+{
+	uint64_t generation = 0, current = 0;
+
+	EXPECT_NE((int)0, (int)portability_library_path_generation(NULL));
+
+#if defined(linux) || defined(__linux__) || defined(__linux) || defined(__gnu_linux) || \
+	defined(__FreeBSD__)
+	/* The generation does not change while no library is loaded or unloaded */
+	EXPECT_EQ((int)0, (int)portability_library_path_generation(&generation));
+	EXPECT_EQ((int)0, (int)portability_library_path_generation(&current));
+	EXPECT_NE((uint64_t)0, (uint64_t)generation);
+	EXPECT_EQ((uint64_t)generation, (uint64_t)current);
+#else
+	(void)generation;
+	(void)current;
+#endif
+}
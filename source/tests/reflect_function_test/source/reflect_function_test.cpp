@@ -25,6 +25,7 @@
 #include <log/log.h>
 
 #include <cstdlib>
+#include <string>
 
 typedef struct example_arg_type
 {
@@ -106,7 +107,8 @@ function_interface function_example_singleton()
 		&function_example_interface_create,
 		&function_example_interface_invoke,
 		&function_example_interface_await,
-		&function_example_interface_destroy
+		&function_example_interface_destroy,
+		NULL
 	};
 
 	return &example_interface;
@@ -151,6 +153,19 @@ TEST_F(reflect_function_test, DefaultConstructor)
 			signature_set(function_signature(f), 1, "i", int_type);
 			signature_set(function_signature(f), 2, "p", ptr_type);
 
+			/* Named argument lookup */
+			{
+				signature s = function_signature(f);
+
+				EXPECT_EQ((size_t)0, (size_t)signature_get_index(s, "c"));
+				EXPECT_EQ((size_t)1, (size_t)signature_get_index(s, "i"));
+				EXPECT_EQ((size_t)2, (size_t)signature_get_index(s, "p"));
+				EXPECT_EQ((size_t)~0, (size_t)signature_get_index(s, "x"));
+				EXPECT_EQ((size_t)~0, (size_t)signature_get_index(s, "reflect_function_test_not_interned"));
+				EXPECT_STREQ("i", signature_get_name(s, 1));
+				EXPECT_EQ((type)int_type, (type)signature_get_type(s, 1));
+			}
+
 			/* function call example */
 			{
 				char c = 'm';
@@ -170,3 +185,60 @@ TEST_F(reflect_function_test, DefaultConstructor)
 		type_destroy(ptr_type);
 	}
 }
+
+TEST_F(reflect_function_test, SignatureIndex)
+{
+	static const size_t size = 64;
+
+	type int_type = type_create(TYPE_INT, "int", NULL, NULL);
+
+	signature s = signature_create(size / 2);
+
+	ASSERT_NE((type)int_type, (type)NULL);
+	ASSERT_NE((signature)s, (signature)NULL);
+
+	for (size_t iterator = 0; iterator < size / 2; ++iterator)
+	{
+		std::string name = "arg_" + std::to_string(iterator);
+
+		signature_set(s, iterator, name.c_str(), int_type);
+	}
+
+	/* Growing the signature moves the name index, all names must be found after that */
+	s = signature_resize(s, size);
+
+	ASSERT_NE((signature)s, (signature)NULL);
+
+	/* The new arguments have no name yet, so the lookup cannot rely on the index */
+	EXPECT_EQ((size_t)1, (size_t)signature_get_index(s, "arg_1"));
+
+	for (size_t iterator = size / 2; iterator < size; ++iterator)
+	{
+		std::string name = "arg_" + std::to_string(iterator);
+
+		signature_set(s, iterator, name.c_str(), int_type);
+	}
+
+	EXPECT_EQ((size_t)size, (size_t)signature_count(s));
+
+	for (size_t iterator = 0; iterator < size; ++iterator)
+	{
+		std::string name = "arg_" + std::to_string(iterator);
+
+		EXPECT_EQ((size_t)iterator, (size_t)signature_get_index(s, name.c_str()));
+		EXPECT_EQ((type)int_type, (type)signature_get_type(s, iterator));
+	}
+
+	EXPECT_EQ((size_t)~0, (size_t)signature_get_index(s, "arg_64"));
+
+	/* Renaming an argument of a complete signature invalidates the index */
+	signature_set(s, 3, "arg_renamed", int_type);
+
+	EXPECT_EQ((size_t)3, (size_t)signature_get_index(s, "arg_renamed"));
+	EXPECT_EQ((size_t)~0, (size_t)signature_get_index(s, "arg_3"));
+	EXPECT_EQ((size_t)4, (size_t)signature_get_index(s, "arg_4"));
+
+	signature_destroy(s);
+
+	type_destroy(int_type);
+}
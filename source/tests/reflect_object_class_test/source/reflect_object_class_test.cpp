@@ -21,6 +21,7 @@
 #include <gtest/gtest.h>
 
 #include <reflect/reflect_class.h>
+#include <reflect/reflect_method_cache.h>
 #include <reflect/reflect_object.h>
 #include <reflect/reflect_value_type.h>
 
@@ -382,6 +383,19 @@ TEST_F(reflect_object_class_test, DefaultConstructor)
 
 	EXPECT_EQ((int)0, (int)class_register_method(cls, test_func_method));
 
+	// Register overloaded methods
+	method overload_int_method = method_create(cls, "overload", 1, NULL, VISIBILITY_PUBLIC, SYNCHRONOUS, NULL);
+	method overload_str_method = method_create(cls, "overload", 1, NULL, VISIBILITY_PUBLIC, SYNCHRONOUS, NULL);
+
+	ASSERT_NE((method)NULL, (method)overload_int_method);
+	ASSERT_NE((method)NULL, (method)overload_str_method);
+
+	signature_set(method_signature(overload_int_method), 0, "i", int_type);
+	signature_set(method_signature(overload_str_method), 0, "s", str_type);
+
+	EXPECT_EQ((int)0, (int)class_register_method(cls, overload_int_method));
+	EXPECT_EQ((int)0, (int)class_register_method(cls, overload_str_method));
+
 	// Register static attributes
 	attribute a_attr = attribute_create(cls, "a", int_type, NULL, VISIBILITY_PUBLIC, NULL);
 	attribute b_attr = attribute_create(cls, "b", float_type, NULL, VISIBILITY_PUBLIC, NULL);
@@ -566,6 +580,61 @@ TEST_F(reflect_object_class_test, DefaultConstructor)
 		object_destroy(obj);
 	}
 
+	// Method resolution
+	{
+		EXPECT_EQ((method)test_func_method, (method)class_method_single(cls, "test_func"));
+		EXPECT_EQ((method)NULL, (method)class_method_single(cls, "overload"));
+		EXPECT_EQ((method)NULL, (method)class_method_single(cls, "not_exists"));
+		EXPECT_EQ((method)NULL, (method)class_static_method_single(cls, "test_func"));
+
+		type_id int_ids[] = { TYPE_INT };
+		type_id str_ids[] = { TYPE_STRING };
+
+		EXPECT_EQ((method)overload_int_method, (method)class_method(cls, "overload", TYPE_INVALID, int_ids, 1));
+		EXPECT_EQ((method)overload_str_method, (method)class_method(cls, "overload", TYPE_INVALID, str_ids, 1));
+	}
+
+	// Method cache
+	{
+		value int_args[] = { value_create_int(3) };
+		value str_args[] = { value_create_string("hi", 2) };
+		value long_args[] = { value_create_long(3L) };
+
+		method_cache mc = method_cache_create("overload");
+
+		ASSERT_NE((method_cache)NULL, (method_cache)mc);
+		EXPECT_STREQ("overload", method_cache_name(mc));
+		EXPECT_EQ((size_t)0, (size_t)method_cache_size(mc));
+
+		// Polymorphic, one entry for each argument type
+		EXPECT_EQ((method)overload_int_method, (method)method_cache_resolve(mc, cls, METHOD_CACHE_INSTANCE, int_args, 1));
+		EXPECT_EQ((method)overload_str_method, (method)method_cache_resolve(mc, cls, METHOD_CACHE_INSTANCE, str_args, 1));
+		EXPECT_EQ((method)overload_int_method, (method)method_cache_resolve(mc, cls, METHOD_CACHE_INSTANCE, int_args, 1));
+		EXPECT_EQ((size_t)2, (size_t)method_cache_size(mc));
+
+		// Misses are not cached
+		EXPECT_EQ((method)NULL, (method)method_cache_resolve(mc, cls, METHOD_CACHE_INSTANCE, long_args, 1));
+		EXPECT_EQ((method)NULL, (method)method_cache_resolve(mc, cls, METHOD_CACHE_STATIC, int_args, 1));
+		EXPECT_EQ((size_t)2, (size_t)method_cache_size(mc));
+
+		method_cache_destroy(mc);
+
+		// Monomorphic, the method is not overloaded so it matches any argument types
+		mc = method_cache_create("test_func");
+
+		ASSERT_NE((method_cache)NULL, (method_cache)mc);
+
+		EXPECT_EQ((method)test_func_method, (method)method_cache_resolve(mc, cls, METHOD_CACHE_INSTANCE, NULL, 0));
+		EXPECT_EQ((method)test_func_method, (method)method_cache_resolve(mc, cls, METHOD_CACHE_INSTANCE, int_args, 1));
+		EXPECT_EQ((size_t)1, (size_t)method_cache_size(mc));
+
+		method_cache_destroy(mc);
+
+		value_type_destroy(int_args[0]);
+		value_type_destroy(str_args[0]);
+		value_type_destroy(long_args[0]);
+	}
+
 	type_destroy(char_type);
 	type_destroy(long_type);
 	type_destroy(str_type);
@@ -110,7 +110,8 @@ function_interface function_example_singleton()
 		&function_example_interface_create,
 		&function_example_interface_invoke,
 		&function_example_interface_await,
-		&function_example_interface_destroy
+		&function_example_interface_destroy,
+		NULL
 	};
 
 	return &example_interface;
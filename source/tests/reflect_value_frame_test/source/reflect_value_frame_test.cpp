@@ -0,0 +1,192 @@
+/*
+ *	Reflect Library by Parra Studios
+ *	A library for provide reflection and metadata representation.
+ *
+ *	Copyright (C) 2016 - 2026 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <reflect/reflect_value_type.h>
+
+#include <portability/portability_compiler.h>
+
+#include <cstdint>
+#include <vector>
+
+class reflect_value_frame_test : public testing::Test
+{
+public:
+};
+
+#if defined(PORTABILITY_THREAD_LOCAL)
+
+static bool value_in_buffer(value v, const void *buffer, size_t size)
+{
+	uintptr_t address = (uintptr_t)v;
+	uintptr_t base = (uintptr_t)buffer;
+
+	return address >= base && address < base + size;
+}
+
+static void value_frame_test_finalizer(value v, void *data)
+{
+	(void)v;
+
+	++*static_cast<int *>(data);
+}
+
+TEST_F(reflect_value_frame_test, Nesting)
+{
+	alignas(16) char outer_buffer[0x200];
+	alignas(16) char inner_buffer[0x200];
+	struct value_frame_type outer, inner;
+
+	value_frame_begin(&outer, outer_buffer, sizeof(outer_buffer));
+
+	value a = value_create_int(1);
+
+	EXPECT_TRUE(value_in_buffer(a, outer_buffer, sizeof(outer_buffer)));
+
+	value_frame_begin(&inner, inner_buffer, sizeof(inner_buffer));
+
+	value b = value_create_int(2);
+
+	EXPECT_TRUE(value_in_buffer(b, inner_buffer, sizeof(inner_buffer)));
+	EXPECT_EQ((value_frame)&outer, (value_frame)inner.prev);
+
+	value_frame_end(&inner);
+
+	/* Ending the inner frame restores the outer one */
+	size_t offset = outer.offset;
+
+	value c = value_create_int(3);
+
+	EXPECT_TRUE(value_in_buffer(c, outer_buffer, sizeof(outer_buffer)));
+	EXPECT_GT((size_t)outer.offset, (size_t)offset);
+
+	value_frame_end(&outer);
+
+	/* Without frames the values are allocated from the heap */
+	value d = value_create_int(4);
+
+	EXPECT_FALSE(value_in_buffer(d, outer_buffer, sizeof(outer_buffer)));
+	EXPECT_FALSE(value_in_buffer(d, inner_buffer, sizeof(inner_buffer)));
+
+	/* The values remain valid after their frame has ended */
+	EXPECT_EQ((int)1, (int)value_to_int(a));
+	EXPECT_EQ((int)2, (int)value_to_int(b));
+	EXPECT_EQ((int)3, (int)value_to_int(c));
+	EXPECT_EQ((int)4, (int)value_to_int(d));
+
+	value_type_destroy(a);
+	value_type_destroy(b);
+	value_type_destroy(c);
+	value_type_destroy(d);
+}
+
+TEST_F(reflect_value_frame_test, Exhaustion)
+{
+	alignas(16) char buffer[0x100];
+	struct value_frame_type frame;
+	std::vector<value> values;
+	size_t frame_count = 0;
+
+	value_frame_begin(&frame, buffer, sizeof(buffer));
+
+	/* Keep allocating until the frame runs out and the values fall back to the heap */
+	for (int iterator = 0; iterator < 0x40; ++iterator)
+	{
+		value v = value_create_long((long)iterator);
+
+		ASSERT_NE((value)NULL, (value)v);
+
+		if (value_in_buffer(v, buffer, sizeof(buffer)))
+		{
+			++frame_count;
+		}
+
+		values.push_back(v);
+	}
+
+	/* A value bigger than the whole frame goes straight to the heap */
+	static const char str[] = "this string does not fit in the frame, so it must be allocated from the heap"
+							  "this string does not fit in the frame, so it must be allocated from the heap"
+							  "this string does not fit in the frame, so it must be allocated from the heap"
+							  "this string does not fit in the frame, so it must be allocated from the heap";
+
+	value s = value_create_string(str, sizeof(str) - 1);
+
+	value_frame_end(&frame);
+
+	EXPECT_GT((size_t)frame_count, (size_t)0);
+	EXPECT_LT((size_t)frame_count, (size_t)values.size());
+	EXPECT_LE((size_t)frame.offset, (size_t)sizeof(buffer));
+
+	ASSERT_NE((value)NULL, (value)s);
+	EXPECT_FALSE(value_in_buffer(s, buffer, sizeof(buffer)));
+	EXPECT_STREQ(str, value_to_string(s));
+
+	for (size_t iterator = 0; iterator < values.size(); ++iterator)
+	{
+		EXPECT_EQ((int)0, (int)value_validate(values[iterator]));
+		EXPECT_EQ((long)iterator, (long)value_to_long(values[iterator]));
+
+		value_type_destroy(values[iterator]);
+	}
+
+	value_type_destroy(s);
+}
+
+TEST_F(reflect_value_frame_test, Destroy)
+{
+	alignas(16) char buffer[0x100];
+	struct value_frame_type frame;
+	int finalized = 0;
+
+	value_frame_begin(&frame, buffer, sizeof(buffer));
+
+	value v = value_create_int(5);
+
+	value_frame_end(&frame);
+
+	ASSERT_TRUE(value_in_buffer(v, buffer, sizeof(buffer)));
+	EXPECT_EQ((int)0, (int)value_validate(v));
+
+	value_finalizer(v, &value_frame_test_finalizer, &finalized);
+
+	size_t offset = frame.offset;
+
+	/* Destroying a frame value runs its finalizer and invalidates it, but the memory belongs to the frame */
+	value_destroy(v);
+
+	EXPECT_EQ((int)1, (int)finalized);
+	EXPECT_NE((int)0, (int)value_validate(v));
+	EXPECT_EQ((size_t)offset, (size_t)frame.offset);
+
+	/* Heap values are still released normally */
+	value h = value_create_int(6);
+
+	EXPECT_FALSE(value_in_buffer(h, buffer, sizeof(buffer)));
+
+	value_finalizer(h, &value_frame_test_finalizer, &finalized);
+
+	value_destroy(h);
+
+	EXPECT_EQ((int)2, (int)finalized);
+}
+
+#endif /* PORTABILITY_THREAD_LOCAL */
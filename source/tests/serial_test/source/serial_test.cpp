@@ -21,6 +21,8 @@
 #include <gtest/gtest.h>
 
 #include <climits>
+#include <cstring>
+#include <string>
 
 #include <portability/portability_assert.h>
 
@@ -50,6 +52,14 @@ public:
 	{
 		return "json";
 	}
+	const char *simd_json_name()
+	{
+		return "simd_json";
+	}
+	const char *simd_json_extension()
+	{
+		return "json";
+	}
 	const char *metacall_name()
 	{
 		return "metacall";
@@ -58,6 +68,41 @@ public:
 	{
 		return "meta";
 	}
+
+	/* Parses the json with the SAX reader and writes it back with the streaming writer twice,
+	both outputs must be the same for the value to have survived the round trip */
+	void round_trip(serial s, memory_allocator allocator, const char *json, size_t size)
+	{
+		size_t first_size = 0, second_size = 0;
+
+		value v = serial_deserialize(s, json, size, allocator);
+
+		ASSERT_NE((value)NULL, (value)v);
+		ASSERT_NE((type_id)TYPE_THROWABLE, (type_id)value_type_id(v));
+
+		char *first = serial_serialize(s, v, &first_size, allocator);
+
+		value_type_destroy(v);
+
+		ASSERT_NE((char *)NULL, (char *)first);
+
+		v = serial_deserialize(s, first, first_size, allocator);
+
+		ASSERT_NE((value)NULL, (value)v);
+		ASSERT_NE((type_id)TYPE_THROWABLE, (type_id)value_type_id(v));
+
+		char *second = serial_serialize(s, v, &second_size, allocator);
+
+		value_type_destroy(v);
+
+		ASSERT_NE((char *)NULL, (char *)second);
+
+		EXPECT_EQ((size_t)first_size, (size_t)second_size);
+		EXPECT_STREQ(first, second);
+
+		memory_allocator_deallocate(allocator, first);
+		memory_allocator_deallocate(allocator, second);
+	}
 };
 
 TEST_F(serial_test, DefaultConstructor)
@@ -82,6 +127,11 @@ TEST_F(serial_test, DefaultConstructor)
 	// Create MetaCall serial
 	create_serial(metacall_name(), metacall_extension());
 
+#if defined(OPTION_BUILD_SERIALS_SIMD_JSON)
+	// Create simdjson serial
+	create_serial(simd_json_name(), simd_json_extension());
+#endif
+
 	// RapidJSON
 	{
 		static const char hello_world[] = "hello world";
@@ -327,6 +377,155 @@ TEST_F(serial_test, DefaultConstructor)
 		}
 	}
 
+#if defined(OPTION_BUILD_SERIALS_SIMD_JSON)
+	// simdjson
+	{
+		static const char hello_world[] = "hello world";
+
+		static const value value_list[] = {
+			value_create_int(244),
+			value_create_double(6.8),
+			value_create_string(hello_world, sizeof(hello_world) - 1),
+			value_create_bool(1L),
+			value_create_null()
+		};
+
+		static const size_t value_list_size = sizeof(value_list) / sizeof(value_list[0]);
+		static const char value_list_str[] = "[244,6.8,\"hello world\",true,null]";
+
+		static const char json_buffer_map[] = "{\"abc\":9.9,\"cde\":[1,\"a\\\"b\"]}";
+		static const size_t json_buffer_map_size = 2;
+
+		static const char json_number[] = "23434";
+		static const char json_long[] = "3000000000";
+		static const char json_empty_array[] = "[]";
+		static const char json_invalid[] = "[1,2";
+
+		size_t serialize_size = 0;
+
+		serial s = serial_create(simd_json_name());
+
+		// Serialize value array into buffer
+		value v = value_create_array(value_list, value_list_size);
+
+		EXPECT_NE((value)NULL, (value)v);
+
+		char *buffer = serial_serialize(s, v, &serialize_size, allocator);
+
+		EXPECT_EQ((size_t)sizeof(value_list_str), (size_t)serialize_size);
+		EXPECT_NE((char *)NULL, (char *)buffer);
+		EXPECT_STREQ(buffer, value_list_str);
+
+		value_destroy(v);
+
+		for (size_t iterator = 0; iterator < value_list_size; ++iterator)
+		{
+			value_destroy(value_list[iterator]);
+		}
+
+		// Deserialize the buffer and serialize it again, it must round-trip
+		v = serial_deserialize(s, buffer, serialize_size, allocator);
+
+		memory_allocator_deallocate(allocator, buffer);
+
+		EXPECT_EQ((type_id)TYPE_ARRAY, (type_id)value_type_id(v));
+		EXPECT_EQ((size_t)value_list_size, (size_t)value_type_count(v));
+
+		value *v_array = value_to_array(v);
+
+		EXPECT_EQ((type_id)TYPE_INT, (type_id)value_type_id(v_array[0]));
+		EXPECT_EQ((int)244, (int)value_to_int(v_array[0]));
+
+		EXPECT_EQ((type_id)TYPE_STRING, (type_id)value_type_id(v_array[2]));
+		EXPECT_STREQ(value_to_string(v_array[2]), hello_world);
+
+		EXPECT_EQ((type_id)TYPE_BOOL, (type_id)value_type_id(v_array[3]));
+		EXPECT_EQ((type_id)TYPE_NULL, (type_id)value_type_id(v_array[4]));
+
+		buffer = serial_serialize(s, v, &serialize_size, allocator);
+
+		EXPECT_EQ((size_t)sizeof(value_list_str), (size_t)serialize_size);
+		EXPECT_STREQ(buffer, value_list_str);
+
+		memory_allocator_deallocate(allocator, buffer);
+
+		value_type_destroy(v);
+
+		// Deserialize json buffer map with a nested array and escaped string into value
+		v = serial_deserialize(s, json_buffer_map, sizeof(json_buffer_map), allocator);
+
+		EXPECT_EQ((type_id)TYPE_MAP, (type_id)value_type_id(v));
+		EXPECT_EQ((size_t)json_buffer_map_size, (size_t)value_type_count(v));
+
+		value *v_map = value_to_map(v);
+
+		value *tupla = value_to_array(v_map[0]);
+
+		EXPECT_STREQ(value_to_string(tupla[0]), "abc");
+		EXPECT_EQ((type_id)TYPE_FLOAT, (type_id)value_type_id(tupla[1]));
+		EXPECT_EQ((float)9.9f, (float)value_to_float(tupla[1]));
+
+		tupla = value_to_array(v_map[1]);
+
+		EXPECT_STREQ(value_to_string(tupla[0]), "cde");
+		EXPECT_EQ((type_id)TYPE_ARRAY, (type_id)value_type_id(tupla[1]));
+
+		v_array = value_to_array(tupla[1]);
+
+		EXPECT_EQ((int)1, (int)value_to_int(v_array[0]));
+		EXPECT_STREQ(value_to_string(v_array[1]), "a\"b");
+
+		// Serialize the map again, the escaped string must round-trip
+		buffer = serial_serialize(s, v, &serialize_size, allocator);
+
+		EXPECT_NE((char *)NULL, (char *)buffer);
+
+		value_type_destroy(v);
+
+		v = serial_deserialize(s, buffer, serialize_size, allocator);
+
+		memory_allocator_deallocate(allocator, buffer);
+
+		EXPECT_EQ((type_id)TYPE_MAP, (type_id)value_type_id(v));
+
+		v_map = value_to_map(v);
+		tupla = value_to_array(v_map[1]);
+		v_array = value_to_array(tupla[1]);
+
+		EXPECT_STREQ(value_to_string(v_array[1]), "a\"b");
+
+		value_type_destroy(v);
+
+		// Deserialize json number primitive types into value
+		v = serial_deserialize(s, json_number, sizeof(json_number), allocator);
+
+		EXPECT_EQ((type_id)TYPE_INT, (type_id)value_type_id(v));
+		EXPECT_EQ((int)23434, (int)value_to_int(v));
+
+		value_destroy(v);
+
+		v = serial_deserialize(s, json_long, sizeof(json_long), allocator);
+
+#if LONG_MAX >= 3000000000L
+		EXPECT_EQ((type_id)TYPE_LONG, (type_id)value_type_id(v));
+		EXPECT_EQ((long)3000000000L, (long)value_to_long(v));
+#endif
+
+		value_type_destroy(v);
+
+		// Deserialize an empty array
+		v = serial_deserialize(s, json_empty_array, sizeof(json_empty_array), allocator);
+
+		EXPECT_EQ((type_id)TYPE_ARRAY, (type_id)value_type_id(v));
+		EXPECT_EQ((size_t)0, (size_t)value_type_count(v));
+
+		value_destroy(v);
+
+		// Deserialize an invalid json
+		EXPECT_EQ((value)NULL, (value)serial_deserialize(s, json_invalid, sizeof(json_invalid), allocator));
+	}
+#endif
+
 	// MetaCall
 	{
 		static const char hello_world[] = "hello world";
@@ -477,6 +676,11 @@ TEST_F(serial_test, DefaultConstructor)
 	// Clear RapidJSON serial
 	EXPECT_EQ((int)0, (int)serial_clear(serial_create(rapid_json_name())));
 
+#if defined(OPTION_BUILD_SERIALS_SIMD_JSON)
+	// Clear simdjson serial
+	EXPECT_EQ((int)0, (int)serial_clear(serial_create(simd_json_name())));
+#endif
+
 	// Clear MetaCall serial
 	EXPECT_EQ((int)0, (int)serial_clear(serial_create(metacall_name())));
 
@@ -486,3 +690,169 @@ TEST_F(serial_test, DefaultConstructor)
 	// Destroy allocator
 	memory_allocator_destroy(allocator);
 }
+
+TEST_F(serial_test, RapidJSONRoundTrip)
+{
+	EXPECT_EQ((int)0, (int)log_configure("metacall",
+						  log_policy_format_text(),
+						  log_policy_schedule_sync(),
+						  log_policy_storage_sequential(),
+						  log_policy_stream_stdio(stdout)));
+
+	memory_allocator allocator = memory_allocator_std(&malloc, &realloc, &free);
+
+	ASSERT_NE((memory_allocator)NULL, (memory_allocator)allocator);
+
+	ASSERT_EQ((int)0, (int)serial_initialize());
+
+	serial s = serial_create(rapid_json_name());
+
+	ASSERT_NE((serial)NULL, (serial)s);
+
+	// Nested arrays and maps
+	{
+		static const char json_nested[] = "[1,[2,[3,[]]],{\"a\":{\"b\":[true,false,null]},\"c\":{}},[{\"d\":[[\"e\"]]}]]";
+
+		round_trip(s, allocator, json_nested, sizeof(json_nested));
+
+		value v = serial_deserialize(s, json_nested, sizeof(json_nested), allocator);
+
+		ASSERT_EQ((type_id)TYPE_ARRAY, (type_id)value_type_id(v));
+		ASSERT_EQ((size_t)4, (size_t)value_type_count(v));
+
+		value *v_array = value_to_array(v);
+
+		/* [2,[3,[]]] */
+		ASSERT_EQ((type_id)TYPE_ARRAY, (type_id)value_type_id(v_array[1]));
+		value *inner = value_to_array(value_to_array(v_array[1])[1]);
+		EXPECT_EQ((int)3, (int)value_to_int(inner[0]));
+		EXPECT_EQ((type_id)TYPE_ARRAY, (type_id)value_type_id(inner[1]));
+		EXPECT_EQ((size_t)0, (size_t)value_type_count(inner[1]));
+
+		/* {"a":{"b":[true,false,null]},"c":{}} */
+		ASSERT_EQ((type_id)TYPE_MAP, (type_id)value_type_id(v_array[2]));
+		ASSERT_EQ((size_t)2, (size_t)value_type_count(v_array[2]));
+		value *tupla = value_to_array(value_to_map(v_array[2])[0]);
+		EXPECT_STREQ("a", value_to_string(tupla[0]));
+		ASSERT_EQ((type_id)TYPE_MAP, (type_id)value_type_id(tupla[1]));
+		tupla = value_to_array(value_to_map(tupla[1])[0]);
+		EXPECT_STREQ("b", value_to_string(tupla[0]));
+		ASSERT_EQ((size_t)3, (size_t)value_type_count(tupla[1]));
+		EXPECT_EQ((type_id)TYPE_NULL, (type_id)value_type_id(value_to_array(tupla[1])[2]));
+		tupla = value_to_array(value_to_map(v_array[2])[1]);
+		EXPECT_EQ((type_id)TYPE_MAP, (type_id)value_type_id(tupla[1]));
+		EXPECT_EQ((size_t)0, (size_t)value_type_count(tupla[1]));
+
+		value_type_destroy(v);
+	}
+
+	// Strings that need escaping
+	{
+		static const char json_escaped[] = "[\"quote \\\" backslash \\\\ slash / newline \\n tab \\t control \\u0001 unicode \\u00e9\"]";
+		static const char escaped_value[] = "quote \" backslash \\ slash / newline \n tab \t control \x01 unicode \xc3\xa9";
+
+		round_trip(s, allocator, json_escaped, sizeof(json_escaped));
+
+		value v = serial_deserialize(s, json_escaped, sizeof(json_escaped), allocator);
+
+		ASSERT_EQ((type_id)TYPE_ARRAY, (type_id)value_type_id(v));
+		ASSERT_EQ((type_id)TYPE_STRING, (type_id)value_type_id(value_to_array(v)[0]));
+		EXPECT_STREQ(escaped_value, value_to_string(value_to_array(v)[0]));
+
+		value_type_destroy(v);
+
+		/* Every control character is escaped, so the output is far bigger than the estimated size */
+		char control[0x20 * 2 + 1];
+		size_t length = 0;
+
+		for (char c = 0x01; c < 0x20; ++c)
+		{
+			control[length++] = c;
+			control[length++] = (c % 2 == 0) ? '"' : '\\';
+		}
+
+		control[length] = '\0';
+
+		v = value_create_string(control, length);
+
+		size_t serialize_size = 0;
+
+		char *buffer = serial_serialize(s, v, &serialize_size, allocator);
+
+		value_type_destroy(v);
+
+		ASSERT_NE((char *)NULL, (char *)buffer);
+		EXPECT_GT((size_t)serialize_size, (size_t)length * 2);
+
+		v = serial_deserialize(s, buffer, serialize_size, allocator);
+
+		memory_allocator_deallocate(allocator, buffer);
+
+		ASSERT_EQ((type_id)TYPE_STRING, (type_id)value_type_id(v));
+		EXPECT_EQ((size_t)length + 1, (size_t)value_type_size(v));
+		EXPECT_EQ((int)0, (int)memcmp(control, value_to_string(v), length));
+
+		value_type_destroy(v);
+	}
+
+	// Large buffers
+	{
+		static const size_t large_count = 0x4000;
+		static const size_t large_string_size = 0x100000;
+
+		std::string json_large = "[";
+
+		for (size_t iterator = 0; iterator < large_count; ++iterator)
+		{
+			std::string index = std::to_string(iterator);
+
+			json_large += (iterator == 0 ? "" : ",");
+			json_large += "{\"key" + index + "\":[" + index + ",\"value \\\"" + index + "\\\"\"]}";
+		}
+
+		json_large += "]";
+
+		round_trip(s, allocator, json_large.c_str(), json_large.length() + 1);
+
+		value v = serial_deserialize(s, json_large.c_str(), json_large.length() + 1, allocator);
+
+		ASSERT_EQ((type_id)TYPE_ARRAY, (type_id)value_type_id(v));
+		ASSERT_EQ((size_t)large_count, (size_t)value_type_count(v));
+
+		value *last = value_to_array(value_to_array(value_to_map(value_to_array(v)[large_count - 1])[0])[1]);
+
+		EXPECT_EQ((int)(large_count - 1), (int)value_to_int(last[0]));
+		EXPECT_EQ(std::string("value \"") + std::to_string(large_count - 1) + "\"", std::string(value_to_string(last[1])));
+
+		value_type_destroy(v);
+
+		/* A string made only of quotes doubles its size when it is escaped */
+		std::string quotes(large_string_size, '"');
+
+		v = value_create_string(quotes.c_str(), quotes.length());
+
+		size_t serialize_size = 0;
+
+		char *buffer = serial_serialize(s, v, &serialize_size, allocator);
+
+		value_type_destroy(v);
+
+		ASSERT_NE((char *)NULL, (char *)buffer);
+		EXPECT_EQ((size_t)large_string_size * 2 + sizeof("\"\""), (size_t)serialize_size);
+
+		v = serial_deserialize(s, buffer, serialize_size, allocator);
+
+		memory_allocator_deallocate(allocator, buffer);
+
+		ASSERT_EQ((type_id)TYPE_STRING, (type_id)value_type_id(v));
+		EXPECT_EQ(quotes, std::string(value_to_string(v)));
+
+		value_type_destroy(v);
+	}
+
+	EXPECT_EQ((int)0, (int)serial_clear(s));
+
+	serial_destroy();
+
+	memory_allocator_destroy(allocator);
+}
@@ -117,21 +117,39 @@ static inline int threading_atomic_ref_count_increment(threading_atomic_ref_coun
 	return 0;
 }
 
-static inline int threading_atomic_ref_count_decrement(threading_atomic_ref_count ref)
+/* Decrement the counter and set @last when this call released the last reference, only one of the concurrent callers sees it */
+static inline int threading_atomic_ref_count_release(threading_atomic_ref_count ref, int *last)
 {
+	uintmax_t old_ref_count;
+
+	*last = 0;
+
 #if defined(__THREAD_SANITIZER__)
 	threading_mutex_lock(&ref->m);
 	{
-		--ref->count;
+		old_ref_count = ref->count;
+
+		if (old_ref_count != THREADING_ATOMIC_REF_COUNT_MIN)
+		{
+			--ref->count;
+		}
 	}
 	threading_mutex_unlock(&ref->m);
-#else
-	if (atomic_load_explicit(&ref->count, memory_order_relaxed) == THREADING_ATOMIC_REF_COUNT_MIN)
+
+	if (old_ref_count == THREADING_ATOMIC_REF_COUNT_MIN)
 	{
 		return 1;
 	}
+#else
+	old_ref_count = atomic_load_explicit(&ref->count, memory_order_relaxed);
 
-	uintmax_t old_ref_count = atomic_fetch_sub_explicit(&ref->count, 1, memory_order_release);
+	do
+	{
+		if (old_ref_count == THREADING_ATOMIC_REF_COUNT_MIN)
+		{
+			return 1;
+		}
+	} while (atomic_compare_exchange_weak_explicit(&ref->count, &old_ref_count, old_ref_count - 1, memory_order_release, memory_order_relaxed) == 0);
 
 	if (old_ref_count == THREADING_ATOMIC_REF_COUNT_MIN + 1)
 	{
@@ -139,9 +157,18 @@ static inline int threading_atomic_ref_count_decrement(threading_atomic_ref_coun
 	}
 #endif
 
+	*last = (old_ref_count == THREADING_ATOMIC_REF_COUNT_MIN + 1);
+
 	return 0;
 }
 
+static inline int threading_atomic_ref_count_decrement(threading_atomic_ref_count ref)
+{
+	int last;
+
+	return threading_atomic_ref_count_release(ref, &last);
+}
+
 static inline void threading_atomic_ref_count_destroy(threading_atomic_ref_count ref)
 {
 #if defined(__THREAD_SANITIZER__)
@@ -0,0 +1,65 @@
+/*
+ *	Thrading Library by Parra Studios
+ *	A threading library providing utilities for lock-free data structures and more.
+ *
+ *	Copyright (C) 2016 - 2026 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+#ifndef THREADING_RWLOCK_H
+#define THREADING_RWLOCK_H 1
+
+/* -- Headers -- */
+
+#include <threading/threading_api.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* -- Type Definitions -- */
+
+#if defined(_WIN32) || defined(__WIN32__) || defined(_WIN64)
+	#include <windows.h>
+	#define THREADING_RWLOCK_INITIALIZE SRWLOCK_INIT
+typedef SRWLOCK threading_rwlock_impl_type;
+#else
+	#include <pthread.h>
+	#define THREADING_RWLOCK_INITIALIZE PTHREAD_RWLOCK_INITIALIZER
+typedef pthread_rwlock_t threading_rwlock_impl_type;
+#endif
+
+typedef threading_rwlock_impl_type threading_rwlock_type;
+typedef threading_rwlock_type *threading_rwlock;
+
+/* -- Methods -- */
+
+int threading_rwlock_initialize(threading_rwlock l);
+
+int threading_rwlock_read_lock(threading_rwlock l);
+
+int threading_rwlock_read_unlock(threading_rwlock l);
+
+int threading_rwlock_write_lock(threading_rwlock l);
+
+int threading_rwlock_write_unlock(threading_rwlock l);
+
+int threading_rwlock_destroy(threading_rwlock l);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* THREADING_RWLOCK_H */